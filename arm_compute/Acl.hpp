@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -425,14 +425,15 @@ public:
          * depends on internal device discovery functionality
          */
         Options()
-            : opts{ AclTuningModeNone, 0 } {};
+            : opts{ AclTuningModeNone, 0, 0 } {};
         /** Constructor
          *
          * @param[in] mode          Tuning mode to be used
          * @param[in] compute_units Number of scheduling units to be used
+         * @param[in] core_mask     (Optional) Bitmask of the cores to pin the threads of the queue to (CPU only)
          */
-        Options(TuningMode mode, int32_t compute_units)
-            : opts{ detail::as_cenum<AclTuningMode>(mode), compute_units }
+        Options(TuningMode mode, int32_t compute_units, uint64_t core_mask = 0)
+            : opts{ detail::as_cenum<AclTuningMode>(mode), compute_units, core_mask }
         {
         }
 
@@ -484,16 +485,26 @@ public:
 /**< Data type enumeration */
 enum class DataType
 {
-    Unknown  = AclDataTypeUnknown,
-    UInt8    = AclUInt8,
-    Int8     = AclInt8,
-    UInt16   = AclUInt16,
-    Int16    = AclInt16,
-    UInt32   = AclUint32,
-    Int32    = AclInt32,
-    Float16  = AclFloat16,
-    BFloat16 = AclBFloat16,
-    Float32  = AclFloat32,
+    Unknown     = AclDataTypeUnknown,
+    UInt8       = AclUInt8,
+    Int8        = AclInt8,
+    UInt16      = AclUInt16,
+    Int16       = AclInt16,
+    UInt32      = AclUint32,
+    Int32       = AclInt32,
+    Float16     = AclFloat16,
+    BFloat16    = AclBFloat16,
+    Float32     = AclFloat32,
+    QAsymmUInt8 = AclQAsymmUInt8,
+    QAsymmInt8  = AclQAsymmInt8,
+};
+
+/**< Data layout enumeration */
+enum class DataLayout
+{
+    Unknown = AclDataLayoutUnknown,
+    Nhwc    = AclNhwc,
+    Nchw    = AclNchw,
 };
 
 /** Tensor Descriptor class
@@ -517,6 +528,21 @@ public:
         _cdesc.strides   = nullptr;
         _cdesc.boffset   = 0;
     }
+    /** Constructor
+     *
+     * @param[in] shape        Shape of the tensor
+     * @param[in] data_type    Data type of the tensor
+     * @param[in] layout       Data layout of the tensor
+     * @param[in] quant_scale  (Optional) Quantization scale, only used by quantized data types
+     * @param[in] quant_offset (Optional) Quantization offset, only used by quantized data types
+     */
+    TensorDescriptor(const std::vector<int32_t> &shape, DataType data_type, DataLayout layout, float quant_scale = 0.f, int32_t quant_offset = 0)
+        : TensorDescriptor(shape, data_type)
+    {
+        _cdesc.layout       = detail::as_cenum<AclDataLayout>(layout);
+        _cdesc.quant_scale  = quant_scale;
+        _cdesc.quant_offset = quant_offset;
+    }
     /** Constructor
      *
      * @param[in] desc C-type descriptor
@@ -759,6 +785,8 @@ class Operator : public detail::ObjectBase<AclOperator_>
 {
 public:
     /** Run an operator on a given input list
+     *
+     * @note The operator is enqueued, call @ref Queue::finish before accessing the results
      *
      * @param[in,out] queue Queue to scheduler the operator on
      * @param pack  Tensor list to be used as input
@@ -769,6 +797,29 @@ public:
     {
         return detail::as_cenum<StatusCode>(AclRunOperator(_object.get(), queue.get(), pack.get()));
     }
+    /** Query the workspace tensors that have to be added to the tensor pack before running the operator
+     *
+     * @param[out] status (Optional) Status code
+     *
+     * @return The workspace requirements
+     */
+    std::vector<AclMemoryRequirement> memory_requirements(StatusCode *status = nullptr) const
+    {
+        int32_t num_reqs = 0;
+        auto    st       = detail::as_enum<StatusCode>(AclGetOperatorMemoryRequirements(_object.get(), nullptr, &num_reqs));
+
+        std::vector<AclMemoryRequirement> reqs(num_reqs);
+        if(st == StatusCode::Success && num_reqs > 0)
+        {
+            st = detail::as_enum<StatusCode>(AclGetOperatorMemoryRequirements(_object.get(), reqs.data(), &num_reqs));
+        }
+        report_status(st, "[Compute Library] Failed to query the operator memory requirements");
+        if(status)
+        {
+            *status = st;
+        }
+        return reqs;
+    }
 
 protected:
     /** Constructor */
@@ -792,6 +843,164 @@ public:
         }
     }
 };
+using Conv2dDesc = AclConv2dDescriptor;
+class Conv2d : public Operator
+{
+public:
+    Conv2d(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &weights, const TensorDescriptor *bias, const TensorDescriptor &dst, const Conv2dDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclConv2d(&op, ctx.get(), src.get(), weights.get(), bias ? bias->get() : nullptr, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Conv2d operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using DepthwiseConv2dDesc = AclDepthwiseConv2dDescriptor;
+class DepthwiseConv2d : public Operator
+{
+public:
+    DepthwiseConv2d(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &weights, const TensorDescriptor *bias, const TensorDescriptor &dst, const DepthwiseConv2dDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclDepthwiseConv2d(&op, ctx.get(), src.get(), weights.get(), bias ? bias->get() : nullptr, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during DepthwiseConv2d operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using GemmDesc = AclGemmDescriptor;
+class Gemm : public Operator
+{
+public:
+    Gemm(Context &ctx, const TensorDescriptor &a, const TensorDescriptor &b, const TensorDescriptor *c, const TensorDescriptor &d, const GemmDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclGemm(&op, ctx.get(), a.get(), b.get(), c ? c->get() : nullptr, d.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Gemm operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using FullyConnectedDesc = AclFullyConnectedDescriptor;
+class FullyConnected : public Operator
+{
+public:
+    FullyConnected(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &weights, const TensorDescriptor *bias, const TensorDescriptor &dst, const FullyConnectedDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclFullyConnected(&op, ctx.get(), src.get(), weights.get(), bias ? bias->get() : nullptr, dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during FullyConnected operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using MatMulDesc = AclMatMulDescriptor;
+class MatMul : public Operator
+{
+public:
+    MatMul(Context &ctx, const TensorDescriptor &lhs, const TensorDescriptor &rhs, const TensorDescriptor &dst, const MatMulDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclMatMul(&op, ctx.get(), lhs.get(), rhs.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during MatMul operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using Pool2dDesc = AclPool2dDescriptor;
+class Pool2d : public Operator
+{
+public:
+    Pool2d(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &dst, const Pool2dDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclPool2d(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Pool2d operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using SoftmaxDesc = AclSoftmaxDescriptor;
+class Softmax : public Operator
+{
+public:
+    Softmax(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &dst, const SoftmaxDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclSoftmax(&op, ctx.get(), src.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Softmax operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+using ElementwiseDesc = AclElementwiseDescriptor;
+class Elementwise : public Operator
+{
+public:
+    Elementwise(Context &ctx, const TensorDescriptor &src0, const TensorDescriptor &src1, const TensorDescriptor &dst, const ElementwiseDesc &desc, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclElementwise(&op, ctx.get(), src0.get(), src1.get(), dst.get(), desc));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Elementwise operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+class Quantize : public Operator
+{
+public:
+    Quantize(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &dst, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclQuantize(&op, ctx.get(), src.get(), dst.get()));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Quantize operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
+class Dequantize : public Operator
+{
+public:
+    Dequantize(Context &ctx, const TensorDescriptor &src, const TensorDescriptor &dst, StatusCode *status = nullptr)
+    {
+        AclOperator op;
+        const auto  st = detail::as_enum<StatusCode>(AclDequantize(&op, ctx.get(), src.get(), dst.get()));
+        reset(op);
+        report_status(st, "[Compute Library] Failure during Dequantize operator creation");
+        if(status)
+        {
+            *status = st;
+        }
+    }
+};
 } // namespace acl
 #undef ARM_COMPUTE_IGNORE_UNUSED
 #endif /* ARM_COMPUTE_ACL_HPP_ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,8 @@
 #ifndef ARM_COMPUTE_ACL_DESCRIPTORS_H_
 #define ARM_COMPUTE_ACL_DESCRIPTORS_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif /** __cplusplus */
@@ -56,6 +58,107 @@ typedef struct
     float             b;       /**< Factor &beta used by some activations */
     bool              inplace; /**< Hint that src and dst tensors will be the same */
 } AclActivationDescriptor;
+
+/**< Padding and strides of a sliding window operator */
+typedef struct
+{
+    int32_t stride_x;   /**< Stride along the width dimension */
+    int32_t stride_y;   /**< Stride along the height dimension */
+    int32_t pad_left;   /**< Padding on the left of the width dimension */
+    int32_t pad_right;  /**< Padding on the right of the width dimension */
+    int32_t pad_top;    /**< Padding on the top of the height dimension */
+    int32_t pad_bottom; /**< Padding on the bottom of the height dimension */
+} AclPadStrideDescriptor;
+
+/**< Convolution layer descriptor */
+typedef struct
+{
+    AclPadStrideDescriptor  pad_stride; /**< Padding and strides */
+    int32_t                 dilation_x; /**< Dilation along the width dimension, 0 is treated as 1 */
+    int32_t                 dilation_y; /**< Dilation along the height dimension, 0 is treated as 1 */
+    AclActivationDescriptor act;        /**< Fused activation */
+} AclConv2dDescriptor;
+
+/**< Depthwise convolution layer descriptor */
+typedef struct
+{
+    AclPadStrideDescriptor  pad_stride;       /**< Padding and strides */
+    int32_t                 dilation_x;       /**< Dilation along the width dimension, 0 is treated as 1 */
+    int32_t                 dilation_y;       /**< Dilation along the height dimension, 0 is treated as 1 */
+    int32_t                 depth_multiplier; /**< Number of output channels per input channel, 0 is treated as 1 */
+    AclActivationDescriptor act;              /**< Fused activation */
+} AclDepthwiseConv2dDescriptor;
+
+/**< General matrix multiplication descriptor */
+typedef struct
+{
+    float                   alpha;      /**< Weight of the product of the matrices */
+    float                   beta;       /**< Weight of the addend matrix */
+    bool                    constant_b; /**< Hint that the content of the second matrix does not change across runs */
+    AclActivationDescriptor act;        /**< Fused activation */
+} AclGemmDescriptor;
+
+/**< Fully connected layer descriptor */
+typedef struct
+{
+    bool                    transpose_weights; /**< Weights have to be transposed as they are stored as [num_inputs, num_outputs] */
+    bool                    constant_weights;  /**< Hint that the content of the weights does not change across runs */
+    AclActivationDescriptor act;               /**< Fused activation */
+} AclFullyConnectedDescriptor;
+
+/**< Batched matrix multiplication descriptor */
+typedef struct
+{
+    bool                    adj_lhs; /**< Transpose the two innermost dimensions of the left-hand side */
+    bool                    adj_rhs; /**< Transpose the two innermost dimensions of the right-hand side */
+    AclActivationDescriptor act;     /**< Fused activation */
+} AclMatMulDescriptor;
+
+/**< Supported pooling types */
+typedef enum
+{
+    AclMaxPooling = 0, /**< Max pooling */
+    AclAvgPooling = 1, /**< Average pooling */
+    AclL2Pooling  = 2, /**< L2 pooling */
+} AclPoolingType;
+
+/**< Pooling layer descriptor */
+typedef struct
+{
+    AclPoolingType         type;            /**< Pooling type */
+    int32_t                pool_width;      /**< Width of the pooling region, ignored by global pooling */
+    int32_t                pool_height;     /**< Height of the pooling region, ignored by global pooling */
+    AclPadStrideDescriptor pad_stride;      /**< Padding and strides, ignored by global pooling */
+    bool                   exclude_padding; /**< Exclude the padding from the average */
+    bool                   is_global;       /**< Pool over the whole width and height */
+} AclPool2dDescriptor;
+
+/**< Softmax layer descriptor */
+typedef struct
+{
+    float   beta;   /**< Scale of the input */
+    int32_t axis;   /**< Reduction axis, negative values are wrapped around */
+    bool    is_log; /**< Compute the log softmax */
+} AclSoftmaxDescriptor;
+
+/**< Supported elementwise operations */
+typedef enum
+{
+    AclElementwiseAdd         = 0, /**< Addition */
+    AclElementwiseSub         = 1, /**< Subtraction */
+    AclElementwiseMul         = 2, /**< Multiplication */
+    AclElementwiseDiv         = 3, /**< Division */
+    AclElementwiseMax         = 4, /**< Maximum */
+    AclElementwiseMin         = 5, /**< Minimum */
+    AclElementwiseSquaredDiff = 6, /**< Squared difference */
+    AclElementwisePow         = 7, /**< Power */
+} AclElementwiseType;
+
+/**< Elementwise operator descriptor */
+typedef struct
+{
+    AclElementwiseType type; /**< Operation to perform */
+} AclElementwiseDescriptor;
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
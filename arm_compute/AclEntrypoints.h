@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,6 +81,8 @@ AclStatus AclDestroyContext(AclContext ctx);
 AclStatus AclCreateQueue(AclQueue *queue, AclContext ctx, const AclQueueOptions *options);
 
 /** Wait until all elements on the queue have been completed
+ *
+ * Errors raised while executing the operators submitted with @ref AclRunOperator are reported here.
  *
  * @param[in] queue Queue to wait on completion
  *
@@ -233,6 +235,10 @@ AclStatus AclPackTensors(AclTensorPack pack, AclTensor *tensors, int32_t *slot_i
 AclStatus AclDestroyTensorPack(AclTensorPack pack);
 
 /** Eager execution of a given operator on a list of inputs and outputs
+ *
+ * The operator is enqueued and the call may return before it has been executed. Operators submitted to the same queue
+ * are executed in order. The operator and the tensors must remain valid until @ref AclQueueFinish has returned,
+ * the tensor pack itself can be reused or destroyed straight away.
  *
  * @param[in]     op      Operator to execute
  * @param[in]     queue   Queue to schedule the operator on
@@ -249,6 +255,26 @@ AclStatus AclDestroyTensorPack(AclTensorPack pack);
  */
 AclStatus AclRunOperator(AclOperator op, AclQueue queue, AclTensorPack tensors);
 
+/** Query the workspace memory an operator needs to run
+ *
+ * Operators do not allocate their workspace: a tensor of at least the requested size has to be added to the tensor
+ * pack at the slot of each requirement before running the operator. Tensors with a @ref AclMemoryPrepare lifetime
+ * are only needed by the first run.
+ *
+ * If @p reqs is nullptr, only the number of requirements is returned in @p num_reqs.
+ *
+ * @param[in]      op       Operator to query
+ * @param[out]     reqs     (Optional) Array to fill with the requirements
+ * @param[in, out] num_reqs Size of @p reqs on input, number of requirements on output
+ *
+ * @return Status Code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclInvalidArgument if a given argument is invalid or @p reqs is too small
+ */
+AclStatus AclGetOperatorMemoryRequirements(AclOperator op, AclMemoryRequirement *reqs, int32_t *num_reqs);
+
 /** Destroy a given operator object
  *
  * @param[in,out] op A valid operator object to destroy
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -80,6 +80,294 @@ AclStatus AclActivation(AclOperator                  *op,
                         const AclTensorDescriptor    *src,
                         const AclTensorDescriptor    *dst,
                         const AclActivationDescriptor info);
+
+/** Create a 2D convolution operator
+ *
+ * The best method (GEMM, Winograd, direct, ...) is selected for the given configuration.
+ * The data layout is taken from the tensor descriptors. Weights are expected as [OFM, IFM, Kh, Kw] in NCHW
+ * and [OFM, Kh, Kw, IFM] in NHWC. Fast math is enabled if the context has been created with it.
+ *
+ * Backends:
+ *   - Cpu   : CpuConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclConv2d(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *src,
+                    const AclTensorDescriptor *weights,
+                    const AclTensorDescriptor *bias,
+                    const AclTensorDescriptor *dst,
+                    const AclConv2dDescriptor  info);
+
+/** Create a 2D depthwise convolution operator
+ *
+ * Backends:
+ *   - Cpu   : CpuDepthwiseConv2d
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Depthwise convolution meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclDepthwiseConv2d(AclOperator                       *op,
+                             AclContext                         ctx,
+                             const AclTensorDescriptor         *src,
+                             const AclTensorDescriptor         *weights,
+                             const AclTensorDescriptor         *bias,
+                             const AclTensorDescriptor         *dst,
+                             const AclDepthwiseConv2dDescriptor info);
+
+/** Create a general matrix multiplication operator
+ *
+ * Computes \f$ d = alpha * a * b + beta * c \f$
+ *
+ * Backends:
+ *   - Cpu   : CpuGemm
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      a    First matrix descriptor. Slot id: ACL_SRC_0
+ * @param[in]      b    Second matrix descriptor. Slot id: ACL_SRC_1
+ * @param[in]      c    (Optional) Addend matrix descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      d    Destination matrix descriptor. Slot id: ACL_DST
+ * @param[in]      info Matrix multiplication meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclGemm(AclOperator               *op,
+                  AclContext                 ctx,
+                  const AclTensorDescriptor *a,
+                  const AclTensorDescriptor *b,
+                  const AclTensorDescriptor *c,
+                  const AclTensorDescriptor *d,
+                  const AclGemmDescriptor    info);
+
+/** Create a fully connected layer operator
+ *
+ * Backends:
+ *   - Cpu   : CpuFullyConnected
+ *
+ * @param[in, out] op      Operator construct to be created if creation was successful
+ * @param[in]      ctx     Context to be used for the creation of the operator
+ * @param[in]      src     Source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      weights Weights tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      bias    (Optional) Bias tensor descriptor, can be nullptr. Slot id: ACL_SRC_2
+ * @param[in]      dst     Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info    Fully connected layer meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclFullyConnected(AclOperator                      *op,
+                            AclContext                        ctx,
+                            const AclTensorDescriptor        *src,
+                            const AclTensorDescriptor        *weights,
+                            const AclTensorDescriptor        *bias,
+                            const AclTensorDescriptor        *dst,
+                            const AclFullyConnectedDescriptor info);
+
+/** Create a batched matrix multiplication operator
+ *
+ * Backends:
+ *   - Cpu   : CpuMatMul
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      lhs  Left-hand side descriptor. Slot id: ACL_SRC_0
+ * @param[in]      rhs  Right-hand side descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Matrix multiplication meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclMatMul(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *lhs,
+                    const AclTensorDescriptor *rhs,
+                    const AclTensorDescriptor *dst,
+                    const AclMatMulDescriptor  info);
+
+/** Create a 2D pooling operator
+ *
+ * Backends:
+ *   - Cpu   : CpuPool2d
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Pooling meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclPool2d(AclOperator               *op,
+                    AclContext                 ctx,
+                    const AclTensorDescriptor *src,
+                    const AclTensorDescriptor *dst,
+                    const AclPool2dDescriptor  info);
+
+/** Create a softmax operator
+ *
+ * Backends:
+ *   - Cpu   : CpuSoftmax/CpuLogSoftmax
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src  Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Softmax meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclSoftmax(AclOperator               *op,
+                     AclContext                 ctx,
+                     const AclTensorDescriptor *src,
+                     const AclTensorDescriptor *dst,
+                     const AclSoftmaxDescriptor info);
+
+/** Create a binary elementwise operator
+ *
+ * Inputs are broadcast along the dimensions where one of them has size 1.
+ *
+ * Backends:
+ *   - Cpu   : CpuAdd/CpuSub/CpuMul/CpuElementwiseDivision/CpuElementwiseMax/CpuElementwiseMin/CpuElementwiseSquaredDiff/CpuElementwisePower
+ *
+ * @param[in, out] op   Operator construct to be created if creation was successful
+ * @param[in]      ctx  Context to be used for the creation of the operator
+ * @param[in]      src0 First source tensor descriptor. Slot id: ACL_SRC_0
+ * @param[in]      src1 Second source tensor descriptor. Slot id: ACL_SRC_1
+ * @param[in]      dst  Destination tensor descriptor. Slot id: ACL_DST
+ * @param[in]      info Elementwise operation meta-data
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclElementwise(AclOperator                   *op,
+                         AclContext                     ctx,
+                         const AclTensorDescriptor     *src0,
+                         const AclTensorDescriptor     *src1,
+                         const AclTensorDescriptor     *dst,
+                         const AclElementwiseDescriptor info);
+
+/** Create a quantization operator
+ *
+ * The quantization parameters are taken from the tensor descriptors.
+ *
+ * Backends:
+ *   - Cpu   : CpuQuantize
+ *
+ * @param[in, out] op  Operator construct to be created if creation was successful
+ * @param[in]      ctx Context to be used for the creation of the operator
+ * @param[in]      src Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst Destination tensor descriptor. Slot id: ACL_DST
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclQuantize(AclOperator               *op,
+                      AclContext                 ctx,
+                      const AclTensorDescriptor *src,
+                      const AclTensorDescriptor *dst);
+
+/** Create a dequantization operator
+ *
+ * The quantization parameters are taken from the tensor descriptors.
+ *
+ * Backends:
+ *   - Cpu   : CpuDequantize
+ *
+ * @param[in, out] op  Operator construct to be created if creation was successful
+ * @param[in]      ctx Context to be used for the creation of the operator
+ * @param[in]      src Source tensor descriptor. Slot id: ACL_SRC
+ * @param[in]      dst Destination tensor descriptor. Slot id: ACL_DST
+ *
+ * @return Status code
+ *
+ * Returns:
+ *  - @ref AclSuccess if function was completed successfully
+ *  - @ref AclOutOfMemory if there was a failure allocating memory resources
+ *  - @ref AclUnsupportedTarget if operator for the requested target is unsupported
+ *  - @ref AclInvalidArgument if a given argument is invalid
+ *  - @ref AclUnsupportedConfig if the configuration is not supported by the operator
+ */
+AclStatus AclDequantize(AclOperator               *op,
+                        AclContext                 ctx,
+                        const AclTensorDescriptor *src,
+                        const AclTensorDescriptor *dst);
 #ifdef __cplusplus
 }
 #endif /** __cplusplus */
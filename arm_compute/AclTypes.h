@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -155,22 +155,27 @@ typedef enum
 typedef struct
 {
     AclTuningMode mode;          /**< Tuning mode */
-    int32_t       compute_units; /**< Compute Units that the queue will deploy */
+    int32_t       compute_units; /**< Compute Units that the queue will deploy.
+                                      On CPU, a value > 0 gives the queue its own pool with that many threads */
+    uint64_t      core_mask;     /**< CPU only: bitmask of the cores the threads of the queue are pinned to, one thread per core.
+                                      0 does not pin the threads. A non-zero mask gives the queue its own pool */
 } AclQueueOptions;
 
 /**< Supported data types */
 typedef enum AclDataType
 {
-    AclDataTypeUnknown = 0, /**< Unknown data type */
-    AclUInt8           = 1, /**< 8-bit unsigned integer */
-    AclInt8            = 2, /**< 8-bit signed integer */
-    AclUInt16          = 3, /**< 16-bit unsigned integer */
-    AclInt16           = 4, /**< 16-bit signed integer */
-    AclUint32          = 5, /**< 32-bit unsigned integer */
-    AclInt32           = 6, /**< 32-bit signed integer */
-    AclFloat16         = 7, /**< 16-bit floating point */
-    AclBFloat16        = 8, /**< 16-bit brain floating point */
-    AclFloat32         = 9, /**< 32-bit floating point */
+    AclDataTypeUnknown = 0,  /**< Unknown data type */
+    AclUInt8           = 1,  /**< 8-bit unsigned integer */
+    AclInt8            = 2,  /**< 8-bit signed integer */
+    AclUInt16          = 3,  /**< 16-bit unsigned integer */
+    AclInt16           = 4,  /**< 16-bit signed integer */
+    AclUint32          = 5,  /**< 32-bit unsigned integer */
+    AclInt32           = 6,  /**< 32-bit signed integer */
+    AclFloat16         = 7,  /**< 16-bit floating point */
+    AclBFloat16        = 8,  /**< 16-bit brain floating point */
+    AclFloat32         = 9,  /**< 32-bit floating point */
+    AclQAsymmUInt8     = 10, /**< 8-bit unsigned asymmetric quantized */
+    AclQAsymmInt8      = 11, /**< 8-bit signed asymmetric quantized */
 } AclDataType;
 
 /**< Supported data layouts for operations */
@@ -195,6 +200,10 @@ typedef struct AclTensorDescriptor
     AclDataType data_type; /**< Tensor Data type */
     int64_t    *strides;   /**< Strides on each dimension. Linear memory is assumed if nullptr */
     int64_t     boffset;   /**< Offset in terms of bytes for the first element */
+
+    AclDataLayout layout;       /**< Data layout, @ref AclDataLayoutUnknown is treated as @ref AclNchw */
+    float         quant_scale;  /**< Quantization scale, only used by quantized data types */
+    int32_t       quant_offset; /**< Quantization offset, only used by quantized data types */
 } AclTensorDescriptor;
 
 /**< Slot type of a tensor */
@@ -204,10 +213,29 @@ typedef enum
     AclSrc         = 0,
     AclSrc0        = 0,
     AclSrc1        = 1,
+    AclSrc2        = 2,
     AclDst         = 30,
     AclSrcVec      = 256,
+    AclIntVec      = 1024, /**< First workspace slot, see @ref AclGetOperatorMemoryRequirements */
 } AclTensorSlot;
 
+/**< Lifetime of the content of a workspace tensor */
+typedef enum
+{
+    AclMemoryTemporary  = 0, /**< Content is only used during a single run */
+    AclMemoryPersistent = 1, /**< Content must be kept across runs */
+    AclMemoryPrepare    = 2, /**< Content is only used until the first run has prepared the operator */
+} AclMemoryLifetime;
+
+/**< Workspace memory requirement of an operator */
+typedef struct AclMemoryRequirement
+{
+    int32_t           slot;      /**< Slot of the workspace tensor in the tensor pack */
+    AclMemoryLifetime lifetime;  /**< Lifetime of the content of the workspace tensor */
+    uint64_t          size;      /**< Size in bytes */
+    uint64_t          alignment; /**< Required alignment in bytes */
+} AclMemoryRequirement;
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -150,21 +150,50 @@ public:
      * @return Current thread's @ref CPUModel
      */
     CPUModel get_cpu_model() const;
+    /** Gets the compute capacity of a given cpu
+     *
+     * @note Read from the system or from the ARM_COMPUTE_CPU_CAPACITIES environment variable when possible,
+     *       estimated from the cpu model otherwise.
+     *
+     * @param[in] cpuid the id of the cpu core to be queried
+     *
+     * @return the capacity of the cpu, in the [1, 1024] range where 1024 is the capacity of the biggest cores
+     */
+    unsigned int get_cpu_capacity(unsigned int cpuid) const;
     /** Gets the current cpu's ISA information
      *
      * @return Current cpu's ISA information
      */
     cpuinfo::CpuIsaInfo get_isa() const;
-    /** Gets the L1 cache size
+    /** Gets the L1 data cache size of the current cpu
+     *
+     * @note Detected from the system when possible, a default value is returned otherwise
      *
      * @return the size of the L1 cache
      */
     unsigned int get_L1_cache_size() const;
-    /** Gets the L2 cache size
+    /** Gets the L2 cache size of the current cpu
      *
-     * @return the size of the L1 cache
+     * @note Detected from the system when possible, a default value is returned otherwise
+     *
+     * @return the size of the L2 cache
      */
     unsigned int get_L2_cache_size() const;
+    /** Gets the size of the last level cache beyond the L2 of the current cpu
+     *
+     * @return the size of the L3 or system level cache, 0 if there is none or it could not be detected
+     */
+    unsigned int get_L3_cache_size() const;
+    /** Gets the number of cpus sharing the L2 cache of the current cpu
+     *
+     * @return the number of cpus sharing the L2 cache
+     */
+    unsigned int get_L2_cache_sharing() const;
+    /** Gets the number of cpus sharing the L3 cache of the current cpu
+     *
+     * @return the number of cpus sharing the L3 cache
+     */
+    unsigned int get_L3_cache_sharing() const;
     /** Return the maximum number of CPUs present
      *
      * @return Number of CPUs
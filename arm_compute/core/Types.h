@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -39,6 +39,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -1682,6 +1683,8 @@ public:
 
     /** Lookup table  */
     using LookupTable256 = std::array<qasymm8_t, 256>;
+    /** Lookup table indexed by the bit pattern of a 16-bit input and holding the bit pattern of the output */
+    using LookupTable65536 = std::array<uint16_t, 65536>;
 
     ActivationLayerInfo() = default;
     /** Default Constructor
@@ -1690,9 +1693,10 @@ public:
      * @param[in] a (Optional) The alpha parameter used by some activation functions
      *              (@ref ActivationFunction::BOUNDED_RELU, @ref ActivationFunction::LU_BOUNDED_RELU, @ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
      * @param[in] b (Optional) The beta parameter used by some activation functions (@ref ActivationFunction::LINEAR, @ref ActivationFunction::LU_BOUNDED_RELU, @ref ActivationFunction::TANH).
+     * @param[in] fast_math (Optional) Allow cheaper approximations of the transcendental activation functions. See @ref ActivationLayerInfo::fast_math.
      */
-    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f)
-        : _act(f), _a(a), _b(b), _enabled(true)
+    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f, bool fast_math = false)
+        : _act(f), _a(a), _b(b), _enabled(true), _fast_math(fast_math)
     {
     }
     /** Get the type of activation function */
@@ -1715,6 +1719,19 @@ public:
     {
         return _enabled;
     }
+    /** Check if cheaper approximations of the transcendental functions are allowed
+     *
+     * Only honoured by the CPU floating point kernels, other backends compute the accurate function.
+     * Maximum absolute errors of the F32 approximations:
+     * - @ref ActivationFunction::TANH: 1e-4 * |a|
+     * - @ref ActivationFunction::LOGISTIC: 5e-5
+     * - @ref ActivationFunction::SWISH: 5e-5 * max(1, |x|)
+     * - @ref ActivationFunction::GELU: 5e-4 (tanh formulation)
+     */
+    bool fast_math() const
+    {
+        return _fast_math;
+    }
 
 #ifdef __aarch64__
     const LookupTable256 &lut() const
@@ -1753,6 +1770,35 @@ public:
     }
 #endif // __aarch64__
 
+    /** Get the lookup table used for 16-bit data types
+     *
+     * @return The lookup table or nullptr if it has not been set
+     */
+    const LookupTable65536 *lut_16bit() const
+    {
+        return _lut_16bit.get();
+    }
+    /** Set the lookup table used for 16-bit data types
+     *
+     * @param[in] lut Lookup table, shared between all the activations with the same function and quantization parameters
+     */
+    void set_lut_16bit(std::shared_ptr<const LookupTable65536> lut)
+    {
+        _lut_16bit = std::move(lut);
+    }
+    /** Check if an activation function is computed through a 16-bit lookup table for a given data type */
+    static inline bool is_lut_16bit_supported(ActivationFunction act_func, DataType data_type)
+    {
+        switch(act_func)
+        {
+            case ActivationFunction::LOGISTIC:
+            case ActivationFunction::TANH:
+                return data_type == DataType::F16 || data_type == DataType::QSYMM16;
+            default:
+                return false;
+        }
+    }
+
     static inline bool is_lut_supported(ActivationFunction act_func, DataType data_type)
     {
 #ifdef __aarch64__
@@ -1775,10 +1821,13 @@ public:
     }
 
 private:
-    ActivationFunction _act     = { ActivationLayerInfo::ActivationFunction::IDENTITY };
-    float              _a       = {};
-    float              _b       = {};
-    bool               _enabled = { false };
+    ActivationFunction _act       = { ActivationLayerInfo::ActivationFunction::IDENTITY };
+    float              _a         = {};
+    float              _b         = {};
+    bool               _enabled   = { false };
+    bool               _fast_math = { false };
+
+    std::shared_ptr<const LookupTable65536> _lut_16bit = {};
 
 #ifdef __aarch64__
     LookupTable256 _lut = {};
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,24 +26,32 @@
 
 #include "arm_compute/graph/Types.h"
 
+#include "arm_compute/runtime/IAllocator.h"
 #include "arm_compute/runtime/IMemoryManager.h"
 #include "arm_compute/runtime/IWeightsManager.h"
 
 #include <map>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
 namespace graph
 {
+// Forward declarations
+class WorkspaceLifetimeManager;
+
 /** Contains structs required for memory management */
 struct MemoryManagerContext
 {
-    Target                                       target      = { Target::UNSPECIFIED }; /**< Target */
-    std::shared_ptr<arm_compute::IMemoryManager> intra_mm    = { nullptr };             /**< Intra-function memory manager */
-    std::shared_ptr<arm_compute::IMemoryManager> cross_mm    = { nullptr };             /**< Cross-function memory manager */
-    std::shared_ptr<arm_compute::IMemoryGroup>   cross_group = { nullptr };             /**< Cross-function memory group */
-    IAllocator                                  *allocator   = { nullptr };             /**< Backend allocator to use */
+    Target                                       target          = { Target::UNSPECIFIED }; /**< Target */
+    std::shared_ptr<arm_compute::IMemoryManager> intra_mm        = { nullptr };             /**< Intra-function memory manager */
+    std::shared_ptr<arm_compute::IMemoryManager> cross_mm        = { nullptr };             /**< Cross-function memory manager */
+    std::shared_ptr<arm_compute::IMemoryGroup>   cross_group     = { nullptr };             /**< Cross-function memory group */
+    std::shared_ptr<WorkspaceLifetimeManager>    workspace_lm    = { nullptr };             /**< Lifetime manager of the intra-function memory manager placing the function workspaces with the transition tensors */
+    IAllocator                                  *allocator       = { nullptr };             /**< Backend allocator to use */
+    size_t                                       intra_pool_size = { 0 };                   /**< Bytes allocated for the pools of the intra-function memory manager once finalized */
+    size_t                                       cross_pool_size = { 0 };                   /**< Bytes allocated for the pools of the cross-function memory manager once finalized */
 };
 
 /** Contains structs required for weights management */
@@ -121,13 +129,17 @@ public:
      * @return Weights manager contexts
      */
     std::map<Target, WeightsManagerContext> &weights_managers();
-    /** Finalizes memory managers in graph context */
+    /** Finalizes memory managers in graph context
+     *
+     * The bytes allocated for the memory pools are recorded in the memory manager contexts.
+     */
     void finalize();
 
 private:
-    GraphConfig _config;                                       /**< Graph configuration */
-    std::map<Target, MemoryManagerContext>  _memory_managers;  /**< Memory managers for each target */
-    std::map<Target, WeightsManagerContext> _weights_managers; /**< Weights managers for each target */
+    GraphConfig                              _config;           /**< Graph configuration */
+    std::map<Target, MemoryManagerContext>   _memory_managers;  /**< Memory managers for each target */
+    std::map<Target, WeightsManagerContext>  _weights_managers; /**< Weights managers for each target */
+    std::vector<std::unique_ptr<IAllocator>> _pool_allocators;  /**< Allocators accounting for the memory of the pools */
 };
 } // namespace graph
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,10 +24,12 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MANAGER_H
 
+#include "arm_compute/graph/MemoryReport.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Workload.h"
 
 #include <map>
+#include <memory>
 
 namespace arm_compute
 {
@@ -37,6 +39,8 @@ namespace graph
 class Graph;
 class GraphContext;
 class PassManager;
+class PipelineExecutor;
+struct PipelineStats;
 
 /** Graph manager class
  *
@@ -50,17 +54,29 @@ public:
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     GraphManager(const GraphManager &) = delete;
     /** Default move constructor */
-    GraphManager(GraphManager &&) = default;
+    GraphManager(GraphManager &&);
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     GraphManager &operator=(const GraphManager &) = delete;
     /** Default move assignment operator */
-    GraphManager &operator=(GraphManager &&) = default;
+    GraphManager &operator=(GraphManager &&);
+    /** Default destructor */
+    ~GraphManager();
     /** Finalizes a given graph
      *
      * @warning At this given time finalize_graph will alter the passed graph,
      *          plan is to avoid by copying the graph structure,
      *          or provide another entry-point for this functionality as it will increase the memory requirements
      *
+     * @note If @ref GraphConfig::pipeline_stages is greater than 1 or @ref GraphConfig::use_async_accessors is set on the Arm® Neon™ backend,
+     *       the nodes are partitioned into stages executing consecutive frames concurrently, see @ref PipelineExecutor.
+     *       The transition memory manager is then not used.
+     *
+     * @note If @ref GraphConfig::use_memory_aware_order is set, the nodes are executed in the topological order minimizing the peak
+     *       memory of the transition tensors, see @ref memory_aware_sort.
+     *
+     * @note If @ref GraphConfig::plan_file is set, the execution methods and constant tensors are taken from the plan stored there
+     *       when it matches the graph, otherwise the plan gets stored once the constant tensors have been filled.
+     *
      * @param[in] graph  Graph to finalize
      * @param[in] ctx    Graph context
      * @param[in] pm     Pass manager to use for any optimization passes
@@ -68,10 +84,26 @@ public:
      */
     void finalize_graph(Graph &graph, GraphContext &ctx, PassManager &pm, Target target);
     /** Executes a graph
+     *
+     * The frames are executed until an input or output accessor fails.
      *
      * @param[in] graph Graph to execute
      */
     void execute_graph(Graph &graph);
+    /** Statistics of the last pipelined execution of a graph
+     *
+     * @param[in] graph Graph to get the statistics of
+     *
+     * @return The statistics of the last execution, empty if the graph is not pipelined
+     */
+    PipelineStats pipeline_stats(Graph &graph) const;
+    /** Memory footprint of a finalized graph
+     *
+     * @param[in] graph Graph to get the memory report of
+     *
+     * @return The memory report created when the graph was finalized
+     */
+    MemoryReport memory_report(Graph &graph) const;
     /** Invalidates the graph execution workload
      *
      * @param[in] graph Graph to invalidate
@@ -79,7 +111,9 @@ public:
     void invalidate_graph(Graph &graph);
 
 private:
-    std::map<GraphID, ExecutionWorkload> _workloads = {}; /**< Graph workloads */
+    std::map<GraphID, ExecutionWorkload>                 _workloads = {}; /**< Graph workloads */
+    std::map<GraphID, std::unique_ptr<PipelineExecutor>> _pipelines;      /**< Pipelined executors of the graphs with pipeline stages */
+    std::map<GraphID, MemoryReport>                      _memory_reports; /**< Memory footprints of the graphs */
 };
 } // namespace graph
 } // namespace arm_compute
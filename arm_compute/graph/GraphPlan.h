@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_GRAPH_PLAN_H
+#define ARM_COMPUTE_GRAPH_GRAPH_PLAN_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+namespace utils
+{
+namespace mmap_io
+{
+// Forward declaration
+class MMappedFile;
+} // namespace mmap_io
+} // namespace utils
+
+namespace graph
+{
+// Forward declaration
+class Graph;
+class INode;
+
+/** Finalized graph plan
+ *
+ * A plan is a versioned binary file storing the outcome of a graph finalization: the execution method selected
+ * for each convolution node and the contents of the constant tensors once their accessors have been called.
+ * When a compatible plan is available, @ref GraphManager::finalize_graph pins the recorded methods and fills
+ * the constant tensors straight from the memory mapped file instead of calling their accessors.
+ *
+ * A plan is only compatible with a graph that has the same structure (nodes, connections, tensor shapes, data types
+ * and quantization) and loads its constant tensors from the same sources (see @ref ITensorAccessor::source) at the
+ * point it is applied. No plan is stored for graphs whose constant tensors have accessors that can't identify their
+ * source. A plan uses the native endianness and has to be regenerated when the contents of a source change.
+ */
+class GraphPlan final
+{
+public:
+    /** Version of the file format */
+    static constexpr uint32_t version = 2;
+
+    /** Default Constructor */
+    GraphPlan();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphPlan(const GraphPlan &) = delete;
+    /** Default move constructor */
+    GraphPlan(GraphPlan &&);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    GraphPlan &operator=(const GraphPlan &) = delete;
+    /** Default move assignment operator */
+    GraphPlan &operator=(GraphPlan &&);
+    /** Default destructor */
+    ~GraphPlan();
+    /** Stores the plan of a graph
+     *
+     * @note The constant tensors of the graph must be allocated and filled.
+     *
+     * @param[in] g        Graph to store the plan of
+     * @param[in] filename File to write the plan to
+     *
+     * @return True if the plan was written successfully, false if it couldn't be written or the sources of the constant tensors can't be identified
+     */
+    static bool save(Graph &g, const std::string &filename);
+    /** Maps a plan file
+     *
+     * @param[in] filename File to load the plan from
+     *
+     * @return True if the file is a valid plan else false
+     */
+    bool load(const std::string &filename);
+    /** Checks if a plan has been loaded
+     *
+     * @return True if a plan is loaded else false
+     */
+    bool is_loaded() const;
+    /** Checks if the loaded plan can be applied to a graph
+     *
+     * @param[in] g Graph to check
+     *
+     * @return True if the graph has the structure the plan was generated from else false
+     */
+    bool is_compatible(const Graph &g) const;
+    /** Pins the recorded execution methods on the nodes of a graph
+     *
+     * @param[in,out] g Graph to update
+     */
+    void apply_execution_methods(Graph &g) const;
+    /** Fills the constant tensors of a graph from the plan
+     *
+     * Constant tensors not recorded in the plan get filled by their accessors.
+     *
+     * @param[in,out] g Graph to fill the constant tensors of. They must be allocated.
+     */
+    void fill_const_tensors(Graph &g) const;
+
+private:
+    /** Record of a node execution method */
+    struct NodeRecord
+    {
+        uint32_t id;        /**< Node ID */
+        uint32_t type;      /**< Node type */
+        uint32_t method;    /**< Convolution or depthwise convolution method */
+        uint32_t fast_math; /**< Fast math hint */
+    };
+    /** Record of the contents of a constant tensor */
+    struct TensorRecord
+    {
+        uint32_t id;       /**< Tensor ID */
+        uint32_t reserved; /**< Reserved for future use */
+        uint64_t offset;   /**< Offset of the contents in the data section */
+        uint64_t size;     /**< Size in bytes of the contents */
+    };
+
+    /** Extracts the execution method of a node
+     *
+     * @param[in]  node   Node to extract the method of
+     * @param[out] record Record to fill
+     *
+     * @return True if the node has an execution method else false
+     */
+    static bool extract_node_record(const INode &node, NodeRecord &record);
+
+    std::unique_ptr<utils::mmap_io::MMappedFile> _file;       /**< Mapped plan file */
+    uint64_t                                     _graph_hash; /**< Hash of the graph structure */
+    const uint8_t                               *_data;       /**< Mapped data section */
+    std::map<NodeID, NodeRecord>                 _nodes;      /**< Execution methods per node */
+    std::map<TensorID, TensorRecord>             _tensors;    /**< Contents records per constant tensor */
+};
+
+/** Computes a hash of the structure of a graph
+ *
+ * Node types and connections, tensor shapes, data types, layouts and quantization information are accounted for,
+ * as well as the sources the accessors of the constant tensors load them from. Execution methods and tensor contents are not.
+ *
+ * @param[in] g Graph to hash
+ *
+ * @return The hash of the graph structure
+ */
+uint64_t graph_structure_hash(const Graph &g);
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_GRAPH_PLAN_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019,2021 Arm Limited.
+ * Copyright (c) 2018-2019,2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -89,6 +89,16 @@ public:
      * @return Backend sub-tensor handle
      */
     virtual std::unique_ptr<ITensorHandle> create_subtensor(ITensorHandle *parent, TensorShape shape, Coordinates coords, bool extend_parent) = 0;
+    /** Create a backend tensor aliasing the memory of another tensor
+     *
+     * @note The tensors must have the same size and the parent must not be padded
+     *
+     * @param[in] parent Parent tensor handle
+     * @param[in] tensor Tensor to create the alias for
+     *
+     * @return Backend alias tensor handle, nullptr if the backend doesn't support aliases
+     */
+    virtual std::unique_ptr<ITensorHandle> create_alias(ITensorHandle *parent, const Tensor &tensor) = 0;
     /** Configure a backend Node
      *
      * @note This creates an appropriate configured backend function for the given node
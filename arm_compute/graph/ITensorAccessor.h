@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019,2021 Arm Limited.
+ * Copyright (c) 2018-2019,2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/ITensor.h"
 
 #include <memory>
+#include <string>
 
 namespace arm_compute
 {
@@ -53,6 +54,16 @@ public:
     {
         return true;
     }
+    /** Returns an identifier of the data provided by the accessor
+     *
+     * Graph plans are keyed on the identifiers of the accessors of the constant tensors.
+     *
+     * @return The identifier of the data (e.g. a file name), an empty string if the accessor can't identify it
+     */
+    virtual std::string source() const
+    {
+        return std::string();
+    }
 };
 
 using ITensorAccessorUPtr = std::unique_ptr<ITensorAccessor>;
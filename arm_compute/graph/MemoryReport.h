@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_MEMORY_REPORT_H
+#define ARM_COMPUTE_GRAPH_MEMORY_REPORT_H
+
+#include "arm_compute/graph/Types.h"
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphContext;
+
+/** Memory used by a node of a finalized graph */
+struct NodeMemoryReport
+{
+    NodeID      id{ EmptyNodeID };     /**< Node ID */
+    std::string name{};                /**< Node name */
+    size_t      constants{ 0 };        /**< Bytes of the constant tensors the node reads, as declared in the graph */
+    size_t      transitions{ 0 };      /**< Bytes of the transition tensors the node writes */
+    size_t      live_transitions{ 0 }; /**< Bytes of the transition tensors alive while the node executes */
+};
+
+/** Memory footprint of a finalized graph
+ *
+ * Sizes are in bytes and include the padding of the tensors.
+ *
+ * @note With @ref GraphConfig::use_shared_workspace_memory, the workspaces placed with the transition tensors are part of the transitions.
+ */
+struct MemoryReport
+{
+    size_t                        constants{ 0 };             /**< Constant tensors still allocated once the functions are prepared */
+    size_t                        transformed_weights{ 0 };   /**< Weights transformed and held by the weights managers */
+    size_t                        io{ 0 };                    /**< Input and output tensors */
+    size_t                        transitions{ 0 };           /**< Pools of the transition memory managers, or the transition tensors allocated on their own */
+    size_t                        peak_live_transitions{ 0 }; /**< Peak of the transition tensors alive at the same time in the execution order */
+    size_t                        workspaces{ 0 };            /**< Pools of the function memory managers */
+    std::vector<NodeMemoryReport> nodes{};                    /**< Breakdown per node in execution order */
+
+    /** Total memory of the graph
+     *
+     * @return The sum of the memory of all the categories
+     */
+    size_t total() const
+    {
+        return constants + transformed_weights + io + transitions + workspaces;
+    }
+};
+
+/** Creates the memory report of a finalized graph
+ *
+ * @note Workspaces of functions not using the function memory manager and weights transformed outside of the weights managers
+ *       are not visible to the graph and can't be accounted for.
+ *
+ * @param[in] g          Finalized graph
+ * @param[in] ctx        Graph context the graph was finalized with
+ * @param[in] node_order Execution order of the nodes
+ *
+ * @return The memory report
+ */
+MemoryReport create_memory_report(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+
+/** Formatted output of the memory used by a node
+ *
+ * @param[out] os     Output stream
+ * @param[in]  report Node memory report to output
+ *
+ * @return Modified output stream
+ */
+std::ostream &operator<<(std::ostream &os, const NodeMemoryReport &report);
+/** Formatted output of the totals of a memory report
+ *
+ * @param[out] os     Output stream
+ * @param[in]  report Memory report to output
+ *
+ * @return Modified output stream
+ */
+std::ostream &operator<<(std::ostream &os, const MemoryReport &report);
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_MEMORY_REPORT_H */
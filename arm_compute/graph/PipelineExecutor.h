@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_PIPELINE_EXECUTOR_H
+#define ARM_COMPUTE_GRAPH_PIPELINE_EXECUTOR_H
+
+#include "arm_compute/graph/Types.h"
+#include "arm_compute/graph/Workload.h"
+
+#include <chrono>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+// Forward declarations
+class IScheduler;
+class MemoryRegion;
+
+namespace graph
+{
+// Forward declarations
+class Graph;
+class GraphContext;
+class ITensorHandle;
+class Tensor;
+
+/** Statistics of the pipelined execution of a graph */
+struct PipelineStats
+{
+    unsigned int        frames{ 0 };           /**< Number of frames executed */
+    double              duration_ms{ 0.0 };    /**< Execution time in milliseconds */
+    double              throughput{ 0.0 };     /**< Executed frames per second */
+    double              avg_latency_ms{ 0.0 }; /**< Average time in milliseconds from the start of a frame on the first stage to its end on the last stage */
+    double              max_latency_ms{ 0.0 }; /**< Maximum time in milliseconds from the start of a frame on the first stage to its end on the last stage */
+    std::vector<double> stage_utilization{};   /**< Fraction of the execution time each stage spent processing frames */
+};
+
+/** Pipelined executor of a graph workload
+ *
+ * The topologically sorted nodes are partitioned into consecutive stages of similar estimated cost. Each stage runs on
+ * its own thread with its own scheduler bound to a subset of the cores, so that the early stages process the next frames
+ * while the late stages process the previous ones.
+ *
+ * The tensors used by more than one stage are double-buffered: each stage gets its own handle of such a tensor, which
+ * points to the buffer of the frame the stage processes. The buffers alternate from one frame to the next, a stage
+ * waits for the later stages to be done with a buffer before reusing it.
+ *
+ * With asynchronous accessors, the input and output accessors are called on stages of their own: the inputs of the next
+ * frame are loaded and the outputs of the previous frame consumed while the compute stages process the current frame.
+ * The accessors access the buffers of their frame directly, so the hand-off to and from the compute stages doesn't copy.
+ *
+ * @note Only workloads of the Arm® Neon™ backend can be pipelined.
+ * @note The stages can't be cut across sub-tensors, which limits the number of stages of graphs with concatenations or views.
+ */
+class PipelineExecutor final
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_stages Maximum number of compute stages to partition the graph into
+     * @param[in] async_io   (Optional) Call the input and output accessors on stages of their own
+     */
+    explicit PipelineExecutor(unsigned int num_stages, bool async_io = false);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PipelineExecutor(const PipelineExecutor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PipelineExecutor &operator=(const PipelineExecutor &) = delete;
+    /** Prevent instances of this class from being moved (As this class contains synchronization primitives) */
+    PipelineExecutor(PipelineExecutor &&) = delete;
+    /** Prevent instances of this class from being moved (As this class contains synchronization primitives) */
+    PipelineExecutor &operator=(PipelineExecutor &&) = delete;
+    /** Default destructor */
+    ~PipelineExecutor();
+    /** Partitions the nodes of a graph into stages and configures them
+     *
+     * The nodes of each stage are configured on the handles of the stage for the tensors shared between stages.
+     *
+     * @param[in] g          Graph to configure
+     * @param[in] ctx        Graph context
+     * @param[in] node_order Topologically sorted nodes of the graph
+     *
+     * @return The execution workload of the graph
+     */
+    ExecutionWorkload configure(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order);
+    /** Allocates the buffers of the tensors shared between stages
+     *
+     * @note Must be called once the other tensors of the graph are allocated
+     */
+    void allocate();
+    /** Executes frames until an input or output accessor fails
+     *
+     * @param[in] workload Workload returned by @ref configure
+     */
+    void execute(ExecutionWorkload &workload);
+    /** Number of stages the graph has been partitioned into
+     *
+     * @return The number of stages, including the accessor stages
+     */
+    unsigned int num_stages() const;
+    /** Number of stages running the functions of the graph
+     *
+     * @return The number of stages, excluding the accessor stages
+     */
+    unsigned int num_compute_stages() const;
+    /** Statistics of the last execution
+     *
+     * @return The statistics of the last call to @ref execute
+     */
+    const PipelineStats &stats() const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /** Tensor used by more than one stage */
+    struct SharedTensor
+    {
+        Tensor                                                *tensor{ nullptr }; /**< Graph tensor */
+        unsigned int                                           home_stage{ 0 };   /**< Stage using the handle of the graph tensor */
+        std::map<unsigned int, std::unique_ptr<ITensorHandle>> handles{};         /**< Handles of the other stages using the tensor */
+        std::unique_ptr<MemoryRegion>                          buffers[2];        /**< Buffers of the even and odd frames */
+    };
+    /** Pipeline stage */
+    struct Stage
+    {
+        std::vector<size_t>                          tasks{};           /**< Indices of the tasks of the stage in the workload */
+        std::vector<std::pair<ITensorHandle *, int>> handles{};         /**< Handles of the shared tensors used by the stage and the index of the tensor */
+        unsigned int                                 wait_stage{ 0 };   /**< Last stage sharing a tensor with this stage */
+        int                                          first_core{ -1 };  /**< First core the stage is bound to */
+        std::unique_ptr<IScheduler>                  scheduler{};       /**< Scheduler running the functions of the stage */
+        double                                       busy_ms{ 0.0 };    /**< Time spent processing frames in the last execution */
+    };
+
+    /** Processes a frame on a stage
+     *
+     * @param[in] workload Workload to execute
+     * @param[in] stage    Index of the stage
+     * @param[in] frame    Index of the frame
+     *
+     * @return False if an input or output accessor failed else true
+     */
+    bool process(ExecutionWorkload &workload, unsigned int stage, unsigned int frame);
+#ifndef NO_MULTI_THREADING
+    /** Processes the frames of a stage until the pipeline stops
+     *
+     * @param[in] workload Workload to execute
+     * @param[in] stage    Index of the stage
+     */
+    void run_stage(ExecutionWorkload &workload, unsigned int stage);
+    /** Stops the pipeline at a given frame
+     *
+     * @param[in] frame First frame not to process
+     */
+    void stop_at(unsigned int frame);
+#endif /* NO_MULTI_THREADING */
+
+    unsigned int                                      _max_stages;                                             /**< Maximum number of compute stages */
+    bool                                              _async_io;                                               /**< Whether the accessors are called on stages of their own */
+    std::vector<Stage>                                _stages;                                                 /**< Stages of the pipeline */
+    std::vector<SharedTensor>                         _shared;                                                 /**< Tensors used by more than one stage */
+    std::vector<std::pair<Tensor *, ITensorHandle *>> _outputs;                                                /**< Output tensors and the handles the last stage reads them from */
+    PipelineStats                                     _stats;                                                  /**< Statistics of the last execution */
+    std::map<unsigned int, Clock::time_point>         _frame_starts;                                           /**< Start time of the frames in flight */
+    double                                            _total_latency_ms;                                       /**< Sum of the latencies of the executed frames */
+#ifndef NO_MULTI_THREADING
+    std::mutex                                        _mtx;                                                    /**< Mutex protecting the pipeline state */
+    std::condition_variable                           _frame_done;                                             /**< Signalled when a stage is done with a frame */
+    std::vector<unsigned int>                         _done;                                                   /**< Number of frames each stage is done with */
+    unsigned int                                      _stop_frame{ std::numeric_limits<unsigned int>::max() }; /**< First frame not to process */
+    std::exception_ptr                                _error;                                                  /**< First error raised by a stage */
+#endif /* NO_MULTI_THREADING */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_PIPELINE_EXECUTOR_H */
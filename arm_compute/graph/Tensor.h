@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,13 @@ public:
      * @return Backend tensor handle
      */
     ITensorHandle *handle();
+    /** Extracts the backend tensor handle from the tensor
+     *
+     * @warning Handle gets unbound from the tensor
+     *
+     * @return The backend tensor handle of the tensor
+     */
+    std::unique_ptr<ITensorHandle> extract_handle();
     /** Sets the backend tensor accessor
      *
      * @param[in] accessor Accessor to set
@@ -94,6 +101,13 @@ public:
      * @return True if the accessor was called else false
      */
     bool call_accessor();
+    /** Calls accessor on another backend tensor of the same descriptor
+     *
+     * @param[in] handle Backend tensor handle to access
+     *
+     * @return True if the accessor was called else false
+     */
+    bool call_accessor(ITensorHandle &handle);
     /** Binds the tensor with an edge
      *
      * @param[in] eid Edge ID that is bound to the tensor
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -83,17 +83,26 @@ struct TensorDescriptor;
 /** Graph configuration structure */
 struct GraphConfig
 {
-    bool          use_function_memory_manager{ true };   /**< Use a memory manager to manage per-function auxilary memory */
-    bool          use_function_weights_manager{ true };  /**< Use a weights manager to manage transformed weights */
-    bool          use_transition_memory_manager{ true }; /**< Use a memory manager to manager transition buffer memory */
-    bool          use_tuner{ false };                    /**< Use a tuner in tunable backends */
-    bool          use_synthetic_type{ false };           /**< Convert graph to a synthetic graph for a data type */
-    DataType      synthetic_type{ DataType::QASYMM8 };   /**< The data type of the synthetic graph  */
-    CLTunerMode   tuner_mode{ CLTunerMode::EXHAUSTIVE }; /**< Tuner mode to be used by the CL tuner */
-    int           num_threads{ -1 };                     /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
-    std::string   tuner_file{ "acl_tuner.csv" };         /**< File to load/store tuning values from */
-    std::string   mlgo_file{ "heuristics.mlgo" };        /**< Filename to load MLGO heuristics from */
-    CLBackendType backend_type{ CLBackendType::Native }; /**< CL backend type to use */
+    bool          use_function_memory_manager{ true };        /**< Use a memory manager to manage per-function auxilary memory */
+    bool          use_function_weights_manager{ true };       /**< Use a weights manager to manage transformed weights */
+    bool          use_transition_memory_manager{ true };      /**< Use a memory manager to manager transition buffer memory */
+    bool          use_tuner{ false };                         /**< Use a tuner in tunable backends */
+    bool          use_synthetic_type{ false };                /**< Convert graph to a synthetic graph for a data type */
+    DataType      synthetic_type{ DataType::QASYMM8 };        /**< The data type of the synthetic graph  */
+    CLTunerMode   tuner_mode{ CLTunerMode::EXHAUSTIVE };      /**< Tuner mode to be used by the CL tuner */
+    int           num_threads{ -1 };                          /**< Number of threads to use (thread capable backends), if 0 the backend will auto-initialize, if -1 the backend will stay as it is. */
+    std::string   tuner_file{ "acl_tuner.csv" };              /**< File to load/store tuning values from */
+    std::string   mlgo_file{ "heuristics.mlgo" };             /**< Filename to load MLGO heuristics from */
+    std::string   plan_file{};                                /**< File to load the finalized graph plan from, or to store it to if missing or outdated. Empty to disable */
+    bool          use_conv_method_benchmark{ false };         /**< Select the convolution methods by measuring them on the device */
+    std::string   conv_method_file{ "acl_conv_methods.csv" }; /**< File to load/store the measured convolution methods from */
+    bool          use_data_layout_selection{ false };         /**< Select the data layout of the nodes to minimise the permutations */
+    int           pipeline_stages{ 1 };                       /**< Number of pipeline stages to execute the frames with on the Arm® Neon™ backend, 1 to execute them one after the other */
+    bool          use_async_accessors{ false };               /**< Call the input and output accessors on their own threads on the Arm® Neon™ backend, overlapping them with the execution */
+    bool          use_memory_aware_order{ false };            /**< Execute the nodes in the topological order minimizing the peak memory of the transition tensors */
+    bool          use_shared_workspace_memory{ false };       /**< Place the auxiliary memory of the functions in the memory of the transition tensors on the Arm® Neon™ backend */
+    bool          use_constant_folding{ false };              /**< Evaluate the nodes fed only by constants when finalizing the graph */
+    CLBackendType backend_type{ CLBackendType::Native };      /**< CL backend type to use */
 };
 
 /**< Device target types */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -139,11 +139,46 @@ std::vector<NodeIdxPair> get_driving_nodes(const INode &node);
  * @return A list with the driver node of a given node
  */
 std::vector<NodeIdxPair> get_driver_nodes(const INode &node);
+/** Checks if a tensor is only read by a given node
+ *
+ * Nodes computing the tensor in-place run before its readers and are not accounted for.
+ *
+ * @param[in] g      Graph the tensor belongs to
+ * @param[in] tensor Tensor to check
+ * @param[in] node   Node expected to be the only reader of @p tensor
+ *
+ * @return True if @p node is the only node reading @p tensor else false
+ */
+bool is_only_consumer(const Graph &g, const Tensor &tensor, const INode &node);
+/** Checks if a tensor is written by a node computing it in-place
+ *
+ * @param[in] g      Graph the tensor belongs to
+ * @param[in] tensor Tensor to check
+ *
+ * @return True if a node reading @p tensor also outputs it else false
+ */
+bool has_in_place_writer(const Graph &g, const Tensor &tensor);
 /** Configures tensor
  *
  * @param[in, out] tensor Tensor to configure
  */
 void configure_tensor(Tensor *tensor);
+/** Copies the contents of a tensor to a buffer holding its elements contiguously
+ *
+ * @note The tensor must be allocated and mapped.
+ *
+ * @param[in]  tensor Tensor to read
+ * @param[out] dst    Buffer of at least the size of the tensor elements
+ */
+void copy_tensor_to_buffer(ITensor &tensor, uint8_t *dst);
+/** Copies the contents of a buffer holding the elements of a tensor contiguously to the tensor
+ *
+ * @note The tensor must be allocated and mapped.
+ *
+ * @param[in]  src    Buffer holding the tensor elements
+ * @param[out] tensor Tensor to write
+ */
+void copy_buffer_to_tensor(const uint8_t *src, ITensor &tensor);
 } // namespace graph
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_GRAPH_UTILS_H */
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_WORKSPACE_LIFETIME_MANAGER_H
+#define ARM_COMPUTE_GRAPH_WORKSPACE_LIFETIME_MANAGER_H
+
+#include "arm_compute/graph/Types.h"
+
+#include "arm_compute/runtime/ISimpleLifetimeManager.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/Types.h"
+
+#include <map>
+#include <memory>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Lifetime manager placing the auxiliary memory of the functions with the transition tensors
+ *
+ * The memory groups of the functions are laid out as with an @ref OffsetLifetimeManager, and the node being configured when
+ * each group gets finalized is recorded. When the transition memory manager is used, a workspace is created for each node:
+ * a tensor holding all the groups of the node back to back, as a function can hold its group while the functions nested in it
+ * acquire theirs. The transition memory manager keeps the workspace alive only while the node executes.
+ * The pools then give the memory of the workspace of a node to its groups, so that auxiliary memory and transition tensors
+ * share the bytes of the transition memory pool whenever their lifetimes don't overlap.
+ *
+ * Groups without an allocated workspace get their memory from a blob of the pools sized for the largest of them.
+ *
+ * @note The mappings are offsets in host memory, only backends allocating their tensors in host memory can use it.
+ */
+class WorkspaceLifetimeManager final : public ISimpleLifetimeManager
+{
+public:
+    /** Constructor */
+    WorkspaceLifetimeManager();
+    /** Prevent instances of this class to be copy constructed */
+    WorkspaceLifetimeManager(const WorkspaceLifetimeManager &) = delete;
+    /** Prevent instances of this class to be copied */
+    WorkspaceLifetimeManager &operator=(const WorkspaceLifetimeManager &) = delete;
+    /** Sets the node whose functions are being configured
+     *
+     * @param[in] nid Node ID, @ref EmptyNodeID once the nodes are configured
+     */
+    void set_active_node(NodeID nid);
+    /** Creates the workspace of a node
+     *
+     * @note The workspace has to be managed and allocated by the memory group of the transition tensors
+     *
+     * @param[in] nid Node ID
+     *
+     * @return The workspace of the node, nullptr if its functions don't need auxiliary memory
+     */
+    arm_compute::Tensor *create_workspace(NodeID nid);
+    /** Gets the allocated workspace of a memory group
+     *
+     * @param[in] mappings Mappings of the memory group
+     *
+     * @return The workspace of the group, nullptr if it has no allocated workspace
+     */
+    arm_compute::Tensor *workspace(const MemoryMappings &mappings) const;
+    /** Gets the offset of a memory group in the workspace of its node
+     *
+     * @param[in] mappings Mappings of the memory group
+     *
+     * @return The offset of the group in bytes
+     */
+    size_t workspace_offset(const MemoryMappings &mappings) const;
+
+    // Inherited methods overridden:
+    bool release_group(IMemoryGroup *group) override;
+    std::unique_ptr<IMemoryPool> create_pool(IAllocator *allocator) override;
+    MappingType mapping_type() const override;
+
+private:
+    // Inherited methods overridden:
+    void update_blobs_and_mappings() override;
+
+private:
+    /** Memory requirements of a finalized group */
+    struct GroupInfo
+    {
+        NodeID node{ EmptyNodeID }; /**< Node being configured when the group got finalized */
+        size_t size{ 0 };           /**< Size of the group */
+        size_t alignment{ 0 };      /**< Alignment of the group */
+        size_t offset{ 0 };         /**< Offset of the group in the workspace of its node */
+    };
+
+    NodeID                                                 _active_node; /**< Node whose functions are being configured */
+    std::map<const MemoryMappings *, GroupInfo>            _groups;      /**< Finalized groups keyed by their mappings */
+    std::map<NodeID, std::unique_ptr<arm_compute::Tensor>> _workspaces;  /**< Workspaces of the nodes */
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_WORKSPACE_LIFETIME_MANAGER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,32 @@ std::vector<NodeID> bfs(Graph &g);
  * @return A vector with the node id traversal order
  */
 std::vector<NodeID> dfs(Graph &g);
+/** Topological sort minimizing the peak memory of the transition tensors
+ *
+ * Nodes are scheduled greedily among the ones whose inputs are computed, picking the one that allocates the
+ * fewest bytes of transition tensors for the bytes it releases, ties being broken by the depth first order.
+ * The depth first order is returned if the greedy one doesn't lower the peak.
+ *
+ * @note The tensor handles of the graph must have been created.
+ *
+ * @param g Graph to traverse
+ *
+ * @return A vector with the node id traversal order
+ */
+std::vector<NodeID> memory_aware_sort(Graph &g);
+/** Bytes of the transition tensors alive while each node of an execution order runs
+ *
+ * Transition tensors are the tensors linking two nodes: the inputs, outputs and constants of the graph are not accounted for.
+ * Sub-tensors are accounted for as their parent. A tensor is alive from the first node that accesses it to the last one.
+ *
+ * @note The tensor handles of the graph must have been created.
+ *
+ * @param g          Graph the nodes belong to
+ * @param node_order Execution order of the nodes
+ *
+ * @return The bytes alive for each node of the execution order
+ */
+std::vector<size_t> live_transition_memory(Graph &g, const std::vector<NodeID> &node_order);
 } // namespace graph
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_GRAPH_ALGORITHM_TOPOLOGICAL_SORT_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -450,6 +450,35 @@ std::unique_ptr<arm_compute::IFunction> create_concatenate_layer(ConcatenateLaye
     return std::move(func);
 }
 
+/** Records on a convolution node the method a backend resolved its default hint to
+ *
+ * Only methods the graph can request again with the same result are recorded; the others leave the hint as it is.
+ *
+ * @param[in,out] node   Convolution node
+ * @param[in]     method Method the backend function picked
+ */
+inline void set_resolved_convolution_method(ConvolutionLayerNode &node, arm_compute::ConvolutionMethod method)
+{
+    switch(method)
+    {
+        case arm_compute::ConvolutionMethod::GEMM:
+            // The graph's GEMM convolution functions are created without fast math
+            if(node.fast_math_hint() != FastMathHint::Enabled)
+            {
+                node.set_convolution_method(ConvolutionMethod::GEMM);
+            }
+            break;
+        case arm_compute::ConvolutionMethod::DIRECT:
+            node.set_convolution_method(ConvolutionMethod::Direct);
+            break;
+        case arm_compute::ConvolutionMethod::WINOGRAD:
+            node.set_convolution_method(ConvolutionMethod::Winograd);
+            break;
+        default:
+            break;
+    }
+}
+
 /** Create a backend convolution layer function
  *
  * @tparam ConvolutionLayerFunctions Backend convolution functions
@@ -1139,6 +1168,12 @@ std::unique_ptr<IFunction> create_flatten_layer(FlattenLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if(!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1753,6 +1788,12 @@ std::unique_ptr<IFunction> create_reshape_layer(ReshapeLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if(!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1874,6 +1915,12 @@ std::unique_ptr<IFunction> create_slice_layer(SliceLayerNode &node)
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if(!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input  = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output = get_backing_tensor<TargetInfo>(node.output(0));
@@ -1993,6 +2040,12 @@ std::unique_ptr<IFunction> create_strided_slice_layer(StridedSliceLayerNode &nod
 {
     validate_node<TargetInfo>(node, 1 /* expected inputs */, 1 /* expected outputs */);
 
+    // Return nullptr if the output is a view of the input
+    if(!node.is_enabled())
+    {
+        return nullptr;
+    }
+
     // Extract IO and info
     typename TargetInfo::TensorType *input   = get_backing_tensor<TargetInfo>(node.input(0));
     typename TargetInfo::TensorType *output  = get_backing_tensor<TargetInfo>(node.output(0));
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_SELECTION_MUTATOR_H
+#define ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_SELECTION_MUTATOR_H
+
+#include "arm_compute/graph/IGraphMutator.h"
+#include "arm_compute/graph/Types.h"
+
+#include <map>
+#include <string>
+
+namespace arm_compute
+{
+namespace graph
+{
+/** Mutation pass to select the convolution method of each convolution node by measuring them
+ *
+ * Every method that validates for a node is configured on scratch tensors and timed on the current machine and
+ * number of threads, the fastest one is pinned on the node. The decisions are keyed by the convolution configuration
+ * and the number of threads, they are loaded from and stored to a file so that later runs don't measure again.
+ *
+ * @note Only nodes assigned to the Arm® Neon™ backend are measured. Nodes whose tensors are sub-tensors of other tensors keep their method.
+ */
+class ConvolutionMethodSelectionMutator final : public IGraphMutator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] decisions_file File to load/store the decisions from. Empty to not persist them
+     * @param[in] iterations     (Optional) Number of timed runs per method
+     */
+    ConvolutionMethodSelectionMutator(std::string decisions_file, unsigned int iterations = 5);
+    // Inherited methods overridden
+    virtual void mutate(Graph &g) override;
+    MutationType type() const override;
+    const char *name() override;
+
+private:
+    std::string                              _decisions_file;
+    unsigned int                             _iterations;
+    std::map<std::string, ConvolutionMethod> _decisions;
+};
+} // namespace graph
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_GRAPH_CONVOLUTION_METHOD_SELECTION_MUTATOR_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,6 +31,8 @@ namespace arm_compute
 namespace graph
 {
 /** Mutation pass to optimize depth concatenation operations by using sub-tensors
+ *
+ * Concatenations along the third dimension or above (e.g. the depth or the batches) are handled.
  *
  * @warning Always run as one of the last mutation pass as optimizations might change the parent of sub-tensors.
  **/
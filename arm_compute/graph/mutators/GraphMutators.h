@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,9 @@
 #ifndef ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 #define ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H
 
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+#include "arm_compute/graph/mutators/ConvolutionMethodSelectionMutator.h"
+#include "arm_compute/graph/mutators/DataLayoutSelectionMutator.h"
 #include "arm_compute/graph/mutators/DepthConcatSubTensorMutator.h"
 #include "arm_compute/graph/mutators/GroupedConvolutionMutator.h"
 #include "arm_compute/graph/mutators/InPlaceOperationMutator.h"
@@ -31,5 +34,6 @@
 #include "arm_compute/graph/mutators/NodeFusionMutator.h"
 #include "arm_compute/graph/mutators/SplitLayerSubTensorMutator.h"
 #include "arm_compute/graph/mutators/SyntheticDataTypeMutator.h"
+#include "arm_compute/graph/mutators/ViewAliasingMutator.h"
 
 #endif /* ARM_COMPUTE_GRAPH_GRAPH_MUTATORS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,14 +30,31 @@ namespace arm_compute
 {
 namespace graph
 {
-/** Mutation pass to optimize operations that can be performed in-place */
+/** Mutation pass to optimize operations that can be performed in-place
+ *
+ * By default the output tensor of the nodes is replaced by their input tensor.
+ * When aliasing backend handles, the pass instead makes the output of quantization and dequantization nodes with
+ * the same element size an alias of their input, and the input of pad nodes only padded along their outermost non-unit
+ * dimension a sub-tensor of the interior of their output.
+ * It must then run after the passes that replace backend handles.
+ *
+ * @note Backend handles are only aliased on the Arm® Neon™ backend.
+ */
 class InPlaceOperationMutator final : public IGraphMutator
 {
 public:
+    /** Constructor
+     *
+     * @param[in] alias_handles (Optional) Alias the backend handles of the tensors instead of sharing the tensors
+     */
+    explicit InPlaceOperationMutator(bool alias_handles = false);
     // Inherited methods overridden
     virtual void mutate(Graph &g) override;
     MutationType type() const override;
     const char *name() override;
+
+private:
+    bool _alias_handles;
 };
 } // namespace graph
 } // namespace arm_compute
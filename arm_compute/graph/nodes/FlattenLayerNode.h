@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,11 +37,28 @@ public:
     /** Default Constructor */
     FlattenLayerNode();
 
+    /** Disables or not the flatten node
+     *
+     * @warning This is used when the output is a view of the input, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the flatten (involves copying),
+     *                       while if false, no function is created and we assume that the output handle aliases the input memory.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
+
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
     TensorDescriptor configure_output(size_t idx) const override;
     void accept(INodeVisitor &v) override;
+
+private:
+    bool _is_enabled{ true };
 };
 } // namespace graph
 } // namespace arm_compute
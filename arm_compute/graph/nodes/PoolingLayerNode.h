@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,13 @@ public:
      * @return Pooling Layer info
      */
     PoolingLayerInfo pooling_info() const;
+    /** Sets the data layout the pooling operation is performed in
+     *
+     * @note Only pooling information with an explicit data layout is updated
+     *
+     * @param[in] layout Data layout to perform the pooling in
+     */
+    void set_data_layout(DataLayout layout);
     /** Computes pooling output descriptor
      *
      * @param[in] input_descriptor Input descriptor
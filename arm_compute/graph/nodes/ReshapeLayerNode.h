@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,20 @@ public:
      */
     ReshapeLayerNode(TensorShape shape);
 
+    /** Disables or not the reshape node
+     *
+     * @warning This is used when the output is a view of the input, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the reshape (involves copying),
+     *                       while if false, no function is created and we assume that the output handle aliases the input memory.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
+
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
@@ -48,6 +62,7 @@ public:
 
 private:
     TensorShape _shape;
+    bool        _is_enabled{ true };
 };
 } // namespace graph
 } // namespace arm_compute
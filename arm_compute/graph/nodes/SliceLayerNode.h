@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -63,6 +63,20 @@ public:
      */
     Coordinates ends() const;
 
+    /** Disables or not the slice node
+     *
+     * @warning This is used when the output is a view of the input, where this node is used as a placeholder.
+     *
+     * @param[in] is_enabled If true a backend function is created to perform the slice (involves copying),
+     *                       while if false, no function is created and we assume that the output handle aliases the input memory.
+     */
+    void set_enabled(bool is_enabled);
+    /** Enabled parameter accessor
+     *
+     * @return True if a backend function is to be created else false
+     */
+    bool is_enabled() const;
+
     // Inherited overridden methods:
     NodeType         type() const override;
     bool             forward_descriptors() override;
@@ -72,6 +86,7 @@ public:
 private:
     Coordinates _starts;
     Coordinates _ends;
+    bool        _is_enabled{ true };
 };
 } // namespace graph
 } // namespace arm_compute
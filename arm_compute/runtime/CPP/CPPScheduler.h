@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2021 Arm Limited.
+ * Copyright (c) 2016-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,11 @@ namespace arm_compute
  * variable ARM_COMPUTE_CPP_SCHEDULER_MODE. e.g.:
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=linear      # Force select the linear scheduling mode
  * ARM_COMPUTE_CPP_SCHEDULER_MODE=fanout      # Force select the fanout scheduling mode
+ *
+ * On heterogeneous systems the threads can be mapped onto the cores according to their capacity, see @ref IScheduler::set_core_policy.
+ * The policy can also be selected via the environment variable ARM_COMPUTE_CPP_SCHEDULER_CORE_POLICY. e.g.:
+ * ARM_COMPUTE_CPP_SCHEDULER_CORE_POLICY=capacity # Pin the threads and split the static workloads by core capacity
+ * ARM_COMPUTE_CPP_SCHEDULER_CORE_POLICY=big      # Only use the big cores
 */
 class CPPScheduler final : public IScheduler
 {
@@ -57,6 +62,8 @@ public:
     // Inherited functions overridden
     void set_num_threads(unsigned int num_threads) override;
     void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func) override;
+    void set_core_policy(CorePolicy policy) override;
+    CorePolicy core_policy() const override;
     unsigned int num_threads() const override;
     void schedule(ICPPKernel *kernel, const Hints &hints) override;
     void schedule_op(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors) override;
@@ -67,6 +74,7 @@ protected:
      * @param[in] workloads Workloads to run
      */
     void run_workloads(std::vector<Workload> &workloads) override;
+    std::vector<unsigned int> thread_capacities(unsigned int num_threads) const override;
 
 private:
     struct Impl;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,10 @@
 
 #include <functional>
 #include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 
 namespace arm_compute
 {
@@ -48,6 +52,35 @@ public:
         DYNAMIC, /**< Split the workload dynamically using a bucket system */
     };
 
+    /** Policies available to map the threads onto heterogeneous (e.g. big.LITTLE) cores */
+    enum class CorePolicy
+    {
+        UNIFORM,           /**< Threads are not pinned and static workloads are split evenly */
+        CAPACITY_WEIGHTED, /**< Threads are pinned to the cores by decreasing capacity and static workloads are split proportionally to it */
+        BIG_CORES_ONLY,    /**< Threads are only run on the big cores, for latency critical workloads */
+    };
+
+    /** Load imbalance statistics of a kernel
+     *
+     * The imbalance of a run is the busy time of the slowest thread divided by the mean busy time of the threads.
+     * 1 means that the workload was perfectly balanced.
+     */
+    struct ImbalanceStats
+    {
+        unsigned int num_runs{ 0 };      /**< Number of parallel runs recorded */
+        double       sum_imbalance{ 0 }; /**< Sum of the imbalance of all the runs */
+        double       max_imbalance{ 0 }; /**< Worst imbalance over all the runs */
+
+        /** Mean imbalance over all the runs
+         *
+         * @return The mean imbalance, 0 if no run has been recorded
+         */
+        double mean_imbalance() const
+        {
+            return num_runs == 0 ? 0. : sum_imbalance / num_runs;
+        }
+    };
+
     /** Function to be used and map a given thread id to a logical core id
      *
      * Mapping function expects the thread index and total number of cores as input,
@@ -137,7 +170,7 @@ public:
     IScheduler();
 
     /** Destructor. */
-    virtual ~IScheduler() = default;
+    virtual ~IScheduler();
 
     /** Sets the number of threads the scheduler will use to run the kernels.
      *
@@ -152,6 +185,39 @@ public:
      */
     virtual void set_num_threads_with_affinity(unsigned int num_threads, BindFunc func);
 
+    /** Sets the policy used to map the threads onto the cores of heterogeneous systems
+     *
+     * @note The capacity of each core is read from the system when possible and can be declared through the
+     *       ARM_COMPUTE_CPU_CAPACITIES environment variable, e.g. ARM_COMPUTE_CPU_CAPACITIES="1024,1024,410,410".
+     * @note @ref CorePolicy::BIG_CORES_ONLY limits the number of threads set by @ref set_num_threads to the number of big cores.
+     *
+     * @param[in] policy Policy to use
+     */
+    virtual void set_core_policy(CorePolicy policy);
+
+    /** Returns the policy used to map the threads onto the cores
+     *
+     * @return The core policy
+     */
+    virtual CorePolicy core_policy() const;
+
+    /** Enable or disable the collection of per-kernel load imbalance statistics
+     *
+     * @note Collecting the statistics adds two timer reads per workload.
+     *
+     * @param[in] enable True to start collecting the statistics
+     */
+    virtual void set_imbalance_stats_enabled(bool enable);
+
+    /** Returns the load imbalance statistics collected so far, indexed by kernel name
+     *
+     * @return The imbalance statistics
+     */
+    virtual std::map<std::string, ImbalanceStats> imbalance_stats() const;
+
+    /** Clear the load imbalance statistics collected so far */
+    virtual void reset_imbalance_stats();
+
     /** Returns the number of threads that the SingleThreadScheduler has in its pool.
      *
      * @return Number of threads available in SingleThreadScheduler.
@@ -228,8 +294,22 @@ protected:
      */
     std::size_t adjust_num_of_windows(const Window &window, std::size_t split_dimension, std::size_t init_num_windows, const ICPPKernel &kernel, const CPUInfo &cpu_info);
 
+    /** Capacity of the core each thread runs on, used to balance static workloads
+     *
+     * @param[in] num_threads Number of threads that will run the workloads
+     *
+     * @return The capacity of the core of each thread id, or an empty vector if the workloads should be split evenly
+     */
+    virtual std::vector<unsigned int> thread_capacities(unsigned int num_threads) const;
+
 private:
-    unsigned int _num_threads_hint = {};
+    /** Run the workloads of a kernel, recording how long each thread has been busy if the statistics are enabled */
+    void run_kernel_workloads(const ICPPKernel &kernel, std::vector<Workload> &workloads);
+
+    struct ImbalanceRecorder;
+
+    unsigned int                       _num_threads_hint = {};
+    std::unique_ptr<ImbalanceRecorder> _imbalance{};
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_ISCHEDULER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -86,6 +86,13 @@ public:
      * @param weights Weights to mark unused
      */
     void pre_mark_as_unused(const ITensor *weights);
+    /** Size of the transformed weights held by the manager
+     *
+     * @note Only the transformations that have run and whose output is still allocated are accounted for
+     *
+     * @return The size in bytes of the transformed weights
+     */
+    size_t transformed_weights_size() const;
 
 private:
     struct CounterElement
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -40,6 +40,8 @@ class ITensor;
 /** Basic function to simulate a 3d convolution. This function calls one of the following functions:
  * -# @ref cpu::CpuDirectConv3d
  *
+ * The convolution is computed as an implicit GEMM by the assembly kernels when they support the configuration.
+ * Otherwise it falls back to the direct convolution kernel, which does not support dilation.
  */
 class NEConv3D : public IFunction
 {
@@ -87,6 +89,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    void prepare() override;
 
 private:
     struct Impl;
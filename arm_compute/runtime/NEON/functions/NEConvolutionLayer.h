@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,7 +55,7 @@ class ITensor;
  * --------------|----------------------------------------------------|-------------------------------------------|
  * Winograd      | 3x3 1x3 3x1 5x1 1x5 5x5(fast maths) 7x1 1x7        |  Input channels is greater than 3         |
  * FFT           | Squared kernels and greater than 9x9               |  Input feature maps > Output feature maps |
- * DirectConv    | 9x9                                                |                                           |
+ * DirectConv    | 9x9, NHWC 3x3 5x5 7x7 with stride 1 or 2           |  NHWC: Input channels is at most 8        |
  * GEMM          | Any size                                           |                                           |
  *
  * Winograd 5x5 requires fast maths enabled.
@@ -64,7 +64,7 @@ class ITensor;
  * --------------|------------------|
  * Winograd      | Not supported    |
  * FFT           | Not supported    |
- * DirectConv    | 9x9              |
+ * DirectConv    | 9x9, NHWC 3x3 5x5 7x7 with stride 1 or 2 and at most 8 input channels |
  * GEMM          | Any size         |
  *
  *
@@ -116,7 +116,8 @@ public:
      * @param[in]  act_info         (Optional) Activation layer information in case of a fused activation. Only RELU, BOUNDED_RELU and LU_BOUNDED_RELU supported.
      * @param[in]  enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                              available which may introduce a drop of accuracy as well. Default is false
-     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in]  num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported with the GEMM_CONV2D method.
+     *                              The weights are then a 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]
      */
     void configure(ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const WeightsInfo &weights_info = WeightsInfo(),
                    const Size2D &dilation = Size2D(1U, 1U), const ActivationLayerInfo &act_info = ActivationLayerInfo(), bool enable_fast_math = false, unsigned int num_groups = 1);
@@ -138,7 +139,8 @@ public:
      * @param[in] act_info         (Optional) Activation layer information in case of a fused activation.
      * @param[in] enable_fast_math (Optional) Enable fast math computation. In case this flag were set, the function could dispatch the fastest implementation
      *                             available which may introduce a drop of accuracy as well. Default is false
-     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is not supported
+     * @param[in] num_groups       (Optional) Number of groups when performing a grouped convolution. num_groups != 1 is only supported with the GEMM_CONV2D method.
+     *                             The weights are then a 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]
      *
      * @return a status
      */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -64,12 +64,22 @@ namespace arm_compute
  * The weights used by Deconvolution are supposed to be the same as the ones used for Convolution. Therefore, it will be necessary to use the weights in the
  * reverse order to perform an actual convolution. This is achieved by using @ref NEReverse.
  *
+ * For NHWC tensors and non-unit strides the transposed convolution is computed natively when possible: the input is multiplied by the reshaped weights to get
+ * the contributions of every kernel tap, which are then accumulated into the output. This avoids the multiplications by the zeros inserted by the upsampling.
+ *
  * This function calls the following kernels/functions:
  *
  * -# @ref CPPUpsample
  * -# @ref NEConvolutionLayer
  * -# @ref NEReverse
  *
+ * or, on the native path:
+ *
+ * -# @ref NEPermute
+ * -# @ref NEReshapeLayer
+ * -# cpu::CpuGemm or cpu::CpuGemmLowpMatrixMultiplyCore
+ * -# cpu::kernels::CpuDeconvCol2ImKernel
+ *
  */
 class NEDeconvolutionLayer : public IFunction
 {
@@ -85,7 +95,7 @@ public:
     /** Default move assignment operator */
     NEDeconvolutionLayer &operator=(NEDeconvolutionLayer &&) = default;
     /** Default destructor */
-    ~NEDeconvolutionLayer() = default;
+    ~NEDeconvolutionLayer();
 
     /** Set the input, weights, biases and output tensors.
      *
@@ -142,6 +152,12 @@ public:
     void prepare() override;
 
 private:
+    /** Configure the native transposed convolution path */
+    void configure_native(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, bool enable_fast_math);
+
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+
     MemoryGroup        _memory_group;
     NEConvolutionLayer _conv_f;
     CPPUpsample        _upsample_f;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -73,6 +73,8 @@ public:
      * |F32      |F32       |
      * |F16      |F16       |
      *
+     * @note The output tensor can be equal to the input, in which case the normalization function is performed in-place
+     *
      * @param[in]  input     Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
      *                       and an optional 4th dimension for batch of inputs. Data type supported: F16/F32. Data layouts supported: NCHW/NHWC.
      * @param[out] output    Destination with the same dimensions, data type, data layout and number of channels of  @p input
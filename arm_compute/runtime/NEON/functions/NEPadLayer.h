@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -74,6 +74,8 @@ public:
      * |:--------|:---------|
      * |All      |All       |
      *
+     * @note In CONSTANT mode @p input can be a sub-tensor of @p output placed at the front padding, in which case only the padding is written.
+     *
      * @param[in]  input          Source tensor. Data types supported: All.
      * @param[out] output         Output tensor. Data type supported: same as @p input
      * @param[in]  padding        The padding for each spatial dimension of the input tensor. The pair padding[i]
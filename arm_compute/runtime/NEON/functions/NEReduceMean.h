@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,9 +32,17 @@
 #include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <memory>
+
 namespace arm_compute
 {
-/** Basic function to perform reduce operation */
+class NEReductionMultiAxisKernel;
+
+/** Basic function to perform reduce operation
+ *
+ * F16/F32 inputs are reduced over all the axes in a single pass by @ref NEReductionMultiAxisKernel. Quantized inputs
+ * run one @ref NEReductionOperation per axis followed by @ref NEReshapeLayer when the reduced dimensions are dropped.
+ */
 class NEReduceMean : public IFunction
 {
 public:
@@ -87,12 +95,15 @@ public:
     void run() override;
 
 private:
-    MemoryGroup                       _memory_group;
-    std::vector<NEReductionOperation> _reduction_kernels;
-    std::vector<Tensor>               _reduced_outs;
-    NEReshapeLayer                    _reshape;
-    int                               _reduction_ops;
-    bool                              _keep_dims;
+    MemoryGroup                                 _memory_group;
+    std::vector<NEReductionOperation>           _reduction_kernels;
+    std::vector<Tensor>                         _reduced_outs;
+    NEReshapeLayer                              _reshape;
+    int                                         _reduction_ops;
+    bool                                        _keep_dims;
+    std::unique_ptr<NEReductionMultiAxisKernel> _multi_axis_kernel;
+    Tensor                                      _partials;
+    bool                                        _split_reduction;
 };
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_NEON_REDUCE_MEAN_H */
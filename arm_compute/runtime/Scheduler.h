@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019 Arm Limited.
+ * Copyright (c) 2017-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -49,6 +49,8 @@ public:
      */
     static void set(std::shared_ptr<IScheduler> scheduler);
     /** Access the scheduler singleton.
+     *
+     * @note Work submitted to a queue with a dedicated thread pool gets the scheduler of that queue instead.
      *
      * @return A reference to the scheduler object.
      */
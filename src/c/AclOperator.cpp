@@ -28,6 +28,8 @@
 #include "src/common/TensorPack.h"
 #include "src/common/utils/Macros.h"
 
+#include <algorithm>
+
 extern "C" AclStatus AclRunOperator(AclOperator external_op, AclQueue external_queue, AclTensorPack external_tensors)
 {
     using namespace arm_compute;
@@ -50,6 +52,45 @@ extern "C" AclStatus AclRunOperator(AclOperator external_op, AclQueue external_q
     return AclSuccess;
 }
 
+extern "C" AclStatus AclGetOperatorMemoryRequirements(AclOperator external_op, AclMemoryRequirement *reqs, int32_t *num_reqs)
+{
+    using namespace arm_compute;
+
+    auto op = get_internal(external_op);
+
+    StatusCode status = detail::validate_internal_operator(op);
+    ARM_COMPUTE_RETURN_CENUM_ON_FAILURE(status);
+    if(num_reqs == nullptr)
+    {
+        return AclInvalidArgument;
+    }
+
+    const MemoryRequirements workspace = op->workspace();
+    const int32_t            count     = std::count_if(workspace.begin(), workspace.end(), [](const experimental::MemoryInfo & info)
+    {
+        return info.size > 0;
+    });
+    if(reqs != nullptr)
+    {
+        if(*num_reqs < count)
+        {
+            return AclInvalidArgument;
+        }
+
+        int32_t i = 0;
+        for(const auto &info : workspace)
+        {
+            if(info.size > 0)
+            {
+                reqs[i++] = AclMemoryRequirement{ info.slot, static_cast<AclMemoryLifetime>(info.lifetime), info.size, info.alignment };
+            }
+        }
+    }
+    *num_reqs = count;
+
+    return AclSuccess;
+}
+
 extern "C" AclStatus AclDestroyOperator(AclOperator external_op)
 {
     using namespace arm_compute;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,11 +24,13 @@
 #ifndef SRC_COMMON_ICONTEXT_H
 #define SRC_COMMON_ICONTEXT_H
 
+#include "arm_compute/core/Error.h"
 #include "src/common/Types.h"
 #include "src/common/utils/Log.h"
 #include "src/common/utils/Object.h"
 
 #include <atomic>
+#include <tuple>
 
 struct AclContext_
 {
@@ -112,6 +114,192 @@ public:
                                                                   const AclTensorDescriptor     &dst,
                                                                   const AclActivationDescriptor &act,
                                                                   bool                           is_validate) = 0;
+    /** Create a 2D convolution operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Convolution meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_conv2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &weights,
+                                                              const AclTensorDescriptor *bias,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclConv2dDescriptor &info,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a 2D depthwise convolution operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Depthwise convolution meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_depthwise_conv2d(const AclTensorDescriptor &src,
+                                                                        const AclTensorDescriptor          &weights,
+                                                                        const AclTensorDescriptor          *bias,
+                                                                        const AclTensorDescriptor          &dst,
+                                                                        const AclDepthwiseConv2dDescriptor &info,
+                                                                        bool                                is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a general matrix multiplication operator
+     *
+     * @param[in] a           First matrix descriptor
+     * @param[in] b           Second matrix descriptor
+     * @param[in] c           Addend matrix descriptor, can be nullptr
+     * @param[in] d           Destination matrix descriptor
+     * @param[in] info        Matrix multiplication meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                            const AclTensorDescriptor &b,
+                                                            const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &d,
+                                                            const AclGemmDescriptor   &info,
+                                                            bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(a, b, c, d, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a fully connected layer operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] weights     Weights tensor descriptor
+     * @param[in] bias        Bias tensor descriptor, can be nullptr
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Fully connected layer meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_fully_connected(const AclTensorDescriptor &src,
+                                                                       const AclTensorDescriptor         &weights,
+                                                                       const AclTensorDescriptor         *bias,
+                                                                       const AclTensorDescriptor         &dst,
+                                                                       const AclFullyConnectedDescriptor &info,
+                                                                       bool                               is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, weights, bias, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a batched matrix multiplication operator
+     *
+     * @param[in] lhs         Left-hand side descriptor
+     * @param[in] rhs         Right-hand side descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Matrix multiplication meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                              const AclTensorDescriptor &rhs,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &info,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(lhs, rhs, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a 2D pooling operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Pooling meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_pool2d(const AclTensorDescriptor &src,
+                                                              const AclTensorDescriptor &dst,
+                                                              const AclPool2dDescriptor &info,
+                                                              bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a softmax operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Softmax meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor &src,
+                                                               const AclTensorDescriptor  &dst,
+                                                               const AclSoftmaxDescriptor &info,
+                                                               bool                        is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a binary elementwise operator
+     *
+     * @param[in] src0        First source tensor descriptor
+     * @param[in] src1        Second source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] info        Elementwise operation meta-data
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor &src0,
+                                                                   const AclTensorDescriptor      &src1,
+                                                                   const AclTensorDescriptor      &dst,
+                                                                   const AclElementwiseDescriptor &info,
+                                                                   bool                            is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src0, src1, dst, info, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a quantization operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_quantize(const AclTensorDescriptor &src,
+                                                                const AclTensorDescriptor &dst,
+                                                                bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
+    /** Create a dequantization operator
+     *
+     * @param[in] src         Source tensor descriptor
+     * @param[in] dst         Destination tensor descriptor
+     * @param[in] is_validate Only check if the configuration is supported, without creating the operator
+     *
+     * @return The created operator and a status code, @ref StatusCode::UnsupportedTarget if the backend does not implement it
+     */
+    virtual std::tuple<IOperator *, StatusCode> create_dequantize(const AclTensorDescriptor &src,
+                                                                  const AclTensorDescriptor &dst,
+                                                                  bool                       is_validate)
+    {
+        ARM_COMPUTE_UNUSED(src, dst, is_validate);
+        return std::make_tuple(nullptr, StatusCode::UnsupportedTarget);
+    }
 
 private:
     Target                   _target;   /**< Target type of context */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "src/common/IOperator.h"
+#include "arm_compute/core/ITensorPack.h"
 #include "src/common/utils/Validate.h"
 
 namespace arm_compute
@@ -54,9 +55,23 @@ StatusCode IOperator::run(ITensorPack &tensors)
 
 StatusCode IOperator::run(IQueue &queue, ITensorPack &tensors)
 {
-    ARM_COMPUTE_UNUSED(queue);
-    _op->run(tensors);
-    return StatusCode::Success;
+    // The workspace is managed by the caller, make sure it has been provided
+    for(const auto &req : _op->workspace())
+    {
+        const bool is_needed = req.size > 0 && (req.lifetime != experimental::MemoryLifetime::Prepare || !_has_run);
+        if(is_needed && tensors.get_tensor(req.slot) == nullptr)
+        {
+            ARM_COMPUTE_LOG_ERROR_ACL("[IOperator]: Missing workspace tensor");
+            return StatusCode::InvalidArgument;
+        }
+    }
+    _has_run = true;
+
+    // The pack is copied as the work can outlive the call
+    return queue.execute([this, tensors]() mutable
+    {
+        _op->run(tensors);
+    });
 }
 
 StatusCode IOperator::prepare(ITensorPack &tensors)
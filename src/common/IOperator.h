@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,7 @@
 #include "arm_compute/runtime/IOperator.h"
 #include "src/common/utils/Validate.h"
 
+#include <tuple>
 #include <vector>
 
 struct AclOperator_
@@ -73,7 +74,9 @@ public:
     /** Run the kernels contained in the function
      *
      * @param[in] queue   Queue to use
-     * @param[in] tensors Vector that contains the tensors to operate on
+     * @param[in] tensors Vector that contains the tensors to operate on, workspace included
+     *
+     * @return InvalidArgument if a workspace tensor reported by @ref IOperator::workspace is missing
      */
     virtual StatusCode run(IQueue &queue, ITensorPack &tensors);
     /** Run the kernels contained in the function
@@ -101,6 +104,7 @@ public:
 
 private:
     std::unique_ptr<experimental::IOperator> _op{ nullptr };
+    bool                                     _has_run{ false };
 };
 
 /** Extract internal representation of an Operator
@@ -131,6 +135,24 @@ inline StatusCode validate_internal_operator(const IOperator *op)
     }
     return StatusCode::Success;
 }
+/** Wrap a backend operator in an operator object
+ *
+ * @param[in] ctx Context the operator belongs to
+ * @param[in] op  Configured backend operator
+ *
+ * @return The operator object and a status code
+ */
+inline std::tuple<IOperator *, StatusCode> wrap_operator(IContext *ctx, std::unique_ptr<experimental::IOperator> op)
+{
+    auto wrapper = new IOperator(ctx);
+    if(wrapper == nullptr)
+    {
+        ARM_COMPUTE_LOG_ERROR_ACL("Couldn't allocate internal resources");
+        return std::make_tuple(nullptr, StatusCode::OutOfMemory);
+    }
+    wrapper->set_internal_operator(std::move(op));
+    return std::make_tuple(wrapper, StatusCode::Success);
+}
 } // namespace detail
 } // namespace arm_compute
 #endif /* SRC_COMMON_IOPERATOR_H_ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,8 @@
 
 #include "src/common/IContext.h"
 
+#include <functional>
+
 struct AclQueue_
 {
     arm_compute::detail::Header header{ arm_compute::detail::ObjectType::Queue, nullptr };
@@ -64,6 +66,21 @@ public:
     {
         return this->header.type == detail::ObjectType::Queue;
     };
+    /** Run some work on the execution resources of the queue
+     *
+     * @param[in] work Work to run
+     *
+     * @return Status code
+     */
+    virtual StatusCode execute(std::function<void()> work)
+    {
+        work();
+        return StatusCode::Success;
+    }
+    /** Block until all the work submitted to the queue has completed
+     *
+     * @return Status code
+     */
     virtual StatusCode finish() = 0;
 };
 
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/common/cpuinfo/CpuCacheInfo.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <sstream>
+
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__)
+#include <fstream>
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) */
+
+namespace arm_compute
+{
+namespace cpuinfo
+{
+namespace
+{
+bool parse_unsigned(const std::string &str, uint32_t &value)
+{
+    if(str.empty() || str.size() > 9)
+    {
+        return false;
+    }
+    value = 0;
+    for(const char c : str)
+    {
+        if(!std::isdigit(static_cast<unsigned char>(c)))
+        {
+            return false;
+        }
+        value = value * 10 + static_cast<uint32_t>(c - '0');
+    }
+    return true;
+}
+
+std::string trim(const std::string &str)
+{
+    const auto begin = str.find_first_not_of(" \t\n");
+    if(begin == std::string::npos)
+    {
+        return std::string{};
+    }
+    const auto end = str.find_last_not_of(" \t\n");
+    return str.substr(begin, end - begin + 1);
+}
+
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__)
+std::string read_line(const std::string &path)
+{
+    std::ifstream file(path, std::ios::in);
+    std::string   line;
+    if(file.is_open())
+    {
+        getline(file, line);
+    }
+    return trim(line);
+}
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) */
+} // namespace
+
+bool parse_cache_size(const std::string &str, uint32_t &size)
+{
+    const std::string value = trim(str);
+    if(value.empty())
+    {
+        return false;
+    }
+
+    uint32_t    multiplier = 1;
+    std::string digits     = value;
+    switch(std::toupper(static_cast<unsigned char>(value.back())))
+    {
+        case 'K':
+            multiplier = 1024;
+            digits.pop_back();
+            break;
+        case 'M':
+            multiplier = 1024 * 1024;
+            digits.pop_back();
+            break;
+        default:
+            break;
+    }
+
+    uint32_t base = 0;
+    if(!parse_unsigned(digits, base) || base > UINT32_MAX / multiplier)
+    {
+        return false;
+    }
+    size = base * multiplier;
+    return true;
+}
+
+uint32_t count_cpus_in_list(const std::string &list)
+{
+    uint32_t           count = 0;
+    std::istringstream stream(trim(list));
+    std::string        range;
+    while(getline(stream, range, ','))
+    {
+        const auto dash  = range.find('-');
+        uint32_t   first = 0;
+        uint32_t   last  = 0;
+        if(!parse_unsigned(range.substr(0, dash), first))
+        {
+            return 0;
+        }
+        last = first;
+        if(dash != std::string::npos && (!parse_unsigned(range.substr(dash + 1), last) || last < first))
+        {
+            return 0;
+        }
+        count += last - first + 1;
+    }
+    return count;
+}
+
+CpuCacheInfo init_cpu_cache_info_from_sysfs(uint32_t cpuid)
+{
+    CpuCacheInfo info{};
+#if !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__)
+    // Each index directory describes one cache seen by the CPU, stop at the first missing one
+    for(unsigned int index = 0;; ++index)
+    {
+        std::stringstream dir;
+        dir << "/sys/devices/system/cpu/cpu" << cpuid << "/cache/index" << index << "/";
+
+        const std::string level_str = read_line(dir.str() + "level");
+        uint32_t          level     = 0;
+        if(!parse_unsigned(level_str, level))
+        {
+            break;
+        }
+
+        const std::string type = read_line(dir.str() + "type");
+        if(type == "Instruction")
+        {
+            continue;
+        }
+
+        CpuCacheLevelInfo cache{};
+        if(!parse_cache_size(read_line(dir.str() + "size"), cache.size))
+        {
+            continue;
+        }
+        parse_unsigned(read_line(dir.str() + "coherency_line_size"), cache.line_size);
+        cache.num_sharing_cpus = std::max(count_cpus_in_list(read_line(dir.str() + "shared_cpu_list")), 1u);
+
+        if(level == 1)
+        {
+            info.l1d = cache;
+        }
+        else if(level == 2)
+        {
+            info.l2 = cache;
+        }
+        else if(level >= 3)
+        {
+            // Keep the outermost level as the last level cache
+            info.l3 = cache;
+        }
+    }
+#else  /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) */
+    ARM_COMPUTE_UNUSED(cpuid);
+#endif /* !defined(BARE_METAL) && !defined(_WIN64) && !defined(__APPLE__) */
+    return info;
+}
+
+void override_cpu_cache_info(CpuCacheInfo &info, const std::string &desc)
+{
+    std::istringstream stream(desc);
+    std::string        entry;
+    while(getline(stream, entry, ','))
+    {
+        const auto eq = entry.find('=');
+        if(eq == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string level = trim(entry.substr(0, eq));
+        for(auto &c : level)
+        {
+            c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        }
+
+        uint32_t size = 0;
+        if(!parse_cache_size(entry.substr(eq + 1), size))
+        {
+            continue;
+        }
+
+        if(level == "L1" || level == "L1D")
+        {
+            info.l1d.size = size;
+        }
+        else if(level == "L2")
+        {
+            info.l2.size = size;
+        }
+        else if(level == "L3" || level == "SLC")
+        {
+            info.l3.size = size;
+        }
+    }
+}
+} // namespace cpuinfo
+} // namespace arm_compute
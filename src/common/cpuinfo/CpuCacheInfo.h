@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SRC_COMMON_CPUINFO_CPUCACHEINFO_H
+#define SRC_COMMON_CPUINFO_CPUCACHEINFO_H
+
+#include <cstdint>
+#include <string>
+
+namespace arm_compute
+{
+namespace cpuinfo
+{
+/** Description of one level of the data cache hierarchy */
+struct CpuCacheLevelInfo
+{
+    uint32_t size{ 0 };             /**< Size in bytes, 0 if unknown */
+    uint32_t line_size{ 0 };        /**< Line size in bytes, 0 if unknown */
+    uint32_t num_sharing_cpus{ 1 }; /**< Number of CPUs sharing this cache */
+};
+
+/** Data cache hierarchy seen by a CPU
+ *
+ * The L3 entry describes the last level of cache beyond the L2, which can be a cluster L3 or a system level cache
+ * when the kernel exposes it.
+ */
+struct CpuCacheInfo
+{
+    CpuCacheLevelInfo l1d{}; /**< Level 1 data cache */
+    CpuCacheLevelInfo l2{};  /**< Level 2 cache */
+    CpuCacheLevelInfo l3{};  /**< Level 3 or system level cache */
+};
+
+/** Parse a cache size in the format used by sysfs
+ *
+ * @param[in]  str  String to parse, e.g. "32768", "64K" or "1M"
+ * @param[out] size Size in bytes
+ *
+ * @return true if the string was a valid size
+ */
+bool parse_cache_size(const std::string &str, uint32_t &size);
+
+/** Count the CPUs in a list in the format used by sysfs
+ *
+ * @param[in] list CPU list, e.g. "0-3,8"
+ *
+ * @return the number of CPUs in the list, 0 if it is malformed
+ */
+uint32_t count_cpus_in_list(const std::string &list);
+
+/** Identify the data caches of a CPU through /sys/devices/system/cpu/cpu<cpuid>/cache
+ *
+ * @param[in] cpuid Id of the CPU to query
+ *
+ * @return CpuCacheInfo A populated cache structure, with zero sizes for the levels that could not be read
+ */
+CpuCacheInfo init_cpu_cache_info_from_sysfs(uint32_t cpuid);
+
+/** Override cache sizes with a user provided description
+ *
+ * The description is a comma separated list of level=size entries, e.g. "L1=64K,L2=1M,L3=32M".
+ * Unknown or malformed entries are ignored.
+ *
+ * @param[in, out] info Cache information to update
+ * @param[in]      desc Description of the cache sizes
+ */
+void override_cpu_cache_info(CpuCacheInfo &info, const std::string &desc);
+} // namespace cpuinfo
+} // namespace arm_compute
+#endif /* SRC_COMMON_CPUINFO_CPUCACHEINFO_H */
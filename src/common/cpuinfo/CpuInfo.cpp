@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Log.h"
+#include "arm_compute/core/utils/misc/Utility.h"
 #include "support/StringSupport.h"
 #include "support/ToolchainSupport.h"
 
@@ -32,6 +33,7 @@
 
 #if !defined(BARE_METAL)
 #include <algorithm>
+#include <cstdlib>
 #include <cstring>
 #include <fstream>
 #if !defined(_WIN64)
@@ -266,6 +268,76 @@ int get_max_cpus()
     }
     return max_cpus;
 }
+
+/** Scale the capacities so that the biggest cores have a capacity of 1024
+ *
+ * @param[in,out] capacities Capacities to normalize, cleared if any of them is zero
+ */
+void normalize_capacities(std::vector<uint32_t> &capacities)
+{
+    const auto max_capacity = capacities.empty() ? 0U : *std::max_element(capacities.begin(), capacities.end());
+    if(std::find(capacities.begin(), capacities.end(), 0U) != capacities.end())
+    {
+        capacities.clear();
+    }
+    for(auto &c : capacities)
+    {
+        c = std::max<uint32_t>(1U, static_cast<uint32_t>((static_cast<uint64_t>(c) * 1024U) / max_capacity));
+    }
+}
+
+/** Read the capacity of each CPU from /sys/devices/system/cpu/cpuN/cpu_capacity
+ *
+ * @param[in] num_cpus Number of CPUs
+ *
+ * @return The capacity of each CPU, empty if the kernel does not expose them
+ */
+std::vector<uint32_t> capacities_from_sysfs(uint32_t num_cpus)
+{
+    std::vector<uint32_t> capacities;
+    for(uint32_t cpu = 0; cpu < num_cpus; ++cpu)
+    {
+        std::ifstream file("/sys/devices/system/cpu/cpu" + support::cpp11::to_string(cpu) + "/cpu_capacity", std::ios::in);
+        uint32_t      capacity = 0;
+        if(!file.is_open() || !(file >> capacity))
+        {
+            return {};
+        }
+        capacities.push_back(capacity);
+    }
+    normalize_capacities(capacities);
+    return capacities;
+}
+
+/** Parse a comma separated list of CPU capacities, e.g. "1024,1024,410,410"
+ *
+ * @param[in] list     List of capacities
+ * @param[in] num_cpus Number of CPUs
+ *
+ * @return The capacity of each CPU, empty if the list is malformed or does not describe all the CPUs
+ */
+std::vector<uint32_t> capacities_from_env(const std::string &list, uint32_t num_cpus)
+{
+    std::vector<uint32_t> capacities;
+    std::istringstream    stream(list);
+    std::string           entry;
+    while(getline(stream, entry, ','))
+    {
+        char         *end      = nullptr;
+        const uint32_t capacity = static_cast<uint32_t>(std::strtoul(entry.c_str(), &end, 10));
+        if(end == entry.c_str() || *end != '\0')
+        {
+            return {};
+        }
+        capacities.push_back(capacity);
+    }
+    if(capacities.size() != num_cpus)
+    {
+        return {};
+    }
+    normalize_capacities(capacities);
+    return capacities;
+}
 #elif defined(__aarch64__) && defined(__APPLE__) /* !defined(BARE_METAL) && !defined(__APPLE__) && (defined(__arm__) || defined(__aarch64__)) */
 /** Query features through sysctlbyname
   *
@@ -295,8 +367,8 @@ uint64_t get_sve_feature_reg()
 #endif /* defined(BARE_METAL) && defined(__aarch64__) */
 } // namespace
 
-CpuInfo::CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus)
-    : _isa(std::move(isa)), _cpus(std::move(cpus))
+CpuInfo::CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus, std::vector<CpuCacheInfo> caches, std::vector<uint32_t> capacities)
+    : _isa(std::move(isa)), _cpus(std::move(cpus)), _caches(std::move(caches)), _capacities(std::move(capacities))
 {
 }
 
@@ -330,7 +402,24 @@ CpuInfo CpuInfo::build()
     std::transform(std::begin(cpus_midr), std::end(cpus_midr), std::back_inserter(cpus_model),
                    [](uint32_t midr) -> CpuModel { return midr_to_model(midr); });
 
-    CpuInfo info(isa, cpus_model);
+    // Populate the data caches of each core, the sizes can be forced for environments hiding sysfs
+    const std::string         cache_sizes = utility::getenv("ARM_COMPUTE_CPU_CACHE_SIZES");
+    std::vector<CpuCacheInfo> caches;
+    for(uint32_t cpu = 0; cpu < cpus_model.size(); ++cpu)
+    {
+        CpuCacheInfo cache = init_cpu_cache_info_from_sysfs(cpu);
+        override_cpu_cache_info(cache, cache_sizes);
+        caches.emplace_back(cache);
+    }
+
+    // Populate the capacity of each core, the declared values take precedence over the ones exposed by the kernel
+    std::vector<uint32_t> capacities = capacities_from_env(utility::getenv("ARM_COMPUTE_CPU_CAPACITIES"), cpus_model.size());
+    if(capacities.empty())
+    {
+        capacities = capacities_from_sysfs(cpus_model.size());
+    }
+
+    CpuInfo info(isa, cpus_model, caches, capacities);
     return info;
 
 #elif(BARE_METAL) && defined(__aarch64__)        /* !defined(BARE_METAL) && !defined(__APPLE__) && !defined(__OpenBSD__) && (defined(__arm__) || defined(__aarch64__)) */
@@ -389,6 +478,34 @@ uint32_t CpuInfo::num_cpus() const
     return _cpus.size();
 }
 
+const CpuCacheInfo &CpuInfo::cache_info(uint32_t cpuid) const
+{
+    static const CpuCacheInfo unknown{};
+    if(cpuid < _caches.size())
+    {
+        return _caches[cpuid];
+    }
+    return unknown;
+}
+
+const CpuCacheInfo &CpuInfo::cache_info() const
+{
+#if defined(_WIN64) || defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__))
+    return cache_info(0);
+#else  /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
+    return cache_info(sched_getcpu());
+#endif /* defined(BARE_METAL) || defined(__APPLE__) || defined(__OpenBSD__) || (!defined(__arm__) && !defined(__aarch64__)) */
+}
+
+uint32_t CpuInfo::capacity(uint32_t cpuid) const
+{
+    if(cpuid < _capacities.size())
+    {
+        return _capacities[cpuid];
+    }
+    return model_default_capacity(cpu_model(cpuid));
+}
+
 uint32_t num_threads_hint()
 {
     unsigned int num_threads_hint = 1;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef SRC_COMMON_CPUINFO_H
 #define SRC_COMMON_CPUINFO_H
 
+#include "src/common/cpuinfo/CpuCacheInfo.h"
 #include "src/common/cpuinfo/CpuIsaInfo.h"
 #include "src/common/cpuinfo/CpuModel.h"
 
@@ -48,11 +49,18 @@ public:
     CpuInfo() = default;
     /** Construct a new Cpu Info object
      *
-     * @param[in] isa  ISA capabilities information
-     * @param[in] cpus CPU models information
+     * @param[in] isa    ISA capabilities information
+     * @param[in] cpus   CPU models information
+     * @param[in] caches     (Optional) Data caches of each CPU
+     * @param[in] capacities (Optional) Compute capacity of each CPU. If empty, it is estimated from the CPU models.
      */
-    CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus);
+    CpuInfo(CpuIsaInfo isa, std::vector<CpuModel> cpus, std::vector<CpuCacheInfo> caches = {}, std::vector<uint32_t> capacities = {});
     /** CpuInfo builder function from system related information
+     *
+     * The cache sizes read from the system can be overridden through the ARM_COMPUTE_CPU_CACHE_SIZES environment
+     * variable, e.g. ARM_COMPUTE_CPU_CACHE_SIZES="L1=64K,L2=1M,L3=32M", which is useful when sysfs is not available.
+     * Similarly, the capacity of each CPU can be declared through ARM_COMPUTE_CPU_CAPACITIES, e.g.
+     * ARM_COMPUTE_CPU_CAPACITIES="1024,1024,410,410,410,410".
      *
      * @return CpuInfo A populated CpuInfo structure
      */
@@ -117,13 +125,24 @@ public:
         return _cpus;
     }
 
-    CpuModel cpu_model(uint32_t cpuid) const;
-    CpuModel cpu_model() const;
-    uint32_t num_cpus() const;
+    CpuModel            cpu_model(uint32_t cpuid) const;
+    CpuModel            cpu_model() const;
+    uint32_t            num_cpus() const;
+    const CpuCacheInfo &cache_info(uint32_t cpuid) const;
+    const CpuCacheInfo &cache_info() const;
+    /** Compute capacity of a CPU, in the [1, 1024] range where 1024 is the capacity of the biggest cores of the system
+     *
+     * @param[in] cpuid Id of the CPU
+     *
+     * @return The capacity of the CPU
+     */
+    uint32_t capacity(uint32_t cpuid) const;
 
 private:
-    CpuIsaInfo            _isa{};
-    std::vector<CpuModel> _cpus{};
+    CpuIsaInfo                _isa{};
+    std::vector<CpuModel>     _cpus{};
+    std::vector<CpuCacheInfo> _caches{};
+    std::vector<uint32_t>     _capacities{};
 };
 
 /** Some systems have both big and small cores, this fuction computes the minimum number of cores
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,22 @@ bool model_supports_dot(CpuModel model)
     }
 }
 
+uint32_t model_default_capacity(CpuModel model)
+{
+    // In-order cores deliver roughly 40% of the throughput of the out-of-order cores they are paired with
+    switch(model)
+    {
+        case CpuModel::A53:
+        case CpuModel::A55r0:
+        case CpuModel::A55r1:
+        case CpuModel::A35:
+        case CpuModel::A510:
+            return 410;
+        default:
+            return 1024;
+    }
+}
+
 CpuModel midr_to_model(uint32_t midr)
 {
     CpuModel model = CpuModel::GENERIC;
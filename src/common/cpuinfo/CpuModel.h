@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -66,6 +66,16 @@ bool model_supports_fp16(CpuModel model);
  * @param[in] model Model to check for allowlisted capabilities
  */
 bool model_supports_dot(CpuModel model);
+
+/** Estimate the compute capacity of a model relatively to a big core
+ *
+ * @note This is used when the system does not expose the capacity of its cores.
+ *
+ * @param[in] model Model to estimate the capacity of
+ *
+ * @return The capacity of the model, in the [1, 1024] range where 1024 is the capacity of a big core
+ */
+uint32_t model_default_capacity(CpuModel model);
 } // namespace cpuinfo
 } // namespace arm_compute
 #endif /* SRC_COMMON_CPUINFO_CPUMODEL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,12 +33,28 @@ DataType convert_to_legacy_data_type(AclDataType data_type)
 {
     switch(data_type)
     {
+        case AclDataType::AclUInt8:
+            return DataType::U8;
+        case AclDataType::AclInt8:
+            return DataType::S8;
+        case AclDataType::AclUInt16:
+            return DataType::U16;
+        case AclDataType::AclInt16:
+            return DataType::S16;
+        case AclDataType::AclUint32:
+            return DataType::U32;
+        case AclDataType::AclInt32:
+            return DataType::S32;
         case AclDataType::AclFloat32:
             return DataType::F32;
         case AclDataType::AclFloat16:
             return DataType::F16;
         case AclDataType::AclBFloat16:
             return DataType::BFLOAT16;
+        case AclDataType::AclQAsymmUInt8:
+            return DataType::QASYMM8;
+        case AclDataType::AclQAsymmInt8:
+            return DataType::QASYMM8_SIGNED;
         default:
             return DataType::UNKNOWN;
     }
@@ -48,17 +64,51 @@ AclDataType convert_to_c_data_type(DataType data_type)
 {
     switch(data_type)
     {
+        case DataType::U8:
+            return AclDataType::AclUInt8;
+        case DataType::S8:
+            return AclDataType::AclInt8;
+        case DataType::U16:
+            return AclDataType::AclUInt16;
+        case DataType::S16:
+            return AclDataType::AclInt16;
+        case DataType::U32:
+            return AclDataType::AclUint32;
+        case DataType::S32:
+            return AclDataType::AclInt32;
         case DataType::F32:
             return AclDataType::AclFloat32;
         case DataType::F16:
             return AclDataType::AclFloat16;
         case DataType::BFLOAT16:
             return AclDataType::AclBFloat16;
+        case DataType::QASYMM8:
+            return AclDataType::AclQAsymmUInt8;
+        case DataType::QASYMM8_SIGNED:
+            return AclDataType::AclQAsymmInt8;
         default:
             return AclDataType::AclDataTypeUnknown;
     }
 }
 
+DataLayout convert_to_legacy_data_layout(AclDataLayout layout)
+{
+    return (layout == AclDataLayout::AclNhwc) ? DataLayout::NHWC : DataLayout::NCHW;
+}
+
+AclDataLayout convert_to_c_data_layout(DataLayout layout)
+{
+    switch(layout)
+    {
+        case DataLayout::NHWC:
+            return AclDataLayout::AclNhwc;
+        case DataLayout::NCHW:
+            return AclDataLayout::AclNchw;
+        default:
+            return AclDataLayout::AclDataLayoutUnknown;
+    }
+}
+
 TensorShape create_legacy_tensor_shape(int32_t ndims, int32_t *shape)
 {
     TensorShape legacy_shape{};
@@ -91,19 +141,28 @@ TensorInfo convert_to_legacy_tensor_info(const AclTensorDescriptor &desc)
 {
     TensorInfo legacy_desc;
     legacy_desc.init(create_legacy_tensor_shape(desc.ndims, desc.shape), 1, convert_to_legacy_data_type(desc.data_type));
+    legacy_desc.set_data_layout(convert_to_legacy_data_layout(desc.layout));
+    if(is_data_type_quantized(legacy_desc.data_type()))
+    {
+        legacy_desc.set_quantization_info(QuantizationInfo(desc.quant_scale, desc.quant_offset));
+    }
     return legacy_desc;
 }
 
 AclTensorDescriptor convert_to_descriptor(const TensorInfo &info)
 {
-    const auto          num_dims = info.num_dimensions();
-    AclTensorDescriptor desc
+    const auto                    num_dims = info.num_dimensions();
+    const UniformQuantizationInfo qinfo    = info.quantization_info().uniform();
+    AclTensorDescriptor           desc
     {
         static_cast<int32_t>(num_dims),
         create_tensor_shape_array(info),
         convert_to_c_data_type(info.data_type()),
         nullptr,
-        0
+        0,
+        convert_to_c_data_layout(info.data_layout()),
+        qinfo.scale,
+        qinfo.offset
     };
     return desc;
 }
@@ -161,5 +220,39 @@ ActivationLayerInfo convert_to_activation_info(const AclActivationDescriptor &de
 
     return ActivationLayerInfo(act, desc.a, desc.b);
 }
+
+PadStrideInfo convert_to_pad_stride_info(const AclPadStrideDescriptor &desc)
+{
+    return PadStrideInfo(desc.stride_x, desc.stride_y, desc.pad_left, desc.pad_right, desc.pad_top, desc.pad_bottom, DimensionRoundingType::FLOOR);
+}
+
+StatusCode convert_to_pooling_info(const AclPool2dDescriptor &desc, DataLayout layout, PoolingLayerInfo &info)
+{
+    PoolingType type;
+    switch(desc.type)
+    {
+        case AclPoolingType::AclMaxPooling:
+            type = PoolingType::MAX;
+            break;
+        case AclPoolingType::AclAvgPooling:
+            type = PoolingType::AVG;
+            break;
+        case AclPoolingType::AclL2Pooling:
+            type = PoolingType::L2;
+            break;
+        default:
+            return StatusCode::InvalidArgument;
+    }
+
+    if(desc.is_global)
+    {
+        info = PoolingLayerInfo(type, layout);
+    }
+    else
+    {
+        info = PoolingLayerInfo(type, Size2D(desc.pool_width, desc.pool_height), layout, convert_to_pad_stride_info(desc.pad_stride), desc.exclude_padding);
+    }
+    return StatusCode::Success;
+}
 } // namespace detail
 } // namespace arm_compute
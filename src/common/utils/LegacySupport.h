@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/Acl.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
+#include "src/common/Types.h"
 
 namespace arm_compute
 {
@@ -53,6 +54,22 @@ AclTensorDescriptor convert_to_descriptor(const TensorInfo &info);
  * @return Legacy tensor meta-data
  */
 ActivationLayerInfo convert_to_activation_info(const AclActivationDescriptor &desc);
+/** Convert an AclPadStride descriptor to an internal one
+ *
+ * @param[in] desc Descriptor to convert
+ *
+ * @return Legacy padding and strides
+ */
+PadStrideInfo convert_to_pad_stride_info(const AclPadStrideDescriptor &desc);
+/** Convert an AclPool2d descriptor to an internal one
+ *
+ * @param[in]  desc   Descriptor to convert
+ * @param[in]  layout Data layout of the source tensor
+ * @param[out] info   Legacy pooling meta-data
+ *
+ * @return StatusCode::InvalidArgument if the pooling type is unknown else StatusCode::Success
+ */
+StatusCode convert_to_pooling_info(const AclPool2dDescriptor &desc, DataLayout layout, PoolingLayerInfo &info);
 } // namespace detail
 } // namespace arm_compute
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -121,6 +121,11 @@ CPUModel CPUInfo::get_cpu_model(unsigned int cpuid) const
     return _impl->info.cpu_model(cpuid);
 }
 
+unsigned int CPUInfo::get_cpu_capacity(unsigned int cpuid) const
+{
+    return _impl->info.capacity(cpuid);
+}
+
 cpuinfo::CpuIsaInfo CPUInfo::get_isa() const
 {
     return _impl->info.isa();
@@ -128,11 +133,28 @@ cpuinfo::CpuIsaInfo CPUInfo::get_isa() const
 
 unsigned int CPUInfo::get_L1_cache_size() const
 {
-    return _impl->L1_cache_size;
+    const unsigned int size = _impl->info.cache_info().l1d.size;
+    return size != 0 ? size : _impl->L1_cache_size;
 }
 
 unsigned int CPUInfo::get_L2_cache_size() const
 {
-    return _impl->L2_cache_size;
+    const unsigned int size = _impl->info.cache_info().l2.size;
+    return size != 0 ? size : _impl->L2_cache_size;
+}
+
+unsigned int CPUInfo::get_L3_cache_size() const
+{
+    return _impl->info.cache_info().l3.size;
+}
+
+unsigned int CPUInfo::get_L2_cache_sharing() const
+{
+    return _impl->info.cache_info().l2.num_sharing_cpus;
+}
+
+unsigned int CPUInfo::get_L3_cache_sharing() const
+{
+    return _impl->info.cache_info().l3.num_sharing_cpus;
 }
 } // namespace arm_compute
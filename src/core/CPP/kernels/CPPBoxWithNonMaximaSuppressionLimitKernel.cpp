@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, 2022 Arm Limited.
+ * Copyright (c) 2018-2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "arm_compute/core/CPP/kernels/CPPBoxWithNonMaximaSuppressionLimitKernel.h"
 
 #include "arm_compute/core/Helpers.h"
+#include "src/core/helpers/NMSHelpers.h"
 #include "src/core/helpers/WindowHelpers.h"
 
 #include <algorithm>
@@ -118,68 +119,31 @@ std::vector<int> SoftNMS(const ITensor *proposals, std::vector<std::vector<T>> &
 }
 
 template <typename T>
-std::vector<int> NonMaximaSuppression(const ITensor *proposals, std::vector<int> sorted_indices, const BoxNMSLimitInfo &info, int class_id)
+std::vector<int> NonMaximaSuppression(const ITensor *proposals, const std::vector<int> &indices, const std::vector<T> &scores, const BoxNMSLimitInfo &info, int class_id)
 {
-    std::vector<int> keep;
-
-    const int proposals_width = proposals->info()->dimension(1);
-
-    std::vector<T> x1(proposals_width);
-    std::vector<T> y1(proposals_width);
-    std::vector<T> x2(proposals_width);
-    std::vector<T> y2(proposals_width);
-    std::vector<T> areas(proposals_width);
-
-    for(int i = 0; i < proposals_width; ++i)
+    nms_helpers::OverlapInfo overlap_info;
+    overlap_info.iou_threshold      = info.nms();
+    overlap_info.coord_offset       = 1.f;
+    overlap_info.ignore_empty_boxes = false;
+    overlap_info.suppress_size      = info.suppress_size();
+    overlap_info.min_size           = info.min_size();
+    overlap_info.im_width           = info.im_width();
+    overlap_info.im_height          = info.im_height();
+
+    std::vector<float> candidate_scores(indices.size());
+    for(unsigned int i = 0; i < indices.size(); ++i)
     {
-        x1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, i)));
-        y1[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, i)));
-        x2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, i)));
-        y2[i]    = *reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, i)));
-        areas[i] = (x2[i] - x1[i] + 1.0) * (y2[i] - y1[i] + 1.0);
+        candidate_scores[i] = static_cast<float>(scores[indices[i]]);
     }
 
-    while(!sorted_indices.empty())
+    return nms_helpers::greedy_nms(indices, candidate_scores, indices.size(), overlap_info,
+                                   [proposals, class_id](int idx, float & x1, float & y1, float & x2, float & y2)
     {
-        int i = sorted_indices.at(0);
-        keep.push_back(i);
-
-        std::vector<int> sorted_indices_temp = sorted_indices;
-        std::vector<int> new_indices;
-        sorted_indices_temp.erase(sorted_indices_temp.begin());
-
-        for(unsigned int j = 0; j < sorted_indices_temp.size(); ++j)
-        {
-            const float xx1 = std::max(x1[sorted_indices_temp.at(j)], x1[i]);
-            const float yy1 = std::max(y1[sorted_indices_temp.at(j)], y1[i]);
-            const float xx2 = std::min(x2[sorted_indices_temp.at(j)], x2[i]);
-            const float yy2 = std::min(y2[sorted_indices_temp.at(j)], y2[i]);
-
-            const float w     = std::max((xx2 - xx1 + 1.f), 0.f);
-            const float h     = std::max((yy2 - yy1 + 1.f), 0.f);
-            const float inter = w * h;
-            const float ovr   = inter / (areas[i] + areas[sorted_indices_temp.at(j)] - inter);
-            const float ctr_x = xx1 + (w / 2);
-            const float ctr_y = yy1 + (h / 2);
-
-            // If suppress_size is specified, filter the boxes based on their size and position
-            const bool keep_size = !info.suppress_size() || (w >= info.min_size() && h >= info.min_size() && ctr_x < info.im_width() && ctr_y < info.im_height());
-            if(ovr <= info.nms() && keep_size)
-            {
-                new_indices.push_back(j);
-            }
-        }
-
-        const unsigned int new_indices_size = new_indices.size();
-        std::vector<int>   new_sorted_indices(new_indices_size);
-        for(unsigned int i = 0; i < new_indices_size; ++i)
-        {
-            new_sorted_indices[i] = sorted_indices[new_indices[i] + 1];
-        }
-        sorted_indices = new_sorted_indices;
-    }
-
-    return keep;
+        x1 = static_cast<float>(*reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4, idx))));
+        y1 = static_cast<float>(*reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 1, idx))));
+        x2 = static_cast<float>(*reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 2, idx))));
+        y2 = static_cast<float>(*reinterpret_cast<T *>(proposals->ptr_to_element(Coordinates(class_id * 4 + 3, idx))));
+    });
 }
 } // namespace
 
@@ -238,13 +202,7 @@ void CPPBoxWithNonMaximaSuppressionLimitKernel::run_nmslimit()
             }
             else
             {
-                std::sort(inds.data(), inds.data() + inds.size(),
-                          [&cur_scores](int lhs, int rhs)
-                {
-                    return cur_scores[lhs] > cur_scores[rhs];
-                });
-
-                keeps[j] = NonMaximaSuppression<T>(_boxes_in, inds, _info, j);
+                keeps[j] = NonMaximaSuppression<T>(_boxes_in, inds, cur_scores, _info, j);
             }
             total_keep_count += keeps[j].size();
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020 Arm Limited.
+ * Copyright (c) 2019-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,10 +27,9 @@
 #include "arm_compute/core/Validate.h"
 
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/NMSHelpers.h"
 #include "src/core/helpers/WindowHelpers.h"
 
-#include <algorithm>
-
 namespace arm_compute
 {
 namespace
@@ -109,87 +108,25 @@ void CPPNonMaximumSuppressionKernel::run(const Window &window, const ThreadInfo
         }
     }
 
-    // Sort selected indices based on scores
-    const unsigned int        num_above_thd = indices_above_thd.size();
-    std::vector<unsigned int> sorted_indices;
-    sorted_indices.resize(num_above_thd);
-    std::iota(sorted_indices.data(), sorted_indices.data() + num_above_thd, 0);
-    std::sort(std::begin(sorted_indices),
-              std::end(sorted_indices),
-              [&](unsigned int first, unsigned int second)
+    // Box-corner format: xmin, ymin, xmax, ymax
+    nms_helpers::OverlapInfo overlap_info;
+    overlap_info.iou_threshold = _iou_threshold;
+
+    const std::vector<int> keep = nms_helpers::greedy_nms(indices_above_thd, scores_above_thd, _max_output_size, overlap_info,
+                                                          [this](int idx, float & xmin, float & ymin, float & xmax, float & ymax)
     {
-        return scores_above_thd[first] > scores_above_thd[second];
+        xmin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, idx))));
+        ymin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, idx))));
+        xmax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, idx))));
+        ymax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, idx))));
     });
 
-    // Number of output is the minimum between max_detection and the scores above the threshold
-    const unsigned int num_output = std::min(_max_output_size, num_above_thd);
-    unsigned int       output_idx = 0;
-    std::vector<bool>  visited(num_above_thd, false);
-
-    // Keep only boxes with small IoU
-    for(unsigned int i = 0; i < num_above_thd; ++i)
+    unsigned int output_idx = 0;
+    for(; output_idx < keep.size(); ++output_idx)
     {
-        // Check if the output is full
-        if(output_idx >= num_output)
-        {
-            break;
-        }
-
-        // Check if it was already visited, if not add it to the output and update the indices counter
-        if(!visited[sorted_indices[i]])
-        {
-            *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) = indices_above_thd[sorted_indices[i]];
-            visited[sorted_indices[i]]                                                           = true;
-            ++output_idx;
-        }
-        else
-        {
-            continue;
-        }
-
-        // Once added one element at the output check if the next ones overlap and can be skipped
-        for(unsigned int j = i + 1; j < num_above_thd; ++j)
-        {
-            if(!visited[sorted_indices[j]])
-            {
-                // Calculate IoU
-                const unsigned int i_index = indices_above_thd[sorted_indices[i]];
-                const unsigned int j_index = indices_above_thd[sorted_indices[j]];
-                // Box-corner format: xmin, ymin, xmax, ymax
-                const auto box_i_xmin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, i_index))));
-                const auto box_i_ymin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, i_index))));
-                const auto box_i_xmax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, i_index))));
-                const auto box_i_ymax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, i_index))));
-
-                const auto box_j_xmin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(0, j_index))));
-                const auto box_j_ymin = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(1, j_index))));
-                const auto box_j_xmax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(2, j_index))));
-                const auto box_j_ymax = *(reinterpret_cast<float *>(_input_bboxes->ptr_to_element(Coordinates(3, j_index))));
-
-                const float area_i = (box_i_xmax - box_i_xmin) * (box_i_ymax - box_i_ymin);
-                const float area_j = (box_j_xmax - box_j_xmin) * (box_j_ymax - box_j_ymin);
-                float       overlap;
-                if(area_i <= 0 || area_j <= 0)
-                {
-                    overlap = 0.0f;
-                }
-                else
-                {
-                    const auto y_min_intersection = std::max<float>(box_i_ymin, box_j_ymin);
-                    const auto x_min_intersection = std::max<float>(box_i_xmin, box_j_xmin);
-                    const auto y_max_intersection = std::min<float>(box_i_ymax, box_j_ymax);
-                    const auto x_max_intersection = std::min<float>(box_i_xmax, box_j_xmax);
-                    const auto area_intersection  = std::max<float>(y_max_intersection - y_min_intersection, 0.0f) * std::max<float>(x_max_intersection - x_min_intersection, 0.0f);
-                    overlap                       = area_intersection / (area_i + area_j - area_intersection);
-                }
-
-                if(overlap > _iou_threshold)
-                {
-                    visited[sorted_indices[j]] = true;
-                }
-            }
-        }
+        *(reinterpret_cast<int *>(_output_indices->ptr_to_element(Coordinates(output_idx)))) = keep[output_idx];
     }
+
     // The output could be full but not the output indices tensor
     // Instead return values not valid we put -1
     for(; output_idx < _max_output_size; ++output_idx)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Arm Limited.
+ * Copyright (c) 2019-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -78,7 +78,11 @@ void NEPadLayerKernel::run_pad_constant(const Window &window)
         T *input_it_ptr  = reinterpret_cast<T *>(_input->ptr_to_element(idin));
         T *output_it_ptr = reinterpret_cast<T *>(output_it.ptr());
         std::fill_n(output_it_ptr, _padding[0].first, _constant_value.get<T>());
-        memcpy(output_it_ptr + _padding[0].first, input_it_ptr, _input->info()->dimension(0) * element_size);
+        // The input may already be in place when it is a sub-tensor of the interior of the output
+        if(input_it_ptr != output_it_ptr + _padding[0].first)
+        {
+            memcpy(output_it_ptr + _padding[0].first, input_it_ptr, _input->info()->dimension(0) * element_size);
+        }
         std::fill_n(output_it_ptr + _padding[0].first + _input->info()->dimension(0), _padding[0].second, _constant_value.get<T>());
     },
     output_it);
@@ -205,9 +209,10 @@ void NEPadLayerKernel::configure(ITensor *input, ITensor *output, const PaddingL
         switch(_input->info()->element_size())
         {
             case 1:
-                if(_input->info()->num_dimensions() == 3 &&                           // Is 3D
-                   padding.size() <= 3 &&                                             // Has 3D padding
-                   !_input->info()->has_padding() && !_output->info()->has_padding()) // Input & Output have no padding
+                if(_input->info()->num_dimensions() == 3 &&                                                                      // Is 3D
+                   padding.size() <= 3 &&                                                                                        // Has 3D padding
+                   !_input->info()->has_padding() && !_output->info()->has_padding() &&                                          // Input & Output have no padding
+                   _input->info()->total_size() == _input->info()->tensor_shape().total_size() * _input->info()->element_size()) // Input is not a sub-tensor
                 {
                     _func = &NEPadLayerKernel::run_pad_constant_uint8_3Dinput_3Dpad;
                 }
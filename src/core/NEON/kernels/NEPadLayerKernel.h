@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -52,6 +52,8 @@ public:
     ~NEPadLayerKernel() = default;
 
     /** Initialize the function
+     *
+     * @note @p input can be a sub-tensor of @p output placed at the front padding, in which case only the padding is written.
      *
      * @param[in]  input          Source tensor. Data types supported: All.
      * @param[out] output         Output tensor. Data type supported: same as @p input
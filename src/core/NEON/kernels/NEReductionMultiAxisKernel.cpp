@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/NEON/kernels/NEReductionMultiAxisKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace
+{
+constexpr size_t max_reduction_dims = 4;
+
+inline float horizontal_add(float32x4_t v)
+{
+#if defined(__aarch64__)
+    return vaddvq_f32(v);
+#else  // defined(__aarch64__)
+    const float32x2_t tmp = vpadd_f32(vget_low_f32(v), vget_high_f32(v));
+    return vget_lane_f32(vpadd_f32(tmp, tmp), 0);
+#endif // defined(__aarch64__)
+}
+
+template <typename T>
+inline float32x4_t load_as_f32(const T *ptr);
+
+template <>
+inline float32x4_t load_as_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+template <>
+inline float32x4_t load_as_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+
+unsigned int compute_reduced_mask(const Coordinates &axes, size_t num_dims)
+{
+    Coordinates axes_local = axes;
+    convert_negative_axis(axes_local, static_cast<int>(num_dims));
+
+    unsigned int mask = 0;
+    for(unsigned int i = 0; i < axes_local.num_dimensions(); ++i)
+    {
+        mask |= (1U << axes_local[i]);
+    }
+    return mask;
+}
+
+inline bool is_reduced(unsigned int mask, size_t dim)
+{
+    return (mask & (1U << dim)) != 0;
+}
+
+/** Outermost reduced dimension in [1, 3] or 0 if there is none */
+size_t outermost_reduced_dim(unsigned int mask)
+{
+    for(size_t d = max_reduction_dims - 1; d > 0; --d)
+    {
+        if(is_reduced(mask, d))
+        {
+            return d;
+        }
+    }
+    return 0;
+}
+
+TensorShape compute_kept_shape(const TensorShape &input_shape, unsigned int mask)
+{
+    TensorShape kept_shape = input_shape;
+    for(size_t d = 0; d < max_reduction_dims; ++d)
+    {
+        if(is_reduced(mask, d))
+        {
+            kept_shape.set(d, 1);
+        }
+    }
+    return kept_shape;
+}
+
+TensorShape compute_output_shape(const TensorShape &input_shape, unsigned int mask, bool keep_dims)
+{
+    TensorShape out_shape = compute_kept_shape(input_shape, mask);
+    if(!keep_dims)
+    {
+        for(int d = max_reduction_dims - 1; d >= 0; --d)
+        {
+            if(is_reduced(mask, d))
+            {
+                out_shape.remove_dimension(d);
+            }
+        }
+    }
+    return out_shape;
+}
+
+/** Strides to address the output tensor with coordinates of the kept shape */
+Strides compute_output_strides(const ITensorInfo &output, unsigned int mask, bool keep_dims)
+{
+    Strides strides;
+    size_t  num_removed = 0;
+    for(size_t d = 0; d < max_reduction_dims; ++d)
+    {
+        if(is_reduced(mask, d))
+        {
+            strides.set(d, 0);
+            ++num_removed;
+        }
+        else
+        {
+            strides.set(d, output.strides_in_bytes()[keep_dims ? d : d - num_removed]);
+        }
+    }
+    return strides;
+}
+
+/** Accumulate into @p sum all the input rows reduced into the output row at @p out_coord
+ *
+ * The range [ @p begin, @p end ) restricts the iterations of the dimension @p split_axis.
+ */
+template <typename T>
+void accumulate_rows(const ITensor *input, const Coordinates &out_coord, unsigned int mask, size_t split_axis, size_t begin, size_t end, float *sum)
+{
+    const ITensorInfo &info    = *input->info();
+    const Strides     &strides = info.strides_in_bytes();
+    const int          width   = static_cast<int>(info.dimension(0));
+    const bool         reduce_x = is_reduced(mask, 0);
+
+    size_t starts[max_reduction_dims];
+    size_t ends[max_reduction_dims];
+    for(size_t d = 1; d < max_reduction_dims; ++d)
+    {
+        if(is_reduced(mask, d))
+        {
+            starts[d] = (d == split_axis) ? begin : 0;
+            ends[d]   = (d == split_axis) ? end : info.dimension(d);
+        }
+        else
+        {
+            starts[d] = out_coord[d];
+            ends[d]   = out_coord[d] + 1;
+        }
+    }
+
+    const uint8_t *base = input->buffer() + info.offset_first_element_in_bytes();
+
+    float32x4_t vsum     = vdupq_n_f32(0.f);
+    float       tail_sum = 0.f;
+
+    for(size_t w = starts[3]; w < ends[3]; ++w)
+    {
+        for(size_t z = starts[2]; z < ends[2]; ++z)
+        {
+            for(size_t y = starts[1]; y < ends[1]; ++y)
+            {
+                const auto row = reinterpret_cast<const T *>(base + y * strides[1] + z * strides[2] + w * strides[3]);
+
+                int x = 0;
+                if(reduce_x)
+                {
+                    for(; x <= (width - 4); x += 4)
+                    {
+                        vsum = vaddq_f32(vsum, load_as_f32(row + x));
+                    }
+                    for(; x < width; ++x)
+                    {
+                        tail_sum += static_cast<float>(row[x]);
+                    }
+                }
+                else
+                {
+                    for(; x <= (width - 4); x += 4)
+                    {
+                        vst1q_f32(sum + x, vaddq_f32(vld1q_f32(sum + x), load_as_f32(row + x)));
+                    }
+                    for(; x < width; ++x)
+                    {
+                        sum[x] += static_cast<float>(row[x]);
+                    }
+                }
+            }
+        }
+    }
+
+    if(reduce_x)
+    {
+        sum[0] += horizontal_add(vsum) + tail_sum;
+    }
+}
+
+/** Turn the sums of one output row into means and store them */
+template <typename T>
+void store_row(float num_reduced, size_t row_width, const float *sum, uint8_t *out_ptr)
+{
+    const float inv_num_reduced = 1.f / num_reduced;
+    auto        out             = reinterpret_cast<T *>(out_ptr);
+    for(size_t x = 0; x < row_width; ++x)
+    {
+        out[x] = static_cast<T>(sum[x] * inv_num_reduced);
+    }
+}
+
+/** Iterate over all the output rows covered by the dimensions 1 to 3 of @p window */
+template <typename F>
+void for_each_output_row(const Window &window, F &&func)
+{
+    Coordinates coord;
+    for(int w = window[3].start(); w < window[3].end(); ++w)
+    {
+        for(int z = window[2].start(); z < window[2].end(); ++z)
+        {
+            for(int y = window[1].start(); y < window[1].end(); ++y)
+            {
+                coord.set(0, 0);
+                coord.set(1, y);
+                coord.set(2, z);
+                coord.set(3, w);
+                func(coord);
+            }
+        }
+    }
+}
+
+Status validate_arguments(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &axes, bool keep_dims, unsigned int num_chunks, const ITensorInfo *partials)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(input, output);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(input);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_RETURN_ERROR_ON(input->num_dimensions() > max_reduction_dims);
+    ARM_COMPUTE_RETURN_ERROR_ON(axes.num_dimensions() < 1);
+
+    const int num_dims = static_cast<int>(input->num_dimensions());
+    for(unsigned int i = 0; i < axes.num_dimensions(); ++i)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(axes[i] < -num_dims || axes[i] >= num_dims);
+        for(unsigned int j = 0; j < i; ++j)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MSG((axes[i] + num_dims) % num_dims == (axes[j] + num_dims) % num_dims, "Duplicated reduction axis");
+        }
+    }
+
+    const unsigned int mask = compute_reduced_mask(axes, input->num_dimensions());
+    if(num_chunks > 1)
+    {
+        const size_t split_axis = outermost_reduced_dim(mask);
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(split_axis == 0, "Splitting requires a reduced dimension other than 0");
+        ARM_COMPUTE_RETURN_ERROR_ON(num_chunks > input->dimension(split_axis));
+        ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(partials);
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(partials, 1, DataType::F32);
+        if(partials->total_size() != 0)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(partials->tensor_shape(),
+                                                               NEReductionMultiAxisKernel::partials_shape(input, axes, num_chunks));
+        }
+    }
+
+    const TensorShape out_shape = compute_output_shape(input->tensor_shape(), mask, keep_dims);
+    if(output->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(output->tensor_shape(), out_shape);
+    }
+
+    return Status{};
+}
+} // namespace
+
+NEReductionMultiAxisKernel::NEReductionMultiAxisKernel()
+    : _input(nullptr), _output(nullptr), _partials(nullptr), _reduced_mask(0), _num_chunks(1), _split_axis(0), _split_dimension(Window::DimY), _num_reduced(1.f), _out_strides()
+{
+}
+
+void NEReductionMultiAxisKernel::configure(const ITensor *input, ITensor *output, const Coordinates &axes, bool keep_dims, unsigned int num_chunks, ITensor *partials)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(input, output);
+
+    const unsigned int mask      = compute_reduced_mask(axes, input->info()->num_dimensions());
+    const TensorShape  out_shape = compute_output_shape(input->info()->tensor_shape(), mask, keep_dims);
+    auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(out_shape).reset_padding().set_is_resizable(true));
+    if(partials != nullptr)
+    {
+        auto_init_if_empty(*partials->info(), TensorInfo(partials_shape(input->info(), axes, num_chunks), 1, DataType::F32));
+    }
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(input->info(), output->info(), axes, keep_dims, num_chunks, partials != nullptr ? partials->info() : nullptr));
+
+    _input        = input;
+    _output       = output;
+    _partials     = partials;
+    _reduced_mask = mask;
+    _num_chunks   = num_chunks;
+    _split_axis   = outermost_reduced_dim(mask);
+    _out_strides  = compute_output_strides(*output->info(), mask, keep_dims);
+
+    const TensorShape &in_shape = input->info()->tensor_shape();
+    _num_reduced                = 1.f;
+    for(size_t d = 0; d < max_reduction_dims; ++d)
+    {
+        if(is_reduced(mask, d))
+        {
+            _num_reduced *= static_cast<float>(in_shape[d]);
+        }
+    }
+
+    // Configure kernel window
+    Window win;
+    if(_num_chunks > 1)
+    {
+        // One window iteration per chunk of the split dimension
+        win.set(Window::DimX, Window::Dimension(0, _num_chunks, 1));
+        _split_dimension = Window::DimX;
+    }
+    else
+    {
+        // One window iteration per output row, the X dimension is always processed as a whole
+        const TensorShape kept_shape = compute_kept_shape(in_shape, mask);
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        _split_dimension = Window::DimY;
+        for(size_t d = 1; d < max_reduction_dims; ++d)
+        {
+            win.set(d, Window::Dimension(0, kept_shape[d], 1));
+            if(kept_shape[d] > kept_shape[_split_dimension])
+            {
+                _split_dimension = d;
+            }
+        }
+    }
+    INEKernel::configure(win);
+}
+
+Status NEReductionMultiAxisKernel::validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &axes, bool keep_dims, unsigned int num_chunks,
+                                            const ITensorInfo *partials)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(input, output, axes, keep_dims, num_chunks, partials));
+    return Status{};
+}
+
+TensorShape NEReductionMultiAxisKernel::partials_shape(const ITensorInfo *input, const Coordinates &axes, unsigned int num_chunks)
+{
+    const unsigned int mask       = compute_reduced_mask(axes, input->num_dimensions());
+    const TensorShape  kept_shape = compute_kept_shape(input->tensor_shape(), mask);
+    return TensorShape(kept_shape.total_size(), num_chunks);
+}
+
+size_t NEReductionMultiAxisKernel::split_dimension() const
+{
+    return _split_dimension;
+}
+
+void NEReductionMultiAxisKernel::run(const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t row_width = is_reduced(_reduced_mask, 0) ? 1 : _input->info()->dimension(0);
+
+    std::vector<float> sum(row_width);
+
+    auto accumulate = [&](const Coordinates & out_coord, size_t begin, size_t end)
+    {
+        std::fill(sum.begin(), sum.end(), 0.f);
+        switch(_input->info()->data_type())
+        {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+            case DataType::F16:
+                accumulate_rows<float16_t>(_input, out_coord, _reduced_mask, _split_axis, begin, end, sum.data());
+                break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+            case DataType::F32:
+                accumulate_rows<float>(_input, out_coord, _reduced_mask, _split_axis, begin, end, sum.data());
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported");
+        }
+    };
+
+    if(_num_chunks > 1)
+    {
+        // Write the sums of each chunk of the split dimension into its own row of the workspace
+        const size_t split_size = _input->info()->dimension(_split_axis);
+        const Window full_window(compute_output_window());
+
+        for(int c = window.x().start(); c < window.x().end(); ++c)
+        {
+            const size_t begin   = (split_size * c) / _num_chunks;
+            const size_t end     = (split_size * (c + 1)) / _num_chunks;
+            auto         partial = reinterpret_cast<float *>(_partials->ptr_to_element(Coordinates(0, c)));
+            for_each_output_row(full_window, [&](const Coordinates & out_coord)
+            {
+                accumulate(out_coord, begin, end);
+                partial = std::copy(sum.begin(), sum.end(), partial);
+            });
+        }
+        return;
+    }
+
+    const size_t split_size = _input->info()->dimension(_split_axis);
+    for_each_output_row(window, [&](const Coordinates & out_coord)
+    {
+        accumulate(out_coord, 0, split_size);
+        store(out_coord, sum.data());
+    });
+}
+
+void NEReductionMultiAxisKernel::combine_partials()
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON(_num_chunks <= 1);
+
+    const size_t row_width = is_reduced(_reduced_mask, 0) ? 1 : _input->info()->dimension(0);
+
+    std::vector<float> sum(row_width);
+
+    size_t offset = 0;
+    for_each_output_row(compute_output_window(), [&](const Coordinates & out_coord)
+    {
+        std::fill(sum.begin(), sum.end(), 0.f);
+        for(unsigned int c = 0; c < _num_chunks; ++c)
+        {
+            const auto partial = reinterpret_cast<const float *>(_partials->ptr_to_element(Coordinates(0, c))) + offset;
+            for(size_t x = 0; x < row_width; ++x)
+            {
+                sum[x] += partial[x];
+            }
+        }
+        offset += row_width;
+        store(out_coord, sum.data());
+    });
+}
+
+Window NEReductionMultiAxisKernel::compute_output_window() const
+{
+    const TensorShape kept_shape = compute_kept_shape(_input->info()->tensor_shape(), _reduced_mask);
+    Window            win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    for(size_t d = 1; d < max_reduction_dims; ++d)
+    {
+        win.set(d, Window::Dimension(0, kept_shape[d], 1));
+    }
+    return win;
+}
+
+void NEReductionMultiAxisKernel::store(const Coordinates &out_coord, const float *sum)
+{
+    const size_t row_width = is_reduced(_reduced_mask, 0) ? 1 : _input->info()->dimension(0);
+
+    size_t out_offset = _output->info()->offset_first_element_in_bytes();
+    for(size_t d = 1; d < max_reduction_dims; ++d)
+    {
+        out_offset += out_coord[d] * _out_strides[d];
+    }
+
+    uint8_t *out_ptr = _output->buffer() + out_offset;
+    switch(_input->info()->data_type())
+    {
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F16:
+            store_row<float16_t>(_num_reduced, row_width, sum, out_ptr);
+            break;
+#endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+        case DataType::F32:
+            store_row<float>(_num_reduced, row_width, sum, out_ptr);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Not supported");
+    }
+}
+} // namespace arm_compute
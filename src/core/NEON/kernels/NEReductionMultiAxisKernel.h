@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_NEREDUCTIONMULTIAXISKERNEL_H
+#define ARM_COMPUTE_NEREDUCTIONMULTIAXISKERNEL_H
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Strides.h"
+#include "src/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kernel to compute the mean of a tensor over an arbitrary set of axes in a single pass
+ *
+ * Every input element is read once and accumulated in fp32.
+ *
+ * When the output is too small to keep all the threads busy, the reduction can be split along the outermost
+ * reduced dimension: each window then writes the partial accumulators of one chunk into a workspace tensor
+ * and @ref NEReductionMultiAxisKernel::combine_partials must be called once all the windows have been run.
+ */
+class NEReductionMultiAxisKernel : public INEKernel
+{
+public:
+    const char *name() const override
+    {
+        return "NEReductionMultiAxisKernel";
+    }
+    /** Default constructor */
+    NEReductionMultiAxisKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReductionMultiAxisKernel(const NEReductionMultiAxisKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEReductionMultiAxisKernel &operator=(const NEReductionMultiAxisKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEReductionMultiAxisKernel(NEReductionMultiAxisKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEReductionMultiAxisKernel &operator=(NEReductionMultiAxisKernel &&) = default;
+    /** Default destructor */
+    ~NEReductionMultiAxisKernel() = default;
+
+    /** Set the source, destination of the kernel
+     *
+     * @param[in]  input      Source tensor. Data type supported: F16/F32.
+     * @param[out] output     Destination tensor. Data type supported: same as @p input.
+     * @param[in]  axes       Axes along which to reduce. Supported axes: 0-3, negative values are wrapped around.
+     * @param[in]  keep_dims  If true, @p output retains the reduced dimensions with length 1.
+     * @param[in]  num_chunks (Optional) Number of chunks in which the outermost reduced dimension is split. 1 disables the split.
+     * @param[in]  partials   (Optional) Workspace holding the partial accumulators when @p num_chunks is greater than 1. Data type supported: F32.
+     *                        Its shape must be the one returned by @ref NEReductionMultiAxisKernel::partials_shape.
+     */
+    void configure(const ITensor *input, ITensor *output, const Coordinates &axes, bool keep_dims, unsigned int num_chunks = 1, ITensor *partials = nullptr);
+
+    /** Static function to check if given info will lead to a valid configuration of @ref NEReductionMultiAxisKernel.
+     *
+     * @param[in] input      Source tensor info. Data type supported: F16/F32.
+     * @param[in] output     Destination tensor info. Data type supported: same as @p input.
+     * @param[in] axes       Axes along which to reduce. Supported axes: 0-3, negative values are wrapped around.
+     * @param[in] keep_dims  If true, @p output retains the reduced dimensions with length 1.
+     * @param[in] num_chunks (Optional) Number of chunks in which the outermost reduced dimension is split. 1 disables the split.
+     * @param[in] partials   (Optional) Workspace info. Data type supported: F32.
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *input, const ITensorInfo *output, const Coordinates &axes, bool keep_dims, unsigned int num_chunks = 1,
+                           const ITensorInfo *partials = nullptr);
+
+    /** Compute the shape of the partial accumulators workspace
+     *
+     * @param[in] input      Source tensor info.
+     * @param[in] axes       Axes along which to reduce.
+     * @param[in] num_chunks Number of chunks in which the outermost reduced dimension is split.
+     *
+     * @return the shape of the workspace
+     */
+    static TensorShape partials_shape(const ITensorInfo *input, const Coordinates &axes, unsigned int num_chunks);
+
+    /** Accumulate the partial results of all the chunks into the output
+     *
+     * @note Only needed when the kernel has been configured with more than one chunk, after all its windows have been run.
+     */
+    void combine_partials();
+
+    /** Dimension along which the kernel window should be split by the scheduler
+     *
+     * @return the split dimension
+     */
+    size_t split_dimension() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, const ThreadInfo &info) override;
+
+private:
+    /** Window covering all the output rows, ignoring the chunks */
+    Window compute_output_window() const;
+    /** Turn the sums of the output row at @p out_coord into means and store them */
+    void store(const Coordinates &out_coord, const float *sum);
+
+    const ITensor *_input;
+    ITensor       *_output;
+    ITensor       *_partials;
+    unsigned int   _reduced_mask;
+    unsigned int   _num_chunks;
+    size_t         _split_axis;
+    size_t         _split_dimension;
+    float          _num_reduced;
+    Strides        _out_strides;
+};
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_NEREDUCTIONMULTIAXISKERNEL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -615,6 +615,22 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
         k_block /= strategy::k_unroll();
         k_block = std::max(k_block, 1U) * strategy::k_unroll();
 
+        // In 1D mode each thread re-reads its interleaved A panel (all of its rows, k_block deep) once per x block.
+        // If the last level cache is known, keep that panel within half of this thread's share of it so the
+        // re-reads do not go to DRAM, as long as this does not make the blocks too shallow.
+        const unsigned int nthreads = std::max(args._maxthreads, 1);
+        const unsigned int L3_share = get_L3_share(args._ci, nthreads);
+        if (L3_share > 0 && !is_thread_columns(args)) {
+            const unsigned int m_rows      = roundup(args._Msize, strategy::out_height()) * args._nbatches * args._nmulti;
+            const unsigned int thread_rows = std::max(iceildiv(m_rows, nthreads), strategy::out_height());
+            const unsigned int l3_k_block  = (L3_share / 2) / (sizeof(Toi) * thread_rows);
+            const unsigned int min_k_block = roundup(64u, strategy::k_unroll());
+
+            if (l3_k_block < k_block) {
+                k_block = std::max(roundup(l3_k_block, strategy::k_unroll()), min_k_block);
+            }
+        }
+
         // Now tune to presented problem size; this is how many blocks we need.
         unsigned int num_k_blocks = iceildiv(get_ktotal(args), k_block);
 
@@ -640,7 +656,7 @@ class GemmInterleaved : public GemmCommon<To, Tr> {
         }
 
         unsigned int x_block;
-        const unsigned int L2_size = args._ci->get_L2_cache_size();
+        const unsigned int L2_size = get_L2_share(args._ci, std::max(args._maxthreads, 1));
         const unsigned int k_block = get_k_block_size(args);
 
         // x_block: Work out how many rows (of length k_block) will fit in the L2
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -358,15 +358,18 @@ public:
     {
         assert(_maxthreads > 0);
 
-        const unsigned int L2_size = _ci->get_L2_cache_size();
+        const unsigned int L2_size = get_L2_share(_ci, _maxthreads);
 
         if (args._cfg && args._cfg->outer_block_size) {
             _x_block = args._cfg->outer_block_size;
         } else {
             // x_block: Work out how many rows (of length k_block) will fit in the L2
             // Don't allocate more than 90% of the L2 to allow for overheads, and subtract off the L1 contents.
-            _x_block = (((L2_size * 9) / 10) - (_k_block * sizeof(Toi) * (strategy::out_width() + strategy::out_height()))) /
-                      (sizeof(Toi) * _k_block);
+            const unsigned int scaled_l2_size = (L2_size * 9) / 10;
+            const unsigned int k_block_area   = _k_block * sizeof(Toi) * (strategy::out_width() + strategy::out_height());
+
+            // .. if the L1 contents is bigger than the L2 share, just use a minimal size block.
+            _x_block = (k_block_area < scaled_l2_size) ? (scaled_l2_size - k_block_area) / (sizeof(Toi) * _k_block) : 0;
 
             // Needs to be (at least a single) multiple of the kernel output width.
             _x_block /= strategy::out_width();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,9 @@
 
 #include <stdio.h>
 
+#include <atomic>
+#include <memory>
+
 #include "arm_gemm.hpp"
 #include "bias_adder.hpp"
 #include "mergeresults.hpp"
@@ -84,11 +87,21 @@ void run_gemv_kernel<Requantize32>::run(
 // This is implementation is for GEMV with pretransposition.
 //
 // batches are not supported as a batched GEMV makes no sense (can be converted to a GEMM).
+//
+// When there are fewer output blocks than threads, K is also split across
+// the window: each window item then computes the partial result of one K
+// chunk into the working space and the last chunk of each output block to
+// complete sums the partials and applies bias and activation.  Window items
+// for the same output block are adjacent, so each thread streams through a
+// contiguous region of the pretransposed buffer.
 template<typename strategy, typename To, typename Tr, typename OutputStage=Nothing>
 class GemvPretransposed : public GemmCommon<To, Tr> {
     typedef typename strategy::operand_type Toi;
     typedef typename strategy::result_type Tri;
 
+    // Minimum number of K iterations per chunk when splitting K.
+    static constexpr unsigned int min_k_per_split = 256;
+
     const GemmArgs     _args;
 
     const unsigned int _buffer_per_multi;
@@ -96,10 +109,96 @@ class GemvPretransposed : public GemmCommon<To, Tr> {
     unsigned int k_block=0;
     unsigned int n_block=0;
 
+    // K splitting: number of K chunks per output block and their size.
+    unsigned int _k_splits=1;
+    unsigned int _k_chunk=0;
+
+    // One counter per output block, tracking how many of its K chunks are complete.
+    std::unique_ptr<std::atomic<unsigned int>[]> _chunks_done{};
+
+    // Partial results of the K chunks.
+    Tri *_partials = nullptr;
+
     const Toi *_B_pretransposed = nullptr;
 
     OutputStage _os;
 
+    unsigned int get_n_blocks_per_multi() const {
+        return iceildiv(_args._Nsize, strategy::out_width());
+    }
+
+    // Decide whether K should be split.  Only done for the non-quantized case
+    // without user blocking, when the output blocks alone can't feed all the threads.
+    void configure_k_split() {
+        const unsigned int n_blocks = get_n_blocks_per_multi() * _args._nmulti;
+
+        if (!std::is_same<OutputStage, Nothing>::value || (_args._cfg && (_args._cfg->inner_block_size || _args._cfg->outer_block_size)) ||
+            _args._maxthreads <= 1 || n_blocks >= static_cast<unsigned int>(_args._maxthreads)) {
+            return;
+        }
+
+        const unsigned int max_splits = std::min(iceildiv(static_cast<unsigned int>(_args._maxthreads), n_blocks), _args._Ksize / min_k_per_split);
+
+        if (max_splits <= 1) {
+            return;
+        }
+
+        // Chunks must start on a k_unroll boundary; recompute the number of chunks so that none is empty.
+        _k_chunk  = roundup(iceildiv(_args._Ksize, max_splits), strategy::k_unroll());
+        _k_splits = iceildiv(_args._Ksize, _k_chunk);
+
+        if (_k_splits > 1) {
+            _chunks_done.reset(new std::atomic<unsigned int>[n_blocks]);
+            for (unsigned int i=0; i<n_blocks; i++) {
+                _chunks_done[i].store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Compute the partial result of K chunk 'kc' for output block 'nb' of 'multi' and
+    // reduce the block if this was its last chunk to complete.
+    void execute_k_chunk(const strategy &strat, unsigned int multi, unsigned int nb, unsigned int kc) {
+        const unsigned int n    = nb * strategy::out_width();
+        const unsigned int nmax = std::min(n + strategy::out_width(), _args._Nsize);
+        const unsigned int k0   = kc * _k_chunk;
+        const unsigned int kmax = std::min(k0 + _k_chunk, _args._Ksize);
+
+        const unsigned int partial_stride = roundup(_args._Nsize, strategy::out_width());
+        Tri *partials = _partials + (multi * _k_splits * partial_stride);
+
+        run_gemv_kernel<OutputStage>::run(strat, this->_Aptr + (multi * this->_A_multi_stride) + k0,
+                     _B_pretransposed + (multi * _buffer_per_multi) + (n * roundup(_args._Ksize, strategy::k_unroll())) + (k0 * strategy::out_width()),
+                     partials + (kc * partial_stride) + n,
+                     (nmax - n), (kmax - k0),
+                     static_cast<const Tr *>(nullptr), Activation(), false,
+                     _os, col_bias, n + (_args._Nsize * multi));
+
+        std::atomic<unsigned int> &chunks_done = _chunks_done[(multi * get_n_blocks_per_multi()) + nb];
+
+        if ((chunks_done.fetch_add(1, std::memory_order_acq_rel) + 1) != _k_splits) {
+            return;
+        }
+
+        Tr *out = this->_Cptr + (multi * this->_C_multi_stride) + n;
+
+        for (unsigned int x=n; x<nmax; x++) {
+            Tri acc = partials[x];
+            for (unsigned int c=1; c<_k_splits; c++) {
+                acc += partials[(c * partial_stride) + x];
+            }
+            out[x - n] = acc;
+        }
+
+        if (this->_bias) {
+            activator<true>(out, 0, this->_bias + (multi * this->_bias_multi_stride) + n, _args._act, 1, (nmax - n));
+        } else {
+            activator<false>(out, 0, static_cast<const Tr *>(nullptr), _args._act, 1, (nmax - n));
+        }
+
+        // All the chunks of this block are complete, so nobody else touches the counter until the next run.
+        chunks_done.store(0, std::memory_order_relaxed);
+    }
+
     // Pointer to the column sums (for quantized cases)
     int32_t *col_bias = nullptr;
 
@@ -132,11 +231,25 @@ public:
         } else {
             n_block = args._Nsize;
         }
+
+        configure_k_split();
     }
 
-    // Window is number of out_width blocks, times number of multis.
+    // Window is number of out_width blocks, times number of multis, times number of K chunks.
     ndrange_t get_window_size() const override {
-        return { iceildiv(_args._Nsize, strategy::out_width()) * _args._nmulti };
+        return { get_n_blocks_per_multi() * _args._nmulti * _k_splits };
+    }
+
+    size_t get_working_size() const override {
+        if (_k_splits <= 1) {
+            return 0;
+        }
+
+        return roundup(_args._Nsize, strategy::out_width()) * _k_splits * _args._nmulti * sizeof(Tri);
+    }
+
+    void set_working_space(void *buffer) override {
+        _partials = reinterpret_cast<Tri *>(buffer);
     }
 
     // Actually execute the GEMV.
@@ -149,6 +262,23 @@ public:
         const auto start = work_range.get_position(0);
         const auto end   = work_range.get_position_end(0);
 
+        static_assert(std::is_same<Tr, Tri>::value, "GemvPretransposed: Result types must be the same.");
+
+        if (_k_splits > 1) {
+            /* Window items for the same output block are adjacent: item = (block * _k_splits) + chunk */
+            const unsigned int n_blocks_per_multi = get_n_blocks_per_multi();
+
+            for (unsigned int item=start; item<end; item++) {
+                const unsigned int block = item / _k_splits;
+#ifdef CYCLE_PROFILING
+                auto p = prof.ScopedProfiler(PROFILE_KERNEL, _k_chunk * strategy::out_width());
+#endif
+                execute_k_chunk(strat, block / n_blocks_per_multi, block % n_blocks_per_multi, item % _k_splits);
+            }
+
+            return;
+        }
+
         /* Break the window values down into multis of interest... */
         const unsigned int window_per_multi = iceildiv(_args._Nsize, strategy::out_width());
         const unsigned int multi_0    = start / window_per_multi;
@@ -158,8 +288,6 @@ public:
         const unsigned int n_0   = (start - (multi_0 * window_per_multi)) * strategy::out_width();
         const unsigned int n_max = (end - (multi_end * window_per_multi)) * strategy::out_width();
 
-        static_assert(std::is_same<Tr, Tri>::value, "GemvPretransposed: Result types must be the same.");
-
         for (unsigned int multi=multi_0; multi<=multi_end; multi++) {
             const unsigned int n_start = (multi==multi_0) ? n_0 : 0;
             const unsigned int n_end = (multi==multi_end) ? n_max : _args._Nsize;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include "src/cpu/kernels/assembly/arm_gemm.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
 #include <tuple>
@@ -77,6 +78,20 @@ inline T roundup(const T a, const T b) {
     }
 }
 
+// Part of the L2 each of 'nthreads' threads can count on: a cluster-wide L2 is split between the threads running on it.
+inline unsigned int get_L2_share(const CPUInfo *ci, unsigned int nthreads) {
+    const unsigned int sharing = std::max(std::min(ci->get_L2_cache_sharing(), nthreads), 1u);
+
+    return ci->get_L2_cache_size() / sharing;
+}
+
+// Same for the last level cache, 0 if there is none.
+inline unsigned int get_L3_share(const CPUInfo *ci, unsigned int nthreads) {
+    const unsigned int sharing = std::max(std::min(ci->get_L3_cache_sharing(), nthreads), 1u);
+
+    return ci->get_L3_cache_size() / sharing;
+}
+
 enum class VLType {
     None,
     SVE,
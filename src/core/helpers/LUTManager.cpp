@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/helpers/LUTManager.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace
+{
+float activate(float x, const LUTInfo &info)
+{
+    switch(info.act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return info.alpha * std::tanh(info.beta * x);
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+void populate_lut(ActivationLayerInfo::LookupTable65536 &lut, const LUTInfo &info)
+{
+    for(size_t i = 0; i < lut.size(); ++i)
+    {
+        const uint16_t bits = static_cast<uint16_t>(i);
+        switch(info.dt)
+        {
+            case DataType::F16:
+            {
+                half in{};
+                std::memcpy(&in, &bits, sizeof(bits));
+                const half out(activate(static_cast<float>(in), info));
+                std::memcpy(&lut[i], &out, sizeof(bits));
+                break;
+            }
+            case DataType::QSYMM16:
+            {
+                const float out = activate(dequantize_qsymm16(static_cast<int16_t>(bits), info.qinfo_in), info);
+                lut[i]          = static_cast<uint16_t>(quantize_qsymm16(out, info.qinfo_out));
+                break;
+            }
+            default:
+                ARM_COMPUTE_ERROR("Unsupported data type");
+        }
+    }
+}
+} // namespace
+
+LUTManager &LUTManager::get_instance()
+{
+    static LUTManager instance;
+    return instance;
+}
+
+std::shared_ptr<const ActivationLayerInfo::LookupTable65536> LUTManager::get_lut_table(const LUTInfo &info)
+{
+#ifndef NO_MULTI_THREADING
+    std::lock_guard<std::mutex> lock(_mtx);
+#endif /* NO_MULTI_THREADING */
+
+    auto &entry = _luts[info];
+    auto  lut   = entry.lock();
+    if(lut == nullptr)
+    {
+        auto new_lut = std::make_shared<ActivationLayerInfo::LookupTable65536>();
+        populate_lut(*new_lut, info);
+        lut   = new_lut;
+        entry = lut;
+    }
+    return lut;
+}
+} // namespace arm_compute
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SRC_CORE_HELPERS_LUTMANAGER_H
+#define SRC_CORE_HELPERS_LUTMANAGER_H
+
+#include "arm_compute/core/QuantizationInfo.h"
+#include "arm_compute/core/Types.h"
+
+#include <map>
+#include <memory>
+#include <tuple>
+
+#ifndef NO_MULTI_THREADING
+#include <mutex>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+/** Parameters that identify a 16-bit activation lookup table */
+struct LUTInfo
+{
+    ActivationLayerInfo::ActivationFunction act;       /**< Activation function */
+    float                                   alpha;     /**< Alpha parameter of the activation function */
+    float                                   beta;      /**< Beta parameter of the activation function */
+    DataType                                dt;        /**< Data type of the input and output */
+    UniformQuantizationInfo                 qinfo_in;  /**< Input quantization info, ignored for F16 */
+    UniformQuantizationInfo                 qinfo_out; /**< Output quantization info, ignored for F16 */
+
+    /** Strict weak ordering so that the info can be used as a map key */
+    bool operator<(const LUTInfo &other) const
+    {
+        return std::tie(act, alpha, beta, dt, qinfo_in.scale, qinfo_in.offset, qinfo_out.scale, qinfo_out.offset)
+               < std::tie(other.act, other.alpha, other.beta, other.dt, other.qinfo_in.scale, other.qinfo_in.offset, other.qinfo_out.scale, other.qinfo_out.offset);
+    }
+};
+
+/** Cache of the 16-bit activation lookup tables
+ *
+ * Tables are built on first request and shared by all the kernels configured with the same @ref LUTInfo.
+ * A table is released once the last kernel using it is destroyed.
+ */
+class LUTManager
+{
+public:
+    /** Access the global instance
+     *
+     * @return the lookup table manager
+     */
+    static LUTManager &get_instance();
+
+    /** Get the lookup table for the given parameters, building it if it is not cached
+     *
+     * @param[in] info Lookup table parameters. Supported data types: F16/QSYMM16.
+     *
+     * @return a shared pointer to the lookup table
+     */
+    std::shared_ptr<const ActivationLayerInfo::LookupTable65536> get_lut_table(const LUTInfo &info);
+
+private:
+    LUTManager() = default;
+
+    std::map<LUTInfo, std::weak_ptr<const ActivationLayerInfo::LookupTable65536>> _luts{};
+#ifndef NO_MULTI_THREADING
+    std::mutex _mtx{};
+#endif /* NO_MULTI_THREADING */
+};
+} // namespace arm_compute
+
+#endif /* SRC_CORE_HELPERS_LUTMANAGER_H */
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/core/helpers/NMSHelpers.h"
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif /* defined(__aarch64__) && defined(__ARM_NEON) */
+
+namespace arm_compute
+{
+namespace nms_helpers
+{
+namespace
+{
+inline void set_suppressed(SuppressionMask &mask, size_t idx)
+{
+    mask[idx / 64] |= (uint64_t(1) << (idx % 64));
+}
+
+inline bool is_suppressed(const BoxesSoA &boxes, size_t ref, size_t j, const OverlapInfo &info)
+{
+    const float xx1 = std::max(boxes.x1[ref], boxes.x1[j]);
+    const float yy1 = std::max(boxes.y1[ref], boxes.y1[j]);
+    const float xx2 = std::min(boxes.x2[ref], boxes.x2[j]);
+    const float yy2 = std::min(boxes.y2[ref], boxes.y2[j]);
+
+    const float w = std::max(xx2 - xx1 + info.coord_offset, 0.f);
+    const float h = std::max(yy2 - yy1 + info.coord_offset, 0.f);
+
+    if(info.suppress_size)
+    {
+        const float ctr_x     = xx1 + (w / 2);
+        const float ctr_y     = yy1 + (h / 2);
+        const bool  keep_size = w >= info.min_size && h >= info.min_size && ctr_x < info.im_width && ctr_y < info.im_height;
+        if(!keep_size)
+        {
+            return true;
+        }
+    }
+
+    if(info.ignore_empty_boxes && (boxes.area[ref] <= 0.f || boxes.area[j] <= 0.f))
+    {
+        return false;
+    }
+
+    const float inter = w * h;
+    const float iou   = inter / (boxes.area[ref] + boxes.area[j] - inter);
+    return iou > info.iou_threshold;
+}
+} // namespace
+
+void suppress_overlapping_boxes(const BoxesSoA &boxes, size_t ref, size_t begin, size_t end, const OverlapInfo &info, SuppressionMask &mask)
+{
+    size_t j = begin;
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    if(!info.suppress_size)
+    {
+        const float32x4_t ref_x1    = vdupq_n_f32(boxes.x1[ref]);
+        const float32x4_t ref_y1    = vdupq_n_f32(boxes.y1[ref]);
+        const float32x4_t ref_x2    = vdupq_n_f32(boxes.x2[ref]);
+        const float32x4_t ref_y2    = vdupq_n_f32(boxes.y2[ref]);
+        const float32x4_t ref_area  = vdupq_n_f32(boxes.area[ref]);
+        const float32x4_t offset    = vdupq_n_f32(info.coord_offset);
+        const float32x4_t threshold = vdupq_n_f32(info.iou_threshold);
+        const float32x4_t zero      = vdupq_n_f32(0.f);
+        const uint32x4_t  lane_bits = { 1, 2, 4, 8 };
+        const uint32x4_t  ref_valid = (info.ignore_empty_boxes && boxes.area[ref] <= 0.f) ? vdupq_n_u32(0) : vdupq_n_u32(~0u);
+
+        for(; j + 4 <= end; j += 4)
+        {
+            const float32x4_t x1   = vld1q_f32(boxes.x1.data() + j);
+            const float32x4_t y1   = vld1q_f32(boxes.y1.data() + j);
+            const float32x4_t x2   = vld1q_f32(boxes.x2.data() + j);
+            const float32x4_t y2   = vld1q_f32(boxes.y2.data() + j);
+            const float32x4_t area = vld1q_f32(boxes.area.data() + j);
+
+            const float32x4_t w     = vmaxq_f32(vaddq_f32(vsubq_f32(vminq_f32(ref_x2, x2), vmaxq_f32(ref_x1, x1)), offset), zero);
+            const float32x4_t h     = vmaxq_f32(vaddq_f32(vsubq_f32(vminq_f32(ref_y2, y2), vmaxq_f32(ref_y1, y1)), offset), zero);
+            const float32x4_t inter = vmulq_f32(w, h);
+            const float32x4_t iou   = vdivq_f32(inter, vsubq_f32(vaddq_f32(ref_area, area), inter));
+
+            uint32x4_t sup = vandq_u32(vcgtq_f32(iou, threshold), ref_valid);
+            if(info.ignore_empty_boxes)
+            {
+                sup = vandq_u32(sup, vcgtq_f32(area, zero));
+            }
+
+            const uint32_t bits = vaddvq_u32(vandq_u32(sup, lane_bits));
+            if(bits != 0)
+            {
+                for(size_t l = 0; l < 4; ++l)
+                {
+                    if(bits & (1u << l))
+                    {
+                        set_suppressed(mask, j + l);
+                    }
+                }
+            }
+        }
+    }
+#endif /* defined(__aarch64__) && defined(__ARM_NEON) */
+
+    for(; j < end; ++j)
+    {
+        if(is_suppressed(boxes, ref, j, info))
+        {
+            set_suppressed(mask, j);
+        }
+    }
+}
+} // namespace nms_helpers
+} // namespace arm_compute
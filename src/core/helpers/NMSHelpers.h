@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SRC_CORE_HELPERS_NMSHELPERS_H
+#define SRC_CORE_HELPERS_NMSHELPERS_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace arm_compute
+{
+namespace nms_helpers
+{
+/** Description of how the overlap between two boxes is measured and when a candidate gets suppressed */
+struct OverlapInfo
+{
+    float iou_threshold{ 0.f };       /**< Candidates with an IoU greater than this value are suppressed */
+    float coord_offset{ 0.f };        /**< Offset added to widths and heights (1 for pixel-inclusive coordinates) */
+    bool  ignore_empty_boxes{ true }; /**< If true, the overlap with a box of non-positive area is zero */
+    bool  suppress_size{ false };     /**< If true, also suppress candidates whose intersection is too small or lies outside the image */
+    float min_size{ 0.f };            /**< Minimum intersection size when @p suppress_size is set */
+    float im_width{ 0.f };            /**< Image width when @p suppress_size is set */
+    float im_height{ 0.f };           /**< Image height when @p suppress_size is set */
+};
+
+/** Boxes in corner format stored as a structure of arrays so that overlaps can be computed several boxes at a time */
+struct BoxesSoA
+{
+    /** Resize all the coordinate arrays
+     *
+     * @param[in] num_boxes Number of boxes to hold
+     */
+    void resize(size_t num_boxes)
+    {
+        x1.resize(num_boxes);
+        y1.resize(num_boxes);
+        x2.resize(num_boxes);
+        y2.resize(num_boxes);
+        area.resize(num_boxes);
+    }
+
+    std::vector<float> x1{};   /**< Left coordinates */
+    std::vector<float> y1{};   /**< Top coordinates */
+    std::vector<float> x2{};   /**< Right coordinates */
+    std::vector<float> y2{};   /**< Bottom coordinates */
+    std::vector<float> area{}; /**< Pre-computed areas */
+};
+
+/** Bitmask with one bit per candidate, set when the candidate has been suppressed */
+using SuppressionMask = std::vector<uint64_t>;
+
+/** Mark as suppressed all the boxes in [ @p begin, @p end ) that overlap with the box @p ref
+ *
+ * @param[in]     boxes Boxes to process
+ * @param[in]     ref   Index of the kept box
+ * @param[in]     begin First candidate to test
+ * @param[in]     end   One past the last candidate to test
+ * @param[in]     info  Overlap information
+ * @param[in,out] mask  Suppression mask to update
+ */
+void suppress_overlapping_boxes(const BoxesSoA &boxes, size_t ref, size_t begin, size_t end, const OverlapInfo &info, SuppressionMask &mask);
+
+/** Order by decreasing score the candidates in [ @p begin, @p mid ) picking them from [ @p begin, order.size() )
+ *
+ * Ties are broken by increasing candidate position so that the result is deterministic.
+ *
+ * @param[in,out] order  Candidate positions in @p scores
+ * @param[in]     scores Candidate scores
+ * @param[in]     begin  First position to order
+ * @param[in]     mid    One past the last position that must be in its final place
+ */
+inline void sort_candidates(std::vector<int> &order, const std::vector<float> &scores, size_t begin, size_t mid)
+{
+    std::partial_sort(order.begin() + begin, order.begin() + mid, order.end(), [&scores](int lhs, int rhs)
+    {
+        return scores[lhs] > scores[rhs] || (scores[lhs] == scores[rhs] && lhs < rhs);
+    });
+}
+
+/** Greedy hard non-maximum suppression
+ *
+ * Candidates are only ordered up to the top-k window that is expected to fill the output; the remaining ones get
+ * ordered lazily if the output is not full once the window is exhausted. Overlaps are computed against a
+ * structure of arrays copy of the ordered boxes and recorded in a bitmask.
+ *
+ * @param[in] indices    Box indices of the candidates
+ * @param[in] scores     Scores of the candidates, one per entry of @p indices
+ * @param[in] max_output Maximum number of boxes to keep
+ * @param[in] info       Overlap information
+ * @param[in] load_box   Functor with signature void(int index, float &x1, float &y1, float &x2, float &y2) that reads a box
+ *
+ * @return the box indices of the kept boxes, sorted by decreasing score
+ */
+template <typename BoxLoader>
+std::vector<int> greedy_nms(const std::vector<int> &indices, const std::vector<float> &scores, size_t max_output, const OverlapInfo &info, BoxLoader &&load_box)
+{
+    std::vector<int> keep;
+    const size_t     num_candidates = indices.size();
+    if(num_candidates == 0 || max_output == 0)
+    {
+        return keep;
+    }
+
+    std::vector<int> order(num_candidates);
+    std::iota(order.begin(), order.end(), 0);
+
+    BoxesSoA boxes;
+    boxes.resize(num_candidates);
+    auto gather = [&](size_t begin, size_t end)
+    {
+        for(size_t i = begin; i < end; ++i)
+        {
+            load_box(indices[order[i]], boxes.x1[i], boxes.y1[i], boxes.x2[i], boxes.y2[i]);
+            boxes.area[i] = (boxes.x2[i] - boxes.x1[i] + info.coord_offset) * (boxes.y2[i] - boxes.y1[i] + info.coord_offset);
+        }
+    };
+
+    constexpr size_t min_window = 64;
+    size_t           sorted_end = std::min(num_candidates, std::max(4 * std::min(max_output, num_candidates), min_window));
+    sort_candidates(order, scores, 0, sorted_end);
+    gather(0, sorted_end);
+
+    SuppressionMask     suppressed((num_candidates + 63) / 64, 0);
+    std::vector<size_t> kept_pos;
+    for(size_t i = 0; i < num_candidates && keep.size() < max_output; ++i)
+    {
+        if(i == sorted_end)
+        {
+            // The output is not full yet: order the tail and check it against the boxes already kept
+            sort_candidates(order, scores, sorted_end, num_candidates);
+            gather(sorted_end, num_candidates);
+            for(const auto k : kept_pos)
+            {
+                suppress_overlapping_boxes(boxes, k, sorted_end, num_candidates, info, suppressed);
+            }
+            sorted_end = num_candidates;
+        }
+
+        if((suppressed[i / 64] >> (i % 64)) & 1)
+        {
+            continue;
+        }
+
+        keep.push_back(indices[order[i]]);
+        kept_pos.push_back(i);
+        if(keep.size() < max_output)
+        {
+            suppress_overlapping_boxes(boxes, i, i + 1, sorted_end, info, suppressed);
+        }
+    }
+    return keep;
+}
+} // namespace nms_helpers
+} // namespace arm_compute
+
+#endif /* SRC_CORE_HELPERS_NMSHELPERS_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -155,6 +155,8 @@ CpuContext::CpuContext(const AclContextOptions *options)
     {
         _allocator = populate_allocator(options->allocator);
         _caps      = populate_capabilities(options->capabilities, options->max_compute_units);
+
+        _caps.enable_fast_math = options->enable_fast_math;
     }
 }
 
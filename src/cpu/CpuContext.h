@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@ struct CpuCapabilities
 {
     cpuinfo::CpuInfo cpu_info{};
     int32_t          max_threads{ -1 };
+    bool             enable_fast_math{ false };
 };
 
 /** CPU context implementation class */
@@ -66,6 +67,54 @@ public:
                                                           const AclTensorDescriptor     &dst,
                                                           const AclActivationDescriptor &act,
                                                           bool                           is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_conv2d(const AclTensorDescriptor &src,
+                                                      const AclTensorDescriptor &weights,
+                                                      const AclTensorDescriptor *bias,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclConv2dDescriptor &info,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_depthwise_conv2d(const AclTensorDescriptor &src,
+                                                                const AclTensorDescriptor          &weights,
+                                                                const AclTensorDescriptor          *bias,
+                                                                const AclTensorDescriptor          &dst,
+                                                                const AclDepthwiseConv2dDescriptor &info,
+                                                                bool                                is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_gemm(const AclTensorDescriptor &a,
+                                                    const AclTensorDescriptor &b,
+                                                    const AclTensorDescriptor *c,
+                                                    const AclTensorDescriptor &d,
+                                                    const AclGemmDescriptor   &info,
+                                                    bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_fully_connected(const AclTensorDescriptor &src,
+                                                               const AclTensorDescriptor         &weights,
+                                                               const AclTensorDescriptor         *bias,
+                                                               const AclTensorDescriptor         &dst,
+                                                               const AclFullyConnectedDescriptor &info,
+                                                               bool                               is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_matmul(const AclTensorDescriptor &lhs,
+                                                      const AclTensorDescriptor &rhs,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclMatMulDescriptor &info,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_pool2d(const AclTensorDescriptor &src,
+                                                      const AclTensorDescriptor &dst,
+                                                      const AclPool2dDescriptor &info,
+                                                      bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_softmax(const AclTensorDescriptor &src,
+                                                       const AclTensorDescriptor  &dst,
+                                                       const AclSoftmaxDescriptor &info,
+                                                       bool                        is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_elementwise(const AclTensorDescriptor &src0,
+                                                           const AclTensorDescriptor      &src1,
+                                                           const AclTensorDescriptor      &dst,
+                                                           const AclElementwiseDescriptor &info,
+                                                           bool                            is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_quantize(const AclTensorDescriptor &src,
+                                                        const AclTensorDescriptor &dst,
+                                                        bool                       is_validate) override;
+    std::tuple<IOperator *, StatusCode> create_dequantize(const AclTensorDescriptor &src,
+                                                          const AclTensorDescriptor &dst,
+                                                          bool                       is_validate) override;
 
 private:
     AllocatorWrapper _allocator;
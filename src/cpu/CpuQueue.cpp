@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,25 +24,280 @@
 #include "src/cpu/CpuQueue.h"
 
 #include "arm_compute/runtime/Scheduler.h"
+#include "src/cpu/CpuContext.h"
+#include "src/runtime/SchedulerScope.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include <algorithm>
+#include <vector>
+
+#ifndef NO_MULTI_THREADING
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#endif /* NO_MULTI_THREADING */
 
 namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Extract the cores of a core mask
+ *
+ * @param[in] options Queue options
+ *
+ * @return The ids of the cores in the mask, empty if there is no mask
+ */
+std::vector<int> cores_from_options(const AclQueueOptions *options)
+{
+    std::vector<int> cores;
+    for(int core = 0; options != nullptr && core < 64; ++core)
+    {
+        if((options->core_mask >> core) & 1)
+        {
+            cores.push_back(core);
+        }
+    }
+    return cores;
+}
+
+/** Create the thread pool requested by the queue options
+ *
+ * @param[in] ctx     Context the queue belongs to
+ * @param[in] options Queue options
+ * @param[in] cores   Cores of the core mask of the queue
+ *
+ * @return The thread pool of the queue, nullptr if the queue should use the process-wide scheduler
+ */
+std::unique_ptr<IScheduler> create_scheduler(IContext *ctx, const AclQueueOptions *options, const std::vector<int> &cores)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    if(options == nullptr || (options->compute_units <= 0 && cores.empty()))
+    {
+        return nullptr;
+    }
+
+    // Use as many threads as requested, or one per core of the mask, within the limits of the context
+    unsigned int num_threads = (options->compute_units > 0) ? options->compute_units : cores.size();
+    const auto   max_threads = static_cast<CpuContext *>(ctx)->capabilities().max_threads;
+    if(max_threads > 0)
+    {
+        num_threads = std::min(num_threads, static_cast<unsigned int>(max_threads));
+    }
+
+    auto scheduler = std::make_unique<CPPScheduler>();
+    if(cores.empty())
+    {
+        scheduler->set_num_threads(num_threads);
+    }
+    else
+    {
+        // The thread of the queue creates the pool and takes part in the work as its first thread, so it gets the first core
+        scheduler->set_num_threads_with_affinity(num_threads, [cores](int thread_index, int)
+        {
+            return cores[thread_index % cores.size()];
+        });
+    }
+    return scheduler;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(ctx, options, cores);
+    return nullptr;
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+/** Run some work, converting the errors it raises to a status code
+ *
+ * @param[in] work Work to run
+ *
+ * @return Status code
+ */
+StatusCode run_work(const std::function<void()> &work)
+{
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    try
+    {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+        work();
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    }
+    catch(const std::bad_alloc &)
+    {
+        return StatusCode::OutOfMemory;
+    }
+    catch(...)
+    {
+        return StatusCode::RuntimeError;
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+    return StatusCode::Success;
+}
+} // namespace
+
+#ifndef NO_MULTI_THREADING
+/** Thread executing the work submitted to a queue in order */
+struct CpuQueue::Worker
+{
+    /** Start the thread of the queue and wait for it to be initialized
+     *
+     * @param[in] init Function run first on the thread, returns the scheduler the work should use (can be nullptr)
+     */
+    explicit Worker(std::function<IScheduler *()> init)
+        : thread(&Worker::loop, this, std::move(init))
+    {
+        bool failed = false;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            work_done.wait(lock, [this] { return ready; });
+            failed = status != StatusCode::Success;
+        }
+        if(failed)
+        {
+            thread.join();
+            ARM_COMPUTE_ERROR("Failed to initialize the thread of the queue");
+        }
+    }
+    ~Worker()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stop = true;
+        }
+        work_available.notify_one();
+        thread.join();
+    }
+    void submit(std::function<void()> work)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            pending.emplace_back(std::move(work));
+        }
+        work_available.notify_one();
+    }
+    StatusCode wait()
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        work_done.wait(lock, [this] { return pending.empty() && !busy; });
+
+        // Report the first failure since the previous wait
+        const StatusCode st = status;
+        status              = StatusCode::Success;
+        return st;
+    }
+    void loop(std::function<IScheduler *()> init)
+    {
+        IScheduler      *scheduler = nullptr;
+        const StatusCode init_st   = run_work([&]()
+        {
+            scheduler = init();
+        });
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            ready  = true;
+            status = init_st;
+        }
+        work_done.notify_all();
+        if(init_st != StatusCode::Success)
+        {
+            return;
+        }
+
+        // Operators pick their scheduler through Scheduler::get(), point it to the pool of the queue
+        std::unique_ptr<SchedulerScope> scope = (scheduler != nullptr) ? std::make_unique<SchedulerScope>(*scheduler) : nullptr;
+
+        std::unique_lock<std::mutex> lock(mtx);
+        while(true)
+        {
+            work_available.wait(lock, [this] { return stop || !pending.empty(); });
+            if(pending.empty())
+            {
+                return;
+            }
+
+            std::function<void()> work = std::move(pending.front());
+            pending.pop_front();
+            busy = true;
+            lock.unlock();
+
+            const StatusCode st = run_work(work);
+
+            lock.lock();
+            busy = false;
+            if(status == StatusCode::Success)
+            {
+                status = st;
+            }
+            if(pending.empty())
+            {
+                work_done.notify_all();
+            }
+        }
+    }
+
+    std::mutex                        mtx{};
+    std::condition_variable           work_available{};
+    std::condition_variable           work_done{};
+    std::deque<std::function<void()>> pending{};
+    bool                              ready{ false };
+    bool                              busy{ false };
+    bool                              stop{ false };
+    StatusCode                        status{ StatusCode::Success };
+    std::thread                       thread;
+};
+#else  /* NO_MULTI_THREADING */
+struct CpuQueue::Worker
+{
+};
+#endif /* NO_MULTI_THREADING */
+
 CpuQueue::CpuQueue(IContext *ctx, const AclQueueOptions *options)
     : IQueue(ctx)
 {
-    ARM_COMPUTE_UNUSED(options);
+    const std::vector<int> cores = cores_from_options(options);
+#ifndef NO_MULTI_THREADING
+    // The pool is created on the thread of the queue, so that pinning its first thread pins the thread of the queue
+    _worker = std::make_unique<Worker>([&]()
+    {
+        _scheduler = create_scheduler(ctx, options, cores);
+        return _scheduler.get();
+    });
+#else  /* NO_MULTI_THREADING */
+    _scheduler = create_scheduler(ctx, options, cores);
+#endif /* NO_MULTI_THREADING */
+}
+
+CpuQueue::~CpuQueue()
+{
+    // Drain the submitted work before releasing the thread pool it runs on
+    _worker.reset();
 }
 
 arm_compute::IScheduler &CpuQueue::scheduler()
 {
-    return arm_compute::Scheduler::get();
+    return (_scheduler != nullptr) ? *_scheduler : arm_compute::Scheduler::get();
+}
+
+StatusCode CpuQueue::execute(std::function<void()> work)
+{
+#ifndef NO_MULTI_THREADING
+    _worker->submit(std::move(work));
+    return StatusCode::Success;
+#else  /* NO_MULTI_THREADING */
+    return run_work(work);
+#endif /* NO_MULTI_THREADING */
 }
 
 StatusCode CpuQueue::finish()
 {
+#ifndef NO_MULTI_THREADING
+    return _worker->wait();
+#else  /* NO_MULTI_THREADING */
     return StatusCode::Success;
+#endif /* NO_MULTI_THREADING */
 }
 } // namespace cpu
 } // namespace arm_compute
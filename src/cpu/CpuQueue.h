@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,11 +28,20 @@
 
 #include "arm_compute/runtime/IScheduler.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 namespace cpu
 {
-/** CPU queue implementation class */
+/** CPU queue implementation class
+ *
+ * Work is executed asynchronously, in submission order, by a thread owned by the queue. @ref CpuQueue::finish blocks
+ * until all the submitted work has completed.
+ *
+ * A queue created with a number of compute units or a core mask owns a thread pool, so that several queues can run
+ * work concurrently on disjoint sets of cores. Otherwise it borrows the process-wide scheduler.
+ */
 class CpuQueue final : public IQueue
 {
 public:
@@ -42,14 +51,23 @@ public:
      * @param[in] options Command queue options
      */
     CpuQueue(IContext *ctx, const AclQueueOptions *options);
-    /** Return legacy scheduler
+    /** Destructor, waits for the submitted work to complete */
+    ~CpuQueue();
+    /** Return the scheduler running the work of the queue
      *
      * @return arm_compute::IScheduler&
      */
     arm_compute::IScheduler &scheduler();
 
     // Inherited functions overridden
+    StatusCode execute(std::function<void()> work) override;
     StatusCode finish() override;
+
+private:
+    struct Worker;
+
+    std::unique_ptr<arm_compute::IScheduler> _scheduler{ nullptr };
+    std::unique_ptr<Worker>                  _worker{ nullptr };
 };
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,6 +36,7 @@ namespace kernels
 /** Casts a given tensor to a new type
  *
  * @note When casting between quantized types the scale and zeroPoint are ignored
+ * @note When casting between types of the same size (e.g. F32 <-> S32), the source and destination tensors can share their memory
  */
 class CpuCastKernel : public ICpuKernel<CpuCastKernel>
 {
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuDeconvCol2ImKernel.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/NEON/NEAsymm.h"
+#include "src/core/NEON/wrapper/wrapper.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <type_traits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+Status validate_arguments(const ITensorInfo *src, const ITensorInfo *bias, const ITensorInfo *dst, const Size2D &kernel_dims, const PadStrideInfo &info,
+                          const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::F16, DataType::F32, DataType::S32);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->total_size() == 0, "Output tensor not initialized");
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(dst, DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(kernel_dims.area() == 0);
+
+    const bool is_quantized = src->data_type() == DataType::S32;
+    if(is_quantized)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_multipliers.empty() || output_stage.gemmlowp_shifts.empty());
+        if(output_stage.is_quantized_per_channel)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_multipliers.size() != dst->dimension(0));
+            ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_shifts.size() != dst->dimension(0));
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src, dst);
+    }
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != dst->dimension(0));
+        if(is_quantized)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(bias, dst);
+        }
+    }
+
+    const auto out_dims = deconvolution_output_dimensions(src->dimension(1), src->dimension(2), kernel_dims.width, kernel_dims.height, info);
+    ARM_COMPUTE_RETURN_ERROR_ON(src->dimension(0) != dst->dimension(0) * kernel_dims.area());
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(1) != out_dims.first);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(2) != out_dims.second);
+    ARM_COMPUTE_RETURN_ERROR_ON(dst->dimension(3) != src->dimension(3));
+
+    return Status{};
+}
+
+inline void accumulate(float *acc, const float *src, int len)
+{
+    int x = 0;
+    for(; x <= len - 4; x += 4)
+    {
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vld1q_f32(src + x)));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] += src[x];
+    }
+}
+
+inline void accumulate(int32_t *acc, const int32_t *src, int len)
+{
+    int x = 0;
+    for(; x <= len - 4; x += 4)
+    {
+        vst1q_s32(acc + x, vaddq_s32(vld1q_s32(acc + x), vld1q_s32(src + x)));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] += src[x];
+    }
+}
+
+inline void store(const float *acc, float *dst, int len, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_UNUSED(output_stage);
+    std::copy_n(acc, len, dst);
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+inline void accumulate(float *acc, const float16_t *src, int len)
+{
+    int x = 0;
+    for(; x <= len - 4; x += 4)
+    {
+        vst1q_f32(acc + x, vaddq_f32(vld1q_f32(acc + x), vcvt_f32_f16(vld1_f16(src + x))));
+    }
+    for(; x < len; ++x)
+    {
+        acc[x] += static_cast<float>(src[x]);
+    }
+}
+
+inline void store(const float *acc, float16_t *dst, int len, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_UNUSED(output_stage);
+    int x = 0;
+    for(; x <= len - 4; x += 4)
+    {
+        vst1_f16(dst + x, vcvt_f16_f32(vld1q_f32(acc + x)));
+    }
+    for(; x < len; ++x)
+    {
+        dst[x] = static_cast<float16_t>(acc[x]);
+    }
+}
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) */
+
+template <typename T>
+void store(const int32_t *acc, T *dst, int len, const GEMMLowpOutputStageInfo &output_stage)
+{
+    using VectorType = typename std::conditional<std::is_same<T, uint8_t>::value, uint8x16_t, int8x16_t>::type;
+
+    const T min_val = std::is_same<T, uint8_t>::value ? 0 : -128;
+    const T max_val = std::is_same<T, uint8_t>::value ? 255 : 127;
+    int     x       = 0;
+
+    if(!output_stage.is_quantized_per_channel)
+    {
+        const int32x4_t  offset = vdupq_n_s32(output_stage.gemmlowp_offset);
+        const VectorType vmin   = wrapper::vdup_n(min_val, wrapper::traits::vector_128_tag{});
+        const VectorType vmax   = wrapper::vdup_n(max_val, wrapper::traits::vector_128_tag{});
+        for(; x <= len - 16; x += 16)
+        {
+            int32x4x4_t in =
+            {
+                {
+                    vld1q_s32(acc + x),
+                    vld1q_s32(acc + x + 4),
+                    vld1q_s32(acc + x + 8),
+                    vld1q_s32(acc + x + 12)
+                }
+            };
+            wrapper::vstore(dst + x, finalize_quantization(in, output_stage.gemmlowp_multiplier, output_stage.gemmlowp_shift, offset, vmin, vmax, false));
+        }
+    }
+    for(; x < len; ++x)
+    {
+        const int ch = output_stage.is_quantized_per_channel ? x : 0;
+        dst[x]       = finalize_quantization(acc[x], output_stage.gemmlowp_multipliers[ch], output_stage.gemmlowp_shifts[ch], output_stage.gemmlowp_offset, min_val, max_val, false);
+    }
+}
+
+template <typename TIn, typename TAcc, typename TOut>
+void deconv_col2im(const ITensor *src, const ITensor *bias, ITensor *dst, const Window &window, const Size2D &kernel_dims, const PadStrideInfo &info,
+                   const GEMMLowpOutputStageInfo &output_stage)
+{
+    const int num_ch   = static_cast<int>(dst->info()->dimension(0));
+    const int src_w    = static_cast<int>(src->info()->dimension(1));
+    const int src_h    = static_cast<int>(src->info()->dimension(2));
+    const int kernel_w = static_cast<int>(kernel_dims.width);
+    const int kernel_h = static_cast<int>(kernel_dims.height);
+    const int stride_x = static_cast<int>(info.stride().first);
+    const int stride_y = static_cast<int>(info.stride().second);
+    const int pad_left = static_cast<int>(info.pad_left());
+    const int pad_top  = static_cast<int>(info.pad_top());
+
+    const Strides &src_strides = src->info()->strides_in_bytes();
+    const uint8_t *src_base    = src->buffer() + src->info()->offset_first_element_in_bytes();
+
+    // Accumulate straight into the destination when it has the same type as the accumulators
+    constexpr bool    in_place = std::is_same<TAcc, TOut>::value;
+    std::vector<TAcc> acc_buffer(in_place ? 0 : num_ch);
+    const TIn        *bias_ptr = (bias != nullptr) ? reinterpret_cast<const TIn *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    Iterator out(dst, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        TAcc *acc = in_place ? reinterpret_cast<TAcc *>(out.ptr()) : acc_buffer.data();
+        if(bias_ptr != nullptr)
+        {
+            std::copy_n(bias_ptr, num_ch, acc);
+        }
+        else
+        {
+            std::fill_n(acc, num_ch, TAcc(0));
+        }
+
+        // Only the taps congruent to the output position modulo the stride reach it
+        const int y_pos   = id.z() + pad_top;
+        const int x_pos   = id.y() + pad_left;
+        const int batch   = id[3];
+        const int ky_end  = std::min(kernel_h, y_pos + 1);
+        const int kx_end  = std::min(kernel_w, x_pos + 1);
+        for(int ky = y_pos % stride_y; ky < ky_end; ky += stride_y)
+        {
+            const int yi = (y_pos - ky) / stride_y;
+            if(yi >= src_h)
+            {
+                continue;
+            }
+            for(int kx = x_pos % stride_x; kx < kx_end; kx += stride_x)
+            {
+                const int xi = (x_pos - kx) / stride_x;
+                if(xi >= src_w)
+                {
+                    continue;
+                }
+                const auto col = reinterpret_cast<const TIn *>(src_base + xi * src_strides[1] + yi * src_strides[2] + batch * src_strides[3]) + (ky * kernel_w + kx) * num_ch;
+                accumulate(acc, col, num_ch);
+            }
+        }
+
+        if(!in_place)
+        {
+            store(acc, reinterpret_cast<TOut *>(out.ptr()), num_ch, output_stage);
+        }
+    },
+    out);
+}
+} // namespace
+
+void CpuDeconvCol2ImKernel::configure(const ITensorInfo *src, const ITensorInfo *bias, ITensorInfo *dst, const Size2D &kernel_dims, const PadStrideInfo &info,
+                                      const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst);
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments(src, bias, dst, kernel_dims, info, output_stage));
+
+    _kernel_dims  = kernel_dims;
+    _info         = info;
+    _output_stage = output_stage;
+
+    // Each window step produces all the channels of an output pixel
+    Window win = calculate_max_window(*dst, Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuDeconvCol2ImKernel::validate(const ITensorInfo *src, const ITensorInfo *bias, const ITensorInfo *dst, const Size2D &kernel_dims, const PadStrideInfo &info,
+                                       const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src, bias, dst, kernel_dims, info, output_stage));
+    return Status{};
+}
+
+void CpuDeconvCol2ImKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    const auto src  = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    const auto bias = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    auto       dst  = tensors.get_tensor(TensorType::ACL_DST);
+
+    switch(dst->info()->data_type())
+    {
+        case DataType::F32:
+            deconv_col2im<float, float, float>(src, bias, dst, window, _kernel_dims, _info, _output_stage);
+            break;
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC)
+        case DataType::F16:
+            deconv_col2im<float16_t, float, float16_t>(src, bias, dst, window, _kernel_dims, _info, _output_stage);
+            break;
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) */
+        case DataType::QASYMM8:
+            deconv_col2im<int32_t, int32_t, uint8_t>(src, bias, dst, window, _kernel_dims, _info, _output_stage);
+            break;
+        case DataType::QASYMM8_SIGNED:
+            deconv_col2im<int32_t, int32_t, int8_t>(src, bias, dst, window, _kernel_dims, _info, _output_stage);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+}
+
+const char *CpuDeconvCol2ImKernel::name() const
+{
+    return "CpuDeconvCol2ImKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
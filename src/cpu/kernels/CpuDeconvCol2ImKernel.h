@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPU_DECONV_COL2IM_KERNEL_H
+#define ARM_COMPUTE_CPU_DECONV_COL2IM_KERNEL_H
+
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel to accumulate the columns of a transposed convolution into its output image.
+ *
+ * The source holds, for each input pixel, the products of its channels with every tap of the kernel: a [kernel_w * kernel_h * OFM, width, height, batches] tensor
+ * whose first dimension is ordered as [OFM, kernel_w, kernel_h]. Each output pixel gathers the taps of the input pixels that reach it, which is equivalent
+ * to scattering the columns with a stride but does not need atomics and never materializes the zero-upsampled input.
+ *
+ * The bias is added and, for S32 sources, the accumulators are requantized with the given output stage.
+ */
+class CpuDeconvCol2ImKernel : public ICpuKernel<CpuDeconvCol2ImKernel>
+{
+public:
+    /** Default constructor */
+    CpuDeconvCol2ImKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuDeconvCol2ImKernel);
+    /** Set the input and output of the kernel.
+     *
+     * Valid data type configurations:
+     * |src            |bias   |dst            |
+     * |:--------------|:------|:--------------|
+     * |F16            |F16    |F16            |
+     * |F32            |F32    |F32            |
+     * |S32            |S32    |QASYMM8        |
+     * |S32            |S32    |QASYMM8_SIGNED |
+     *
+     * @param[in]  src          Source tensor info with shape [kernel_dims.area() * OFM, width, height, batches]. Data types supported: F16/F32/S32.
+     * @param[in]  bias         (Optional) Biases tensor info with shape [OFM]. Data types supported: S32 if @p src is S32, same as @p dst otherwise.
+     * @param[out] dst          Destination tensor info with shape [OFM, out_width, out_height, batches]. Data layout supported: NHWC.
+     *                          Data types supported: QASYMM8/QASYMM8_SIGNED if @p src is S32, same as @p src otherwise.
+     * @param[in]  kernel_dims  Width and height of the deconvolution kernel.
+     * @param[in]  info         Strides and paddings of the deconvolution.
+     * @param[in]  output_stage (Optional) Requantization parameters. Only used when @p src is S32.
+     */
+    void configure(const ITensorInfo *src, const ITensorInfo *bias, ITensorInfo *dst, const Size2D &kernel_dims, const PadStrideInfo &info,
+                   const GEMMLowpOutputStageInfo &output_stage = GEMMLowpOutputStageInfo());
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuDeconvCol2ImKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *bias, const ITensorInfo *dst, const Size2D &kernel_dims, const PadStrideInfo &info,
+                           const GEMMLowpOutputStageInfo &output_stage = GEMMLowpOutputStageInfo());
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    Size2D                  _kernel_dims{};
+    PadStrideInfo           _info{};
+    GEMMLowpOutputStageInfo _output_stage{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_DECONV_COL2IM_KERNEL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,8 @@
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/WindowHelpers.h"
 
+#include <cstring>
+
 using namespace arm_compute::detail;
 
 namespace arm_compute
@@ -45,6 +47,11 @@ static const std::vector<CpuDirectConv2dKernel::DirectConv2dKernel> available_ke
         [](const DataTypeDataLayoutISASelectorData & data) { return data.dt == DataType::F32 && data.dl == DataLayout::NHWC; },
         REGISTER_FP32_NEON(arm_compute::cpu::kernels::neon_fp32_nhwc_directconv2d)
     },
+    {
+        "neon_fp16_nhwc_directconv2d",
+        [](const DataTypeDataLayoutISASelectorData & data) { return data.dt == DataType::F16 && data.dl == DataLayout::NHWC && data.isa.fp16; },
+        REGISTER_FP16_NEON(arm_compute::cpu::kernels::neon_fp16_nhwc_directconv2d)
+    },
     {
         "neon_fp32_nchw_directconv2d",
         [](const DataTypeDataLayoutISASelectorData & data) { return data.dt == DataType::F32 && data.dl == DataLayout::NCHW; },
@@ -73,8 +80,10 @@ Status validate_arguments(const ITensorInfo *src, const ITensorInfo *weights, co
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(channel_idx) != src->dimension(channel_idx));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(width_idx) != weights->dimension(height_idx));
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
-    ARM_COMPUTE_RETURN_ERROR_ON(data_layout == DataLayout::NHWC && src->data_type() != DataType::F32);
     ARM_COMPUTE_UNUSED(width_idx);
+
+    const auto *uk = CpuDirectConv2dKernel::get_implementation(DataTypeDataLayoutISASelectorData{ src->data_type(), data_layout, CPUInfo::get().get_isa() });
+    ARM_COMPUTE_RETURN_ERROR_ON(uk == nullptr || uk->ukernel == nullptr);
     // Checks performed when output is configured
     if(dst->total_size() != 0)
     {
@@ -147,12 +156,65 @@ void CpuDirectConv2dKernel::run_op(ITensorPack &tensors, const Window &window, c
 
     auto src     = tensors.get_const_tensor(TensorType::ACL_SRC_0);
     auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    auto bias    = tensors.get_const_tensor(TensorType::ACL_SRC_2);
     auto dst     = tensors.get_tensor(TensorType::ACL_DST);
 
     const auto *uk = CpuDirectConv2dKernel::get_implementation(DataTypeDataLayoutISASelectorData{ src->info()->data_type(), _data_layout, CPUInfo::get().get_isa() });
     ARM_COMPUTE_ERROR_ON(uk == nullptr);
 
-    uk->ukernel(window, src, weights, dst, _conv_info);
+    uk->ukernel(window, src, weights, bias, dst, _conv_info);
+}
+
+TensorInfo CpuDirectConv2dKernel::packed_weights_info(const ITensorInfo *weights)
+{
+    ARM_COMPUTE_ERROR_ON(weights->data_layout() != DataLayout::NHWC);
+
+    // Two vectors of output channels per block
+    const size_t block_size = 2 * (16 / weights->element_size());
+    const size_t num_blocks = DIV_CEIL(weights->dimension(3), block_size);
+
+    const TensorShape shape(weights->dimension(0) * block_size, weights->dimension(1), weights->dimension(2), num_blocks);
+    return TensorInfo(shape, 1, weights->data_type(), DataLayout::NHWC);
+}
+
+void CpuDirectConv2dKernel::pack_weights(const ITensor *weights, ITensor *packed)
+{
+    const ITensorInfo *info       = weights->info();
+    const size_t       elem       = info->element_size();
+    const size_t       channels   = info->dimension(0);
+    const size_t       kernel_w   = info->dimension(1);
+    const size_t       kernel_h   = info->dimension(2);
+    const size_t       num_ofm    = info->dimension(3);
+    const size_t       block_size = 2 * (16 / elem);
+    const Strides     &strides    = info->strides_in_bytes();
+
+    const uint8_t *src_ptr = weights->buffer() + info->offset_first_element_in_bytes();
+    uint8_t       *dst_ptr = packed->buffer() + packed->info()->offset_first_element_in_bytes();
+
+    // Layout: [block][kernel_y][kernel_x][IFM][output channel in the block]
+    for(size_t ofm_start = 0; ofm_start < num_ofm; ofm_start += block_size)
+    {
+        for(size_t ky = 0; ky < kernel_h; ++ky)
+        {
+            for(size_t kx = 0; kx < kernel_w; ++kx)
+            {
+                for(size_t c = 0; c < channels; ++c)
+                {
+                    for(size_t o = 0; o < block_size; ++o, dst_ptr += elem)
+                    {
+                        if(ofm_start + o < num_ofm)
+                        {
+                            std::memcpy(dst_ptr, src_ptr + c * strides[0] + kx * strides[1] + ky * strides[2] + (ofm_start + o) * strides[3], elem);
+                        }
+                        else
+                        {
+                            std::memset(dst_ptr, 0, elem);
+                        }
+                    }
+                }
+            }
+        }
+    }
 }
 const char *CpuDirectConv2dKernel::name() const
 {
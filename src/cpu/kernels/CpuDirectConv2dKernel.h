@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #ifndef ARM_COMPUTE_CPU_DIRECT_CONV2D_KERNEL_H
 #define ARM_COMPUTE_CPU_DIRECT_CONV2D_KERNEL_H
 
+#include "arm_compute/core/TensorInfo.h"
 #include "src/core/common/Macros.h"
 #include "src/cpu/ICpuKernel.h"
 
@@ -37,7 +38,7 @@ namespace kernels
 class CpuDirectConv2dKernel : public ICpuKernel<CpuDirectConv2dKernel>
 {
 private:
-    using DirectConv2dKernel_Ptr = std::add_pointer<void(const Window &, const ITensor *, const ITensor *, ITensor *, const PadStrideInfo &)>::type;
+    using DirectConv2dKernel_Ptr = std::add_pointer<void(const Window &, const ITensor *, const ITensor *, const ITensor *, ITensor *, const PadStrideInfo &)>::type;
 
 public:
     CpuDirectConv2dKernel() = default;
@@ -48,6 +49,8 @@ public:
      *        1x1 convolution with stride_x = 1/2/3, stride_y = 1/2/3
      *        3x3 convolution with stride_x = 1/2/3, stride_y = 1/2/3
      *
+     * @note: For NHWC, the kernel is run on the weights packed by @ref CpuDirectConv2dKernel::pack_weights and adds the biases itself.
+     *
      * @param[in]  src       The input tensor to convolve. 3 lower dimensions represent a single input [width, height, IFM],
      *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32.
      * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM].
@@ -66,6 +69,23 @@ public:
      */
     static Status validate(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *dst, const PadStrideInfo &conv_info);
 
+    /** Compute the info of the weights packed for the NHWC micro-kernels
+     *
+     * The output channels are grouped in blocks of two vectors. Each block is a 4D tensor with dimensions
+     * [IFM * block size, kernel_x, kernel_y, number of blocks], the last block is padded with zeros.
+     *
+     * @param[in] weights Weights tensor info in NHWC. Data type supported: F16/F32.
+     *
+     * @return the packed weights tensor info
+     */
+    static TensorInfo packed_weights_info(const ITensorInfo *weights);
+    /** Pack the NHWC weights in the layout expected by the micro-kernels
+     *
+     * @param[in]  weights Weights tensor in NHWC. Data type supported: F16/F32.
+     * @param[out] packed  Packed weights tensor, with the info returned by @ref CpuDirectConv2dKernel::packed_weights_info.
+     */
+    static void pack_weights(const ITensor *weights, ITensor *packed);
+
     // Inherited methods overridden:
     void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
     const char *name() const override;
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmLowpFusedMatrixMultiplyKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/NEON/NEMath.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <arm_neon.h>
+#include <cstring>
+#include <limits>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+namespace
+{
+constexpr int panel_width  = CpuGemmLowpMatrixBPackKernel::panel_width; /**< Number of columns of Matrix B in a packed panel */
+constexpr int block_height = 4;                                          /**< Number of rows of Matrix A in a packed block */
+
+/** Dimension of the output the kernel window is split on */
+size_t compute_split_dimension(const ITensorInfo &a)
+{
+    return a.dimension(1) <= static_cast<size_t>(block_height) ? Window::DimX : Window::DimY;
+}
+
+/** Shape of the workspace holding the packed block of Matrix A of each thread
+ *
+ * The scheduler can't use more threads than there are window steps along the split dimension.
+ */
+TensorShape compute_a_blocks_shape(const ITensorInfo &a, const ITensorInfo &b)
+{
+    const size_t max_threads = compute_split_dimension(a) == Window::DimX ? ceil_to_multiple(b.dimension(0), static_cast<size_t>(panel_width)) / panel_width :
+                               ceil_to_multiple(a.dimension(1), static_cast<size_t>(block_height)) / block_height;
+    return TensorShape(a.dimension(0) * block_height, max_threads);
+}
+
+Status validate_arguments_matrix_multiply(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *dst, const ITensorInfo *a_blocks,
+                                          const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(a, b, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::U8, DataType::S8);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL, DataType::U8, DataType::S8);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->dimension(0) != b->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
+
+    const size_t num_batches   = a->tensor_shape().total_size_upper(2);
+    const size_t num_batches_b = b->tensor_shape().total_size_upper(2);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(num_batches_b != 1 && num_batches_b != num_batches, "Matrix B must have the same number of batches of matrix A or the number of batches must be set to 1");
+
+    const bool is_quantized = output_stage.type != GEMMLowpOutputStageType::NONE;
+    if(is_quantized)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN && output_stage.type != GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT);
+        ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_min_bound > output_stage.gemmlowp_max_bound);
+        if(output_stage.is_quantized_per_channel)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_multipliers.size() != b->dimension(0));
+            ARM_COMPUTE_RETURN_ERROR_ON(output_stage.gemmlowp_shifts.size() != b->dimension(0));
+        }
+    }
+
+    if(bias != nullptr)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->num_dimensions() > 1);
+        ARM_COMPUTE_RETURN_ERROR_ON(bias->dimension(0) != b->dimension(0));
+    }
+
+    if(dst->total_size() != 0)
+    {
+        if(is_quantized)
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S32);
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(0) != b->dimension(0), "Output tensor must have the same number of columns of matrix B");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->dimension(1) != a->dimension(1), "Output tensor must have the same number of rows of matrix A");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(dst->tensor_shape().total_size_upper(2) != num_batches, "Output tensor must have the same number of batches of matrix A");
+    }
+
+    if(a_blocks != nullptr && a_blocks->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a_blocks, 1, DataType::S16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(a_blocks->tensor_shape(), compute_a_blocks_shape(*a, *b));
+    }
+    return Status{};
+}
+
+/** Accumulate a 4x16 block of the output from a packed block of Matrix A and a packed panel of Matrix B */
+inline void multiply_block(const int16_t *a_ptr, const int16_t *b_ptr, int k, int32x4x4_t acc[block_height])
+{
+    for(int i = 0; i < k; ++i, a_ptr += block_height, b_ptr += panel_width)
+    {
+        const int16x8_t b0 = vld1q_s16(b_ptr);
+        const int16x8_t b1 = vld1q_s16(b_ptr + 8);
+        const int16x4_t a  = vld1_s16(a_ptr);
+
+        acc[0].val[0] = vmlal_lane_s16(acc[0].val[0], vget_low_s16(b0), a, 0);
+        acc[0].val[1] = vmlal_lane_s16(acc[0].val[1], vget_high_s16(b0), a, 0);
+        acc[0].val[2] = vmlal_lane_s16(acc[0].val[2], vget_low_s16(b1), a, 0);
+        acc[0].val[3] = vmlal_lane_s16(acc[0].val[3], vget_high_s16(b1), a, 0);
+
+        acc[1].val[0] = vmlal_lane_s16(acc[1].val[0], vget_low_s16(b0), a, 1);
+        acc[1].val[1] = vmlal_lane_s16(acc[1].val[1], vget_high_s16(b0), a, 1);
+        acc[1].val[2] = vmlal_lane_s16(acc[1].val[2], vget_low_s16(b1), a, 1);
+        acc[1].val[3] = vmlal_lane_s16(acc[1].val[3], vget_high_s16(b1), a, 1);
+
+        acc[2].val[0] = vmlal_lane_s16(acc[2].val[0], vget_low_s16(b0), a, 2);
+        acc[2].val[1] = vmlal_lane_s16(acc[2].val[1], vget_high_s16(b0), a, 2);
+        acc[2].val[2] = vmlal_lane_s16(acc[2].val[2], vget_low_s16(b1), a, 2);
+        acc[2].val[3] = vmlal_lane_s16(acc[2].val[3], vget_high_s16(b1), a, 2);
+
+        acc[3].val[0] = vmlal_lane_s16(acc[3].val[0], vget_low_s16(b0), a, 3);
+        acc[3].val[1] = vmlal_lane_s16(acc[3].val[1], vget_high_s16(b0), a, 3);
+        acc[3].val[2] = vmlal_lane_s16(acc[3].val[2], vget_low_s16(b1), a, 3);
+        acc[3].val[3] = vmlal_lane_s16(acc[3].val[3], vget_high_s16(b1), a, 3);
+    }
+}
+
+inline int32x4x4_t load_s32x16(const int32_t *ptr)
+{
+    return
+    {
+        {
+            vld1q_s32(ptr),
+            vld1q_s32(ptr + 4),
+            vld1q_s32(ptr + 8),
+            vld1q_s32(ptr + 12)
+        }
+    };
+}
+
+/** Apply the output stage on a row of 16 offset-corrected values */
+inline void requantize(int32x4x4_t &in_s32, const int32x4x4_t &multiplier, const int32x4x4_t &shift, int32x4_t result_offset, bool is_fixed_point)
+{
+    const int32x4_t zero_s32 = vdupq_n_s32(0);
+    for(int i = 0; i < 4; ++i)
+    {
+        if(is_fixed_point)
+        {
+            // A negative shift is a left shift applied before the fixed point multiplication
+            const int32x4_t left_shift  = vmaxq_s32(vnegq_s32(shift.val[i]), zero_s32);
+            const int32x4_t right_shift = vmaxq_s32(shift.val[i], zero_s32);
+
+            in_s32.val[i] = vqrdmulhq_s32(vshlq_s32(in_s32.val[i], left_shift), multiplier.val[i]);
+            in_s32.val[i] = vaddq_s32(rounding_divide_by_pow2(in_s32.val[i], right_shift), result_offset);
+        }
+        else
+        {
+            // The result offset has already been added with the other offsets
+            in_s32.val[i] = vshlq_s32(vmulq_s32(in_s32.val[i], multiplier.val[i]), vnegq_s32(shift.val[i]));
+        }
+    }
+}
+
+template <typename T>
+inline void store_row(T *ptr, const int32x4x4_t &in_s32, int cols);
+
+template <>
+inline void store_row(int32_t *ptr, const int32x4x4_t &in_s32, int cols)
+{
+    int32_t  tmp[panel_width];
+    int32_t *out = cols == panel_width ? ptr : tmp;
+    vst1q_s32(out, in_s32.val[0]);
+    vst1q_s32(out + 4, in_s32.val[1]);
+    vst1q_s32(out + 8, in_s32.val[2]);
+    vst1q_s32(out + 12, in_s32.val[3]);
+    if(out != ptr)
+    {
+        std::memcpy(ptr, tmp, cols * sizeof(int32_t));
+    }
+}
+
+template <>
+inline void store_row(uint8_t *ptr, const int32x4x4_t &in_s32, int cols)
+{
+    // Values have already been clamped to the output range
+    const uint8x16_t out_u8 = vcombine_u8(vqmovun_s16(vcombine_s16(vmovn_s32(in_s32.val[0]), vmovn_s32(in_s32.val[1]))),
+                                          vqmovun_s16(vcombine_s16(vmovn_s32(in_s32.val[2]), vmovn_s32(in_s32.val[3]))));
+    if(cols == panel_width)
+    {
+        vst1q_u8(ptr, out_u8);
+    }
+    else
+    {
+        uint8_t tmp[panel_width];
+        vst1q_u8(tmp, out_u8);
+        std::memcpy(ptr, tmp, cols);
+    }
+}
+
+template <>
+inline void store_row(int8_t *ptr, const int32x4x4_t &in_s32, int cols)
+{
+    // Values have already been clamped to the output range
+    const int8x16_t out_s8 = vcombine_s8(vqmovn_s16(vcombine_s16(vmovn_s32(in_s32.val[0]), vmovn_s32(in_s32.val[1]))),
+                                         vqmovn_s16(vcombine_s16(vmovn_s32(in_s32.val[2]), vmovn_s32(in_s32.val[3]))));
+    if(cols == panel_width)
+    {
+        vst1q_s8(ptr, out_s8);
+    }
+    else
+    {
+        int8_t tmp[panel_width];
+        vst1q_s8(tmp, out_s8);
+        std::memcpy(ptr, tmp, cols);
+    }
+}
+} // namespace
+
+void CpuGemmLowpFusedMatrixMultiplyKernel::configure(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, ITensorInfo *dst, ITensorInfo *a_blocks, int32_t a_offset,
+                                                     int32_t b_offset, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a, b, dst, a_blocks);
+
+    // Output auto initialization if not yet initialized
+    const bool  is_quantized = output_stage.type != GEMMLowpOutputStageType::NONE;
+    TensorShape dst_shape    = a->tensor_shape();
+    dst_shape.set(0, b->dimension(0));
+    auto_init_if_empty(*dst, a->clone()->set_tensor_shape(dst_shape).set_data_type(is_quantized ? a->data_type() : DataType::S32));
+    auto_init_if_empty(*a_blocks, TensorInfo(compute_a_blocks_shape(*a, *b), 1, DataType::S16));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_matrix_multiply(a, b, bias, dst, a_blocks, output_stage));
+
+    _a_offset        = a_offset;
+    _b_offset        = b_offset;
+    _output_stage    = output_stage;
+    _slide_matrix_b  = b->tensor_shape().total_size_upper(2) > 1;
+    _split_dimension = compute_split_dimension(*a);
+
+    const bool is_signed_a = a->data_type() == DataType::QASYMM8_SIGNED || a->data_type() == DataType::S8;
+    switch(dst->data_type())
+    {
+        case DataType::S32:
+            _func = is_signed_a ? &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<int8_t, int32_t> : &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<uint8_t, int32_t>;
+            break;
+        case DataType::QASYMM8:
+            _func = is_signed_a ? &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<int8_t, uint8_t> : &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<uint8_t, uint8_t>;
+            break;
+        case DataType::QASYMM8_SIGNED:
+            _func = is_signed_a ? &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<int8_t, int8_t> : &CpuGemmLowpFusedMatrixMultiplyKernel::run_internal<uint8_t, int8_t>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+
+    // Each window step computes a 4x16 block of the output, all the batches are collapsed on the z dimension
+    Window win = calculate_max_window(*dst, Steps(panel_width, block_height));
+    win        = win.collapse(win, Window::DimZ);
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmLowpFusedMatrixMultiplyKernel::validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *dst, const ITensorInfo *a_blocks,
+                                                      int32_t a_offset, int32_t b_offset, const GEMMLowpOutputStageInfo &output_stage)
+{
+    ARM_COMPUTE_UNUSED(a_offset, b_offset);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_matrix_multiply(a, b, bias, dst, a_blocks, output_stage));
+    return Status{};
+}
+
+size_t CpuGemmLowpFusedMatrixMultiplyKernel::split_dimension() const
+{
+    return _split_dimension;
+}
+
+template <typename TA, typename TOut>
+void CpuGemmLowpFusedMatrixMultiplyKernel::run_internal(ITensorPack &tensors, const Window &window, int16_t *a_block)
+{
+    auto a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
+    auto packed_b       = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+    auto vector_sum_col = tensors.get_const_tensor(TensorType::ACL_SRC_2);
+    auto bias           = tensors.get_const_tensor(TensorType::ACL_SRC_3);
+    auto dst            = tensors.get_tensor(TensorType::ACL_DST);
+
+    const int num_cols = static_cast<int>(dst->info()->dimension(0));
+    const int num_rows = static_cast<int>(dst->info()->dimension(1));
+    const int k        = static_cast<int>(a->info()->dimension(0));
+
+    const size_t  a_stride_y            = a->info()->strides_in_bytes().y();
+    const size_t  a_stride_z            = a->info()->strides_in_bytes().z();
+    const size_t  packed_b_stride_y     = packed_b->info()->strides_in_bytes().y();
+    const size_t  packed_b_stride_batch = _slide_matrix_b ? packed_b->info()->strides_in_bytes().z() : 0;
+    const size_t  sum_col_stride_batch  = _slide_matrix_b ? vector_sum_col->info()->strides_in_bytes().y() : 0;
+    const size_t  dst_stride_y          = dst->info()->strides_in_bytes().y();
+    const size_t  dst_stride_z          = dst->info()->strides_in_bytes().z();
+    const auto    a_base                = a->buffer() + a->info()->offset_first_element_in_bytes();
+    const auto    packed_b_base         = packed_b->buffer() + packed_b->info()->offset_first_element_in_bytes();
+    const auto    sum_col_base          = vector_sum_col->buffer() + vector_sum_col->info()->offset_first_element_in_bytes();
+    const auto    dst_base              = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const auto    bias_ptr              = bias != nullptr ? reinterpret_cast<const int32_t *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+    const bool    is_quantized          = _output_stage.type != GEMMLowpOutputStageType::NONE;
+    const bool    is_fixed_point        = _output_stage.type == GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    const bool    is_per_channel        = is_quantized && _output_stage.is_quantized_per_channel;
+    const int32_t k_offset              = _a_offset * _b_offset * k;
+    const int32_t result_offset         = is_quantized ? _output_stage.gemmlowp_offset : 0;
+
+    // Bounded ReLU and saturation to the output type are applied together
+    const int32_t   min_bound = std::max<int32_t>(_output_stage.gemmlowp_min_bound, std::numeric_limits<TOut>::lowest());
+    const int32_t   max_bound = std::min<int32_t>(_output_stage.gemmlowp_max_bound, std::numeric_limits<TOut>::max());
+    const int32x4_t min_s32   = vdupq_n_s32(min_bound);
+    const int32x4_t max_s32   = vdupq_n_s32(max_bound);
+
+    for(int z = window.z().start(); z < window.z().end(); ++z)
+    {
+        const auto b_batch       = packed_b_base + z * packed_b_stride_batch;
+        const auto sum_col_batch = reinterpret_cast<const int32_t *>(sum_col_base + z * sum_col_stride_batch);
+
+        for(int y = window.y().start(); y < std::min(window.y().end(), num_rows); y += block_height)
+        {
+            // Pack the rows of Matrix A and compute their sums in the same pass, missing rows are zero.
+            // The block is reused for all the panels of Matrix B in the window
+            const int rows                   = std::min(block_height, num_rows - y);
+            int32_t   row_sums[block_height] = { 0 };
+            for(int r = 0; r < block_height; ++r)
+            {
+                if(r >= rows)
+                {
+                    for(int i = 0; i < k; ++i)
+                    {
+                        a_block[i * block_height + r] = 0;
+                    }
+                    continue;
+                }
+                const auto row = reinterpret_cast<const TA *>(a_base + z * a_stride_z + (y + r) * a_stride_y);
+                for(int i = 0; i < k; ++i)
+                {
+                    a_block[i * block_height + r] = static_cast<int16_t>(row[i]);
+                    row_sums[r] += row[i];
+                }
+            }
+
+            for(int x = window.x().start(); x < std::min(window.x().end(), num_cols); x += panel_width)
+            {
+                const int cols = std::min(panel_width, num_cols - x);
+
+                int32x4x4_t acc[block_height];
+                for(auto &block_row : acc)
+                {
+                    block_row = { { vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0), vdupq_n_s32(0) } };
+                }
+                multiply_block(a_block, reinterpret_cast<const int16_t *>(b_batch + (x / panel_width) * packed_b_stride_y), k, acc);
+
+                // Per column terms of the epilogue, the lanes past the last column are never stored
+                int32_t col_terms[panel_width]   = { 0 };
+                int32_t multipliers[panel_width] = { 0 };
+                int32_t shifts[panel_width]      = { 0 };
+                for(int j = 0; j < cols; ++j)
+                {
+                    col_terms[j] = _a_offset * sum_col_batch[x + j] + (bias_ptr != nullptr ? bias_ptr[x + j] : 0) + (is_fixed_point ? 0 : result_offset);
+                    if(is_quantized)
+                    {
+                        multipliers[j] = is_per_channel ? _output_stage.gemmlowp_multipliers[x + j] : _output_stage.gemmlowp_multiplier;
+                        shifts[j]      = is_per_channel ? _output_stage.gemmlowp_shifts[x + j] : _output_stage.gemmlowp_shift;
+                    }
+                }
+                const int32x4x4_t col_terms_s32   = load_s32x16(col_terms);
+                const int32x4x4_t multipliers_s32 = load_s32x16(multipliers);
+                const int32x4x4_t shifts_s32      = load_s32x16(shifts);
+
+                for(int r = 0; r < rows; ++r)
+                {
+                    const int32x4_t row_term = vdupq_n_s32(_b_offset * row_sums[r] + k_offset);
+                    int32x4x4_t     in_s32   = acc[r];
+                    for(int i = 0; i < 4; ++i)
+                    {
+                        in_s32.val[i] = vaddq_s32(vaddq_s32(in_s32.val[i], col_terms_s32.val[i]), row_term);
+                    }
+
+                    if(is_quantized)
+                    {
+                        requantize(in_s32, multipliers_s32, shifts_s32, vdupq_n_s32(result_offset), is_fixed_point);
+                        for(int i = 0; i < 4; ++i)
+                        {
+                            in_s32.val[i] = vminq_s32(vmaxq_s32(in_s32.val[i], min_s32), max_s32);
+                        }
+                    }
+                    store_row(reinterpret_cast<TOut *>(dst_base + z * dst_stride_z + (y + r) * dst_stride_y) + x, in_s32, cols);
+                }
+            }
+        }
+    }
+}
+
+void CpuGemmLowpFusedMatrixMultiplyKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    auto a_blocks = tensors.get_tensor(TensorType::ACL_INT_0);
+    ARM_COMPUTE_ERROR_ON_NULLPTR(a_blocks);
+    ARM_COMPUTE_ERROR_ON(static_cast<size_t>(info.thread_id) >= a_blocks->info()->dimension(1));
+    auto a_block = reinterpret_cast<int16_t *>(a_blocks->buffer() + a_blocks->info()->offset_first_element_in_bytes() + info.thread_id * a_blocks->info()->strides_in_bytes().y());
+
+    (this->*_func)(tensors, window, a_block);
+}
+
+const char *CpuGemmLowpFusedMatrixMultiplyKernel::name() const
+{
+    return "CpuGemmLowpFusedMatrixMultiplyKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPU_GEMMLOWP_FUSED_MATRIXMULTIPLY_KERNEL_H
+#define ARM_COMPUTE_CPU_GEMMLOWP_FUSED_MATRIXMULTIPLY_KERNEL_H
+
+#include "arm_compute/core/KernelDescriptors.h"
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+#include "src/cpu/kernels/CpuGemmLowpMatrixBPackKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel used to multiply two quantized matrices and to finalize the result in a single pass.
+ *
+ * Rows of Matrix A are packed in blocks of 4 into the workspace row of the calling thread, and their sums are computed while packing.
+ * Each 4x16 block of the output is accumulated in S32 registers from the packed Matrix B of @ref CpuGemmLowpMatrixBPackKernel, then the epilogue adds
+ * the offset contribution and the bias and performs the output stage before storing the block:
+ *
+ * mm_result'[i][k] = mm_result[i][k] +
+ *                    (vector_sum_col[k] * a_offset) +
+ *                    (vector_sum_row[i] * b_offset) +
+ *                    (a_offset * b_offset * k) +
+ *                    bias[k]
+ *
+ * The output stage is the one of @ref CpuGemmLowpOffsetContributionOutputStageKernel. Matrices A and B may have different signedness.
+ */
+class CpuGemmLowpFusedMatrixMultiplyKernel : public ICpuKernel<CpuGemmLowpFusedMatrixMultiplyKernel>
+{
+public:
+    /** Default constructor */
+    CpuGemmLowpFusedMatrixMultiplyKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmLowpFusedMatrixMultiplyKernel);
+    /** Initialise the kernel's inputs and output.
+     *
+     * @param[in]  a            Input tensor info (Matrix A). Data type supported: QASYMM8/QASYMM8_SIGNED/U8/S8
+     * @param[in]  b            Input tensor info (Matrix B) before packing. Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL/U8/S8
+     * @param[in]  bias         Biases tensor info. Only shared biases supported and it can be a nullptr if the addition of biases is not required.
+     *                          Biases are 1D tensor with dimensions [OFM]. Data type supported: S32.
+     * @param[out] dst          Output tensor info. Data type supported: S32 if @p output_stage.type is NONE, QASYMM8/QASYMM8_SIGNED otherwise
+     * @param[out] a_blocks     Workspace tensor info holding a packed block of rows of Matrix A per thread the kernel can be split on. Data type supported: S16
+     * @param[in]  a_offset     Offset to be added to each element of the matrix A.
+     * @param[in]  b_offset     Offset to be added to each element of the matrix B.
+     * @param[in]  output_stage GEMMLowp output stage info. Supported types: NONE/QUANTIZE_DOWN/QUANTIZE_DOWN_FIXEDPOINT
+     */
+    void configure(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, ITensorInfo *dst, ITensorInfo *a_blocks, int32_t a_offset, int32_t b_offset,
+                   const GEMMLowpOutputStageInfo &output_stage);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmLowpFusedMatrixMultiplyKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *bias, const ITensorInfo *dst, const ITensorInfo *a_blocks, int32_t a_offset, int32_t b_offset,
+                           const GEMMLowpOutputStageInfo &output_stage);
+
+    /** Dimension along which the kernel window should be split by the scheduler
+     *
+     * @return the split dimension
+     */
+    size_t split_dimension() const;
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+
+private:
+    /** Execution of the kernel specialized on the data types
+     *
+     * @param[in] tensors Tensor pack holding Matrix A, the packed Matrix B, its column sums, the biases and the output
+     * @param[in] window  Region on which to execute the kernel.
+     * @param[in] a_block Workspace of the calling thread for a packed block of rows of Matrix A
+     */
+    template <typename TA, typename TOut>
+    void run_internal(ITensorPack &tensors, const Window &window, int16_t *a_block);
+
+    using CpuGemmLowpFusedMatrixMultiplyKernelPtr = void (CpuGemmLowpFusedMatrixMultiplyKernel::*)(ITensorPack &tensors, const Window &window, int16_t *a_block);
+
+    CpuGemmLowpFusedMatrixMultiplyKernelPtr _func{ nullptr };
+    int32_t                                 _a_offset{ 0 };
+    int32_t                                 _b_offset{ 0 };
+    bool                                    _slide_matrix_b{ false };
+    size_t                                  _split_dimension{ Window::DimY };
+    GEMMLowpOutputStageInfo                 _output_stage{};
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_GEMMLOWP_FUSED_MATRIXMULTIPLY_KERNEL_H */
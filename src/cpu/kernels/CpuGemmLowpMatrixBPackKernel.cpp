@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/cpu/kernels/CpuGemmLowpMatrixBPackKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/WindowHelpers.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+constexpr int CpuGemmLowpMatrixBPackKernel::panel_width;
+
+namespace
+{
+constexpr int panel_width = CpuGemmLowpMatrixBPackKernel::panel_width;
+
+TensorShape compute_packed_b_shape(const ITensorInfo &b)
+{
+    return TensorShape(b.dimension(1) * panel_width, ceil_to_multiple(b.dimension(0), static_cast<size_t>(panel_width)) / panel_width, b.tensor_shape().total_size_upper(2));
+}
+
+TensorShape compute_vector_sum_col_shape(const ITensorInfo &b)
+{
+    return TensorShape(b.dimension(0), b.tensor_shape().total_size_upper(2));
+}
+
+Status validate_arguments_matrix_b_pack(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *vector_sum_col)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, dst, vector_sum_col);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8, DataType::QSYMM8_PER_CHANNEL, DataType::U8, DataType::S8);
+
+    if(dst->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(dst, 1, DataType::S16);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), compute_packed_b_shape(*src));
+    }
+    if(vector_sum_col->total_size() != 0)
+    {
+        ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(vector_sum_col, 1, DataType::S32);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(vector_sum_col->tensor_shape(), compute_vector_sum_col_shape(*src));
+    }
+    return Status{};
+}
+
+template <typename T>
+void pack_matrix_b(const ITensor *src, ITensor *dst, ITensor *vector_sum_col, const Window &window)
+{
+    const int    num_cols       = static_cast<int>(src->info()->dimension(0));
+    const int    num_rows       = static_cast<int>(src->info()->dimension(1));
+    const size_t src_stride_y   = src->info()->strides_in_bytes().y();
+    const size_t src_stride_z   = src->info()->strides_in_bytes().z();
+    const size_t dst_stride_y   = dst->info()->strides_in_bytes().y();
+    const size_t dst_stride_z   = dst->info()->strides_in_bytes().z();
+    const size_t sum_col_stride = vector_sum_col->info()->strides_in_bytes().y();
+    const auto   src_base       = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const auto   dst_base       = dst->buffer() + dst->info()->offset_first_element_in_bytes();
+    const auto   sum_col_base   = vector_sum_col->buffer() + vector_sum_col->info()->offset_first_element_in_bytes();
+
+    for(int z = window.y().start(); z < window.y().end(); ++z)
+    {
+        for(int x = window.x().start(); x < window.x().end(); x += panel_width)
+        {
+            const int cols  = std::min(panel_width, num_cols - x);
+            auto      panel = reinterpret_cast<int16_t *>(dst_base + z * dst_stride_z + (x / panel_width) * dst_stride_y);
+
+            int32_t sums[panel_width] = { 0 };
+            for(int k = 0; k < num_rows; ++k)
+            {
+                const auto row = reinterpret_cast<const T *>(src_base + z * src_stride_z + k * src_stride_y) + x;
+                for(int j = 0; j < cols; ++j)
+                {
+                    panel[j] = static_cast<int16_t>(row[j]);
+                    sums[j] += row[j];
+                }
+                for(int j = cols; j < panel_width; ++j)
+                {
+                    panel[j] = 0;
+                }
+                panel += panel_width;
+            }
+            std::memcpy(sum_col_base + z * sum_col_stride + x * sizeof(int32_t), sums, cols * sizeof(int32_t));
+        }
+    }
+}
+} // namespace
+
+void CpuGemmLowpMatrixBPackKernel::configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *vector_sum_col)
+{
+    ARM_COMPUTE_ERROR_ON_NULLPTR(src, dst, vector_sum_col);
+
+    // Output auto initialization if not yet initialized
+    auto_init_if_empty(*dst, TensorInfo(compute_packed_b_shape(*src), 1, DataType::S16));
+    auto_init_if_empty(*vector_sum_col, TensorInfo(compute_vector_sum_col_shape(*src), 1, DataType::S32));
+
+    ARM_COMPUTE_ERROR_THROW_ON(validate_arguments_matrix_b_pack(src, dst, vector_sum_col));
+
+    // Each window step along x packs a panel of Matrix B, the y dimension is the batch dimension
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(static_cast<int>(src->dimension(0)), panel_width), panel_width));
+    win.set(Window::DimY, Window::Dimension(0, static_cast<int>(src->tensor_shape().total_size_upper(2)), 1));
+    ICpuKernel::configure(win);
+}
+
+Status CpuGemmLowpMatrixBPackKernel::validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *vector_sum_col)
+{
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments_matrix_b_pack(src, dst, vector_sum_col));
+    return Status{};
+}
+
+void CpuGemmLowpMatrixBPackKernel::run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info)
+{
+    ARM_COMPUTE_UNUSED(info);
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICpuKernel::window(), window);
+
+    auto src            = tensors.get_const_tensor(TensorType::ACL_SRC);
+    auto dst            = tensors.get_tensor(TensorType::ACL_DST_0);
+    auto vector_sum_col = tensors.get_tensor(TensorType::ACL_DST_1);
+
+    switch(src->info()->data_type())
+    {
+        case DataType::QASYMM8:
+        case DataType::U8:
+            pack_matrix_b<uint8_t>(src, dst, vector_sum_col, window);
+            break;
+        case DataType::QASYMM8_SIGNED:
+        case DataType::QSYMM8:
+        case DataType::QSYMM8_PER_CHANNEL:
+        case DataType::S8:
+            pack_matrix_b<int8_t>(src, dst, vector_sum_col, window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+}
+
+const char *CpuGemmLowpMatrixBPackKernel::name() const
+{
+    return "CpuGemmLowpMatrixBPackKernel";
+}
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_CPU_GEMMLOWP_MATRIXB_PACK_KERNEL_H
+#define ARM_COMPUTE_CPU_GEMMLOWP_MATRIXB_PACK_KERNEL_H
+
+#include "src/core/common/Macros.h"
+#include "src/cpu/ICpuKernel.h"
+
+namespace arm_compute
+{
+namespace cpu
+{
+namespace kernels
+{
+/** Kernel used to pack Matrix B for @ref CpuGemmLowpFusedMatrixMultiplyKernel and compute the sums of its columns.
+ *
+ * Matrix B is widened to S16 and stored in panels of 16 columns. Each panel holds the 16 values of a row next to each other,
+ * the last panel is padded with zeros. The sums of all the entries in each column are computed in the same pass.
+ */
+class CpuGemmLowpMatrixBPackKernel : public ICpuKernel<CpuGemmLowpMatrixBPackKernel>
+{
+public:
+    static constexpr int panel_width = 16; /**< Number of columns of Matrix B in a packed panel */
+
+    /** Default constructor */
+    CpuGemmLowpMatrixBPackKernel() = default;
+    ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmLowpMatrixBPackKernel);
+    /** Initialise the kernel's input and outputs.
+     *
+     * @param[in]  src            Input tensor info (Matrix B). Data type supported: QASYMM8/QASYMM8_SIGNED/QSYMM8/QSYMM8_PER_CHANNEL/U8/S8
+     * @param[out] dst            Output tensor info of the packed matrix. Data type supported: S16
+     * @param[out] vector_sum_col Output row-vector tensor info of sums of all the entries in each column of @p src.
+     *                            A 2D tensor where the y dim is the batch dimension of @p src. Data type supported: S32
+     */
+    void configure(const ITensorInfo *src, ITensorInfo *dst, ITensorInfo *vector_sum_col);
+    /** Static function to check if given info will lead to a valid configuration
+     *
+     * Similar to CpuGemmLowpMatrixBPackKernel::configure()
+     *
+     * @return a status
+     */
+    static Status validate(const ITensorInfo *src, const ITensorInfo *dst, const ITensorInfo *vector_sum_col);
+
+    // Inherited methods overridden:
+    void run_op(ITensorPack &tensors, const Window &window, const ThreadInfo &info) override;
+    const char *name() const override;
+};
+} // namespace kernels
+} // namespace cpu
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_CPU_GEMMLOWP_MATRIXB_PACK_KERNEL_H */
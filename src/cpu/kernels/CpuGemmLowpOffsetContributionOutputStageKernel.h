@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022 Arm Limited.
+ * Copyright (c) 2019-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,11 +34,11 @@ namespace cpu
 {
 namespace kernels
 {
-/** Kernel used to add the offset contribution and perform the output stage after @ref CpuGemmLowpMatrixMultiplyKernel.
+/** Kernel used to add the offset contribution and perform the output stage after the matrix multiplication in @ref CpuGemmLowpMatrixMultiplyCore.
  *
  * The computation is performed in-place
  *
- * This kernel takes a final int32 accumulator value (the output of @ref CpuGemmLowpMatrixMultiplyKernel),
+ * This kernel takes a final int32 accumulator value (the output of the matrix multiplication in @ref CpuGemmLowpMatrixMultiplyCore),
  * and adds to it the offset contribution of matrix A and matrix B in-place.
  *
  * The output stage can perform either QuantizeDownInt32ToUint8Scale or QuantizeDownInt32ToUint8ScaleByFixedPoint for Uint8.
@@ -71,7 +71,7 @@ public:
     ARM_COMPUTE_DISALLOW_COPY_ALLOW_MOVE(CpuGemmLowpOffsetContributionOutputStageKernel);
     /** Initialise the kernel inputs and output.
      *
-     * @param[in]  mm_result      Input tensor info containing the result of @ref CpuGemmLowpMatrixMultiplyKernel. Data type supported: S32
+     * @param[in]  mm_result      Input tensor info containing the result of the matrix multiplication in @ref CpuGemmLowpMatrixMultiplyCore. Data type supported: S32
      * @param[in]  vector_sum_col Input row-vector tensor info of sums of all the entries in each column of matrix B.
      *                            Can be a 1D or 2D tensor, in case of 2D, y dim is the batch dimension
      *                            Note: vector_sum_col can be a nullptr in case a_offset = 0. Data type supported: same as @p mm_result
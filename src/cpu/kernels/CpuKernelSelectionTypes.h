@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022 Arm Limited.
+ * Copyright (c) 2021-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -82,6 +82,7 @@ struct ActivationDataTypeISASelectorData
     const CPUModel                         &cpumodel;
     const cpuinfo::CpuIsaInfo              &isa;
     ActivationLayerInfo::ActivationFunction f;
+    bool                                    fast_math;
 };
 
 struct CpuAddKernelDataTypeISASelectorData
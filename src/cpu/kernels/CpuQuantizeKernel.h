@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -48,6 +48,7 @@ public:
      * @param[out] dst Destination tensor info with the same dimensions of input. Data types supported: QASYMM8/QASYMM8_SIGNED/QASYMM16.
      *
      * @note Output auto initialization is not supported by this kernel
+     * @note When @p src and @p dst have the same element size, the tensors they describe can share their memory
      */
     void configure(const ITensorInfo *src, ITensorInfo *dst);
     /** Static function to check if given info will lead to a valid configuration
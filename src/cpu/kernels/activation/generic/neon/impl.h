@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022 Arm Limited.
+ * Copyright (c) 2020-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,102 @@ inline float16x8_t mask_float_vector(const float16x8_t &in, const uint16x8_t &ma
 #endif //defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
 #endif /* __aarch64__ */
 
+/** Check if an activation function has a fast approximation used when @ref ActivationLayerInfo::fast_math is set */
+inline bool has_fast_approximation(ActivationLayerInfo::ActivationFunction act)
+{
+    switch(act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+        case ActivationLayerInfo::ActivationFunction::TANH:
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/** [7/6] Padé approximation of tanh, the maximum absolute error is 1e-4 */
+inline float tanh_fast(float x)
+{
+    const float c  = std::min(std::max(x, -9.f), 9.f);
+    const float x2 = c * c;
+    const float p  = c * (135135.f + x2 * (17325.f + x2 * (378.f + x2)));
+    const float q  = 135135.f + x2 * (62370.f + x2 * (3150.f + x2 * 28.f));
+    return std::min(std::max(p / q, -1.f), 1.f);
+}
+
+/** Vector version of @ref tanh_fast */
+inline float32x4_t vtanh_fast(const float32x4_t &x)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t c   = vminq_f32(vmaxq_f32(x, vdupq_n_f32(-9.f)), vdupq_n_f32(9.f));
+    const float32x4_t x2  = vmulq_f32(c, c);
+
+    float32x4_t p = vaddq_f32(vdupq_n_f32(378.f), x2);
+    p             = vmlaq_f32(vdupq_n_f32(17325.f), x2, p);
+    p             = vmulq_f32(c, vmlaq_f32(vdupq_n_f32(135135.f), x2, p));
+
+    float32x4_t q = vmlaq_f32(vdupq_n_f32(3150.f), x2, vdupq_n_f32(28.f));
+    q             = vmlaq_f32(vdupq_n_f32(62370.f), x2, q);
+    q             = vmlaq_f32(vdupq_n_f32(135135.f), x2, q);
+
+    return vminq_f32(vmaxq_f32(wrapper::vdiv(p, q), vnegq_f32(one)), one);
+}
+
+/** Fast approximation of the activation functions for which @ref has_fast_approximation is true
+ *
+ * LOGISTIC and SWISH use logistic(x) = 0.5 + 0.5 * tanh(x / 2), GELU uses its tanh formulation.
+ */
+inline float activation_fast(float in, ActivationLayerInfo::ActivationFunction act, float a, float b)
+{
+    switch(act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return 0.5f + 0.5f * tanh_fast(0.5f * in);
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return a * tanh_fast(b * in);
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            return in * (0.5f + 0.5f * tanh_fast(0.5f * a * in));
+        case ActivationLayerInfo::ActivationFunction::GELU:
+            return 0.5f * in * (1.f + tanh_fast(in * (0.7978845608f + 0.0356774081f * in * in)));
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+/** Vector version of @ref activation_fast */
+inline float32x4_t vactivation_fast(const float32x4_t &vin, ActivationLayerInfo::ActivationFunction act, float a, float b)
+{
+    const float32x4_t const_half = vdupq_n_f32(0.5f);
+    switch(act)
+    {
+        case ActivationLayerInfo::ActivationFunction::LOGISTIC:
+            return vmlaq_f32(const_half, const_half, vtanh_fast(vmulq_f32(const_half, vin)));
+        case ActivationLayerInfo::ActivationFunction::TANH:
+            return vmulq_n_f32(vtanh_fast(vmulq_n_f32(vin, b)), a);
+        case ActivationLayerInfo::ActivationFunction::SWISH:
+            return vmulq_f32(vin, vmlaq_f32(const_half, const_half, vtanh_fast(vmulq_n_f32(vin, 0.5f * a))));
+        case ActivationLayerInfo::ActivationFunction::GELU:
+        {
+            const float32x4_t k = vmulq_f32(vin, vmlaq_f32(vdupq_n_f32(0.7978845608f), vmulq_f32(vin, vin), vdupq_n_f32(0.0356774081f)));
+            return vmulq_f32(vmulq_f32(const_half, vin), vaddq_f32(vdupq_n_f32(1.f), vtanh_fast(k)));
+        }
+        default:
+            ARM_COMPUTE_ERROR("Unsupported activation function");
+    }
+}
+
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+/** Vector version of @ref activation_fast for F16, the approximation is evaluated in F32 to stay within the F16 range */
+inline float16x8_t vactivation_fast(const float16x8_t &vin, ActivationLayerInfo::ActivationFunction act, float a, float b)
+{
+    const float32x4_t lo = vactivation_fast(vcvt_f32_f16(vget_low_f16(vin)), act, a, b);
+    const float32x4_t hi = vactivation_fast(vcvt_f32_f16(vget_high_f16(vin)), act, a, b);
+    return vcombine_f16(vcvt_f16_f32(lo), vcvt_f16_f32(hi));
+}
+#endif //defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+
 template <typename T, const ActFpImplParams &P>
 void fp_neon_activation_impl(const ITensor *src, ITensor *dst, const ActivationLayerInfo &act_info, const Window &window)
 {
@@ -87,6 +183,7 @@ void fp_neon_activation_impl(const ITensor *src, ITensor *dst, const ActivationL
     const auto      vb                = wrapper::vdup_n(static_cast<T>(act_info.b()), ExactTagType{});
     const auto      a                 = static_cast<T>(act_info.a());
     const auto      b                 = static_cast<T>(act_info.b());
+    const bool      use_fast          = act_info.fast_math() && has_fast_approximation(act);
     execute_window_loop(win_collapsed, [&](const Coordinates &)
     {
         const auto input_ptr  = reinterpret_cast<const T *>(input.ptr());
@@ -94,6 +191,18 @@ void fp_neon_activation_impl(const ITensor *src, ITensor *dst, const ActivationL
         wrapper::traits::neon_bitvector_t<T, wrapper::traits::BitWidth::W128> tmp;
         // Compute S elements per iteration
         int x = window_start_x;
+        if(use_fast)
+        {
+            for(; x <= (window_end_x - window_step_x); x += window_step_x)
+            {
+                wrapper::vstore(output_ptr + x, vactivation_fast(wrapper::vloadq(input_ptr + x), act, act_info.a(), act_info.b()));
+            }
+            for(; x < window_end_x; ++x)
+            {
+                *(output_ptr + x) = static_cast<T>(activation_fast(static_cast<float>(input_ptr[x]), act, act_info.a(), act_info.b()));
+            }
+            return;
+        }
         for(; x <= (window_end_x - window_step_x); x += window_step_x)
         {
             const auto vin = wrapper::vloadq(input_ptr + x);
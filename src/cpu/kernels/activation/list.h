@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2023 Arm Limited.
+ * Copyright (c) 2020-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@ namespace cpu
 DECLARE_ACTIVATION_KERNEL(neon_q8_activation_lut);
 #endif // __aarch64__
 DECLARE_ACTIVATION_KERNEL(sve2_q8_activation_lut);
+DECLARE_ACTIVATION_KERNEL(neon_16bit_activation_lut);
 DECLARE_ACTIVATION_KERNEL(neon_qasymm8_activation);
 DECLARE_ACTIVATION_KERNEL(sve2_qasymm8_activation);
 DECLARE_ACTIVATION_KERNEL(neon_qasymm8_signed_activation);
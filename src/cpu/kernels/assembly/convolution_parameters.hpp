@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,8 +37,8 @@ namespace arm_gemm
  *
  * The parameters describe the convolution details - the notional shape of
  * the input and output tensors, whether padding is to be applied, the size
- * of the kernel and a constant value to be used for padding (needed for
- * quantized tensors).
+ * of the kernel, its dilation and a constant value to be used for padding
+ * (needed for quantized tensors).
  *
  * The second part describes the layout of the input tensor in memory, which
  * is assumed to be in NHWC format.  This consists of a base pointer and
@@ -60,6 +60,8 @@ struct ConvolutionParameters
     int64_t padding_top;
     int64_t padding_left;
     float   padding_value;
+    int64_t dilation_w{ 1 };
+    int64_t dilation_h{ 1 };
 };
 
 } // namespace arm_gemm
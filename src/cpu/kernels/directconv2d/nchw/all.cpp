@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,14 +47,18 @@ template <typename T>
 void convolve_nchw(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info);
 
 #if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
-void neon_fp16_nchw_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info)
+void neon_fp16_nchw_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info)
 {
+    // Biases are added by CpuDirectConv2dOutputStageKernel
+    ARM_COMPUTE_UNUSED(bias);
     convolve_nchw<float16_t>(window, src, weights, dst, conv_info);
 }
 #endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
-void neon_fp32_nchw_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info)
+void neon_fp32_nchw_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info)
 {
+    // Biases are added by CpuDirectConv2dOutputStageKernel
+    ARM_COMPUTE_UNUSED(bias);
     convolve_nchw<float>(window, src, weights, dst, conv_info);
 }
 
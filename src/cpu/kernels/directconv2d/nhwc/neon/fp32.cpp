@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,9 +30,9 @@ namespace cpu
 {
 namespace kernels
 {
-void neon_fp32_nhwc_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info)
+void neon_fp32_nhwc_directconv2d(const Window &window, const ITensor *src, const ITensor *weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info)
 {
-    convolve_nhwc<float>(window, src, weights, dst, conv_info);
+    convolve_nhwc<float>(window, src, weights, bias, dst, conv_info);
 }
 } // namespace kernels
 } // namespace cpu
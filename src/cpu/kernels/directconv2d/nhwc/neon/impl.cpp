@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,12 +24,10 @@
 
 #include "src/cpu/kernels/directconv2d/nhwc/neon/impl.h"
 
-#include "src/core/NEON/kernels/detail/NEDirectConvolutionDetail.h"
 #include "src/core/NEON/wrapper/wrapper.h"
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
-#include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Utils.h"
@@ -37,8 +35,6 @@
 
 #include <algorithm>
 
-using namespace arm_compute::detail;
-
 namespace arm_compute
 {
 namespace cpu
@@ -47,205 +43,267 @@ namespace kernels
 {
 namespace
 {
-bool have_zero_x_internal_padding(ITensorInfo *src, const ITensorInfo *weights)
+/** Number of output points along the width computed by each micro-kernel call */
+constexpr int tile_w = 4;
+
+/** Geometry of the convolution shared by the micro-kernels. Strides are in elements. */
+struct ConvGeometry
 {
-    return (src->padding().left == 0 && weights->padding().left == 0 && src->padding().right == 0 && weights->padding().right == 0);
-}
-}
+    int in_stride_w;
+    int in_stride_h;
+    int in_dim_w;
+    int in_dim_h;
+    int channels;
+    int kernel_w;
+    int kernel_h;
+    int stride_w;
+    int stride_h;
+    int pad_left;
+    int pad_top;
+};
 
 template <typename T>
-void convolve_nhwc(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info)
+struct BlockTraits
 {
-    // Declare useful types
     using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
     using vector_type = typename vtype::type;
     using tag_type    = typename vtype::tag_type;
 
-    // Scalar quantities
-    const int element_size   = src->info()->element_size();
-    const int input_stride_w = src->info()->strides_in_bytes().y() / element_size;
-    const int input_stride_h = src->info()->strides_in_bytes().z() / element_size;
-    const int input_stride_n = src->info()->strides_in_bytes()[3] / element_size;
-    const int input_dim_w    = src->info()->dimension(1);
-    const int input_dim_h    = src->info()->dimension(2);
-
-    const int output_stride_c = dst->info()->strides_in_bytes().x();
+    static constexpr int vec_len    = 16 / sizeof(T);
+    static constexpr int block_size = 2 * vec_len;
+};
 
-    const unsigned int kernel_stride_w = weights->info()->strides_in_bytes().y() / element_size;
-    const unsigned int kernel_stride_h = weights->info()->strides_in_bytes().z() / element_size;
-    const int          kernel_dim_w    = weights->info()->dimension(1);
-    const int          kernel_dim_h    = weights->info()->dimension(2);
-
-    const int conv_pad_top  = conv_info.pad_top();
-    const int conv_pad_left = conv_info.pad_left();
-    const int conv_stride_w = std::get<0>(conv_info.stride());
-    const int conv_stride_h = std::get<1>(conv_info.stride());
+/** Micro-kernel for a full tile whose receptive field lies entirely inside the input
+ *
+ * Kernel size and strides are template parameters for the common configurations so that the tap loops are fully
+ * unrolled; a value of 0 means that the runtime value in @p geo is used instead.
+ */
+template <typename T, int KW, int KH, int SW, int SH>
+void tile_interior(const ConvGeometry &geo, const T *in_ptr, const T *w_ptr, typename BlockTraits<T>::vector_type (&acc)[tile_w][2])
+{
+    using Traits   = BlockTraits<T>;
+    using tag_type = typename Traits::tag_type;
 
-    // Setup input window for the output iterator
-    Window window_out = window;
-    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+    const int kernel_w    = KW > 0 ? KW : geo.kernel_w;
+    const int kernel_h    = KH > 0 ? KH : geo.kernel_h;
+    const int stride_w    = SW > 0 ? SW : geo.stride_w;
+    const int in_stride_w = geo.in_stride_w;
+    ARM_COMPUTE_UNUSED(SH);
 
-    // Setup input window for the weights iterator
-    Window window_w = calculate_max_window(*weights->info(), Steps());
-    window_w.set(Window::DimX, Window::Dimension(0, 1, 1));
-    window_w.set(Window::DimY, Window::Dimension(0, 1, 1));
-    window_w.set(Window::DimZ, Window::Dimension(0, 1, 1));
+    for(int ky = 0; ky < kernel_h; ++ky)
+    {
+        const T *in_row = in_ptr + ky * geo.in_stride_h;
+        for(int kx = 0; kx < kernel_w; ++kx)
+        {
+            const T *in_tap = in_row + kx * in_stride_w;
+            for(int c = 0; c < geo.channels; ++c, w_ptr += Traits::block_size)
+            {
+                const auto w0 = wrapper::vloadq(w_ptr);
+                const auto w1 = wrapper::vloadq(w_ptr + Traits::vec_len);
+                for(int p = 0; p < tile_w; ++p)
+                {
+                    const auto x = wrapper::vdup_n(in_tap[p * stride_w * in_stride_w + c], tag_type());
+                    acc[p][0]    = wrapper::vmla(acc[p][0], w0, x);
+                    acc[p][1]    = wrapper::vmla(acc[p][1], w1, x);
+                }
+            }
+        }
+    }
+}
 
-    Iterator out(dst, window_out);
-    Iterator wei(weights, window_w);
+/** Micro-kernel for the tiles on the borders of the input or at the end of the window
+ *
+ * Every point of the tile only visits the taps that fall inside the input.
+ */
+template <typename T>
+void tile_border(const ConvGeometry &geo, const T *in_batch, int out_w, int out_h, int num_points, const T *w_ptr, typename BlockTraits<T>::vector_type (&acc)[tile_w][2])
+{
+    using Traits   = BlockTraits<T>;
+    using tag_type = typename Traits::tag_type;
 
-    constexpr int num_elems_read_per_iteration = 16 / sizeof(T);
+    const int in_h_start_t = out_h * geo.stride_h - geo.pad_top;
+    const int ky_start     = std::max(-in_h_start_t, 0);
+    const int ky_end       = std::min(geo.kernel_h, geo.in_dim_h - in_h_start_t);
+    const int tap_size     = geo.channels * Traits::block_size;
 
-    // nhwc optimized
-    if(have_zero_x_internal_padding(src->info(), weights->info()))
+    for(int p = 0; p < num_points; ++p)
     {
-        // This function assumes that input and weights have not padding in channel
-
-        /*
-        * This implementation parallelize the full WC plane of input and weights by
-        * treating them as series of elements. So for example, a 3x3 weights and
-        * floating point vector operations of 4 elements per time, the first 3
-        * channel elements of the first row would be taken and additionally the first
-        * element of the second row. The 9 elements in each single WC weight plane
-        * would require 2 4-element vector operations and a last single element operation.
-        *
-        * This works since when we create the input vector to multiply with the weights,
-        * the exact required elements are loaded in the same order. Therefore the
-        * multiplication works on the correct input/weight elements.
-        */
-        execute_window_loop(
-            window_out, [&](const Coordinates & id)
+        const int in_w_start_t = (out_w + p) * geo.stride_w - geo.pad_left;
+        const int kx_start     = std::max(-in_w_start_t, 0);
+        const int kx_end       = std::min(geo.kernel_w, geo.in_dim_w - in_w_start_t);
+
+        for(int ky = ky_start; ky < ky_end; ++ky)
         {
-            /*
-            * In here we create theoretical indexes which then we validate for both
-            * inputs and weights.
-            * As a reminder, this loop take each output point in NHW, C is treated
-            * in the weights loop.
-            */
-            // We are computing the theoretical starting input starting points
-            const int in_w_start_t = static_cast<int>(id.y()) * conv_stride_w - conv_pad_left;
-            const int in_h_start_t = static_cast<int>(id.z()) * conv_stride_h - conv_pad_top;
-            const int in_w_end_t   = in_w_start_t + kernel_dim_w;
-            const int in_h_end_t   = in_h_start_t + kernel_dim_h;
-
-            // We are computing the valid initial and ending input points by checking the borders
-            const int in_w_start = std::max(in_w_start_t, 0);
-            const int in_h_start = std::max(in_h_start_t, 0);
-            const int in_w_end   = std::min(in_w_end_t, input_dim_w);
-            const int in_h_end   = std::min(in_h_end_t, input_dim_h);
-
-            // We use the input points to select the valid weight points to use
-            const int index_wc_start = (in_w_start - in_w_start_t) * kernel_stride_w;
-            const int index_h_start  = in_h_start - in_h_start_t;
-            const int index_wc_end   = (kernel_dim_w - (in_w_end_t - in_w_end)) * kernel_stride_w;
-            const int index_h_end    = kernel_dim_h - (in_h_end_t - in_h_end);
-
-            execute_window_loop(
-                window_w, [&](const Coordinates & id_w)
+            for(int kx = kx_start; kx < kx_end; ++kx)
             {
-                /*
-                * This is the loop in the weights, and it goes along N (the batches)
-                * As a reminder, the batches of the weights are translated into the
-                * channels of the output
-                */
-                const T *in_ptr_row = reinterpret_cast<const T *>(src->buffer() + src->info()->offset_first_element_in_bytes())
-                                      + id[3] * input_stride_n + in_w_start * input_stride_w + in_h_start * input_stride_h;
-                const T *weights_ptr_row = reinterpret_cast<const T *>(wei.ptr()) + index_h_start * kernel_stride_h;
-                uint8_t *out_ptr         = out.ptr() + id_w[3] * output_stride_c;
-
-                T out_temp = static_cast<T>(0);
-                for(int index_h = index_h_start; index_h < index_h_end; ++index_h, in_ptr_row += input_stride_h, weights_ptr_row += kernel_stride_h)
+                const T *in_tap = in_batch + (in_h_start_t + ky) * geo.in_stride_h + (in_w_start_t + kx) * geo.in_stride_w;
+                const T *w_tap  = w_ptr + (ky * geo.kernel_w + kx) * tap_size;
+                for(int c = 0; c < geo.channels; ++c, w_tap += Traits::block_size)
                 {
-                    const T    *in_ptr_mover = in_ptr_row;
-                    int         index_wc     = index_wc_start;
-                    vector_type out_temp_vec = wrapper::vdup_n(static_cast<T>(0), tag_type());
-                    for(; index_wc <= index_wc_end - num_elems_read_per_iteration; index_wc += num_elems_read_per_iteration, in_ptr_mover += num_elems_read_per_iteration)
-                    {
-                        const auto src_vec = wrapper::vloadq(in_ptr_mover);
-                        const auto w_vec   = wrapper::vloadq(weights_ptr_row + index_wc);
-                        out_temp_vec       = wrapper::vmla(out_temp_vec, w_vec, src_vec);
-                    }
-                    out_temp += vreduce(out_temp_vec);
-                    for(; index_wc < index_wc_end; ++index_wc, ++in_ptr_mover)
-                    {
-                        const auto src_val = *(in_ptr_mover);
-                        const auto w_val   = *(weights_ptr_row + index_wc);
-                        out_temp += src_val * w_val;
-                    }
+                    const auto x = wrapper::vdup_n(in_tap[c], tag_type());
+                    acc[p][0]    = wrapper::vmla(acc[p][0], wrapper::vloadq(w_tap), x);
+                    acc[p][1]    = wrapper::vmla(acc[p][1], wrapper::vloadq(w_tap + Traits::vec_len), x);
                 }
-                *(reinterpret_cast<T *>(out_ptr)) = out_temp;
-            },
-            wei);
-        },
-        out);
+            }
+        }
+    }
+}
+
+template <typename T>
+using TileInteriorPtr = void (*)(const ConvGeometry &, const T *, const T *, typename BlockTraits<T>::vector_type (&)[tile_w][2]);
+
+/** Select the micro-kernel specialized for the kernel size and strides, if any */
+template <typename T>
+TileInteriorPtr<T> select_tile_interior(const ConvGeometry &geo)
+{
+    const bool is_square = geo.kernel_w == geo.kernel_h && geo.stride_w == geo.stride_h;
+    if(is_square && geo.stride_w == 1)
+    {
+        switch(geo.kernel_w)
+        {
+            case 3:
+                return &tile_interior<T, 3, 3, 1, 1>;
+            case 5:
+                return &tile_interior<T, 5, 5, 1, 1>;
+            case 7:
+                return &tile_interior<T, 7, 7, 1, 1>;
+            default:
+                break;
+        }
     }
-    else // nhwc non optimized
+    else if(is_square && geo.stride_w == 2)
     {
-        execute_window_loop(
-            window_out, [&](const Coordinates & id)
+        switch(geo.kernel_w)
         {
-            // We are computing the theoretical starting input starting points
-            const int in_w_start_t = static_cast<int>(id.y()) * conv_stride_w - conv_pad_left;
-            const int in_h_start_t = static_cast<int>(id.z()) * conv_stride_h - conv_pad_top;
-            const int in_w_end_t   = in_w_start_t + kernel_dim_w;
-            const int in_h_end_t   = in_h_start_t + kernel_dim_h;
-
-            // We are computing the valid initial and ending input points by checking the borders
-            const int in_w_start = std::max(in_w_start_t, 0);
-            const int in_h_start = std::max(in_h_start_t, 0);
-            const int in_w_end   = std::min(in_w_end_t, input_dim_w);
-            const int in_h_end   = std::min(in_h_end_t, input_dim_h);
-
-            // We use the input points to select the valid weight points to use
-            const int wei_w_start = in_w_start - in_w_start_t;
-            const int wei_h_start = in_h_start - in_h_start_t;
-            const int wei_w_end   = kernel_dim_w - (in_w_end_t - in_w_end);
-            const int wei_h_end   = kernel_dim_h - (in_h_end_t - in_h_end);
-
-            const int      index_c_end  = weights->info()->dimension(0);
-            const T *const in_ptr_start = reinterpret_cast<const T *>(src->buffer() + src->info()->offset_first_element_in_bytes()) + id[3] * input_stride_n;
-
-            execute_window_loop(
-                window_w, [&](const Coordinates & id_w)
+            case 3:
+                return &tile_interior<T, 3, 3, 2, 2>;
+            case 5:
+                return &tile_interior<T, 5, 5, 2, 2>;
+            case 7:
+                return &tile_interior<T, 7, 7, 2, 2>;
+            default:
+                break;
+        }
+    }
+    return &tile_interior<T, 0, 0, 0, 0>;
+}
+} // namespace
+
+template <typename T>
+void convolve_nhwc(const Window &window, const ITensor *src, const ITensor *packed_weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info)
+{
+    using Traits = BlockTraits<T>;
+
+    const ITensorInfo *src_info = src->info();
+    const int          elem     = src_info->element_size();
+
+    ConvGeometry geo{};
+    geo.in_stride_w = src_info->strides_in_bytes().y() / elem;
+    geo.in_stride_h = src_info->strides_in_bytes().z() / elem;
+    geo.in_dim_w    = src_info->dimension(1);
+    geo.in_dim_h    = src_info->dimension(2);
+    geo.channels    = src_info->dimension(0);
+    geo.kernel_w    = packed_weights->info()->dimension(1);
+    geo.kernel_h    = packed_weights->info()->dimension(2);
+    geo.stride_w    = std::get<0>(conv_info.stride());
+    geo.stride_h    = std::get<1>(conv_info.stride());
+    geo.pad_left    = conv_info.pad_left();
+    geo.pad_top     = conv_info.pad_top();
+
+    const int in_stride_n     = src_info->strides_in_bytes()[3] / elem;
+    const int out_stride_w    = dst->info()->strides_in_bytes().y();
+    const int num_ofm         = dst->info()->dimension(0);
+    const int num_blocks      = packed_weights->info()->dimension(3);
+    const int block_stride    = packed_weights->info()->strides_in_bytes()[3] / elem;
+    const int out_w_start     = window.y().start();
+    const int out_w_end       = window.y().end();
+    const int interior_last_w = geo.in_dim_w - geo.kernel_w;
+
+    const TileInteriorPtr<T> interior = select_tile_interior<T>(geo);
+
+    const T *src_ptr  = reinterpret_cast<const T *>(src->buffer() + src_info->offset_first_element_in_bytes());
+    const T *wei_ptr  = reinterpret_cast<const T *>(packed_weights->buffer() + packed_weights->info()->offset_first_element_in_bytes());
+    const T *bias_ptr = (bias != nullptr) ? reinterpret_cast<const T *>(bias->buffer() + bias->info()->offset_first_element_in_bytes()) : nullptr;
+
+    // The output iterator walks the height and the batches, the width and the channels are handled by the micro-kernels
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+    window_out.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator out(dst, window_out);
+
+    execute_window_loop(
+        window_out, [&](const Coordinates & id)
+    {
+        const int  out_h       = id.z();
+        const T   *in_batch    = src_ptr + id[3] * in_stride_n;
+        const int  in_h_start  = out_h * geo.stride_h - geo.pad_top;
+        const bool rows_inside = in_h_start >= 0 && in_h_start + geo.kernel_h <= geo.in_dim_h;
+        uint8_t   *out_row     = out.ptr();
+
+        for(int b = 0; b < num_blocks; ++b)
+        {
+            const int ofm_start = b * Traits::block_size;
+            const int ofm_valid = std::min(Traits::block_size, num_ofm - ofm_start);
+            const T  *w_block   = wei_ptr + b * block_stride;
+
+            // Biases of the block, zero-padded past the last output channel
+            T bias_block[Traits::block_size] = {};
+            if(bias_ptr != nullptr)
             {
-                const T *const weights_ptr_start = reinterpret_cast<const T *>(wei.ptr());
-                uint8_t       *out_ptr           = out.ptr() + id_w[3] * output_stride_c;
+                std::copy_n(bias_ptr + ofm_start, ofm_valid, bias_block);
+            }
+            const auto bias0 = wrapper::vloadq(bias_block);
+            const auto bias1 = wrapper::vloadq(bias_block + Traits::vec_len);
+
+            for(int out_w = out_w_start; out_w < out_w_end; out_w += tile_w)
+            {
+                const int num_points = std::min(tile_w, out_w_end - out_w);
+                const int in_w_start = out_w * geo.stride_w - geo.pad_left;
+                const int in_w_last  = (out_w + tile_w - 1) * geo.stride_w - geo.pad_left;
+
+                typename Traits::vector_type acc[tile_w][2];
+                for(int p = 0; p < tile_w; ++p)
+                {
+                    acc[p][0] = bias0;
+                    acc[p][1] = bias1;
+                }
 
-                T out_temp = static_cast<T>(0);
-                for(int index_wei_h = wei_h_start, index_in_h = in_h_start; index_wei_h < wei_h_end; ++index_wei_h, ++index_in_h)
+                if(rows_inside && num_points == tile_w && in_w_start >= 0 && in_w_last <= interior_last_w)
                 {
-                    const T *const in_ptr_row      = in_ptr_start + index_in_h * input_stride_h;
-                    const T *const weights_ptr_row = weights_ptr_start + index_wei_h * kernel_stride_h;
-                    for(int index_wei_w = wei_w_start, index_in_w = in_w_start; index_wei_w < wei_w_end; ++index_wei_w, ++index_in_w)
+                    interior(geo, in_batch + in_h_start * geo.in_stride_h + in_w_start * geo.in_stride_w, w_block, acc);
+                }
+                else
+                {
+                    tile_border<T>(geo, in_batch, out_w, out_h, num_points, w_block, acc);
+                }
+
+                for(int p = 0; p < num_points; ++p)
+                {
+                    T *out_ptr = reinterpret_cast<T *>(out_row + (out_w + p) * out_stride_w) + ofm_start;
+                    if(ofm_valid == Traits::block_size)
+                    {
+                        wrapper::vstore(out_ptr, acc[p][0]);
+                        wrapper::vstore(out_ptr + Traits::vec_len, acc[p][1]);
+                    }
+                    else
                     {
-                        const T    *in_ptr_mover      = in_ptr_row + index_in_w * input_stride_w;
-                        const T    *weights_ptr_mover = weights_ptr_row + index_wei_w * kernel_stride_w;
-                        int         index_c           = 0;
-                        vector_type out_temp_vec      = wrapper::vdup_n(static_cast<T>(0), tag_type());
-                        for(; index_c <= index_c_end - num_elems_read_per_iteration; index_c += num_elems_read_per_iteration, in_ptr_mover += num_elems_read_per_iteration, weights_ptr_mover += num_elems_read_per_iteration)
-                        {
-                            const auto src_vec = wrapper::vloadq(in_ptr_mover);
-                            const auto w_vec   = wrapper::vloadq(weights_ptr_mover);
-                            out_temp_vec       = wrapper::vmla(out_temp_vec, w_vec, src_vec);
-                        }
-                        out_temp += vreduce(out_temp_vec);
-                        for(; index_c < index_c_end; ++index_c, ++in_ptr_mover, ++weights_ptr_mover)
-                        {
-                            const auto src_val = *(in_ptr_mover);
-                            const auto w_val   = *(weights_ptr_mover);
-                            out_temp += src_val * w_val;
-                        }
+                        T out_block[Traits::block_size];
+                        wrapper::vstore(out_block, acc[p][0]);
+                        wrapper::vstore(out_block + Traits::vec_len, acc[p][1]);
+                        std::copy_n(out_block, ofm_valid, out_ptr);
                     }
                 }
-                *(reinterpret_cast<T *>(out_ptr)) = out_temp;
-            },
-            wei);
-        },
-        out);
-    }
+            }
+        }
+    },
+    out);
 }
 
-template void convolve_nhwc<float>(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info);
+template void convolve_nhwc<float>(const Window &window, const ITensor *src, const ITensor *packed_weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info);
+#if defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS)
+template void convolve_nhwc<float16_t>(const Window &window, const ITensor *src, const ITensor *packed_weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info);
+#endif /* defined(__ARM_FEATURE_FP16_VECTOR_ARITHMETIC) && defined(ENABLE_FP16_KERNELS) */
 
 } // namespace kernels
 } // namespace cpu
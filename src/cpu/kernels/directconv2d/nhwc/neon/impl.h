@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,8 +33,21 @@ namespace cpu
 {
 namespace kernels
 {
+/** Register-blocked NHWC direct convolution
+ *
+ * Each micro-kernel call accumulates a tile of 4 consecutive output points along the width times one block of
+ * output channels in registers. The output channels are the vectorized dimension, so the number of input channels
+ * does not need to be a multiple of the vector length.
+ *
+ * @param[in]  window         Region on which to execute the kernel. Only the dimensions Y (width) and above are used.
+ * @param[in]  src            Source tensor. Data types supported: F16/F32.
+ * @param[in]  packed_weights Weights packed by @ref CpuDirectConv2dKernel::pack_weights. Data type supported: Same as @p src.
+ * @param[in]  bias           Biases tensor. Can be nullptr. Data type supported: Same as @p src.
+ * @param[out] dst            Destination tensor. Data type supported: Same as @p src.
+ * @param[in]  conv_info      Contains padding and stride information described in @ref PadStrideInfo.
+ */
 template <typename T>
-void convolve_nhwc(const Window &window, const ITensor *src, const ITensor *weights, ITensor *dst, const PadStrideInfo &conv_info);
+void convolve_nhwc(const Window &window, const ITensor *src, const ITensor *packed_weights, const ITensor *bias, ITensor *dst, const PadStrideInfo &conv_info);
 } // namespace kernels
 } // namespace cpu
 } // namespace arm_compute
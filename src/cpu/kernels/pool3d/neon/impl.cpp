@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,256 +29,193 @@
 
 #include "src/cpu/kernels/pool3d/neon/impl.h"
 
+#include <array>
+
 namespace arm_compute
 {
 namespace cpu
 {
 namespace
 {
-template <typename T>
-void max_poolingMxNxD_fp_neon_ndhwc(const ITensor *src, ITensor *dst0, Pooling3dLayerInfo &pool_info, const Window &window_out,
-                                    const int window_start_x, const int window_end_x, const int window_step_x)
+/** Number of outputs along the width computed by a tile */
+constexpr int pool3d_tile_w = 8;
+/** Budget in bytes for the input values read by a tile for one block of channels */
+constexpr size_t pool3d_cache_budget = 16 * 1024;
+
+/** Reduction performed by a pooling operation */
+template <typename T, PoolingType pool_type>
+struct PoolOp;
 
+template <typename T>
+struct PoolOp<T, PoolingType::MAX>
 {
     using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
     using vector_type = typename vtype::type;
     using tag_type    = typename vtype::tag_type;
 
-    int pool_stride_x = static_cast<int>(pool_info.stride.width);
-    int pool_stride_y = static_cast<int>(pool_info.stride.height);
-    int pool_stride_z = static_cast<int>(pool_info.stride.depth);
-
-    const int pool_size_x = pool_info.is_global_pooling ? src->info()->tensor_shape().y() : pool_info.pool_size.width;
-    const int pool_size_y = pool_info.is_global_pooling ? src->info()->tensor_shape().z() : pool_info.pool_size.height;
-    const int pool_size_z = pool_info.is_global_pooling ? src->info()->tensor_shape()[3] : pool_info.pool_size.depth;
-
-    const int pool_pad_top   = static_cast<int>(pool_info.padding.top);
-    const int pool_pad_left  = static_cast<int>(pool_info.padding.left);
-    const int pool_pad_front = static_cast<int>(pool_info.padding.front);
-
-    const int input_dim_w = src->info()->dimension(1);
-    const int input_dim_h = src->info()->dimension(2);
-    const int input_dim_d = src->info()->dimension(3);
-
-    const int y_stride = static_cast<int>(src->info()->strides_in_bytes().y());
-    const int z_stride = static_cast<int>(src->info()->strides_in_bytes().z());
-    const int w_stride = static_cast<int>(src->info()->strides_in_bytes()[3]);
-    const int n_stride = static_cast<int>(src->info()->strides_in_bytes()[4]);
-
-    const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
-
-    Iterator out(dst0, window_out);
-
-    vector_type vres;
-    execute_window_loop(window_out, [&](const Coordinates & id)
+    static inline vector_type init()
     {
-        // Computing the theoretical input starting/ending points
-        const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
-        const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
-        const int in_idx_depth  = static_cast<int>(id[3]) * pool_stride_z - pool_pad_front;
-
-        const int pool_start_x = std::max(0, -in_idx_width);
-        const int pool_end_x_t = std::min(input_dim_w + pool_pad_left - in_idx_width, pool_size_x);
-        const int pool_start_y = std::max(0, -in_idx_height);
-        const int pool_end_y_t = std::min(input_dim_h + pool_pad_top - in_idx_height, pool_size_y);
-
-        const int pool_start_z = std::max(0, -in_idx_depth);
-        const int pool_end_z_t = std::min(input_dim_d + pool_pad_front - in_idx_depth, pool_size_z);
-
-        // The end of width to consider in calculation should exclude PAD_X, PAD_Y and PAD_Z
-        const int pool_end_x = std::min(pool_end_x_t, input_dim_w - in_idx_width);
-        const int pool_end_y = std::min(pool_end_y_t, input_dim_h - in_idx_height);
-        const int pool_end_z = std::min(pool_end_z_t, input_dim_d - in_idx_depth);
-
-        const uint8_t *in_ptr_n = in_ptr_start + id[4] * n_stride;
-
-        int x_off = window_start_x;
-
-        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x) // C
-        {
-            vres = wrapper::vdup_n(static_cast<T>(-std::numeric_limits<float>::infinity()), tag_type());
-            for(int z = pool_start_z; z < pool_end_z; ++z)
-            {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
-                {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t    *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const vector_type data     = wrapper::vloadq(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        vres                       = wrapper::vmax(vres, data);
-                    }
-                }
-            }
-            // Store result
-            wrapper::vstore(reinterpret_cast<T *>(out.ptr()) + x_off, vres);
-        }
-
-        // Left-overs loop
-        for(; x_off < window_end_x; ++x_off)
-        {
-            T res(0);
-            res = -std::numeric_limits<float>::infinity();
-            for(int z = pool_start_z; z < pool_end_z; ++z)
-            {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
-                {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const T        data     = *(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        res                     = std::max(res, data);
-                    }
-                }
-            }
-            // Store result
-            *(reinterpret_cast<T *>(out.ptr()) + x_off) = res;
-        }
-    },
-    out);
-}
+        return wrapper::vdup_n(static_cast<T>(-std::numeric_limits<float>::infinity()), tag_type());
+    }
+    static inline vector_type reduce(const vector_type &acc, const vector_type &data)
+    {
+        return wrapper::vmax(acc, data);
+    }
+    static inline vector_type finalize(const vector_type &acc, float scale)
+    {
+        ARM_COMPUTE_UNUSED(scale);
+        return acc;
+    }
+    static inline T init_scalar()
+    {
+        return static_cast<T>(-std::numeric_limits<float>::infinity());
+    }
+    static inline T reduce_scalar(T acc, T data)
+    {
+        return std::max(acc, data);
+    }
+    static inline T finalize_scalar(T acc, float scale)
+    {
+        ARM_COMPUTE_UNUSED(scale);
+        return acc;
+    }
+};
 
 template <typename T>
-void avg_poolingMxNxD_fp_neon_ndhwc(const ITensor *src, ITensor *dst0, Pooling3dLayerInfo &pool_info,
-                                    const Window &window_out, const int window_start_x, const int window_end_x, const int window_step_x)
+struct PoolOp<T, PoolingType::AVG>
 {
     using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
     using vector_type = typename vtype::type;
     using tag_type    = typename vtype::tag_type;
 
-    int pool_stride_x = static_cast<int>(pool_info.stride.width);
-    int pool_stride_y = static_cast<int>(pool_info.stride.height);
-    int pool_stride_z = static_cast<int>(pool_info.stride.depth);
-
-    const int pool_size_x = pool_info.is_global_pooling ? src->info()->tensor_shape().y() : pool_info.pool_size.width;
-    const int pool_size_y = pool_info.is_global_pooling ? src->info()->tensor_shape().z() : pool_info.pool_size.height;
-    const int pool_size_z = pool_info.is_global_pooling ? src->info()->tensor_shape()[3] : pool_info.pool_size.depth;
-
-    const int pool_pad_top    = static_cast<int>(pool_info.padding.top);
-    const int pool_pad_bottom = static_cast<int>(pool_info.padding.bottom);
-    const int pool_pad_left   = static_cast<int>(pool_info.padding.left);
-    const int pool_pad_right  = static_cast<int>(pool_info.padding.right);
-    const int pool_pad_front  = static_cast<int>(pool_info.padding.front);
-    const int pool_pad_back   = static_cast<int>(pool_info.padding.back);
-
-    const int upper_bound_w = src->info()->dimension(1) + (pool_info.exclude_padding ? 0 : pool_pad_right);
-    const int upper_bound_h = src->info()->dimension(2) + (pool_info.exclude_padding ? 0 : pool_pad_bottom);
-    const int upper_bound_d = src->info()->dimension(3) + (pool_info.exclude_padding ? 0 : pool_pad_back);
-
-    const int input_dim_w = src->info()->dimension(1);
-    const int input_dim_h = src->info()->dimension(2);
-    const int input_dim_d = src->info()->dimension(3);
-
-    const int y_stride = static_cast<int>(src->info()->strides_in_bytes().y());
-    const int z_stride = static_cast<int>(src->info()->strides_in_bytes().z());
-    const int w_stride = static_cast<int>(src->info()->strides_in_bytes()[3]);
-    const int n_stride = static_cast<int>(src->info()->strides_in_bytes()[4]);
-
-    const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
-
-    Iterator out(dst0, window_out);
-
-    vector_type vres;
-    execute_window_loop(window_out, [&](const Coordinates & id)
+    static inline vector_type init()
     {
-        // Computing the theoretical input starting/ending points
-        const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
-        const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
-        const int in_idx_depth  = static_cast<int>(id[3]) * pool_stride_z - pool_pad_front;
-
-        const int pool_start_x = std::max(0, -in_idx_width);
-        const int pool_end_x_t = std::min(input_dim_w + pool_pad_left - in_idx_width, pool_size_x);
-        const int pool_start_y = std::max(0, -in_idx_height);
-        const int pool_end_y_t = std::min(input_dim_h + pool_pad_top - in_idx_height, pool_size_y);
-
-        const int pool_start_z = std::max(0, -in_idx_depth);
-        const int pool_end_z_t = std::min(input_dim_d + pool_pad_front - in_idx_depth, pool_size_z);
-
-        // The end of width to consider in calculation should exclude PAD_X, PAD_Y and PAD_Z
-        const int pool_end_x = std::min(pool_end_x_t, input_dim_w - in_idx_width);
-        const int pool_end_y = std::min(pool_end_y_t, input_dim_h - in_idx_height);
-        const int pool_end_z = std::min(pool_end_z_t, input_dim_d - in_idx_depth);
+        return wrapper::vdup_n(static_cast<T>(0.0f), tag_type());
+    }
+    static inline vector_type reduce(const vector_type &acc, const vector_type &data)
+    {
+        return wrapper::vadd(acc, data);
+    }
+    static inline vector_type finalize(const vector_type &acc, float scale)
+    {
+        return wrapper::vmul(acc, wrapper::vdup_n(static_cast<T>(scale), tag_type()));
+    }
+    static inline T init_scalar()
+    {
+        return T(0);
+    }
+    static inline T reduce_scalar(T acc, T data)
+    {
+        return acc + data;
+    }
+    static inline T finalize_scalar(T acc, float scale)
+    {
+        return acc * static_cast<T>(scale);
+    }
+};
 
-        const uint8_t *in_ptr_n = in_ptr_start + id[4] * n_stride;
+template <typename T>
+struct PoolOp<T, PoolingType::L2>
+{
+    using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
+    using vector_type = typename vtype::type;
+    using tag_type    = typename vtype::tag_type;
 
-        // Calculate scale
-        const float scale = calculate_avg_scale_pool3d(pool_info.exclude_padding, id, pool_size_x, pool_size_y, pool_size_z, upper_bound_w, upper_bound_h, upper_bound_d, pool_pad_left,
-                                                       pool_pad_top, pool_pad_front, pool_stride_x,
-                                                       pool_stride_y, pool_stride_z);
-        const vector_type scale_v = wrapper::vdup_n(static_cast<T>(scale), tag_type());
+    static inline vector_type init()
+    {
+        return wrapper::vdup_n(static_cast<T>(0.0f), tag_type());
+    }
+    static inline vector_type reduce(const vector_type &acc, const vector_type &data)
+    {
+        return wrapper::vmla(acc, data, data);
+    }
+    static inline vector_type finalize(const vector_type &acc, float scale)
+    {
+        // Divide by scale and calculate square-root
+        const vector_type res = wrapper::vmul(acc, wrapper::vdup_n(static_cast<T>(scale), tag_type()));
+        return wrapper::vinv(wrapper::vinvsqrt(res));
+    }
+    static inline T init_scalar()
+    {
+        return T(0);
+    }
+    static inline T reduce_scalar(T acc, T data)
+    {
+        return acc + data * data;
+    }
+    static inline T finalize_scalar(T acc, float scale)
+    {
+        return static_cast<T>(std::sqrt(acc * static_cast<T>(scale)));
+    }
+};
 
-        int x_off = window_start_x;
+/** Output point of a tile and the part of its pooling region that lies inside the input */
+struct TilePoint
+{
+    const uint8_t *in_ptr{ nullptr };  /**< Address of the first input element of the pooling region */
+    uint8_t       *out_ptr{ nullptr }; /**< Address of the output element */
+    int            size_x{ 0 };        /**< Number of input elements along the width */
+    float          scale{ 1.f };       /**< Scale applied to the reduction */
+};
+
+/** Pool the channels [ @p c_start, @p c_end ) of one output point */
+template <typename T, typename Op>
+inline void pool_channels(const TilePoint &point, int size_y, int size_z, int y_stride, int z_stride, int w_stride, int c_start, int c_end)
+{
+    constexpr int vec_len = 16 / sizeof(T);
 
-        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x) // C
+    int c = c_start;
+    for(; c <= (c_end - vec_len); c += vec_len)
+    {
+        auto acc = Op::init();
+        for(int z = 0; z < size_z; ++z)
         {
-            // Perform pooling
-            vres = wrapper::vdup_n(static_cast<T>(0.0f), tag_type());
-            for(int z = pool_start_z; z < pool_end_z; ++z)
+            for(int y = 0; y < size_y; ++y)
             {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
+                const uint8_t *in_ptr_y = point.in_ptr + z * w_stride + y * z_stride;
+                for(int x = 0; x < point.size_x; ++x)
                 {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t    *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const vector_type data     = wrapper::vloadq(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        vres                       = wrapper::vadd(vres, data);
-                    }
+                    acc = Op::reduce(acc, wrapper::vloadq(reinterpret_cast<const T *>(in_ptr_y + x * y_stride) + c));
                 }
             }
-
-            // Divide by scale
-            vres = wrapper::vmul(vres, scale_v);
-
-            // Store result
-            wrapper::vstore(reinterpret_cast<T *>(out.ptr()) + x_off, vres);
         }
+        wrapper::vstore(reinterpret_cast<T *>(point.out_ptr) + c, Op::finalize(acc, point.scale));
+    }
 
-        // Left-overs loop
-        for(; x_off < window_end_x; ++x_off)
+    // Left-overs loop
+    for(; c < c_end; ++c)
+    {
+        T acc = Op::init_scalar();
+        for(int z = 0; z < size_z; ++z)
         {
-            T res(0);
-
-            for(int z = pool_start_z; z < pool_end_z; ++z)
+            for(int y = 0; y < size_y; ++y)
             {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
+                const uint8_t *in_ptr_y = point.in_ptr + z * w_stride + y * z_stride;
+                for(int x = 0; x < point.size_x; ++x)
                 {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const T        data     = *(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        res += data;
-                    }
+                    acc = Op::reduce_scalar(acc, *(reinterpret_cast<const T *>(in_ptr_y + x * y_stride) + c));
                 }
             }
-
-            // Divide by scale
-            res *= scale;
-
-            // Store result
-            *(reinterpret_cast<T *>(out.ptr()) + x_off) = res;
         }
-    },
-    out);
+        *(reinterpret_cast<T *>(point.out_ptr) + c) = Op::finalize_scalar(acc, point.scale);
+    }
 }
 
-template <typename T>
-void l2_poolingMxNxD_fp_neon_ndhwc(const ITensor *src, ITensor *dst0, Pooling3dLayerInfo &pool_info,
-                                   const Window &window_out, const int window_start_x, const int window_end_x, const int window_step_x)
+/** Depth-first pooling of NDHWC tensors
+ *
+ * The outputs of a row are computed in tiles of @ref pool3d_tile_w points. Each tile runs over blocks of channels sized
+ * so that the input values read by the tile for one block stay in the L1 cache: the input columns shared by neighbouring
+ * pooling regions are then only fetched once from memory.
+ */
+template <typename T, PoolingType pool_type>
+void poolingMxNxD_fp_neon_ndhwc_depthfirst(const ITensor *src, ITensor *dst0, const Pooling3dLayerInfo &pool_info, const Window &window)
 {
-    using vtype       = wrapper::traits::neon_bitvector<T, wrapper::traits::BitWidth::W128>;
-    using vector_type = typename vtype::type;
-    using tag_type    = typename vtype::tag_type;
+    using Op              = PoolOp<T, pool_type>;
+    constexpr int vec_len = 16 / sizeof(T);
 
-    int pool_stride_x = static_cast<int>(pool_info.stride.width);
-    int pool_stride_y = static_cast<int>(pool_info.stride.height);
-    int pool_stride_z = static_cast<int>(pool_info.stride.depth);
+    const int pool_stride_x = static_cast<int>(pool_info.stride.width);
+    const int pool_stride_y = static_cast<int>(pool_info.stride.height);
+    const int pool_stride_z = static_cast<int>(pool_info.stride.depth);
 
     const int pool_size_x = pool_info.is_global_pooling ? src->info()->tensor_shape().y() : pool_info.pool_size.width;
     const int pool_size_y = pool_info.is_global_pooling ? src->info()->tensor_shape().z() : pool_info.pool_size.height;
@@ -304,126 +241,86 @@ void l2_poolingMxNxD_fp_neon_ndhwc(const ITensor *src, ITensor *dst0, Pooling3dL
     const int w_stride = static_cast<int>(src->info()->strides_in_bytes()[3]);
     const int n_stride = static_cast<int>(src->info()->strides_in_bytes()[4]);
 
-    const uint8_t *in_ptr_start = src->buffer() + src->info()->offset_first_element_in_bytes();
+    const Strides &out_strides = dst0->info()->strides_in_bytes();
+
+    const uint8_t *in_ptr_start  = src->buffer() + src->info()->offset_first_element_in_bytes();
+    uint8_t       *out_ptr_start = dst0->buffer() + dst0->info()->offset_first_element_in_bytes();
 
-    Iterator out(dst0, window_out);
+    const int window_start_x = window.x().start();
+    const int window_end_x   = window.x().end();
+    const int window_start_w = window.y().start();
+    const int window_end_w   = window.y().end();
 
-    vector_type vres;
+    // Size the channel blocks so that the input values read by a tile fit in the budget
+    const size_t bytes_per_channel = sizeof(T) * ((pool3d_tile_w - 1) * pool_stride_x + pool_size_x) * pool_size_y * pool_size_z;
+    const int    channel_block     = std::max(static_cast<int>(pool3d_cache_budget / bytes_per_channel) / vec_len * vec_len, vec_len);
+
+    // The width is traversed in tiles inside the window loop
+    Window window_out = window;
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+    window_out.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    std::array<TilePoint, pool3d_tile_w> tile{};
     execute_window_loop(window_out, [&](const Coordinates & id)
     {
-        // Computing the theoretical input starting/ending points
-        const int in_idx_width  = static_cast<int>(id.y()) * pool_stride_x - pool_pad_left;
+        // The bounds along the height and the depth are shared by all the outputs of the row
         const int in_idx_height = static_cast<int>(id.z()) * pool_stride_y - pool_pad_top;
         const int in_idx_depth  = static_cast<int>(id[3]) * pool_stride_z - pool_pad_front;
 
-        const int pool_start_x = std::max(0, -in_idx_width);
-        const int pool_end_x_t = std::min(input_dim_w + pool_pad_left - in_idx_width, pool_size_x);
         const int pool_start_y = std::max(0, -in_idx_height);
-        const int pool_end_y_t = std::min(input_dim_h + pool_pad_top - in_idx_height, pool_size_y);
-
+        const int pool_end_y   = std::min(std::min(input_dim_h + pool_pad_top - in_idx_height, pool_size_y), input_dim_h - in_idx_height);
         const int pool_start_z = std::max(0, -in_idx_depth);
-        const int pool_end_z_t = std::min(input_dim_d + pool_pad_front - in_idx_depth, pool_size_z);
-
-        // The end of width to consider in calculation should exclude PAD_X, PAD_Y and PAD_Z
-        const int pool_end_x = std::min(pool_end_x_t, input_dim_w - in_idx_width);
-        const int pool_end_y = std::min(pool_end_y_t, input_dim_h - in_idx_height);
-        const int pool_end_z = std::min(pool_end_z_t, input_dim_d - in_idx_depth);
-
-        const uint8_t *in_ptr_n = in_ptr_start + id[4] * n_stride;
-
-        // Calculate scale
-        const float scale = calculate_avg_scale_pool3d(pool_info.exclude_padding, id, pool_size_x, pool_size_y, pool_size_z, upper_bound_w, upper_bound_h, upper_bound_d, pool_pad_left,
-                                                       pool_pad_top, pool_pad_front, pool_stride_x,
-                                                       pool_stride_y, pool_stride_z);
+        const int pool_end_z   = std::min(std::min(input_dim_d + pool_pad_front - in_idx_depth, pool_size_z), input_dim_d - in_idx_depth);
 
-        int x_off = window_start_x;
+        const uint8_t *in_ptr_row  = in_ptr_start + id[4] * n_stride + (pool_start_z + in_idx_depth) * w_stride + (pool_start_y + in_idx_height) * z_stride;
+        uint8_t       *out_ptr_row = out_ptr_start + id.z() * out_strides.z() + id[3] * out_strides[3] + id[4] * out_strides[4];
 
-        for(; x_off <= (window_end_x - window_step_x); x_off += window_step_x) // C
+        for(int w = window_start_w; w < window_end_w; w += pool3d_tile_w)
         {
-            // Perform pooling
-            vres = wrapper::vdup_n(static_cast<T>(0.0f), tag_type());
-            for(int z = pool_start_z; z < pool_end_z; ++z)
+            const int num_points = std::min(pool3d_tile_w, window_end_w - w);
+            for(int p = 0; p < num_points; ++p)
             {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
+                const int in_idx_width = (w + p) * pool_stride_x - pool_pad_left;
+                const int pool_start_x = std::max(0, -in_idx_width);
+                const int pool_end_x   = std::min(std::min(input_dim_w + pool_pad_left - in_idx_width, pool_size_x), input_dim_w - in_idx_width);
+
+                tile[p].in_ptr  = in_ptr_row + (pool_start_x + in_idx_width) * y_stride;
+                tile[p].out_ptr = out_ptr_row + (w + p) * out_strides.y();
+                tile[p].size_x  = pool_end_x - pool_start_x;
+                if(pool_type != PoolingType::MAX)
                 {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t    *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const vector_type data     = wrapper::vloadq(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        vres                       = wrapper::vmla(vres, data, data);
-                    }
+                    const Coordinates point_id(0, w + p, id.z(), id[3], id[4]);
+                    tile[p].scale = calculate_avg_scale_pool3d(pool_info.exclude_padding, point_id, pool_size_x, pool_size_y, pool_size_z, upper_bound_w, upper_bound_h, upper_bound_d,
+                                                               pool_pad_left, pool_pad_top, pool_pad_front, pool_stride_x, pool_stride_y, pool_stride_z);
                 }
             }
 
-            const vector_type scale_v = wrapper::vdup_n(static_cast<T>(scale), tag_type());
-
-            // Divide by scale
-            vres = wrapper::vmul(vres, scale_v);
-
-            // Calculate square-root
-            vres = wrapper::vinv(wrapper::vinvsqrt(vres));
-
-            // Store result
-            wrapper::vstore(reinterpret_cast<T *>(out.ptr()) + x_off, vres);
-        }
-
-        // Left-overs loop
-        for(; x_off < window_end_x; ++x_off)
-        {
-            T res(0);
-
-            for(int z = pool_start_z; z < pool_end_z; ++z)
+            for(int c = window_start_x; c < window_end_x; c += channel_block)
             {
-                const uint8_t *in_ptr_z = in_ptr_n + (z + in_idx_depth) * w_stride;
-                for(int y = pool_start_y; y < pool_end_y; ++y)
+                const int c_end = std::min(c + channel_block, window_end_x);
+                for(int p = 0; p < num_points; ++p)
                 {
-                    const uint8_t *in_ptr_y = in_ptr_z + (y + in_idx_height) * z_stride;
-                    for(int x = pool_start_x; x < pool_end_x; ++x)
-                    {
-                        const uint8_t *in_ptr_x = in_ptr_y + (x + in_idx_width) * y_stride;
-                        const T        data     = *(reinterpret_cast<const T *>(in_ptr_x) + x_off);
-                        res += data * data;
-                    }
+                    pool_channels<T, Op>(tile[p], pool_end_y - pool_start_y, pool_end_z - pool_start_z, y_stride, z_stride, w_stride, c, c_end);
                 }
             }
-
-            // Divide by scale
-            res *= scale;
-
-            // Square root
-            res = std::sqrt(res);
-
-            // Store result
-            *(reinterpret_cast<T *>(out.ptr()) + x_off) = res;
         }
-    },
-    out);
+    });
 }
 } // namespace
 
 template <typename T>
 void poolingMxNxD_fp_neon_ndhwc(const ITensor *src, ITensor *dst0, Pooling3dLayerInfo &pool_info, const Window &window)
 {
-    const int     window_start_x = window.x().start();
-    const int     window_end_x   = window.x().end();
-    constexpr int window_step_x  = 16 / sizeof(T);
-    Window        window_out     = window;
-
-    // Needed to handle loop left-over
-    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
-
     switch(pool_info.pool_type)
     {
         case PoolingType::MAX:
-            max_poolingMxNxD_fp_neon_ndhwc<T>(src, dst0, pool_info, window_out, window_start_x, window_end_x, window_step_x);
+            poolingMxNxD_fp_neon_ndhwc_depthfirst<T, PoolingType::MAX>(src, dst0, pool_info, window);
             break;
         case PoolingType::AVG:
-            avg_poolingMxNxD_fp_neon_ndhwc<T>(src, dst0, pool_info, window_out, window_start_x, window_end_x, window_step_x);
+            poolingMxNxD_fp_neon_ndhwc_depthfirst<T, PoolingType::AVG>(src, dst0, pool_info, window);
             break;
         case PoolingType::L2:
-            l2_poolingMxNxD_fp_neon_ndhwc<T>(src, dst0, pool_info, window_out, window_start_x, window_end_x, window_step_x);
+            poolingMxNxD_fp_neon_ndhwc_depthfirst<T, PoolingType::L2>(src, dst0, pool_info, window);
             break;
         default:
             ARM_COMPUTE_ERROR("Pool operation not supported");
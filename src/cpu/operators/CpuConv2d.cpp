@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,7 +24,10 @@
 #include "src/cpu/operators/CpuConv2d.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEFFTConvolutionLayer.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 #include "src/cpu/operators/CpuGemm.h"
 #include "src/cpu/operators/CpuGemmConv2d.h"
@@ -95,10 +98,11 @@ void CpuConv2d::configure(ITensorInfo *input, ITensorInfo *weights, const ITenso
 Status CpuConv2d::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *output, const PadStrideInfo &conv_info,
                            const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math, unsigned int num_groups)
 {
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1), "Grouping (num_groups != 1) is not supported on Neon");
+    const Conv2dInfo        info(conv_info, dilation, act_info, enable_fast_math, num_groups);
+    const ConvolutionMethod method = CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math);
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG((num_groups != 1) && (method != ConvolutionMethod::GEMM_CONV2D), "Grouping (num_groups != 1) is only supported by CpuGemmDirectConv2d on Neon");
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, num_groups);
-    switch(CpuConv2d::get_convolution_method(input, weights, output, conv_info, weights_info, dilation, act_info, enable_fast_math))
+    switch(method)
     {
         case ConvolutionMethod::WINOGRAD:
             ARM_COMPUTE_RETURN_ON_ERROR(CpuWinogradConv2d::validate(input, weights, biases, output, conv_info, act_info, enable_fast_math));
@@ -125,13 +129,38 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo *input, co
                                                     const WeightsInfo &weights_info, const Size2D &dilation, const ActivationLayerInfo &act_info, bool enable_fast_math)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(input, output, weights);
-    ARM_COMPUTE_UNUSED(weights_info);
 
     const size_t idx_w = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::WIDTH);
     const size_t idx_h = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::HEIGHT);
     const size_t idx_c = get_data_layout_dimension_index(input->data_layout(), DataLayoutDimension::CHANNEL);
 
-    const Conv2dInfo info(conv_info, dilation, act_info, enable_fast_math, 1);
+    // Grouped convolutions have fewer input channels in the weights than in the input
+    const unsigned int num_groups = (weights->dimension(idx_c) != 0 && input->dimension(idx_c) > weights->dimension(idx_c)) ? input->dimension(idx_c) / weights->dimension(idx_c) : 1;
+    const Conv2dInfo   info(conv_info, dilation, act_info, enable_fast_math, num_groups);
+    if(num_groups > 1)
+    {
+        return ConvolutionMethod::GEMM_CONV2D;
+    }
+
+    // Layers with few input channels, such as the first layer of a network, have a GEMM reduction only a few taps deep:
+    // the register-blocked direct convolution vectorizes over the output channels instead
+    const size_t kernel_size           = weights->dimension(idx_w);
+    const bool   is_small_channel_conv = input->data_layout() == DataLayout::NHWC && is_data_type_float(input->data_type()) && input->dimension(idx_c) <= 8
+                                         && kernel_size == weights->dimension(idx_h) && (kernel_size == 3 || kernel_size == 5 || kernel_size == 7)
+                                         && conv_info.stride().first == conv_info.stride().second && conv_info.stride().first <= 2 && dilation == Size2D(1U, 1U)
+                                         && !weights_info.are_reshaped() && weights_info.weight_format() == WeightFormat::UNSPECIFIED;
+    if(is_small_channel_conv && bool(CpuDirectConv2d::validate(input, weights, nullptr, output, conv_info, act_info)))
+    {
+        return ConvolutionMethod::DIRECT;
+    }
+
+    // Compute the convolution as an implicit GEMM whenever the im2col buffer cannot be skipped
+    const bool skip_im2col = input->data_layout() == DataLayout::NHWC && weights->dimension(idx_w) == 1 && weights->dimension(idx_h) == 1 && conv_info.stride() == std::make_pair(1U, 1U)
+                             && dilation == Size2D(1U, 1U);
+    const auto gemm_method = [&]()
+    {
+        return (!skip_im2col && bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info))) ? ConvolutionMethod::GEMM_CONV2D : ConvolutionMethod::GEMM;
+    };
 
     /* Input spatial dims, kernel size, IFM/OFM, conv info*/
     using ConvolutionConfiguration = std::tuple<Size2D, Size2D, Size2D, PadStrideInfo>;
@@ -162,12 +191,12 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo *input, co
     std::vector<ConfigurationMethod>::const_iterator found;
     if((found = std::find_if(known_configs.begin(), known_configs.end(), find_config)) != known_configs.end())
     {
-        return (*found).second;
+        return (*found).second == ConvolutionMethod::GEMM ? gemm_method() : (*found).second;
     }
 
     if(dilation != Size2D(1U, 1U))
     {
-        return ConvolutionMethod::GEMM;
+        return gemm_method();
     }
     else
     {
@@ -184,7 +213,7 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo *input, co
         }
         if(input->dimension(idx_c) < 16)
         {
-            return ConvolutionMethod::GEMM;
+            return gemm_method();
         }
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -215,25 +244,21 @@ ConvolutionMethod CpuConv2d::get_convolution_method(const ITensorInfo *input, co
                              != known_bad_winograd_f16_with_fastmath_configs.end();
             if(found_bad)
             {
-                return ConvolutionMethod::GEMM;
+                return gemm_method();
             }
         }
 #endif // __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
         // For 1x1 convolutions run the default GEMM
         if(weights->dimension(idx_w) == 1 && weights->dimension(idx_h) == 1)
         {
-            return ConvolutionMethod::GEMM;
+            return gemm_method();
         }
 
         if(bool(CpuWinogradConv2d::validate(input, weights, nullptr, output, conv_info, act_info, enable_fast_math)))
         {
             return ConvolutionMethod::WINOGRAD;
         }
-        if(bool(CpuGemmDirectConv2d::validate(input, weights, nullptr, output, info)))
-        {
-            return ConvolutionMethod::GEMM_CONV2D;
-        }
-        return ConvolutionMethod::GEMM;
+        return gemm_method();
     }
 }
 
@@ -252,5 +277,33 @@ experimental::MemoryRequirements CpuConv2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_conv2d(const AclTensorDescriptor &src, const AclTensorDescriptor &weights, const AclTensorDescriptor *bias,
+                                                              const AclTensorDescriptor &dst, const AclConv2dDescriptor &info, bool is_validate)
+{
+    TensorInfo         src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo         weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo         bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo         dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    const ITensorInfo *bias_to_use  = (bias != nullptr) ? &bias_info : nullptr;
+
+    const PadStrideInfo       conv_info = detail::convert_to_pad_stride_info(info.pad_stride);
+    const Size2D              dilation(std::max(info.dilation_x, 1), std::max(info.dilation_y, 1));
+    const ActivationLayerInfo act_info  = detail::convert_to_activation_info(info.act);
+    const bool                fast_math = _caps.enable_fast_math;
+
+    if(!bool(CpuConv2d::validate(&src_info, &weights_info, bias_to_use, &dst_info, conv_info, WeightsInfo(), dilation, act_info, fast_math)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto conv_op = std::make_unique<CpuConv2d>();
+    conv_op->configure(&src_info, &weights_info, bias_to_use, &dst_info, conv_info, WeightsInfo(), dilation, act_info, fast_math);
+    return detail::wrap_operator(this, std::move(conv_op));
+}
 } // namespace cpu
 } // namespace arm_compute
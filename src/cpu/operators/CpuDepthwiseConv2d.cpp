@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,10 @@
 #include "arm_compute/core/utils/misc/InfoHelpers.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuDepthwiseConv2dNativeKernel.h"
 
 namespace arm_compute
@@ -517,5 +520,31 @@ void CpuDepthwiseConv2d::prepare(ITensorPack &tensors)
             ARM_COMPUTE_ERROR("DepthwiseConvolutionFunction not properly configured");
     }
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_depthwise_conv2d(const AclTensorDescriptor &src, const AclTensorDescriptor &weights, const AclTensorDescriptor *bias,
+                                                                        const AclTensorDescriptor &dst, const AclDepthwiseConv2dDescriptor &info, bool is_validate)
+{
+    TensorInfo         src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo         weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo         bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo         dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    const ITensorInfo *bias_to_use  = (bias != nullptr) ? &bias_info : nullptr;
+
+    const ConvolutionInfo conv_info(detail::convert_to_pad_stride_info(info.pad_stride), std::max(info.depth_multiplier, 1), detail::convert_to_activation_info(info.act),
+                                    Size2D(std::max(info.dilation_x, 1), std::max(info.dilation_y, 1)));
+
+    if(!bool(CpuDepthwiseConv2d::validate(&src_info, &weights_info, bias_to_use, &dst_info, conv_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto dwc_op = std::make_unique<CpuDepthwiseConv2d>();
+    dwc_op->configure(&src_info, &weights_info, bias_to_use, &dst_info, conv_info);
+    return detail::wrap_operator(this, std::move(dwc_op));
+}
 } // namespace cpu
 } // namespace arm_compute
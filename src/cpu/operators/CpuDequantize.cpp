@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,10 @@
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuDequantizeKernel.h"
 
 namespace arm_compute
@@ -52,5 +55,24 @@ void CpuDequantize::run(ITensorPack &tensors)
     prepare(tensors);
     NEScheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_dequantize(const AclTensorDescriptor &src, const AclTensorDescriptor &dst, bool is_validate)
+{
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+
+    if(!bool(CpuDequantize::validate(&src_info, &dst_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto dequantize_op = std::make_unique<CpuDequantize>();
+    dequantize_op->configure(&src_info, &dst_info);
+    return detail::wrap_operator(this, std::move(dequantize_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,8 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 namespace arm_compute
 {
@@ -37,7 +39,7 @@ CpuDirectConv2d::~CpuDirectConv2d() = default;
 
 CpuDirectConv2d::CpuDirectConv2d(std::shared_ptr<IMemoryManager> memory_manager)
     : _memory_group(std::move(memory_manager)), _output_stage_kernel(), _conv_kernel(), _input_border_handler(), _activationlayer_function(), _accumulator(), _has_bias(false),
-      _is_activationlayer_enabled(false), _dim_split(Window::DimZ), _is_padding_required()
+      _is_activationlayer_enabled(false), _dim_split(Window::DimZ), _is_padding_required(), _is_nhwc(false), _is_prepared(false), _packed_weights(), _aux_mem(Count)
 {
 }
 
@@ -56,13 +58,22 @@ void CpuDirectConv2d::configure(ITensorInfo *src, ITensorInfo *weights, const IT
         _accumulator.allocator()->free();
     }
 
-    _dim_split = src->data_layout() == DataLayout::NCHW ? Window::DimZ : Window::DimY;
+    _dim_split   = src->data_layout() == DataLayout::NCHW ? Window::DimZ : Window::DimY;
+    _is_nhwc     = src->data_layout() == DataLayout::NHWC;
+    _is_prepared = false;
 
     // Check if bias should be added in the convolution result
     _has_bias = (bias != nullptr);
 
     _conv_kernel->configure(src, weights, dst, conv_info);
-    if(_has_bias)
+
+    // The NHWC micro-kernels read packed weights and add the biases themselves
+    if(_is_nhwc)
+    {
+        _packed_weights         = kernels::CpuDirectConv2dKernel::packed_weights_info(weights);
+        _aux_mem[PackedWeights] = experimental::MemoryInfo(offset_int_vec(PackedWeights), experimental::MemoryLifetime::Persistent, _packed_weights.total_size());
+    }
+    else if(_has_bias)
     {
         _output_stage_kernel->configure(dst, bias);
     }
@@ -116,6 +127,8 @@ Status CpuDirectConv2d::validate(const ITensorInfo *src, const ITensorInfo *weig
 
 void CpuDirectConv2d::run(ITensorPack &tensors)
 {
+    prepare(tensors);
+
     MemoryGroupResourceScope scope_mg(_memory_group);
 
     auto src  = tensors.get_tensor(TensorType::ACL_SRC_0);
@@ -128,8 +141,22 @@ void CpuDirectConv2d::run(ITensorPack &tensors)
         pack.add_tensor(TensorType::ACL_SRC_DST, src);
         NEScheduler::get().schedule_op(_input_border_handler.get(), Window::DimZ, _input_border_handler->window(), pack);
     }
-    NEScheduler::get().schedule_op(_conv_kernel.get(), _dim_split, _conv_kernel->window(), tensors);
-    if(_has_bias)
+    if(_is_nhwc)
+    {
+        CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors, false);
+
+        ITensorPack pack;
+        pack.add_const_tensor(TensorType::ACL_SRC_0, src);
+        pack.add_const_tensor(TensorType::ACL_SRC_1, packed_weights.get());
+        pack.add_const_tensor(TensorType::ACL_SRC_2, bias);
+        pack.add_tensor(TensorType::ACL_DST, dst);
+        NEScheduler::get().schedule_op(_conv_kernel.get(), _dim_split, _conv_kernel->window(), pack);
+    }
+    else
+    {
+        NEScheduler::get().schedule_op(_conv_kernel.get(), _dim_split, _conv_kernel->window(), tensors);
+    }
+    if(_has_bias && !_is_nhwc)
     {
         ITensorPack pack;
         pack.add_tensor(TensorType::ACL_SRC_0, dst);
@@ -146,5 +173,25 @@ void CpuDirectConv2d::run(ITensorPack &tensors)
         _activationlayer_function->run(pack);
     }
 }
+
+void CpuDirectConv2d::prepare(ITensorPack &tensors)
+{
+    if(!_is_prepared)
+    {
+        if(_is_nhwc)
+        {
+            auto weights = tensors.get_const_tensor(TensorType::ACL_SRC_1);
+
+            CpuAuxTensorHandler packed_weights(offset_int_vec(PackedWeights), _packed_weights, tensors, true);
+            kernels::CpuDirectConv2dKernel::pack_weights(weights, packed_weights.get());
+        }
+        _is_prepared = true;
+    }
+}
+
+experimental::MemoryRequirements CpuDirectConv2d::workspace() const
+{
+    return _aux_mem;
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,8 @@ namespace cpu
  * -# @ref NEFillBorderKernel for the input
  * -# @ref kernels::CpuDirectConv2dOutputStageKernel
  * -# @ref kernels::CpuDirectConv2dKernel
+ *
+ * For NHWC, the weights are packed once at prepare time and the biases are added by @ref kernels::CpuDirectConv2dKernel.
  */
 class CpuDirectConv2d : public ICpuOperator
 {
@@ -86,9 +88,17 @@ public:
                            const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
-    void run(ITensorPack &tensors) override;
+    void                             run(ITensorPack &tensors) override;
+    void                             prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
+    enum AuxTensorIdx
+    {
+        PackedWeights = 0,
+        Count
+    };
+
     MemoryGroup                                                _memory_group;
     std::unique_ptr<kernels::CpuDirectConv2dOutputStageKernel> _output_stage_kernel;
     std::unique_ptr<kernels::CpuDirectConv2dKernel>            _conv_kernel;
@@ -99,6 +109,10 @@ private:
     bool                                                       _is_activationlayer_enabled{ false };
     unsigned int                                               _dim_split{ 0 };
     bool                                                       _is_padding_required{ false };
+    bool                                                       _is_nhwc{ false };
+    bool                                                       _is_prepared{ false };
+    TensorInfo                                                 _packed_weights{};
+    experimental::MemoryRequirements                           _aux_mem{ Count };
 };
 } // namespace cpu
 } // namespace arm_compute
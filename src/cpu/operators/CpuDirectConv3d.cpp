@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,17 +26,123 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/common/utils/Log.h"
+#include "src/core/CPP/Validate.h"
+#include "src/core/helpers/AutoConfiguration.h"
+
+#include <set>
 
 namespace arm_compute
 {
 namespace cpu
 {
+using namespace arm_compute::experimental;
+
+namespace
+{
+GEMMLowpOutputStageInfo calculate_output_stage_metadata(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *dst, const ActivationLayerInfo &act)
+{
+    const UniformQuantizationInfo uoqinfo   = dst->quantization_info().uniform();
+    const DataType                data_type = src->data_type();
+
+    // Merge activation with output stage
+    const std::set<ActivationLayerInfo::ActivationFunction> supported_acts = { ActivationLayerInfo::ActivationFunction::RELU,
+                                                                               ActivationLayerInfo::ActivationFunction::BOUNDED_RELU,
+                                                                               ActivationLayerInfo::ActivationFunction::LU_BOUNDED_RELU
+                                                                             };
+    PixelValue type_min{};
+    PixelValue type_max{};
+    std::tie(type_min, type_max) = get_min_max(data_type);
+    int32_t min_activation       = type_min.get<int32_t>();
+    int32_t max_activation       = type_max.get<int32_t>();
+    if(supported_acts.count(act.activation()) != 0)
+    {
+        std::tie(min_activation, max_activation) = get_quantized_activation_min_max(act, data_type, uoqinfo);
+    }
+    GEMMLowpOutputStageInfo os_info;
+    os_info.type               = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+    os_info.gemmlowp_offset    = uoqinfo.offset;
+    os_info.gemmlowp_min_bound = min_activation;
+    os_info.gemmlowp_max_bound = max_activation;
+    quantization::calculate_quantized_multipliers(src->quantization_info(), weights->quantization_info(), dst->quantization_info(), os_info);
+    return os_info;
+}
+
+AsmGemmInfo init_assembly_metadata(const Conv3dInfo &conv_info)
+{
+    AsmGemmInfo asm_info;
+    asm_info.method          = AsmConvMethod::Indirect;
+    asm_info.conv3d          = true;
+    asm_info.ps_info         = PadStrideInfo(conv_info.stride.x(), conv_info.stride.y(), conv_info.padding.left, conv_info.padding.right, conv_info.padding.top, conv_info.padding.bottom,
+                                             conv_info.round_type);
+    asm_info.activation_info = conv_info.act_info;
+    asm_info.padding_top     = conv_info.padding.top;
+    asm_info.padding_left    = conv_info.padding.left;
+    asm_info.padding_front   = conv_info.padding.front;
+    asm_info.dilation        = Size2D(conv_info.dilation.width, conv_info.dilation.height);
+    asm_info.stride_depth    = conv_info.stride.z();
+    asm_info.dilation_depth  = conv_info.dilation.depth;
+    asm_info.negated_offsets = false;
+    asm_info.fast_mode       = conv_info.enable_fast_math;
+    return asm_info;
+}
+
+Status validate_arguments(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *src2, const ITensorInfo *dst, const Conv3dInfo &conv_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON(src0->data_layout() != DataLayout::NDHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(src0);
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src0, 1, DataType::F16, DataType::F32, DataType::QASYMM8, DataType::QASYMM8_SIGNED);
+    ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src0, src1);
+    ARM_COMPUTE_RETURN_ERROR_ON(conv_info.dilation.width == 0 || conv_info.dilation.height == 0 || conv_info.dilation.depth == 0);
+
+    // Weight layout is D, H, W, Cin, Cout
+    ARM_COMPUTE_RETURN_ERROR_ON(src1->num_dimensions() > 5);
+    ARM_COMPUTE_RETURN_ERROR_ON(src1->dimension(1) != src0->dimension(0));
+
+    if(src2 != nullptr)
+    {
+        if(is_data_type_quantized(src0->data_type()))
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src2, 1, DataType::S32);
+        }
+        else
+        {
+            ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_TYPES(src1, src2);
+        }
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src2->dimension(0) != src1->dimension(0), "Biases size and number of dst feature maps should match");
+        ARM_COMPUTE_RETURN_ERROR_ON_MSG(src2->num_dimensions() > 1, "Biases should be one dimensional");
+    }
+
+    if(dst->total_size() != 0)
+    {
+        const TensorShape output_shape = misc::shape_calculator::compute_conv3d_shape(src0->tensor_shape(), src1->tensor_shape(), conv_info);
+        ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DIMENSIONS(dst->tensor_shape(), output_shape);
+        ARM_COMPUTE_RETURN_ERROR_ON(dst->data_type() != src0->data_type());
+    }
+    return Status{};
+}
+
+Status validate_gemm(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *src2, const ITensorInfo *dst, const Conv3dInfo &conv_info)
+{
+    TensorInfo gemm_dst(*dst);
+    if(dst->total_size() == 0)
+    {
+        gemm_dst.set_tensor_shape(misc::shape_calculator::compute_conv3d_shape(src0->tensor_shape(), src1->tensor_shape(), conv_info)).set_data_type(src0->data_type());
+    }
+    return CpuGemmAssemblyDispatch::validate(src0, src1, src2, &gemm_dst, init_assembly_metadata(conv_info));
+}
+} // namespace
+
 CpuDirectConv3d::~CpuDirectConv3d() = default;
 
 CpuDirectConv3d::CpuDirectConv3d(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _conv_kernel(), _activationlayer_function(), _accumulator(), _is_activationlayer_enabled(false), _dim_split(Window::DimZ)
+    : _memory_group(std::move(memory_manager)), _conv_kernel(), _gemm_asm_func(), _activationlayer_function(), _accumulator(), _is_activationlayer_enabled(false), _use_gemm(false),
+      _dim_split(Window::DimZ), _aux_mem()
 {
 }
 
@@ -45,8 +151,6 @@ void CpuDirectConv3d::configure(ITensorInfo *src0, ITensorInfo *src1, const ITen
     ARM_COMPUTE_LOG_PARAMS(src0, src1, src2, dst, conv_info);
     ARM_COMPUTE_ERROR_ON(src0->data_layout() != DataLayout::NDHWC);
 
-    _conv_kernel = std::make_unique<kernels::CpuDirectConv3dKernel>();
-
     // Free accumulator
     if(_accumulator.buffer() != nullptr)
     {
@@ -54,11 +158,36 @@ void CpuDirectConv3d::configure(ITensorInfo *src0, ITensorInfo *src1, const ITen
     }
 
     _dim_split = Window::DimY;
+    _aux_mem.clear();
+
+    // The weights are [OFM, IFM, kernel_x, kernel_y, kernel_z], which is the layout of the B matrix of an indirect GEMM
+    // with one section per kernel element: prefer the assembly kernels when they support the configuration
+    _use_gemm = bool(validate_gemm(src0, src1, src2, dst, conv_info));
+    if(_use_gemm)
+    {
+        auto_init_if_empty(*dst, misc::shape_calculator::compute_conv3d_shape(src0->tensor_shape(), src1->tensor_shape(), conv_info), 1, src0->data_type());
+
+        AsmGemmInfo asm_info = init_assembly_metadata(conv_info);
+        if(is_data_type_quantized(src0->data_type()))
+        {
+            asm_info.output_stage = calculate_output_stage_metadata(src0, src1, dst, conv_info.act_info);
+        }
+
+        _gemm_asm_func = std::make_unique<CpuGemmAssemblyDispatch>();
+        _gemm_asm_func->configure(src0, src1, src2, dst, asm_info);
+        _aux_mem = _gemm_asm_func->workspace();
 
-    _conv_kernel->configure(src0, src1, src2, dst, conv_info);
+        _is_activationlayer_enabled = conv_info.act_info.enabled() && !CpuGemmAssemblyDispatch::is_activation_supported(conv_info.act_info);
+    }
+    else
+    {
+        _conv_kernel = std::make_unique<kernels::CpuDirectConv3dKernel>();
+        _conv_kernel->configure(src0, src1, src2, dst, conv_info);
+
+        _is_activationlayer_enabled = conv_info.act_info.enabled();
+    }
 
     //Configure Activation Layer
-    _is_activationlayer_enabled = conv_info.act_info.enabled();
     if(_is_activationlayer_enabled)
     {
         _activationlayer_function = std::make_unique<CpuActivation>();
@@ -69,9 +198,13 @@ void CpuDirectConv3d::configure(ITensorInfo *src0, ITensorInfo *src1, const ITen
 Status CpuDirectConv3d::validate(const ITensorInfo *src0, const ITensorInfo *src1, const ITensorInfo *src2, const ITensorInfo *dst, const Conv3dInfo conv_info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src0, src1, dst);
+    ARM_COMPUTE_RETURN_ON_ERROR(validate_arguments(src0, src1, src2, dst, conv_info));
 
-    // Validate Convolution kernel
-    ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDirectConv3dKernel::validate(src0, src1, src2, dst, conv_info));
+    // Validate Convolution kernel if the assembly kernels do not support the configuration
+    if(!bool(validate_gemm(src0, src1, src2, dst, conv_info)))
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuDirectConv3dKernel::validate(src0, src1, src2, dst, conv_info));
+    }
 
     if(conv_info.act_info.enabled())
     {
@@ -87,7 +220,14 @@ void CpuDirectConv3d::run(ITensorPack &tensors)
 
     auto dst = tensors.get_tensor(TensorType::ACL_DST);
 
-    NEScheduler::get().schedule_op(_conv_kernel.get(), _dim_split, _conv_kernel->window(), tensors);
+    if(_use_gemm)
+    {
+        _gemm_asm_func->run(tensors);
+    }
+    else
+    {
+        NEScheduler::get().schedule_op(_conv_kernel.get(), _dim_split, _conv_kernel->window(), tensors);
+    }
 
     if(_is_activationlayer_enabled)
     {
@@ -97,5 +237,18 @@ void CpuDirectConv3d::run(ITensorPack &tensors)
         _activationlayer_function->run(pack);
     }
 }
+
+void CpuDirectConv3d::prepare(ITensorPack &tensors)
+{
+    if(_use_gemm)
+    {
+        _gemm_asm_func->prepare(tensors);
+    }
+}
+
+experimental::MemoryRequirements CpuDirectConv3d::workspace() const
+{
+    return _aux_mem;
+}
 } // namespace cpu
-} // namespace arm_compute
\ No newline at end of file
+} // namespace arm_compute
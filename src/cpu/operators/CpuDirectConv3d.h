@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,7 @@
 #include "src/cpu/ICpuOperator.h"
 #include "src/cpu/kernels/CpuDirectConv3dKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
+#include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
 #include <memory>
 
@@ -44,11 +45,12 @@ namespace arm_compute
 {
 namespace cpu
 {
-/** Function to run the direct convolution.
+/** Function to run the 3D convolution.
  *
- *  This function calls the following kernels:
+ *  This function calls one of the following:
  *
- * -# @ref kernels::CpuDirectConv3dKernel
+ * -# @ref CpuGemmAssemblyDispatch (implicit GEMM through an indirect buffer over the NDHWC source)
+ * -# @ref kernels::CpuDirectConv3dKernel (if no assembly kernel supports the configuration)
  */
 class CpuDirectConv3d : public ICpuOperator
 {
@@ -87,14 +89,19 @@ public:
 
     // Inherited methods overridden:
     void run(ITensorPack &tensors) override;
+    void prepare(ITensorPack &tensors) override;
+    experimental::MemoryRequirements workspace() const override;
 
 private:
     MemoryGroup                                     _memory_group;
     std::unique_ptr<kernels::CpuDirectConv3dKernel> _conv_kernel;
+    std::unique_ptr<CpuGemmAssemblyDispatch>        _gemm_asm_func;
     std::unique_ptr<CpuActivation>                  _activationlayer_function;
     Tensor                                          _accumulator;
     bool                                            _is_activationlayer_enabled{ false };
+    bool                                            _use_gemm{ false };
     unsigned int                                    _dim_split{ 0 };
+    experimental::MemoryRequirements                _aux_mem{};
 };
 } // namespace cpu
 } // namespace arm_compute
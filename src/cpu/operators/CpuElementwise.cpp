@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,9 +22,15 @@
  * SOFTWARE.
  */
 #include "src/cpu/operators/CpuElementwise.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/WindowHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuElementwiseKernel.h"
+#include "src/cpu/operators/CpuAdd.h"
+#include "src/cpu/operators/CpuMul.h"
+#include "src/cpu/operators/CpuSub.h"
 
 namespace arm_compute
 {
@@ -126,5 +132,73 @@ template class CpuElementwiseComparisonStatic<ComparisonOperation::Greater>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::GreaterEqual>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::Less>;
 template class CpuElementwiseComparisonStatic<ComparisonOperation::LessEqual>;
+
+namespace
+{
+/** Validate a binary operator and configure it unless only the validation is requested */
+template <typename OperatorType, typename... Args>
+std::unique_ptr<ICpuOperator> create_binary_operator(Status &status, bool is_validate, TensorInfo &src0, TensorInfo &src1, TensorInfo &dst, Args... args)
+{
+    status = OperatorType::validate(&src0, &src1, &dst, args...);
+    if(!bool(status) || is_validate)
+    {
+        return nullptr;
+    }
+
+    auto op = std::make_unique<OperatorType>();
+    op->configure(&src0, &src1, &dst, args...);
+    return op;
+}
+} // namespace
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_elementwise(const AclTensorDescriptor &src0, const AclTensorDescriptor &src1, const AclTensorDescriptor &dst,
+                                                                   const AclElementwiseDescriptor &info, bool is_validate)
+{
+    TensorInfo src0_info = detail::convert_to_legacy_tensor_info(src0);
+    TensorInfo src1_info = detail::convert_to_legacy_tensor_info(src1);
+    TensorInfo dst_info  = detail::convert_to_legacy_tensor_info(dst);
+
+    Status                        status{};
+    std::unique_ptr<ICpuOperator> op{ nullptr };
+    switch(info.type)
+    {
+        case AclElementwiseType::AclElementwiseAdd:
+            op = create_binary_operator<CpuAdd>(status, is_validate, src0_info, src1_info, dst_info, ConvertPolicy::SATURATE, ActivationLayerInfo());
+            break;
+        case AclElementwiseType::AclElementwiseSub:
+            op = create_binary_operator<CpuSub>(status, is_validate, src0_info, src1_info, dst_info, ConvertPolicy::SATURATE, ActivationLayerInfo());
+            break;
+        case AclElementwiseType::AclElementwiseMul:
+            op = create_binary_operator<CpuMul>(status, is_validate, src0_info, src1_info, dst_info, 1.f, ConvertPolicy::SATURATE, RoundingPolicy::TO_ZERO, ActivationLayerInfo());
+            break;
+        case AclElementwiseType::AclElementwiseDiv:
+            op = create_binary_operator<CpuElementwiseDivision>(status, is_validate, src0_info, src1_info, dst_info);
+            break;
+        case AclElementwiseType::AclElementwiseMax:
+            op = create_binary_operator<CpuElementwiseMax>(status, is_validate, src0_info, src1_info, dst_info);
+            break;
+        case AclElementwiseType::AclElementwiseMin:
+            op = create_binary_operator<CpuElementwiseMin>(status, is_validate, src0_info, src1_info, dst_info);
+            break;
+        case AclElementwiseType::AclElementwiseSquaredDiff:
+            op = create_binary_operator<CpuElementwiseSquaredDiff>(status, is_validate, src0_info, src1_info, dst_info);
+            break;
+        case AclElementwiseType::AclElementwisePow:
+            op = create_binary_operator<CpuElementwisePower>(status, is_validate, src0_info, src1_info, dst_info);
+            break;
+        default:
+            return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    if(!bool(status))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+    return detail::wrap_operator(this, std::move(op));
+}
 } // namespace cpu
 } // namespace arm_compute
\ No newline at end of file
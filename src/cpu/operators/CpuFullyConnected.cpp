@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,10 +29,13 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuTransposeKernel.h"
 #include "src/cpu/operators/CpuConvertFullyConnectedWeights.h"
 #include "src/cpu/operators/CpuFlatten.h"
@@ -543,5 +546,34 @@ experimental::MemoryRequirements CpuFullyConnected::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<arm_compute::IOperator *, StatusCode> CpuContext::create_fully_connected(const AclTensorDescriptor &src, const AclTensorDescriptor &weights, const AclTensorDescriptor *bias,
+                                                                                    const AclTensorDescriptor &dst, const AclFullyConnectedDescriptor &info, bool is_validate)
+{
+    TensorInfo         src_info     = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo         weights_info = detail::convert_to_legacy_tensor_info(weights);
+    TensorInfo         bias_info    = (bias != nullptr) ? detail::convert_to_legacy_tensor_info(*bias) : TensorInfo();
+    TensorInfo         dst_info     = detail::convert_to_legacy_tensor_info(dst);
+    const ITensorInfo *bias_to_use  = (bias != nullptr) ? &bias_info : nullptr;
+
+    weights_info.set_are_values_constant(info.constant_weights);
+    FullyConnectedLayerInfo fc_info{};
+    fc_info.activation_info   = detail::convert_to_activation_info(info.act);
+    fc_info.transpose_weights = info.transpose_weights;
+    fc_info.enable_fast_math  = _caps.enable_fast_math;
+
+    if(!bool(CpuFullyConnected::validate(&src_info, &weights_info, bias_to_use, &dst_info, fc_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto fc_op = std::make_unique<CpuFullyConnected>();
+    fc_op->configure(&src_info, &weights_info, bias_to_use, &dst_info, fc_info);
+    return detail::wrap_operator(this, std::move(fc_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,10 +27,13 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
@@ -413,5 +416,33 @@ bool CpuGemm::isVarWeightsKernel() const
 {
     return _asm_glue && _asm_glue->isVarWeightsKernel();
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_gemm(const AclTensorDescriptor &a, const AclTensorDescriptor &b, const AclTensorDescriptor *c,
+                                                            const AclTensorDescriptor &d, const AclGemmDescriptor &info, bool is_validate)
+{
+    TensorInfo         a_info   = detail::convert_to_legacy_tensor_info(a);
+    TensorInfo         b_info   = detail::convert_to_legacy_tensor_info(b);
+    TensorInfo         c_info   = (c != nullptr) ? detail::convert_to_legacy_tensor_info(*c) : TensorInfo();
+    TensorInfo         d_info   = detail::convert_to_legacy_tensor_info(d);
+    const ITensorInfo *c_to_use = (c != nullptr) ? &c_info : nullptr;
+
+    // Constant weights get reshaped once, variable ones at every run
+    b_info.set_are_values_constant(info.constant_b);
+    const GEMMInfo gemm_info(false, false, info.constant_b, 0, false, false, GEMMLowpOutputStageInfo(), false, _caps.enable_fast_math, false,
+                             detail::convert_to_activation_info(info.act));
+
+    if(!bool(CpuGemm::validate(&a_info, &b_info, c_to_use, &d_info, info.alpha, info.beta, gemm_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto gemm_op = std::make_unique<CpuGemm>();
+    gemm_op->configure(&a_info, &b_info, c_to_use, &d_info, info.alpha, info.beta, gemm_info);
+    return detail::wrap_operator(this, std::move(gemm_op));
+}
 } // namespace cpu
 } // namespace arm_compute
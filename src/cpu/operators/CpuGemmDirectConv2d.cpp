@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -85,6 +85,7 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
     asm_info.reinterpret_input_as_3d = true;
     asm_info.padding_top             = info.conv_info.pad_top();
     asm_info.padding_left            = info.conv_info.pad_left();
+    asm_info.dilation                = info.dilation;
     asm_info.padding_value           = 0.f;
     asm_info.negated_offsets         = false;
     asm_info.fast_mode               = info.enable_fast_math;
@@ -92,14 +93,71 @@ cpu::AsmGemmInfo init_assembly_metadata(const Conv2dInfo &info, bool is_indirect
     asm_info.weight_format           = info.weights_info.weight_format();
     return asm_info;
 }
+PermutationVector weights_permutation(DataLayout data_layout)
+{
+    // The assembly dispatch expects the weights as [OFM, IFM, kernel_x, kernel_y]
+    return data_layout == DataLayout::NCHW ? PermutationVector(3U, 2U, 0U, 1U) : PermutationVector(3U, 0U, 1U, 2U);
+}
+TensorInfo permute_to_nhwc(const ITensorInfo &info)
+{
+    TensorShape shape = info.tensor_shape();
+    permute(shape, PermutationVector(2U, 0U, 1U));
+    return TensorInfo(info.clone()->set_tensor_shape(shape).set_data_layout(DataLayout::NHWC));
+}
+/** Create a view of the channels of @p info that belong to @p group. The view shares the strides of @p info */
+TensorInfo group_view(const ITensorInfo &info, unsigned int num_groups, unsigned int group)
+{
+    TensorShape  shape      = info.tensor_shape();
+    const size_t group_size = shape[0] / num_groups;
+    shape.set(0, group_size, false);
+
+    TensorInfo view(info);
+    view.init(shape, info.num_channels(), info.data_type(), info.strides_in_bytes(),
+              info.offset_first_element_in_bytes() + group * group_size * info.strides_in_bytes()[0], info.total_size());
+    return view;
+}
+/** Import in @p view the channels of @p tensor that belong to @p group */
+Tensor *import_group_view(Tensor &view, const ITensor *tensor, unsigned int num_groups, unsigned int group)
+{
+    if(tensor == nullptr)
+    {
+        return nullptr;
+    }
+    view.allocator()->init(group_view(*tensor->info(), num_groups, group));
+    if(tensor->buffer() != nullptr)
+    {
+        view.allocator()->import_memory(tensor->buffer());
+    }
+    return &view;
+}
+GEMMLowpOutputStageInfo group_output_stage(const GEMMLowpOutputStageInfo &output_stage, unsigned int num_groups, unsigned int group)
+{
+    GEMMLowpOutputStageInfo group_stage = output_stage;
+    if(output_stage.is_quantized_per_channel && num_groups > 1)
+    {
+        const size_t group_size = output_stage.gemmlowp_multipliers.size() / num_groups;
+        const auto   first      = group * group_size;
+        group_stage.gemmlowp_multipliers.assign(output_stage.gemmlowp_multipliers.begin() + first, output_stage.gemmlowp_multipliers.begin() + first + group_size);
+        group_stage.gemmlowp_shifts.assign(output_stage.gemmlowp_shifts.begin() + first, output_stage.gemmlowp_shifts.begin() + first + group_size);
+        group_stage.gemmlowp_multiplier = group_stage.gemmlowp_multipliers[0];
+        group_stage.gemmlowp_shift      = group_stage.gemmlowp_shifts[0];
+    }
+    return group_stage;
+}
 } // namespace
 
 CpuGemmDirectConv2d::CpuGemmDirectConv2d()
-    : _gemm_asm_func(std::make_unique<CpuGemmAssemblyDispatch>()),
+    : _gemm_asm_funcs(),
       _activation_func(std::make_unique<CpuActivation>()),
       _weights_permute_func(std::make_unique<CpuPermute>()),
+      _src_permute_func(),
+      _dst_permute_func(),
       _aux_mem(AuxTensorIdx::Count),
       _perm_weights(),
+      _perm_src(),
+      _perm_dst(),
+      _num_groups(1),
+      _is_nchw(false),
       _run_activation(false),
       _is_prepared(false)
 {
@@ -107,6 +165,11 @@ CpuGemmDirectConv2d::CpuGemmDirectConv2d()
 
 CpuGemmDirectConv2d::~CpuGemmDirectConv2d() = default;
 
+int CpuGemmDirectConv2d::pretranspose_idx(unsigned int group)
+{
+    return group == 0 ? static_cast<int>(Pretranspose) : static_cast<int>(Count + group - 1);
+}
+
 void CpuGemmDirectConv2d::configure(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *biases, ITensorInfo *dst, const Conv2dInfo &info)
 {
     ARM_COMPUTE_ERROR_ON_NULLPTR(src, weights, dst);
@@ -117,18 +180,62 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src, const ITensorInfo *w
                                                              info));
     ARM_COMPUTE_LOG_PARAMS(src, weights, biases, dst, info);
 
-    _run_activation = info.act_info.enabled() && !_gemm_asm_func->is_activation_supported(info.act_info);
+    _num_groups     = info.num_groups;
+    _is_nchw        = src->data_layout() == DataLayout::NCHW;
+    _run_activation = info.act_info.enabled() && !CpuGemmAssemblyDispatch::is_activation_supported(info.act_info);
     _is_prepared    = false;
 
-    _weights_permute_func->configure(weights, &_perm_weights, PermutationVector{ 3, 0, 1, 2 });
+    _weights_permute_func->configure(weights, &_perm_weights, weights_permutation(src->data_layout()));
+
+    // The GEMM works on NHWC tensors: permute NCHW source and destination around it
+    const ITensorInfo *gemm_src = src;
+    ITensorInfo       *gemm_dst = dst;
+    if(_is_nchw)
+    {
+        _src_permute_func = std::make_unique<CpuPermute>();
+        _src_permute_func->configure(src, &_perm_src, PermutationVector(2U, 0U, 1U));
+        _perm_src.set_data_layout(DataLayout::NHWC);
+
+        _perm_dst         = permute_to_nhwc(*dst);
+        _dst_permute_func = std::make_unique<CpuPermute>();
+        _dst_permute_func->configure(&_perm_dst, dst, PermutationVector(1U, 2U, 0U));
 
-    // Configure assembly dispatch
+        gemm_src = &_perm_src;
+        gemm_dst = &_perm_dst;
+    }
+
+    // Configure assembly dispatch, one per group
     cpu::AsmGemmInfo asm_info = init_assembly_metadata(info, false);
     if(is_data_type_quantized(src->data_type()))
     {
         asm_info.output_stage = calculate_output_stage_metadata(src, weights, dst, info.act_info);
     }
-    _gemm_asm_func->configure(src, &_perm_weights, biases, dst, asm_info);
+
+    _gemm_asm_funcs.clear();
+    _aux_mem = MemoryRequirements(Count + _num_groups - 1);
+    for(unsigned int g = 0; g < _num_groups; ++g)
+    {
+        TensorInfo       src_g      = group_view(*gemm_src, _num_groups, g);
+        TensorInfo       weights_g  = group_view(_perm_weights, _num_groups, g);
+        TensorInfo       biases_g   = biases != nullptr ? group_view(*biases, _num_groups, g) : TensorInfo();
+        TensorInfo       dst_g      = group_view(*gemm_dst, _num_groups, g);
+        cpu::AsmGemmInfo asm_info_g = asm_info;
+        asm_info_g.output_stage     = group_output_stage(asm_info.output_stage, _num_groups, g);
+
+        auto gemm_asm_func = std::make_unique<CpuGemmAssemblyDispatch>();
+        gemm_asm_func->configure(&src_g, &weights_g, biases != nullptr ? &biases_g : nullptr, &dst_g, asm_info_g);
+
+        // Add auxiliary memory requirements of the assembly dispatch. Groups run one after the other and share the workspace
+        const auto asm_mem_req = gemm_asm_func->workspace();
+        if(!_aux_mem[AsmGemmWorkspace].merge(offset_int_vec(AsmGemmWorkspace), asm_mem_req[AsmGemmWorkspace].size, asm_mem_req[AsmGemmWorkspace].alignment))
+        {
+            _aux_mem[AsmGemmWorkspace] = asm_mem_req[AsmGemmWorkspace];
+        }
+        const int idx  = pretranspose_idx(g);
+        _aux_mem[idx] = MemoryInfo(offset_int_vec(idx), asm_mem_req[Pretranspose].lifetime, asm_mem_req[Pretranspose].size, asm_mem_req[Pretranspose].alignment);
+
+        _gemm_asm_funcs.emplace_back(std::move(gemm_asm_func));
+    }
 
     // Configure activation
     if(_run_activation)
@@ -136,11 +243,6 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src, const ITensorInfo *w
         _activation_func->configure(dst, nullptr, info.act_info);
     }
 
-    // Add auxiliary memory requirements of the assembly dispatch
-    auto asm_mem_req           = _gemm_asm_func->workspace();
-    _aux_mem[AsmGemmWorkspace] = asm_mem_req[AsmGemmWorkspace];
-    _aux_mem[Pretranspose]     = asm_mem_req[Pretranspose];
-
     if(_aux_mem[Pretranspose].size > 0)
     {
         // Release permuted weights at the of prepare as they are further transposed by the assembly dispatch
@@ -152,23 +254,29 @@ void CpuGemmDirectConv2d::configure(const ITensorInfo *src, const ITensorInfo *w
         if(info.weights_info.weight_format() == WeightFormat::UNSPECIFIED)
             _aux_mem[PermutedWeights] = MemoryInfo(offset_int_vec(PermutedWeights), MemoryLifetime::Persistent, weights->total_size());
     }
+    _aux_mem[PermutedSrc] = MemoryInfo(offset_int_vec(PermutedSrc), MemoryLifetime::Temporary, _perm_src.total_size());
+    _aux_mem[PermutedDst] = MemoryInfo(offset_int_vec(PermutedDst), MemoryLifetime::Temporary, _perm_dst.total_size());
 }
 Status CpuGemmDirectConv2d::validate(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *biases, const ITensorInfo *dst, const Conv2dInfo &info)
 {
     ARM_COMPUTE_RETURN_ERROR_ON_NULLPTR(src, weights, dst);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(src, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::BFLOAT16, DataType::F16, DataType::F32);
     ARM_COMPUTE_RETURN_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::QASYMM8, DataType::QASYMM8_SIGNED, DataType::QSYMM8_PER_CHANNEL, DataType::BFLOAT16, DataType::F16, DataType::F32);
-    if(!is_fixed_format(info.weights_info.weight_format()))
+    ARM_COMPUTE_RETURN_ERROR_ON_DATA_LAYOUT_NOT_IN(src, DataLayout::NHWC, DataLayout::NCHW);
+    const bool is_fixed_format_weights = is_fixed_format(info.weights_info.weight_format());
+    if(!is_fixed_format_weights)
     {
         ARM_COMPUTE_RETURN_ERROR_ON_MISMATCHING_DATA_LAYOUT(src, weights);
     }
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.num_groups > 1, "Grouping (num_groups != 1) is not supported on Neon");
-    ARM_COMPUTE_RETURN_ERROR_ON_MSG(src->data_layout() != DataLayout::NHWC, "Data layout supported is NHWC");
-    const DataType    data_type = src->data_type();
-    const TensorShape i_shape   = src->tensor_shape();
-    const TensorShape w_shape   = weights->tensor_shape();
-    ARM_COMPUTE_RETURN_ERROR_ON(w_shape[0] != i_shape[0]);
-    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation != Size2D(1U, 1U));
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_fixed_format_weights && src->data_layout() != DataLayout::NHWC, "Fixed format weights are only supported with NHWC");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(is_fixed_format_weights && info.num_groups > 1, "Grouping (num_groups != 1) is not supported with fixed format weights");
+    ARM_COMPUTE_RETURN_ERROR_ON(info.num_groups == 0);
+    const DataType     data_type = src->data_type();
+    const DataLayout   layout    = src->data_layout();
+    const unsigned int idx_c     = get_data_layout_dimension_index(layout, DataLayoutDimension::CHANNEL);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(idx_c) * info.num_groups != src->dimension(idx_c));
+    ARM_COMPUTE_RETURN_ERROR_ON(weights->dimension(3) % info.num_groups != 0);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.dilation.x() == 0 || info.dilation.y() == 0);
     ARM_COMPUTE_RETURN_ERROR_ON(weights->num_dimensions() > 4);
     // Validate biases
     if(biases != nullptr)
@@ -189,19 +297,89 @@ Status CpuGemmDirectConv2d::validate(const ITensorInfo *src, const ITensorInfo *
         ARM_COMPUTE_RETURN_ERROR_ON(biases->num_dimensions() > 1);
     }
 
+    // Validate the assembly dispatch of the first group, the other groups have the same configuration
+    const bool is_nchw  = layout == DataLayout::NCHW;
+    TensorInfo gemm_src = is_nchw ? permute_to_nhwc(*src) : TensorInfo(*src);
+    TensorInfo gemm_dst = is_nchw ? permute_to_nhwc(*dst) : TensorInfo(*dst);
+    TensorShape perm_weights_shape = weights->tensor_shape();
+    permute(perm_weights_shape, weights_permutation(layout));
+    const TensorInfo perm_weights(weights->clone()->set_tensor_shape(perm_weights_shape));
+
+    const TensorInfo src_g     = group_view(gemm_src, info.num_groups, 0);
+    const TensorInfo weights_g = group_view(perm_weights, info.num_groups, 0);
+    const TensorInfo biases_g  = biases != nullptr ? group_view(*biases, info.num_groups, 0) : TensorInfo();
+    const TensorInfo dst_g     = group_view(gemm_dst, info.num_groups, 0);
+
     cpu::AsmGemmInfo asm_info = init_assembly_metadata(info, false);
-    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(src, weights, biases, dst, asm_info));
+    ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmAssemblyDispatch::validate(&src_g, &weights_g, biases != nullptr ? &biases_g : nullptr, &dst_g, asm_info));
     return Status{};
 }
+
+void CpuGemmDirectConv2d::run_groups(ITensorPack &tensors, const ITensor *src, const ITensor *weights, const ITensor *biases, ITensor *dst, bool run_func)
+{
+    ITensor *workspace = tensors.get_tensor(offset_int_vec(AsmGemmWorkspace));
+    for(unsigned int g = 0; g < _num_groups; ++g)
+    {
+        Tensor src_g{};
+        Tensor weights_g{};
+        Tensor biases_g{};
+        Tensor dst_g{};
+
+        ITensorPack pack{};
+        pack.add_const_tensor(ACL_SRC_0, import_group_view(src_g, src, _num_groups, g));
+        pack.add_const_tensor(ACL_SRC_1, import_group_view(weights_g, weights, _num_groups, g));
+        pack.add_const_tensor(ACL_SRC_2, import_group_view(biases_g, biases, _num_groups, g));
+        pack.add_tensor(ACL_DST, import_group_view(dst_g, dst, _num_groups, g));
+        pack.add_tensor(offset_int_vec(AsmGemmWorkspace), workspace);
+        pack.add_tensor(offset_int_vec(Pretranspose), tensors.get_tensor(offset_int_vec(pretranspose_idx(g))));
+
+        if(run_func)
+        {
+            _gemm_asm_funcs[g]->run(pack);
+        }
+        else
+        {
+            _gemm_asm_funcs[g]->prepare(pack);
+        }
+    }
+}
+
 void CpuGemmDirectConv2d::run(ITensorPack &tensors)
 {
     prepare(tensors);
 
-    _gemm_asm_func->run(tensors);
+    const ITensor *src     = tensors.get_const_tensor(ACL_SRC_0);
+    const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
+    const ITensor *biases  = tensors.get_const_tensor(ACL_SRC_2);
+    ITensor       *dst     = tensors.get_tensor(ACL_DST);
+
+    // The permuted weights are only read when the assembly dispatch does not pre-transpose them
+    CpuAuxTensorHandler perm_weights(offset_int_vec(PermutedWeights), _perm_weights, tensors, false, true);
+    CpuAuxTensorHandler perm_src(offset_int_vec(PermutedSrc), _perm_src, tensors, false);
+    CpuAuxTensorHandler perm_dst(offset_int_vec(PermutedDst), _perm_dst, tensors, false);
+
+    if(_is_nchw)
+    {
+        ITensorPack pack{ { ACL_SRC, src }, { ACL_DST, perm_src.get() } };
+        _src_permute_func->run(pack);
+    }
+
+    run_groups(tensors,
+               _is_nchw ? perm_src.get() : src,
+               _gemm_asm_funcs[0]->isVarWeightsKernel() ? weights : perm_weights.get(),
+               biases,
+               _is_nchw ? perm_dst.get() : dst,
+               true);
+
+    if(_is_nchw)
+    {
+        ITensorPack pack{ { ACL_SRC, perm_dst.get() }, { ACL_DST, dst } };
+        _dst_permute_func->run(pack);
+    }
+
     if(_run_activation)
     {
-        ITensor    *io = tensors.get_tensor(ACL_DST);
-        ITensorPack pack{ { ACL_SRC, io }, { ACL_DST, io } };
+        ITensorPack pack{ { ACL_SRC, dst }, { ACL_DST, dst } };
         _activation_func->run(pack);
     }
 }
@@ -210,24 +388,25 @@ void CpuGemmDirectConv2d::prepare(ITensorPack &tensors)
 {
     if(!_is_prepared)
     {
+        const ITensor *weights = tensors.get_const_tensor(ACL_SRC_1);
+        const ITensor *biases  = tensors.get_const_tensor(ACL_SRC_2);
+
         // If we are using fixed-format kernel the weights are already reshaped
-        if(_gemm_asm_func && _gemm_asm_func->isVarWeightsKernel())
+        if(_gemm_asm_funcs[0]->isVarWeightsKernel())
         {
-            _gemm_asm_func->prepare(tensors);
+            run_groups(tensors, nullptr, weights, biases, nullptr, false);
             _is_prepared = true;
             return;
         }
-        const ITensor *weights     = tensors.get_const_tensor(ACL_SRC_1);
-        ITensor       *weights_aux = utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
+        ITensor *weights_aux = utils::cast::polymorphic_cast<ITensor *>(tensors.get_tensor(offset_int_vec(PermutedWeights)));
         ARM_COMPUTE_ERROR_ON_NULLPTR(weights, weights_aux);
 
         CpuAuxTensorHandler permuted_weights(_perm_weights, *weights_aux);
         ITensorPack         permute_tensors{ { ACL_SRC, weights }, { ACL_DST, permuted_weights.get() } };
         _weights_permute_func->run(permute_tensors);
 
-        tensors.add_const_tensor(ACL_SRC_1, permuted_weights.get());
         // Call prepare of assembly dispatch
-        _gemm_asm_func->prepare(tensors);
+        run_groups(tensors, nullptr, permuted_weights.get(), biases, nullptr, false);
 
         _is_prepared = true;
     }
@@ -31,6 +31,9 @@
 #include "src/cpu/operators/CpuPermute.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 
+#include <memory>
+#include <vector>
+
 namespace arm_compute
 {
 // Forward declarations
@@ -38,6 +41,12 @@ class ITensor;
 struct Conv2dInfo;
 namespace cpu
 {
+/** Basic function to compute a convolution as an implicit GEMM through the assembly dispatch
+ *
+ * The rows of the GEMM input matrix are generated on the fly from the source tensor, so no im2col buffer is needed.
+ * NCHW tensors are permuted to NHWC around the GEMM. Grouped convolutions run one GEMM per group on views of the
+ * source, weights, biases and destination tensors.
+ */
 class CpuGemmDirectConv2d : public ICpuOperator
 {
 public:
@@ -67,7 +76,8 @@ public:
      *                    Data type supported: Should match @p input data type, except for input of QASYMM8/QASYMM8_SIGNED type where biases should be of S32 type.
      * @param[in] dst     Destination tensor info. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
      *                    Data types supported: Same as @p input.
-     * @param[in] info    Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] info    Contains padding, stride, dilation and number of groups information.
+     *                    With more than one group the weights are a 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM].
      */
     void configure(const ITensorInfo *src, const ITensorInfo *weights, const ITensorInfo *biases, ITensorInfo *dst, const Conv2dInfo &info);
     /** Static function to check if given info will lead to a valid configuration of @ref CpuGemmDirectConv2d
@@ -89,16 +99,42 @@ private:
         AsmGemmWorkspace = 0,
         Pretranspose,
         PermutedWeights,
+        PermutedSrc,
+        PermutedDst,
         Count
     };
 
-    std::unique_ptr<CpuGemmAssemblyDispatch> _gemm_asm_func;
-    std::unique_ptr<CpuActivation>           _activation_func;
-    std::unique_ptr<CpuPermute>              _weights_permute_func;
-    experimental::MemoryRequirements         _aux_mem;
-    TensorInfo                               _perm_weights;
-    bool                                     _run_activation;
-    bool                                     _is_prepared;
+    /** Index of the auxiliary memory holding the pre-transposed weights of a group
+     *
+     * @param[in] group Group index
+     *
+     * @return the index in the memory requirements
+     */
+    static int pretranspose_idx(unsigned int group);
+    /** Run an assembly dispatch function on each group
+     *
+     * @param[in] tensors   Tensor pack holding the auxiliary tensors
+     * @param[in] src       Source tensor in NHWC
+     * @param[in] weights   Permuted weights tensor
+     * @param[in] biases    Biases tensor. Can be nullptr
+     * @param[in] dst       Destination tensor in NHWC. Can be nullptr when only preparing
+     * @param[in] run_func  If true run the functions, otherwise only prepare them
+     */
+    void run_groups(ITensorPack &tensors, const ITensor *src, const ITensor *weights, const ITensor *biases, ITensor *dst, bool run_func);
+
+    std::vector<std::unique_ptr<CpuGemmAssemblyDispatch>> _gemm_asm_funcs;
+    std::unique_ptr<CpuActivation>                        _activation_func;
+    std::unique_ptr<CpuPermute>                           _weights_permute_func;
+    std::unique_ptr<CpuPermute>                           _src_permute_func;
+    std::unique_ptr<CpuPermute>                           _dst_permute_func;
+    experimental::MemoryRequirements                      _aux_mem;
+    TensorInfo                                            _perm_weights;
+    TensorInfo                                            _perm_src;
+    TensorInfo                                            _perm_dst;
+    unsigned int                                          _num_groups;
+    bool                                                  _is_nchw;
+    bool                                                  _run_activation;
+    bool                                                  _is_prepared;
 };
 } // namespace cpu
 } // namespace arm_compute
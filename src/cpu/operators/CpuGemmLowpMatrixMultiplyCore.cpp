@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Arm Limited.
+ * Copyright (c) 2021-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,12 +37,11 @@
 
 #include "src/common/utils/Log.h"
 #include "src/cpu/kernels/CpuConvertQuantizedSignednessKernel.h"
-#include "src/cpu/kernels/CpuGemmInterleave4x4Kernel.h"
-#include "src/cpu/kernels/CpuGemmLowpMatrixMultiplyKernel.h"
+#include "src/cpu/kernels/CpuGemmLowpFusedMatrixMultiplyKernel.h"
+#include "src/cpu/kernels/CpuGemmLowpMatrixBPackKernel.h"
 #include "src/cpu/kernels/CpuGemmLowpMatrixReductionKernel.h"
 #include "src/cpu/kernels/CpuGemmLowpOffsetContributionKernel.h"
 #include "src/cpu/kernels/CpuGemmLowpOffsetContributionOutputStageKernel.h"
-#include "src/cpu/kernels/CpuGemmTranspose1xWKernel.h"
 #include "src/cpu/operators/CpuActivation.h"
 #include "src/cpu/operators/internal/CpuGemmAssemblyDispatch.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
@@ -73,8 +72,7 @@ cpu::AsmGemmInfo init_assembly_metadata(const GEMMInfo &info)
 CpuGemmLowpMatrixMultiplyCore::CpuGemmLowpMatrixMultiplyCore()
     : _asm_glue(std::make_unique<CpuGemmAssemblyDispatch>()),
       _mm_kernel(),
-      _mtx_a_reshape_kernel(),
-      _mtx_b_reshape_kernel(),
+      _mtx_b_pack_kernel(),
       _mtx_a_reduction_kernel(),
       _mtx_b_reduction_kernel(),
       _offset_contribution_kernel(),
@@ -84,14 +82,13 @@ CpuGemmLowpMatrixMultiplyCore::CpuGemmLowpMatrixMultiplyCore()
       _convert_from_signed_asymm(),
       _vector_sum_col(),
       _vector_sum_row(),
-      _tmp_a(),
-      _tmp_b(),
+      _packed_b(),
+      _a_blocks(),
       _mm_result_s32(),
       _signed_a(),
       _signed_output(),
       _a_offset(0),
       _b_offset(0),
-      _run_vector_matrix_multiplication(false),
       _assembly_path(false),
       _fused_assembly_path(false),
       _reshape_b_only_on_first_run(false),
@@ -111,19 +108,18 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
     ARM_COMPUTE_ERROR_THROW_ON(CpuGemmLowpMatrixMultiplyCore::validate(a, b, c, dst, gemm_info));
     ARM_COMPUTE_LOG_PARAMS(a, b, c, dst, gemm_info);
 
-    const ITensorInfo *matrix_a = a;
-    const ITensorInfo *matrix_b = b;
-    GEMMInfo           info     = gemm_info;
+    GEMMInfo info = gemm_info;
 
     // Set internal variables
-    _a_offset                         = a->quantization_info().uniform().offset;
-    _b_offset                         = b->quantization_info().uniform().offset;
-    _run_vector_matrix_multiplication = a->dimension(1) < 2;
-    _reshape_b_only_on_first_run      = b->are_values_constant();
-    _is_prepared                      = false;
-    _fused_assembly_path              = false;
-    _flip_signedness                  = is_data_type_quantized_per_channel(b->data_type()) && (a->data_type() == DataType::QASYMM8) && _reshape_b_only_on_first_run;
-    _gemm_info                        = gemm_info;
+    _a_offset                    = a->quantization_info().uniform().offset;
+    _b_offset                    = b->quantization_info().uniform().offset;
+    _reshape_b_only_on_first_run = b->are_values_constant();
+    _is_prepared                 = false;
+    _assembly_path               = false;
+    _fused_assembly_path         = false;
+    _fuse_output_stage           = false;
+    _flip_signedness             = is_data_type_quantized_per_channel(b->data_type()) && (a->data_type() == DataType::QASYMM8) && _reshape_b_only_on_first_run;
+    _gemm_info                   = gemm_info;
 
     _asm_glue = std::make_unique<cpu::CpuGemmAssemblyDispatch>();
 
@@ -151,9 +147,6 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
         output_stage_corr.gemmlowp_min_bound -= offset_correction;
         output_stage_corr.gemmlowp_max_bound -= offset_correction;
         info.set_gemmlowp_output_stage(output_stage_corr);
-
-        // Update matrix a
-        matrix_a = &_signed_a;
     }
 
     // If GEMMLowpOutputStage != NONE, fuse the offset contribution with the output stage
@@ -197,26 +190,26 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
         }
     }
 #endif /* __aarch64__ */
-    if(!(_assembly_path || _run_vector_matrix_multiplication))
+    if(!_assembly_path)
     {
-        matrix_a = &_tmp_a;
-        matrix_b = &_tmp_b;
-
-        // The interleaved output matrix will have the following shape: [ a_height * 4, ceil(a_width / 4.0f) ]
-        _tmp_a = TensorInfo(compute_interleaved_shape(*a_to_use), 1, a_to_use->data_type(), a_to_use->quantization_info());
-        // The transpose1xW output matrix will have the following shape: [ b_height * 16, ceil(b_width / 16.0f) ]
-        _tmp_b = TensorInfo(compute_transpose1xW_shape(*b), 1, b->data_type(), b->quantization_info());
-
-        // Configure interleave kernel
-        _mtx_a_reshape_kernel = std::make_unique<kernels::CpuGemmInterleave4x4Kernel>();
-        _mtx_a_reshape_kernel->configure(a_to_use, &_tmp_a);
-
-        // Configure transpose kernel
-        _mtx_b_reshape_kernel = std::make_unique<kernels::CpuGemmTranspose1xWKernel>();
-        _mtx_b_reshape_kernel->configure(b, &_tmp_b);
+        // The fused kernel handles mixed signedness and the output stage itself: use the original inputs
+        _flip_signedness   = false;
+        _fuse_output_stage = false;
+        _a_offset          = a->quantization_info().uniform().offset;
+        _signed_a          = TensorInfo();
+        _signed_output     = TensorInfo();
+        _mm_result_s32     = TensorInfo();
+        _convert_to_signed_asymm.reset();
+
+        // Configure packing kernel. Column sums of Matrix B are computed while packing
+        _mtx_b_pack_kernel = std::make_unique<kernels::CpuGemmLowpMatrixBPackKernel>();
+        _mtx_b_pack_kernel->configure(b, &_packed_b, &_vector_sum_col);
+
+        // Configure matrix multiply kernel with offset contribution and output stage
+        _mm_kernel = std::make_unique<kernels::CpuGemmLowpFusedMatrixMultiplyKernel>();
+        _mm_kernel->configure(a, b, c, dst, &_a_blocks, _a_offset, _b_offset, gemm_info.gemmlowp_output_stage());
     }
-
-    if(!_fused_assembly_path)
+    else if(!_fused_assembly_path)
     {
         // Build reduction info
         const GEMMLowpReductionKernelInfo reduction_info(a_to_use->dimension(0), false, 0, false);
@@ -243,13 +236,6 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
 
         if(_fuse_output_stage)
         {
-            // Configure matrix multiply kernel
-            if(!_assembly_path)
-            {
-                _mm_kernel = std::make_unique<kernels::CpuGemmLowpMatrixMultiplyKernel>();
-                _mm_kernel->configure(matrix_a, matrix_b, &_mm_result_s32);
-            }
-
             _offset_contribution_output_stage_kernel = std::make_unique<kernels::CpuGemmLowpOffsetContributionOutputStageKernel>();
             _offset_contribution_output_stage_kernel->configure(&_mm_result_s32,
                                                                 _a_offset == 0 ? nullptr : &_vector_sum_col,
@@ -266,18 +252,13 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
         }
         else
         {
-            // Configure matrix multiply kernel
-            if(!_assembly_path)
-            {
-                _mm_kernel = std::make_unique<kernels::CpuGemmLowpMatrixMultiplyKernel>();
-                _mm_kernel->configure(matrix_a, matrix_b, dst);
-            }
             // Configure offset contribution kernel
             _offset_contribution_kernel = std::make_unique<kernels::CpuGemmLowpOffsetContributionKernel>();
             _offset_contribution_kernel->configure(dst, _a_offset == 0 ? nullptr : &_vector_sum_col, _b_offset == 0 ? nullptr : &_vector_sum_row, a_to_use->dimension(0),
                                                    _a_offset, _b_offset);
         }
     }
+
     // Configure activation
     const ActivationLayerInfo &activation = gemm_info.activation_info();
     _run_activation                       = activation.enabled() && (!_assembly_path || !cpu::CpuGemmAssemblyDispatch::is_activation_supported(activation));
@@ -294,16 +275,16 @@ void CpuGemmLowpMatrixMultiplyCore::configure(const ITensorInfo *a, const ITenso
         _aux_mem[Pretranspose]     = asm_mem_req[Pretranspose];
     }
 
-    // Request memory for LHS and RHS reshape matrix
-    _aux_mem[VectorSumCol] = MemoryInfo(offset_int_vec(VectorSumCol), !_fused_assembly_path && _a_offset != 0
+    // Request memory for the packed RHS matrix and the reductions
+    _aux_mem[VectorSumCol] = MemoryInfo(offset_int_vec(VectorSumCol), !_fused_assembly_path && (_a_offset != 0 || !_assembly_path)
                                         && _reshape_b_only_on_first_run ?
                                         MemoryLifetime::Persistent :
                                         MemoryLifetime::Temporary,
                                         _vector_sum_col.total_size());
     _aux_mem[VectorSumRow] = MemoryInfo(offset_int_vec(VectorSumRow), MemoryLifetime::Temporary, _vector_sum_row.total_size());
-    _aux_mem[TmpA]         = MemoryInfo(offset_int_vec(TmpA), MemoryLifetime::Temporary, _tmp_a.total_size());
-    _aux_mem[TmpB]         = MemoryInfo(offset_int_vec(TmpB), _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary, _tmp_b.total_size());
+    _aux_mem[PackedB]      = MemoryInfo(offset_int_vec(PackedB), _reshape_b_only_on_first_run ? MemoryLifetime::Persistent : MemoryLifetime::Temporary, _packed_b.total_size());
     _aux_mem[MMResultS32]  = MemoryInfo(offset_int_vec(MMResultS32), MemoryLifetime::Temporary, _mm_result_s32.total_size());
+    _aux_mem[ABlocks]      = MemoryInfo(offset_int_vec(ABlocks), MemoryLifetime::Temporary, _a_blocks.total_size());
     _aux_mem[SignedA]      = MemoryInfo(offset_int_vec(SignedA), MemoryLifetime::Temporary, _signed_a.total_size());
     _aux_mem[SignedOutput] = MemoryInfo(offset_int_vec(SignedOutput), MemoryLifetime::Temporary, _signed_output.total_size());
 }
@@ -319,14 +300,9 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITens
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_a_reshaped(), "Matrix A already reshaped is not supported");
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(gemm_info.is_b_reshaped(), "Matrix B already reshaped is not supported");
 
-    GEMMInfo           info          = gemm_info;
-    const ITensorInfo *matrix_a_info = a;
-    const ITensorInfo *matrix_b_info = b;
-
+    GEMMInfo           info     = gemm_info;
     const ITensorInfo *a_to_use = a;
 
-    TensorInfo tmp_a_info{};
-    TensorInfo tmp_b_info{};
     TensorInfo mm_result_s32_info{};
 
     int32_t a_offset = a->quantization_info().uniform().offset;
@@ -362,9 +338,6 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITens
         output_stage_corr.gemmlowp_min_bound -= offset_correction;
         output_stage_corr.gemmlowp_max_bound -= offset_correction;
         info.set_gemmlowp_output_stage(output_stage_corr);
-
-        // Update matrix a
-        matrix_a_info = &signed_a;
     }
 
     // Initialize assembly kernel meta-data
@@ -412,32 +385,17 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITens
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.reinterpret_input_as_3d(), "NEGEMM cannot reinterpret the input tensor as 3D");
         ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.depth_output_gemm3d() != 0, "NEGEMM cannot reinterpret the output tensor as 3D");
 
-        const bool run_vector_matrix_multiplication = a->dimension(1) < 2;
-        if(!run_vector_matrix_multiplication)
-        {
-            matrix_a_info = &tmp_a_info;
-            matrix_b_info = &tmp_b_info;
-
-            // The interleaved output matrix will have the following shape: [ a_height * 4, ceil(a_width / 4.0f) ]
-            TensorShape shape_tmp_a = a->tensor_shape();
-            shape_tmp_a.set(0, a->dimension(0) * 4);
-            shape_tmp_a.set(1, std::ceil(a->dimension(1) / 4.f));
-
-            // The transpose1xW output matrix will have the following shape: [ b_height * 16, ceil(b_width / 16.0f) ]
-            TensorShape shape_tmp_b = b->tensor_shape();
-            shape_tmp_b.set(0, b->dimension(1) * 16);
-            shape_tmp_b.set(1, std::ceil(b->dimension(0) / 16.f));
+        // The fused kernel works on the original inputs and output stage
+        a_offset = a->quantization_info().uniform().offset;
 
-            // Validate interleave kernel
-            auto_init_if_empty(tmp_a_info, a_to_use->clone()->set_tensor_shape(shape_tmp_a));
-            auto_init_if_empty(tmp_b_info, b->clone()->set_tensor_shape(shape_tmp_b));
-
-            ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmInterleave4x4Kernel::validate(a_to_use, &tmp_a_info));
-            ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmTranspose1xWKernel::validate(b, &tmp_b_info));
-        }
+        TensorInfo packed_b_info{};
+        TensorInfo info_vector_sum_col{};
+        TensorInfo a_blocks_info{};
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpMatrixBPackKernel::validate(b, &packed_b_info, &info_vector_sum_col));
+        ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpFusedMatrixMultiplyKernel::validate(a, b, c, output, &a_blocks_info, a_offset, b_offset, gemm_info.gemmlowp_output_stage()));
     }
 
-    if(!run_optimised_requantized)
+    if(run_optimised && !run_optimised_requantized)
     {
         TensorInfo info_vector_sum_col{};
         TensorInfo info_vector_sum_row{};
@@ -464,14 +422,6 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITens
 
         if(fuse_output_stage)
         {
-            if(!run_optimised)
-            {
-                ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.reinterpret_input_as_3d(), "CpuGemmLowpMatrixMultiplyKernel cannot reinterpret the input tensor as 3D");
-                ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.depth_output_gemm3d() != 0, "CpuGemmLowpMatrixMultiplyKernel cannot reinterpret the output tensor as 3D");
-
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpMatrixMultiplyKernel::validate(matrix_a_info, matrix_b_info, &mm_result_s32_info));
-            }
-
             // Validate offset contribution kernel
             ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpOffsetContributionOutputStageKernel::validate(&mm_result_s32_info,
                                                                                                           a_offset == 0 ? nullptr : &info_vector_sum_col,
@@ -483,13 +433,6 @@ Status CpuGemmLowpMatrixMultiplyCore::validate(const ITensorInfo *a, const ITens
         }
         else
         {
-            if(!run_optimised)
-            {
-                ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.reinterpret_input_as_3d(), "CpuGemmLowpMatrixMultiplyKernel cannot reinterpret the input tensor as 3D");
-                ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.depth_output_gemm3d() != 0, "CpuGemmLowpMatrixMultiplyKernel cannot reinterpret the output tensor as 3D");
-
-                ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpMatrixMultiplyKernel::validate(matrix_a_info, matrix_b_info, output));
-            }
             // Validate offset contribution kernel
             ARM_COMPUTE_RETURN_ON_ERROR(kernels::CpuGemmLowpOffsetContributionKernel::validate(output,
                                                                                                a_offset == 0 ? nullptr : &info_vector_sum_col,
@@ -517,14 +460,12 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
     auto c        = tensors.get_const_tensor(TensorType::ACL_SRC_2);
     auto dst      = tensors.get_tensor(TensorType::ACL_DST);
     auto a_to_use = a;
-    auto matrix_a = a;
-    auto matrix_b = b;
 
     CpuAuxTensorHandler vector_sum_col(offset_int_vec(VectorSumCol), _vector_sum_col, tensors, false);
     CpuAuxTensorHandler vector_sum_row(offset_int_vec(VectorSumRow), _vector_sum_row, tensors, false);
-    CpuAuxTensorHandler tmp_a(offset_int_vec(TmpA), _tmp_a, tensors, false);
-    CpuAuxTensorHandler tmp_b(offset_int_vec(TmpB), _tmp_b, tensors, true);
+    CpuAuxTensorHandler packed_b(offset_int_vec(PackedB), _packed_b, tensors, true);
     CpuAuxTensorHandler mm_result_s32(offset_int_vec(MMResultS32), _mm_result_s32, tensors, false);
+    CpuAuxTensorHandler a_blocks(offset_int_vec(ABlocks), _a_blocks, tensors, false);
     CpuAuxTensorHandler signed_a(offset_int_vec(SignedA), _signed_a, tensors, false);
     CpuAuxTensorHandler signed_output(offset_int_vec(SignedOutput), _signed_output, tensors, false);
 
@@ -538,7 +479,6 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
         };
         NEScheduler::get().schedule_op(_convert_to_signed_asymm.get(), Window::DimY, _convert_to_signed_asymm->window(), pack);
         a_to_use = signed_a.get();
-        matrix_a = signed_a.get();
     }
 
     // Run GEMM
@@ -563,46 +503,30 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
     }
     else
     {
-        if(!_run_vector_matrix_multiplication)
+        if(!_reshape_b_only_on_first_run)
         {
-            matrix_a = tmp_a.get();
-            matrix_b = tmp_b.get();
-            // Run interleave kernel
-            ITensorPack pack_a =
+            // Run packing kernel
+            ITensorPack pack_b =
             {
-                { TensorType::ACL_SRC, a_to_use },
-                { TensorType::ACL_DST, tmp_a.get() }
+                { TensorType::ACL_SRC, b },
+                { TensorType::ACL_DST_0, packed_b.get() },
+                { TensorType::ACL_DST_1, vector_sum_col.get() }
             };
-            NEScheduler::get().schedule_op(_mtx_a_reshape_kernel.get(), Window::DimY, _mtx_a_reshape_kernel->window(), pack_a);
-
-            if(!_reshape_b_only_on_first_run)
-            {
-                ITensorPack pack_b =
-                {
-                    { TensorType::ACL_SRC, b },
-                    { TensorType::ACL_DST, tmp_b.get() }
-                };
-                // Run transpose kernel
-                NEScheduler::get().schedule_op(_mtx_b_reshape_kernel.get(), Window::DimY, _mtx_b_reshape_kernel->window(), pack_b);
-            }
+            NEScheduler::get().schedule_op(_mtx_b_pack_kernel.get(), Window::DimX, _mtx_b_pack_kernel->window(), pack_b);
         }
-        ITensorPack pack_mm =
-        {
-            { TensorType::ACL_SRC_0, matrix_a },
-            { TensorType::ACL_SRC_1, matrix_b }
-        };
-        if(_fuse_output_stage)
-        {
-            pack_mm.add_tensor(TensorType::ACL_DST, mm_result_s32.get());
-        }
-        else
-        {
-            pack_mm.add_tensor(TensorType::ACL_DST, dst);
-        }
-        NEScheduler::get().schedule_op(_mm_kernel.get(), Window::DimY, _mm_kernel->window(), pack_mm);
+
+        // Run matrix multiply kernel with offset contribution and output stage
+        ITensorPack pack_mm;
+        pack_mm.add_const_tensor(TensorType::ACL_SRC_0, a);
+        pack_mm.add_const_tensor(TensorType::ACL_SRC_1, packed_b.get());
+        pack_mm.add_const_tensor(TensorType::ACL_SRC_2, vector_sum_col.get());
+        pack_mm.add_const_tensor(TensorType::ACL_SRC_3, c);
+        pack_mm.add_tensor(TensorType::ACL_DST, dst);
+        pack_mm.add_tensor(TensorType::ACL_INT_0, a_blocks.get());
+        NEScheduler::get().schedule_op(_mm_kernel.get(), _mm_kernel->split_dimension(), _mm_kernel->window(), pack_mm);
     }
 
-    if(!_fused_assembly_path)
+    if(_assembly_path && !_fused_assembly_path)
     {
         // Run matrix A reduction kernel only if _b_offset is not equal to 0
         if(_b_offset != 0)
@@ -651,7 +575,7 @@ void CpuGemmLowpMatrixMultiplyCore::run(ITensorPack &tensors)
     }
 
     // Convert QASYMM8_SIGNED->QASYMM8
-    if(!_fused_assembly_path && _fuse_output_stage && _flip_signedness)
+    if(_assembly_path && !_fused_assembly_path && _fuse_output_stage && _flip_signedness)
     {
         ITensorPack pack =
         {
@@ -683,22 +607,25 @@ void CpuGemmLowpMatrixMultiplyCore::prepare(ITensorPack &tensors)
         {
             _asm_glue->prepare(tensors);
         }
-        // Run non-assembly reshape
-        else if(_reshape_b_only_on_first_run && !_run_vector_matrix_multiplication && !_asm_glue->is_configured())
+        // Run non-assembly packing
+        else if(_reshape_b_only_on_first_run)
         {
-            // Run reshape kernel and mark original weights tensor as unused
-            ITensor            *tmp_b_p = utils::cast::polymorphic_downcast<ITensor *>(tensors.get_tensor(offset_int_vec(TmpB)));
-            CpuAuxTensorHandler tmp_b(_tmp_b, *tmp_b_p);
+            // Run packing kernel and mark original weights tensor as unused
+            ITensor            *packed_b_p       = utils::cast::polymorphic_downcast<ITensor *>(tensors.get_tensor(offset_int_vec(PackedB)));
+            ITensor            *vector_sum_col_p = utils::cast::polymorphic_downcast<ITensor *>(tensors.get_tensor(offset_int_vec(VectorSumCol)));
+            CpuAuxTensorHandler packed_b(_packed_b, *packed_b_p);
+            CpuAuxTensorHandler vector_sum_col(_vector_sum_col, *vector_sum_col_p);
             ITensorPack         pack =
             {
                 { TensorType::ACL_SRC, original_b },
-                { TensorType::ACL_DST, tmp_b.get() }
+                { TensorType::ACL_DST_0, packed_b.get() },
+                { TensorType::ACL_DST_1, vector_sum_col.get() }
             };
-            NEScheduler::get().schedule_op(_mtx_b_reshape_kernel.get(), Window::DimY, _mtx_b_reshape_kernel->window(), pack);
+            NEScheduler::get().schedule_op(_mtx_b_pack_kernel.get(), Window::DimX, _mtx_b_pack_kernel->window(), pack);
         }
 
         // Run matrix B reduction kernel only if _a_offset is not equal to 0
-        if(!_fused_assembly_path && _a_offset != 0 && _reshape_b_only_on_first_run)
+        if(_assembly_path && !_fused_assembly_path && _a_offset != 0 && _reshape_b_only_on_first_run)
         {
             ITensor            *vector_sum_col_p = utils::cast::polymorphic_downcast<ITensor *>(tensors.get_tensor(offset_int_vec(VectorSumCol)));
             CpuAuxTensorHandler vector_sum_col(_vector_sum_col, *vector_sum_col_p);
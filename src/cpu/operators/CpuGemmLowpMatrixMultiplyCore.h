@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -36,29 +36,28 @@ namespace cpu
 {
 namespace kernels
 {
-class CpuGemmInterleave4x4Kernel;
-class CpuGemmLowpMatrixMultiplyKernel;
+class CpuGemmLowpFusedMatrixMultiplyKernel;
+class CpuGemmLowpMatrixBPackKernel;
 class CpuGemmLowpOffsetContributionKernel;
 class CpuGemmLowpOffsetContributionOutputStageKernel;
 class CpuGemmLowpMatrixAReductionKernel;
 class CpuGemmLowpMatrixBReductionKernel;
-class CpuGemmTranspose1xWKernel;
 class CpuConvertQuantizedSignednessKernel;
 } // namespace kernels
 class CpuGemmAssemblyDispatch;
 class CpuActivation;
 
-/** Basic function to execute GEMMLowpMatrixMultiplyCore. This function calls the following kernels if the DOT product instruction is not available:
+/** Basic function to execute GEMMLowpMatrixMultiplyCore. This function calls the following kernels if the assembly kernels cannot handle the configuration:
  *
- *  -# @ref kernels::CpuGemmInterleave4x4Kernel
- *  -# @ref kernels::CpuGemmTranspose1xWKernel
- *  -# @ref kernels::CpuGemmLowpMatrixMultiplyKernel
- *  -# @ref kernels::CpuGemmLowpOffsetContributionKernel
+ *  -# @ref kernels::CpuGemmLowpMatrixBPackKernel
+ *  -# @ref kernels::CpuGemmLowpFusedMatrixMultiplyKernel
  *  -# @ref CpuActivation
  *
- * otherwise if the DOT product instruction is available:
+ * otherwise if the assembly kernels do not perform the output stage:
  *
- *  -# @ref kernels::CpuGemmLowpOffsetContributionKernel
+ *  -# @ref kernels::CpuGemmLowpMatrixAReductionKernel
+ *  -# @ref kernels::CpuGemmLowpMatrixBReductionKernel
+ *  -# @ref kernels::CpuGemmLowpOffsetContributionKernel or @ref kernels::CpuGemmLowpOffsetContributionOutputStageKernel
  *
 */
 class CpuGemmLowpMatrixMultiplyCore : public ICpuOperator
@@ -128,18 +127,17 @@ private:
         Pretranspose,
         VectorSumCol,
         VectorSumRow,
-        TmpA,
-        TmpB,
+        PackedB,
         MMResultS32,
         SignedA,
         SignedOutput,
+        ABlocks,
         Count
     };
 
     std::unique_ptr<CpuGemmAssemblyDispatch>                                 _asm_glue;
-    std::unique_ptr<kernels::CpuGemmLowpMatrixMultiplyKernel>                _mm_kernel;
-    std::unique_ptr<kernels::CpuGemmInterleave4x4Kernel>                     _mtx_a_reshape_kernel;
-    std::unique_ptr<kernels::CpuGemmTranspose1xWKernel>                      _mtx_b_reshape_kernel;
+    std::unique_ptr<kernels::CpuGemmLowpFusedMatrixMultiplyKernel>           _mm_kernel;
+    std::unique_ptr<kernels::CpuGemmLowpMatrixBPackKernel>                   _mtx_b_pack_kernel;
     std::unique_ptr<kernels::CpuGemmLowpMatrixAReductionKernel>              _mtx_a_reduction_kernel;
     std::unique_ptr<kernels::CpuGemmLowpMatrixBReductionKernel>              _mtx_b_reduction_kernel;
     std::unique_ptr<kernels::CpuGemmLowpOffsetContributionKernel>            _offset_contribution_kernel;
@@ -150,15 +148,14 @@ private:
 
     TensorInfo _vector_sum_col;
     TensorInfo _vector_sum_row;
-    TensorInfo _tmp_a;
-    TensorInfo _tmp_b;
+    TensorInfo _packed_b;
+    TensorInfo _a_blocks;
     TensorInfo _mm_result_s32;
     TensorInfo _signed_a;
     TensorInfo _signed_output;
     int32_t    _a_offset;
     int32_t    _b_offset;
 
-    bool                             _run_vector_matrix_multiplication;
     bool                             _assembly_path;
     bool                             _fused_assembly_path;
     bool                             _reshape_b_only_on_first_run;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,11 +30,14 @@
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEMatMul.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
 #include "src/core/helpers/AutoConfiguration.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/utils/quantization/AsymmHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
 using namespace arm_compute::experimental;
@@ -267,5 +270,32 @@ experimental::MemoryRequirements CpuMatMul::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_matmul(const AclTensorDescriptor &lhs, const AclTensorDescriptor &rhs, const AclTensorDescriptor &dst,
+                                                              const AclMatMulDescriptor &info, bool is_validate)
+{
+    TensorInfo lhs_info = detail::convert_to_legacy_tensor_info(lhs);
+    TensorInfo rhs_info = detail::convert_to_legacy_tensor_info(rhs);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+
+    // Both operands are provided at run time
+    lhs_info.set_are_values_constant(false);
+    rhs_info.set_are_values_constant(false);
+    const MatMulInfo        mm_info  = MatMulInfo().adj_lhs(info.adj_lhs).adj_rhs(info.adj_rhs).fused_activation(detail::convert_to_activation_info(info.act));
+    const CpuMatMulSettings settings = CpuMatMulSettings().fast_math(_caps.enable_fast_math);
+
+    if(!bool(CpuMatMul::validate(&lhs_info, &rhs_info, &dst_info, mm_info, settings)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto mm_op = std::make_unique<CpuMatMul>();
+    mm_op->configure(&lhs_info, &rhs_info, &dst_info, mm_info, settings);
+    return detail::wrap_operator(this, std::move(mm_op));
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023 Arm Limited.
+ * Copyright (c) 2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,10 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuPool2dKernel.h"
 #include "src/cpu/kernels/internal/CpuPool2dAssemblyWrapperKernel.h"
 
@@ -130,5 +133,29 @@ experimental::MemoryRequirements CpuPool2d::workspace() const
 {
     return _aux_mem;
 }
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_pool2d(const AclTensorDescriptor &src, const AclTensorDescriptor &dst, const AclPool2dDescriptor &info, bool is_validate)
+{
+    TensorInfo       src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo       dst_info = detail::convert_to_legacy_tensor_info(dst);
+    PoolingLayerInfo pool_info{};
+    if(detail::convert_to_pooling_info(info, src_info.data_layout(), pool_info) != StatusCode::Success)
+    {
+        return std::make_tuple(nullptr, StatusCode::InvalidArgument);
+    }
+
+    if(!bool(CpuPool2d::validate(&src_info, &dst_info, pool_info)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto pool_op = std::make_unique<CpuPool2d>();
+    pool_op->configure(&src_info, &dst_info, pool_info);
+    return detail::wrap_operator(this, std::move(pool_op));
+}
 } // namespace cpu
 } // namespace arm_compute
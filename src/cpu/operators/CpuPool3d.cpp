@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,32 @@ namespace arm_compute
 {
 namespace cpu
 {
+namespace
+{
+/** Select the dimension along which the pooling window is split between the threads
+ *
+ * The outermost of the batch, depth, height and width dimensions that has enough iterations for all the threads is
+ * preferred, so that every thread works on whole rows. Otherwise the dimension with the most iterations is used.
+ */
+size_t select_split_dimension(const Window &window, unsigned int num_threads)
+{
+    size_t largest_dim = Window::DimY;
+    for(size_t dim = 4; dim >= Window::DimY; --dim)
+    {
+        const size_t num_iterations = window.num_iterations(dim);
+        if(num_iterations >= num_threads)
+        {
+            return dim;
+        }
+        if(num_iterations > window.num_iterations(largest_dim))
+        {
+            largest_dim = dim;
+        }
+    }
+    return largest_dim;
+}
+} // namespace
+
 CpuPool3d::CpuPool3d()
     : _aux_mem(1)
 {
@@ -61,7 +87,8 @@ void CpuPool3d::run(ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(tensors.empty(), "No tensors provided");
 
-    Scheduler::get().schedule_op(_kernel.get(), Window::DimY, _kernel->window(), tensors);
+    const size_t split_dim = select_split_dimension(_kernel->window(), Scheduler::get().num_threads());
+    Scheduler::get().schedule_op(_kernel.get(), split_dim, _kernel->window(), tensors);
 }
 
 experimental::MemoryRequirements CpuPool3d::workspace() const
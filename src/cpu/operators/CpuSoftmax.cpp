@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,9 +28,12 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/common/IOperator.h"
+#include "src/common/utils/LegacySupport.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/MemoryHelpers.h"
 #include "src/core/helpers/SoftmaxHelpers.h"
+#include "src/cpu/CpuContext.h"
 #include "src/cpu/kernels/CpuSoftmaxKernel.h"
 #include "src/cpu/utils/CpuAuxTensorHandler.h"
 
@@ -219,5 +222,33 @@ experimental::MemoryRequirements CpuSoftmaxGeneric<IS_LOG>::workspace() const
 
 template class CpuSoftmaxGeneric<false>;
 template class CpuSoftmaxGeneric<true>;
+
+namespace
+{
+template <bool IS_LOG>
+std::tuple<IOperator *, StatusCode> create_softmax_operator(IContext *ctx, TensorInfo &src_info, TensorInfo &dst_info, const AclSoftmaxDescriptor &info, bool is_validate)
+{
+    if(!bool(CpuSoftmaxGeneric<IS_LOG>::validate(&src_info, &dst_info, info.beta, info.axis)))
+    {
+        return std::make_tuple(nullptr, StatusCode::UnsupportedConfig);
+    }
+    if(is_validate)
+    {
+        return std::make_tuple(nullptr, StatusCode::Success);
+    }
+
+    auto softmax_op = std::make_unique<CpuSoftmaxGeneric<IS_LOG>>();
+    softmax_op->configure(&src_info, &dst_info, info.beta, info.axis);
+    return detail::wrap_operator(ctx, std::move(softmax_op));
+}
+} // namespace
+
+std::tuple<IOperator *, StatusCode> CpuContext::create_softmax(const AclTensorDescriptor &src, const AclTensorDescriptor &dst, const AclSoftmaxDescriptor &info, bool is_validate)
+{
+    TensorInfo src_info = detail::convert_to_legacy_tensor_info(src);
+    TensorInfo dst_info = detail::convert_to_legacy_tensor_info(dst);
+
+    return info.is_log ? create_softmax_operator<true>(this, src_info, dst_info, info, is_validate) : create_softmax_operator<false>(this, src_info, dst_info, info, is_validate);
+}
 } // namespace cpu
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -117,6 +117,10 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
     {
         p.indirect = true;
         p.sections = b->tensor_shape()[2] * b->tensor_shape()[3];
+        if(info.conv3d)
+        {
+            p.sections *= b->tensor_shape()[4];
+        }
     }
     else
     {
@@ -124,8 +128,13 @@ Params extract_parameters(const ITensorInfo *a, const ITensorInfo *b, const ITen
         p.batches = d->tensor_shape().total_size_upper(2) / p.multis;
     }
 
-    // Update M in case of GEMM3D for output
-    if(info.depth_output_gemm3d != 0)
+    // Update M in case of 3D convolution or GEMM3D for output
+    if(info.conv3d)
+    {
+        p.M       = d->tensor_shape().y() * d->tensor_shape().z() * d->tensor_shape()[3];
+        p.batches = d->tensor_shape().total_size_upper(4) / p.multis;
+    }
+    else if(info.depth_output_gemm3d != 0)
     {
         p.M       = d->tensor_shape().y() * d->tensor_shape().z();
         p.batches = d->tensor_shape().total_size_upper(3) / p.multis;
@@ -252,7 +261,18 @@ private:
     std::unique_ptr<const TypeInput *const *, free_delete> _indirect_arg{};
     std::unique_ptr<const TypeInput *, free_delete>        _indirect_buf{};
     std::vector<TypeInput>           _indirect_pad{};
+    const uint8_t                   *_indirect_src{ nullptr };
     arm_gemm::ConvolutionParameters  _cp{};
+    /** Depth parameters of the indirect convolution. 2D convolutions have a single plane */
+    struct DepthParameters
+    {
+        int64_t input_depth{ 1 };
+        int64_t kernel_depth{ 1 };
+        int64_t output_depth{ 1 };
+        int64_t output_stride_d{ 1 };
+        int64_t padding_front{ 0 };
+        int64_t dilation_d{ 1 };
+    } _cp_depth{};
     experimental::MemoryRequirements _aux_mem{ Count };
     bool                             _B_pretranspose_required{ false };
     bool                             _is_b_constant{ true };
@@ -282,46 +302,55 @@ template <typename TypeInput, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeOutput, OutputStage>::prepare_indirect_buffer(ITensorPack &tensors)
 {
     auto             a              = tensors.get_const_tensor(TensorType::ACL_SRC_0);
-    const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer());
+    const TypeInput *A_ptr          = reinterpret_cast<TypeInput *>(a->buffer() + a->info()->offset_first_element_in_bytes());
+    const size_t     batch_idx      = _gemm_info.conv3d ? 4 : 3;
     const int        multis         = 1;
-    const int        batches        = a->info()->tensor_shape().total_size_upper(3);
-    const size_t     stride_A       = a->info()->strides_in_bytes().y() / sizeof(TypeInput);
-    const size_t     batch_stride_A = a->info()->strides_in_bytes()[3] / sizeof(TypeInput);
-    const size_t     multi_stride_A = a->info()->strides_in_bytes()[4] / sizeof(TypeInput);
+    const int        batches        = a->info()->tensor_shape().total_size_upper(batch_idx);
+    const size_t     stride_x_A     = a->info()->strides_in_bytes()[1] / sizeof(TypeInput);
+    const size_t     stride_y_A     = a->info()->strides_in_bytes()[2] / sizeof(TypeInput);
+    const size_t     stride_z_A     = _gemm_info.conv3d ? a->info()->strides_in_bytes()[3] / sizeof(TypeInput) : 0;
+    const size_t     batch_stride_A = a->info()->strides_in_bytes()[batch_idx] / sizeof(TypeInput);
+    const size_t     multi_stride_A = a->info()->strides_in_bytes()[batch_idx + 1] / sizeof(TypeInput);
 
     const size_t output_hw    = _cp.output_height * _cp.output_width;
-    const int    batch_size   = _cp.kernel_height * _cp.kernel_width * output_hw * sizeof(TypeInput);
-    const size_t batch_stride = batch_size / sizeof(TypeInput);
-    const int    multi_size   = batch_size * batches;
-    const size_t multi_stride = multi_size / sizeof(TypeInput);
+    const size_t output_size  = output_hw * _cp_depth.output_depth;
+    const size_t kernel_size  = _cp.kernel_height * _cp.kernel_width * _cp_depth.kernel_depth;
+    const size_t batch_stride = kernel_size * output_size;
+    const size_t multi_stride = batch_stride * batches;
 
     for(int64_t m = 0; m < multis; m++)
     {
         for(int64_t b = 0; b < batches; b++)
         {
-            for(int64_t output_y = 0; output_y < _cp.output_height; output_y++)
+            for(int64_t output_z = 0; output_z < _cp_depth.output_depth; output_z++)
             {
-                for(int64_t output_x = 0; output_x < _cp.output_width; output_x++)
+                for(int64_t output_y = 0; output_y < _cp.output_height; output_y++)
                 {
-                    int64_t output_xy = (output_y * _cp.output_width) + output_x;
-
-                    for(int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
+                    for(int64_t output_x = 0; output_x < _cp.output_width; output_x++)
                     {
-                        for(int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
-                        {
-                            int64_t input_x   = (output_x * _cp.output_stride_w) + kernel_x - _cp.padding_left;
-                            int64_t input_y   = (output_y * _cp.output_stride_h) + kernel_y - _cp.padding_top;
-                            int64_t kernel_xy = (kernel_y * _cp.kernel_width) + kernel_x;
-                            int64_t input_xy  = (input_y * _cp.input_width) + input_x;
+                        const int64_t output_xyz = (output_z * output_hw) + (output_y * _cp.output_width) + output_x;
 
-                            if(input_x < 0 || input_x >= _cp.input_width || input_y < 0 || input_y >= _cp.input_height)
-                            {
-                                _indirect_buf.get()[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] = _indirect_pad.data();
-                            }
-                            else
+                        for(int64_t kernel_z = 0; kernel_z < _cp_depth.kernel_depth; kernel_z++)
+                        {
+                            for(int64_t kernel_y = 0; kernel_y < _cp.kernel_height; kernel_y++)
                             {
-                                _indirect_buf.get()[m * multi_stride + b * batch_stride + kernel_xy * output_hw + output_xy] =
-                                    A_ptr + (m * multi_stride_A + b * batch_stride_A + input_xy * stride_A);
+                                for(int64_t kernel_x = 0; kernel_x < _cp.kernel_width; kernel_x++)
+                                {
+                                    const int64_t input_x    = (output_x * _cp.output_stride_w) + (kernel_x * _cp.dilation_w) - _cp.padding_left;
+                                    const int64_t input_y    = (output_y * _cp.output_stride_h) + (kernel_y * _cp.dilation_h) - _cp.padding_top;
+                                    const int64_t input_z    = (output_z * _cp_depth.output_stride_d) + (kernel_z * _cp_depth.dilation_d) - _cp_depth.padding_front;
+                                    const int64_t kernel_xyz = (((kernel_z * _cp.kernel_height) + kernel_y) * _cp.kernel_width) + kernel_x;
+
+                                    const TypeInput *&entry = _indirect_buf.get()[m * multi_stride + b * batch_stride + kernel_xyz * output_size + output_xyz];
+                                    if(input_x < 0 || input_x >= _cp.input_width || input_y < 0 || input_y >= _cp.input_height || input_z < 0 || input_z >= _cp_depth.input_depth)
+                                    {
+                                        entry = _indirect_pad.data();
+                                    }
+                                    else
+                                    {
+                                        entry = A_ptr + (m * multi_stride_A + b * batch_stride_A + input_z * stride_z_A + input_y * stride_y_A + input_x * stride_x_A);
+                                    }
+                                }
                             }
                         }
                     }
@@ -329,12 +358,14 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare_indirect_buffer(ITens
             }
         }
     }
+    _indirect_src = a->buffer();
 }
 
 template <typename TypeInput, typename TypeOutput, class OutputStage>
 void Fallback<TypeInput, TypeOutput, OutputStage>::configure_indirect(const ITensorInfo *a, const ITensorInfo *b, const ITensorInfo *d, const AsmGemmInfo &info)
 {
     ARM_COMPUTE_ERROR_ON(!(info.method == AsmConvMethod::Conv || info.method == AsmConvMethod::Indirect));
+    ARM_COMPUTE_ERROR_ON_MSG(info.conv3d && info.method != AsmConvMethod::Indirect, "3D convolutions are only supported through the indirect buffer");
 
     float zeropad = 0.f;
     if(is_data_type_quantized(a->data_type()))
@@ -353,6 +384,19 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure_indirect(const ITen
     _cp = { input_width, input_height, input_channels, kernel_width, kernel_height, output_width, output_height,
             info.ps_info.stride().first, info.ps_info.stride().second, info.padding_top, info.padding_left, zeropad
           };
+    _cp.dilation_w = static_cast<int64_t>(info.dilation.x());
+    _cp.dilation_h = static_cast<int64_t>(info.dilation.y());
+
+    _cp_depth = DepthParameters{};
+    if(info.conv3d)
+    {
+        _cp_depth.input_depth     = static_cast<int64_t>(a->tensor_shape()[3]);
+        _cp_depth.kernel_depth    = static_cast<int64_t>(b->tensor_shape()[4]);
+        _cp_depth.output_depth    = static_cast<int64_t>(d->tensor_shape()[3]);
+        _cp_depth.output_stride_d = static_cast<int64_t>(info.stride_depth);
+        _cp_depth.padding_front   = info.padding_front;
+        _cp_depth.dilation_d      = static_cast<int64_t>(info.dilation_depth);
+    }
 
     if(info.method == AsmConvMethod::Conv)
     {
@@ -361,20 +405,21 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure_indirect(const ITen
 
     if(info.method == AsmConvMethod::Indirect)
     {
-        const unsigned int multis    = 1;
-        const unsigned int batches   = a->tensor_shape().total_size_upper(3);
-        const unsigned int kernel_hw = _cp.kernel_width * _cp.kernel_height;
-        const unsigned int output_hw = _cp.output_width * _cp.output_height;
+        const unsigned int multis      = 1;
+        const unsigned int batches     = a->tensor_shape().total_size_upper(info.conv3d ? 4 : 3);
+        const unsigned int kernel_size = _cp.kernel_width * _cp.kernel_height * _cp_depth.kernel_depth;
+        const unsigned int output_size = _cp.output_width * _cp.output_height * _cp_depth.output_depth;
 
         using TypeInputPtr        = TypeInput *;
-        const int    batch_size   = kernel_hw * output_hw * sizeof(TypeInputPtr);
+        const int    batch_size   = kernel_size * output_size * sizeof(TypeInputPtr);
         const size_t batch_stride = batch_size / sizeof(TypeInputPtr);
         const int    multi_size   = batch_size * batches;
         const size_t multi_stride = multi_size / sizeof(TypeInputPtr);
 
         _indirect_buf = std::unique_ptr<const TypeInput *, free_delete>(reinterpret_cast<const TypeInput **>(malloc(multi_size * multis)));
-        _indirect_arg = std::unique_ptr<const TypeInput *const *, free_delete>(reinterpret_cast<const TypeInput *const **>(malloc(sizeof(TypeInput **) * kernel_hw * multis * batches)));
+        _indirect_arg = std::unique_ptr<const TypeInput *const *, free_delete>(reinterpret_cast<const TypeInput *const **>(malloc(sizeof(TypeInput **) * kernel_size * multis * batches)));
         _indirect_pad = std::vector<TypeInput>(_cp.input_channels, TypeInput(zeropad));
+        _indirect_src = nullptr;
 
         // Set indirect argument
         int64_t pos = 0;
@@ -382,9 +427,9 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::configure_indirect(const ITen
         {
             for(int64_t b = 0; b < batches; b++)
             {
-                for(int64_t kernel_xy = 0; kernel_xy < kernel_hw; kernel_xy++)
+                for(int64_t kernel_xyz = 0; kernel_xyz < kernel_size; kernel_xyz++)
                 {
-                    (_indirect_arg.get())[pos++] = _indirect_buf.get() + m * multi_stride + b * batch_stride + kernel_xy * output_hw;
+                    (_indirect_arg.get())[pos++] = _indirect_buf.get() + m * multi_stride + b * batch_stride + kernel_xyz * output_size;
                 }
             }
         }
@@ -481,7 +526,8 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::prepare(ITensorPack &tensors)
             b->mark_as_unused();
         }
 
-        if(_gemm_info.method == AsmConvMethod::Indirect)
+        // The source might not be available yet: the indirect buffer is then filled at the first run
+        if(_gemm_info.method == AsmConvMethod::Indirect && tensors.get_const_tensor(TensorType::ACL_SRC_0) != nullptr)
         {
             prepare_indirect_buffer(tensors);
         }
@@ -516,7 +562,7 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run(ITensorPack &tensors)
 
     const size_t a_batch_idx = _gemm_info.reinterpret_input_as_3d != 0 ? 3 : 2;
     const size_t a_multi_idx = a_batch_idx + 1;
-    const size_t d_batch_idx = _gemm_info.depth_output_gemm3d != 0 ? 3 : 2;
+    const size_t d_batch_idx = _gemm_info.conv3d ? 4 : (_gemm_info.depth_output_gemm3d != 0 ? 3 : 2);
     const size_t d_multi_idx = d_batch_idx + 1;
 
     int       batch_stride_a = a->info()->strides_in_bytes()[a_batch_idx] / a->info()->element_size();
@@ -602,6 +648,11 @@ void Fallback<TypeInput, TypeOutput, OutputStage>::run(ITensorPack &tensors)
 
     if(_gemm_info.method == AsmConvMethod::Indirect)
     {
+        // The indirect buffer points into the source tensor: rebuild it if the source has been moved since the last run
+        if(a->buffer() != _indirect_src)
+        {
+            prepare_indirect_buffer(tensors);
+        }
         in0_ptr        = nullptr;
         lda            = 0;
         batch_stride_a = 0;
@@ -766,6 +817,7 @@ Status CpuGemmAssemblyDispatch::validate(const ITensorInfo *a, const ITensorInfo
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_F16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_CPU_BF16_UNSUPPORTED(a);
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(!(info.reshape_b_only_on_first_run), "Assembly kernel will not be executed when reshape_b_only_on_first_run is false");
+    ARM_COMPUTE_RETURN_ERROR_ON_MSG(info.conv3d && info.method != AsmConvMethod::Indirect, "3D convolutions are only supported through the indirect buffer");
 
 #ifndef __aarch64__
     ARM_COMPUTE_RETURN_ERROR_ON_MSG(a->element_size() == 1, "8bit integer types only supported for aarch64");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023 Arm Limited.
+ * Copyright (c) 2018-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -50,6 +50,11 @@ struct AsmGemmInfo
     bool                      depth_output_gemm3d{ false };
     int64_t                   padding_top{ 0 };
     int64_t                   padding_left{ 0 };
+    Size2D                    dilation{ 1U, 1U };
+    bool                      conv3d{ false };
+    int64_t                   padding_front{ 0 };
+    unsigned int              stride_depth{ 1 };
+    unsigned int              dilation_depth{ 1 };
     float                     padding_value{ 0.f };
     bool                      fast_mode{ false };
     bool                      fixed_format{ false };
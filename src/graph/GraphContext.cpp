@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019 Arm Limited.
+ * Copyright (c) 2018-2019, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,12 +27,76 @@
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
+namespace
+{
+/** Allocator forwarding to a backend allocator and accounting for the bytes it allocates */
+class AccountingAllocator final : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] allocator Backend allocator to forward to
+     */
+    explicit AccountingAllocator(IAllocator &allocator)
+        : _allocator(allocator), _size(0)
+    {
+    }
+    /** Bytes allocated so far
+     *
+     * @return The number of bytes allocated
+     */
+    size_t size() const
+    {
+        return _size;
+    }
+    // Inherited methods overridden
+    void *allocate(size_t size, size_t alignment) override
+    {
+        _size += size;
+        return _allocator.allocate(size, alignment);
+    }
+    void free(void *ptr) override
+    {
+        _allocator.free(ptr);
+    }
+    std::unique_ptr<IMemoryRegion> make_region(size_t size, size_t alignment) override
+    {
+        _size += size;
+        return _allocator.make_region(size, alignment);
+    }
+
+private:
+    IAllocator &_allocator;
+    size_t      _size;
+};
+
+/** Populates a memory manager with pools allocated through an accounting allocator
+ *
+ * @param[in]     mm         Memory manager to populate
+ * @param[in]     allocator  Backend allocator
+ * @param[in]     num_pools  Number of pools to create
+ * @param[in,out] allocators Allocators to keep the accounting allocator alive in, pools use it to duplicate themselves
+ *
+ * @return The bytes allocated for the pools
+ */
+size_t populate_memory_manager(IMemoryManager &mm, IAllocator &allocator, size_t num_pools, std::vector<std::unique_ptr<IAllocator>> &allocators)
+{
+    auto accounting_allocator = std::make_unique<AccountingAllocator>(allocator);
+    mm.populate(*accounting_allocator, num_pools);
+    const size_t size = accounting_allocator->size();
+    allocators.push_back(std::move(accounting_allocator));
+    return size;
+}
+} // namespace
+
 GraphContext::GraphContext()
-    : _config(), _memory_managers(), _weights_managers()
+    : _config(), _memory_managers(), _weights_managers(), _pool_allocators()
 {
 }
 
@@ -101,20 +165,21 @@ std::map<Target, WeightsManagerContext> &GraphContext::weights_managers()
 
 void GraphContext::finalize()
 {
-    const size_t num_pools = 1;
+    const size_t num_pools       = 1;
+    const size_t num_stage_pools = static_cast<size_t>(std::max(_config.pipeline_stages, 1));
     for(auto &mm_obj : _memory_managers)
     {
         ARM_COMPUTE_ERROR_ON(!mm_obj.second.allocator);
 
-        // Finalize intra layer memory manager
+        // Finalize intra layer memory manager, pipeline stages run their functions concurrently
         if(mm_obj.second.intra_mm != nullptr)
         {
-            mm_obj.second.intra_mm->populate(*mm_obj.second.allocator, num_pools);
+            mm_obj.second.intra_pool_size = populate_memory_manager(*mm_obj.second.intra_mm, *mm_obj.second.allocator, num_stage_pools, _pool_allocators);
         }
         // Finalize cross layer memory manager
         if(mm_obj.second.cross_mm != nullptr)
         {
-            mm_obj.second.cross_mm->populate(*mm_obj.second.allocator, num_pools);
+            mm_obj.second.cross_pool_size = populate_memory_manager(*mm_obj.second.cross_mm, *mm_obj.second.allocator, num_pools, _pool_allocators);
         }
     }
 }
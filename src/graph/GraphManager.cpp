@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,11 @@
 
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphPlan.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/MemoryReport.h"
 #include "arm_compute/graph/PassManager.h"
+#include "arm_compute/graph/PipelineExecutor.h"
 #include "arm_compute/graph/TypePrinter.h"
 #include "arm_compute/graph/Utils.h"
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
@@ -35,15 +38,23 @@
 
 #include "src/common/utils/Log.h"
 
+#include <algorithm>
+
 namespace arm_compute
 {
 namespace graph
 {
 GraphManager::GraphManager()
-    : _workloads()
+    : _workloads(), _pipelines(), _memory_reports()
 {
 }
 
+GraphManager::GraphManager(GraphManager &&) = default;
+
+GraphManager &GraphManager::operator=(GraphManager &&) = default;
+
+GraphManager::~GraphManager() = default;
+
 void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &pm, Target target)
 {
     ARM_COMPUTE_LOG_INFO_WITH_FUNCNAME_ACL("Initiate graph configuration!");
@@ -87,25 +98,61 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     // Apply backend mutating passes
     pm.run_type(graph, IGraphMutator::MutationType::Backend);
 
+    // Pin the execution methods of a previous finalization if a compatible plan is available
+    const std::string &plan_file = ctx.config().plan_file;
+    GraphPlan          plan;
+    const bool         use_plan = !plan_file.empty() && plan.load(plan_file) && plan.is_compatible(graph);
+    if(use_plan)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Using graph plan " << plan_file << std::endl);
+        plan.apply_execution_methods(graph);
+    }
+
     // Perform topological sort
-    std::vector<NodeID> topological_sorted_nodes = dfs(graph);
+    std::vector<NodeID> topological_sorted_nodes = ctx.config().use_memory_aware_order ? memory_aware_sort(graph) : dfs(graph);
 
     // Validate all nodes
     detail::validate_all_nodes(graph);
 
-    // Configure all nodes
-    auto workload = detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
+    // Configure all nodes, partitioning them into pipeline stages if requested
+    std::unique_ptr<PipelineExecutor> pipeline = nullptr;
+    if((ctx.config().pipeline_stages > 1 || ctx.config().use_async_accessors) && forced_target == Target::NEON)
+    {
+        pipeline = std::make_unique<PipelineExecutor>(std::max(ctx.config().pipeline_stages, 1), ctx.config().use_async_accessors);
+    }
+    auto workload = (pipeline != nullptr) ? pipeline->configure(graph, ctx, topological_sorted_nodes) : detail::configure_all_nodes(graph, ctx, topological_sorted_nodes);
     ARM_COMPUTE_ERROR_ON_MSG(workload.tasks.empty(), "Could not configure all nodes!");
+    if(pipeline != nullptr && pipeline->num_stages() < 2)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Could not partition the graph into pipeline stages, executing the frames one after the other" << std::endl);
+        pipeline = nullptr;
+    }
 
-    // Allocate const tensors and call accessors
+    // Stages run concurrently: each of them needs a pool of function memory and the transition buffers can't be shared
+    GraphConfig config     = ctx.config();
+    config.pipeline_stages = (pipeline != nullptr) ? static_cast<int>(pipeline->num_compute_stages()) : 1;
+    ctx.set_config(config);
+
+    // Allocate const tensors and call accessors, or fill them from the plan
     detail::allocate_const_tensors(graph);
-    detail::call_all_const_node_accessors(graph);
+    if(use_plan)
+    {
+        plan.fill_const_tensors(graph);
+    }
+    else
+    {
+        detail::call_all_const_node_accessors(graph);
+        if(!plan_file.empty())
+        {
+            GraphPlan::save(graph, plan_file);
+        }
+    }
 
     // Prepare graph
     detail::prepare_all_tasks(workload);
 
     // Setup tensor memory (Allocate all tensors or setup transition manager)
-    if(ctx.config().use_transition_memory_manager)
+    if(ctx.config().use_transition_memory_manager && pipeline == nullptr)
     {
         detail::configure_transition_manager(graph, ctx, workload);
     }
@@ -113,10 +160,26 @@ void GraphManager::finalize_graph(Graph &graph, GraphContext &ctx, PassManager &
     {
         detail::allocate_all_tensors(graph);
     }
+    if(pipeline != nullptr)
+    {
+        pipeline->allocate();
+        _pipelines.insert(std::make_pair(graph.id(), std::move(pipeline)));
+    }
 
     // Finalize Graph context
     ctx.finalize();
 
+    // Report the memory footprint
+    MemoryReport memory_report = create_memory_report(graph, ctx, topological_sorted_nodes);
+    ARM_COMPUTE_LOG_GRAPH_INFO("Memory footprint of graph with ID : " << graph.id() << std::endl
+                               << memory_report);
+    for(const auto &node_report : memory_report.nodes)
+    {
+        ARM_COMPUTE_UNUSED(node_report);
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE(node_report << std::endl);
+    }
+    _memory_reports[graph.id()] = std::move(memory_report);
+
     // Register graph
     _workloads.insert(std::make_pair(graph.id(), std::move(workload)));
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Created workload for graph with ID : " << graph.id() << std::endl);
@@ -130,6 +193,14 @@ void GraphManager::execute_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    // Overlap the frames on the stages of the pipeline
+    auto pipeline = _pipelines.find(graph.id());
+    if(pipeline != std::end(_pipelines))
+    {
+        pipeline->second->execute(it->second);
+        return;
+    }
+
     while(true)
     {
         // Call input accessors
@@ -154,7 +225,22 @@ void GraphManager::invalidate_graph(Graph &graph)
     auto it = _workloads.find(graph.id());
     ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_workloads), "Graph is not registered!");
 
+    _pipelines.erase(graph.id());
+    _memory_reports.erase(graph.id());
     _workloads.erase(it);
 }
+
+PipelineStats GraphManager::pipeline_stats(Graph &graph) const
+{
+    auto it = _pipelines.find(graph.id());
+    return (it != std::end(_pipelines)) ? it->second->stats() : PipelineStats{};
+}
+
+MemoryReport GraphManager::memory_report(Graph &graph) const
+{
+    auto it = _memory_reports.find(graph.id());
+    ARM_COMPUTE_ERROR_ON_MSG(it == std::end(_memory_reports), "Graph is not registered!");
+    return it->second;
+}
 } // namespace graph
-} // namespace arm_compute
\ No newline at end of file
+} // namespace arm_compute
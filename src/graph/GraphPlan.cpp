@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphPlan.h"
+
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/utils/misc/MMappedFile.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "support/Cast.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+constexpr char     plan_magic[8]  = { 'A', 'C', 'L', 'G', 'P', 'L', 'A', 'N' };
+constexpr uint64_t plan_alignment = 64;
+
+/** Plan file header */
+struct PlanHeader
+{
+    char     magic[8];    /**< File magic */
+    uint32_t version;     /**< File format version */
+    uint32_t num_nodes;   /**< Number of node records */
+    uint32_t num_tensors; /**< Number of tensor records */
+    uint32_t reserved;    /**< Reserved for future use */
+    uint64_t graph_hash;  /**< Hash of the graph structure */
+    uint64_t data_offset; /**< Offset of the data section from the start of the file */
+    uint64_t data_size;   /**< Size of the data section */
+};
+
+/** 64-bit FNV-1a hash accumulator */
+class StructureHasher
+{
+public:
+    template <typename T>
+    void add(const T &value)
+    {
+        const auto *bytes = reinterpret_cast<const uint8_t *>(&value);
+        for(size_t i = 0; i < sizeof(T); ++i)
+        {
+            _hash ^= bytes[i];
+            _hash *= 0x100000001b3ULL;
+        }
+    }
+    void add(const std::string &value)
+    {
+        add(value.size());
+        for(const char c : value)
+        {
+            add(c);
+        }
+    }
+    uint64_t value() const
+    {
+        return _hash;
+    }
+
+private:
+    uint64_t _hash{ 0xcbf29ce484222325ULL };
+};
+
+uint64_t align_up(uint64_t value)
+{
+    return ((value + plan_alignment - 1) / plan_alignment) * plan_alignment;
+}
+
+uint64_t contents_size(const Tensor &tensor)
+{
+    return tensor.desc().shape.total_size() * element_size_from_data_type(tensor.desc().data_type);
+}
+
+bool is_planned_const_tensor(const INode &node)
+{
+    return node.type() == NodeType::Const && node.num_outputs() != 0 && node.output(0) != nullptr && !node.output(0)->bound_edges().empty()
+           && node.output(0)->handle() != nullptr;
+}
+
+/** Gets the identifier of the contents of a constant tensor, empty if its accessor can't identify them */
+std::string const_tensor_source(Tensor &tensor)
+{
+    ITensorAccessor *accessor = tensor.accessor();
+    return (accessor != nullptr) ? accessor->source() : std::string("none");
+}
+} // namespace
+
+uint64_t graph_structure_hash(const Graph &g)
+{
+    StructureHasher hasher;
+    for(const auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        hasher.add(node->id());
+        hasher.add(node->type());
+        hasher.add(node->assigned_target());
+        if(node->type() == NodeType::Const && node->output(0) != nullptr)
+        {
+            hasher.add(const_tensor_source(*node->output(0)));
+        }
+        for(const auto &tid : node->inputs())
+        {
+            hasher.add(tid);
+        }
+        for(const auto &tid : node->outputs())
+        {
+            hasher.add(tid);
+        }
+    }
+    for(const auto &tensor : g.tensors())
+    {
+        if(tensor == nullptr)
+        {
+            continue;
+        }
+        const TensorDescriptor &desc = tensor->desc();
+        hasher.add(tensor->id());
+        hasher.add(desc.data_type);
+        hasher.add(desc.layout);
+        for(size_t d = 0; d < desc.shape.num_dimensions(); ++d)
+        {
+            hasher.add(desc.shape[d]);
+        }
+        for(const auto scale : desc.quant_info.scale())
+        {
+            hasher.add(scale);
+        }
+        for(const auto offset : desc.quant_info.offset())
+        {
+            hasher.add(offset);
+        }
+    }
+    return hasher.value();
+}
+
+GraphPlan::GraphPlan()
+    : _file(nullptr), _graph_hash(0), _data(nullptr), _nodes(), _tensors()
+{
+}
+
+GraphPlan::GraphPlan(GraphPlan &&) = default;
+GraphPlan &GraphPlan::operator=(GraphPlan &&) = default;
+GraphPlan::~GraphPlan()                       = default;
+
+bool GraphPlan::extract_node_record(const INode &node, NodeRecord &record)
+{
+    record.id        = node.id();
+    record.type      = static_cast<uint32_t>(node.type());
+    record.method    = 0;
+    record.fast_math = static_cast<uint32_t>(FastMathHint::Disabled);
+
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        {
+            const auto &conv = static_cast<const ConvolutionLayerNode &>(node);
+            record.method    = static_cast<uint32_t>(conv.convolution_method());
+            record.fast_math = static_cast<uint32_t>(conv.fast_math_hint());
+            return true;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        {
+            const auto &conv = static_cast<const FusedConvolutionBatchNormalizationNode &>(node);
+            record.method    = static_cast<uint32_t>(conv.convolution_method());
+            record.fast_math = static_cast<uint32_t>(conv.fast_math_hint());
+            return true;
+        }
+        case NodeType::FusedConvolutionWithPostOp:
+        {
+            const auto &conv = static_cast<const FusedConvolutionWithPostOpNode &>(node);
+            record.method    = static_cast<uint32_t>(conv.convolution_method());
+            record.fast_math = static_cast<uint32_t>(conv.fast_math_hint());
+            return true;
+        }
+        case NodeType::FusedConvolutionBatchNormalizationLayerWithPostOpsLayer:
+        {
+            const auto &conv = static_cast<const FusedConvolutionBatchNormalizationWithPostOpsNode &>(node);
+            record.method    = static_cast<uint32_t>(conv.convolution_method());
+            record.fast_math = static_cast<uint32_t>(conv.fast_math_hint());
+            return true;
+        }
+        case NodeType::DepthwiseConvolutionLayer:
+        {
+            const auto &dwc = static_cast<const DepthwiseConvolutionLayerNode &>(node);
+            record.method   = static_cast<uint32_t>(dwc.depthwise_convolution_method());
+            return true;
+        }
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            const auto &dwc = static_cast<const FusedDepthwiseConvolutionBatchNormalizationNode &>(node);
+            record.method   = static_cast<uint32_t>(dwc.depthwise_convolution_method());
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool GraphPlan::save(Graph &g, const std::string &filename)
+{
+    std::vector<NodeRecord>   node_records;
+    std::vector<TensorRecord> tensor_records;
+    std::vector<Tensor *>     const_tensors;
+
+    uint64_t data_size = 0;
+    for(const auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+
+        NodeRecord node_record{};
+        if(extract_node_record(*node, node_record))
+        {
+            node_records.push_back(node_record);
+        }
+
+        if(is_planned_const_tensor(*node))
+        {
+            Tensor *tensor = node->output(0);
+            if(const_tensor_source(*tensor).empty())
+            {
+                ARM_COMPUTE_LOG_GRAPH_WARNING("Not storing graph plan " << filename << ": the contents of the constant node " << node->name() << " can't be identified" << std::endl);
+                return false;
+            }
+
+            TensorRecord tensor_record{};
+            tensor_record.id     = tensor->id();
+            tensor_record.offset = data_size;
+            tensor_record.size   = contents_size(*tensor);
+            tensor_records.push_back(tensor_record);
+            const_tensors.push_back(tensor);
+            data_size = align_up(data_size + tensor_record.size);
+        }
+    }
+
+    PlanHeader header{};
+    std::memcpy(header.magic, plan_magic, sizeof(plan_magic));
+    header.version     = version;
+    header.num_nodes   = static_cast<uint32_t>(node_records.size());
+    header.num_tensors = static_cast<uint32_t>(tensor_records.size());
+    header.graph_hash  = graph_structure_hash(g);
+    header.data_offset = align_up(sizeof(PlanHeader) + node_records.size() * sizeof(NodeRecord) + tensor_records.size() * sizeof(TensorRecord));
+    header.data_size   = data_size;
+
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!fs.good())
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Could not open graph plan file " << filename << " for writing" << std::endl);
+        return false;
+    }
+
+    fs.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    fs.write(reinterpret_cast<const char *>(node_records.data()), node_records.size() * sizeof(NodeRecord));
+    fs.write(reinterpret_cast<const char *>(tensor_records.data()), tensor_records.size() * sizeof(TensorRecord));
+
+    // Each tensor's contents start on an aligned boundary, the gaps are zero filled
+    std::vector<uint8_t> buffer;
+    uint64_t             written = sizeof(header) + node_records.size() * sizeof(NodeRecord) + tensor_records.size() * sizeof(TensorRecord);
+    for(size_t i = 0; i < const_tensors.size(); ++i)
+    {
+        const uint64_t start = header.data_offset + tensor_records[i].offset;
+        buffer.assign(start - written, 0);
+        fs.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+
+        buffer.resize(tensor_records[i].size);
+        ITensorHandle *handle = const_tensors[i]->handle();
+        handle->map(true);
+        copy_tensor_to_buffer(handle->tensor(), buffer.data());
+        handle->unmap();
+        fs.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+        written = start + tensor_records[i].size;
+    }
+    buffer.assign(header.data_offset + header.data_size - written, 0);
+    fs.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+
+    const bool success = fs.good();
+    ARM_COMPUTE_LOG_GRAPH_INFO("Stored graph plan with " << node_records.size() << " execution methods and " << tensor_records.size() << " constant tensors to " << filename
+                               << std::endl);
+    return success;
+}
+
+bool GraphPlan::load(const std::string &filename)
+{
+#if !defined(_WIN64) && !defined(BARE_METAL)
+    _file.reset();
+    _data = nullptr;
+    _nodes.clear();
+    _tensors.clear();
+
+    // The mapping would create a missing file
+    if(!std::ifstream(filename).good())
+    {
+        return false;
+    }
+
+    auto file = std::make_unique<utils::mmap_io::MMappedFile>(filename, 0, 0);
+    if(!file->is_mapped() || file->map_size() < sizeof(PlanHeader))
+    {
+        return false;
+    }
+
+    const uint8_t *base = file->data();
+    PlanHeader     header{};
+    std::memcpy(&header, base, sizeof(header));
+
+    const uint64_t records_end = sizeof(PlanHeader) + uint64_t(header.num_nodes) * sizeof(NodeRecord) + uint64_t(header.num_tensors) * sizeof(TensorRecord);
+    if(std::memcmp(header.magic, plan_magic, sizeof(plan_magic)) != 0 || header.version != version || header.data_offset < records_end
+       || header.data_offset > file->map_size() || header.data_size > file->map_size() - header.data_offset)
+    {
+        ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring invalid or outdated graph plan file " << filename << std::endl);
+        return false;
+    }
+
+    const uint8_t *records = base + sizeof(PlanHeader);
+    for(uint32_t i = 0; i < header.num_nodes; ++i, records += sizeof(NodeRecord))
+    {
+        NodeRecord record{};
+        std::memcpy(&record, records, sizeof(record));
+        _nodes[record.id] = record;
+    }
+    for(uint32_t i = 0; i < header.num_tensors; ++i, records += sizeof(TensorRecord))
+    {
+        TensorRecord record{};
+        std::memcpy(&record, records, sizeof(record));
+        if(record.offset > header.data_size || record.size > header.data_size - record.offset)
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Ignoring corrupted graph plan file " << filename << std::endl);
+            _nodes.clear();
+            _tensors.clear();
+            return false;
+        }
+        _tensors[record.id] = record;
+    }
+
+    _graph_hash = header.graph_hash;
+    _data       = base + header.data_offset;
+    _file       = std::move(file);
+    return true;
+#else  // !defined(_WIN64) && !defined(BARE_METAL)
+    ARM_COMPUTE_UNUSED(filename);
+    return false;
+#endif // !defined(_WIN64) && !defined(BARE_METAL)
+}
+
+bool GraphPlan::is_loaded() const
+{
+    return _file != nullptr;
+}
+
+bool GraphPlan::is_compatible(const Graph &g) const
+{
+    return is_loaded() && _graph_hash == graph_structure_hash(g);
+}
+
+void GraphPlan::apply_execution_methods(Graph &g) const
+{
+    for(const auto &entry : _nodes)
+    {
+        INode            *node   = g.node(entry.first);
+        const NodeRecord &record = entry.second;
+        if(node == nullptr || static_cast<uint32_t>(node->type()) != record.type)
+        {
+            continue;
+        }
+
+        const auto method    = static_cast<ConvolutionMethod>(record.method);
+        const auto dw_method = static_cast<DepthwiseConvolutionMethod>(record.method);
+        const auto fast_math = static_cast<FastMathHint>(record.fast_math);
+        switch(node->type())
+        {
+            case NodeType::ConvolutionLayer:
+            {
+                auto *conv = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(node);
+                conv->set_convolution_method(method);
+                conv->set_fast_math_hint(fast_math);
+                break;
+            }
+            case NodeType::FusedConvolutionBatchNormalizationLayer:
+            {
+                auto *conv = arm_compute::utils::cast::polymorphic_downcast<FusedConvolutionBatchNormalizationNode *>(node);
+                conv->set_convolution_method(method);
+                conv->set_fast_math_hint(fast_math);
+                break;
+            }
+            case NodeType::FusedConvolutionWithPostOp:
+            {
+                auto *conv = arm_compute::utils::cast::polymorphic_downcast<FusedConvolutionWithPostOpNode *>(node);
+                conv->set_convolution_method(method);
+                conv->set_fast_math_hint(fast_math);
+                break;
+            }
+            case NodeType::FusedConvolutionBatchNormalizationLayerWithPostOpsLayer:
+            {
+                auto *conv = arm_compute::utils::cast::polymorphic_downcast<FusedConvolutionBatchNormalizationWithPostOpsNode *>(node);
+                conv->set_convolution_method(method);
+                conv->set_fast_math_hint(fast_math);
+                break;
+            }
+            case NodeType::DepthwiseConvolutionLayer:
+            {
+                auto *dwc = arm_compute::utils::cast::polymorphic_downcast<DepthwiseConvolutionLayerNode *>(node);
+                dwc->set_depthwise_convolution_method(dw_method);
+                break;
+            }
+            case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            {
+                auto *dwc = arm_compute::utils::cast::polymorphic_downcast<FusedDepthwiseConvolutionBatchNormalizationNode *>(node);
+                dwc->set_depthwise_convolution_method(dw_method);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+}
+
+void GraphPlan::fill_const_tensors(Graph &g) const
+{
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || !is_planned_const_tensor(*node))
+        {
+            continue;
+        }
+
+        Tensor    *tensor = node->output(0);
+        const auto it     = _tensors.find(tensor->id());
+        if(it != _tensors.end() && it->second.size == contents_size(*tensor))
+        {
+            ITensorHandle *handle = tensor->handle();
+            handle->map(true);
+            copy_buffer_to_tensor(_data + it->second.offset, handle->tensor());
+            handle->unmap();
+        }
+        else
+        {
+            tensor->call_accessor();
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/MemoryReport.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+
+#include <algorithm>
+#include <set>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Collects the parent handles of the tensors accessed by the nodes of some types
+ *
+ * @param[in] g     Graph to inspect
+ * @param[in] types Node types to collect the handles of
+ *
+ * @return The parent handles
+ */
+std::set<ITensorHandle *> node_handles(Graph &g, const std::set<NodeType> &types)
+{
+    std::set<ITensorHandle *> handles;
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || types.find(node->type()) == std::end(types))
+        {
+            continue;
+        }
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            if(node->input(i) != nullptr && node->input(i)->handle() != nullptr)
+            {
+                handles.insert(node->input(i)->handle()->parent_handle());
+            }
+        }
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            if(node->output(i) != nullptr && node->output(i)->handle() != nullptr)
+            {
+                handles.insert(node->output(i)->handle()->parent_handle());
+            }
+        }
+    }
+    return handles;
+}
+
+/** Sums the sizes of the handles that are allocated
+ *
+ * @param[in] handles Handles to account for
+ *
+ * @return The size in bytes of the allocated handles
+ */
+size_t allocated_size(const std::set<ITensorHandle *> &handles)
+{
+    size_t size = 0;
+    for(auto *handle : handles)
+    {
+        if(!handle->tensor().info()->is_resizable())
+        {
+            size += handle->tensor().info()->total_size();
+        }
+    }
+    return size;
+}
+} // namespace
+
+MemoryReport create_memory_report(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
+{
+    MemoryReport report;
+
+    // Constants and inputs/outputs
+    const std::set<ITensorHandle *> const_handles = node_handles(g, { NodeType::Const });
+    std::set<ITensorHandle *>       io_handles    = node_handles(g, { NodeType::Input, NodeType::Output });
+    for(auto *handle : const_handles)
+    {
+        io_handles.erase(handle);
+    }
+    report.constants = allocated_size(const_handles);
+    report.io        = allocated_size(io_handles);
+
+    // Memory managers pools
+    for(auto &mm_ctx : ctx.memory_managers())
+    {
+        report.transitions += mm_ctx.second.cross_pool_size;
+        report.workspaces += mm_ctx.second.intra_pool_size;
+    }
+    for(auto &wm_ctx : ctx.weights_managers())
+    {
+        if(wm_ctx.second.wm != nullptr)
+        {
+            report.transformed_weights += wm_ctx.second.wm->transformed_weights_size();
+        }
+    }
+
+    // Transition tensors allocated on their own when no transition memory manager is used
+    if(report.transitions == 0)
+    {
+        std::set<ITensorHandle *> transition_handles;
+        for(auto &tensor : g.tensors())
+        {
+            if(tensor != nullptr && tensor->handle() != nullptr)
+            {
+                ITensorHandle *parent = tensor->handle()->parent_handle();
+                if(const_handles.find(parent) == std::end(const_handles) && io_handles.find(parent) == std::end(io_handles))
+                {
+                    transition_handles.insert(parent);
+                }
+            }
+        }
+        report.transitions = allocated_size(transition_handles);
+    }
+
+    // Breakdown per node
+    const std::vector<size_t> live_memory = live_transition_memory(g, node_order);
+    for(size_t i = 0; i < node_order.size(); ++i)
+    {
+        INode *node = g.node(node_order[i]);
+        if(node == nullptr || node->type() == NodeType::Const)
+        {
+            continue;
+        }
+
+        NodeMemoryReport node_report;
+        node_report.id               = node->id();
+        node_report.name             = node->name();
+        node_report.live_transitions = live_memory[i];
+
+        std::set<ITensorHandle *> inputs;
+        for(unsigned int j = 0; j < node->num_inputs(); ++j)
+        {
+            Tensor *tensor = node->input(j);
+            if(tensor != nullptr && tensor->handle() != nullptr && const_handles.find(tensor->handle()->parent_handle()) != std::end(const_handles))
+            {
+                inputs.insert(tensor->handle()->parent_handle());
+            }
+        }
+        for(auto *handle : inputs)
+        {
+            node_report.constants += handle->tensor().info()->total_size();
+        }
+
+        std::set<ITensorHandle *> outputs;
+        for(unsigned int j = 0; j < node->num_outputs(); ++j)
+        {
+            Tensor *tensor = node->output(j);
+            if(tensor != nullptr && tensor->handle() != nullptr)
+            {
+                ITensorHandle *parent = tensor->handle()->parent_handle();
+                if(const_handles.find(parent) == std::end(const_handles) && io_handles.find(parent) == std::end(io_handles))
+                {
+                    outputs.insert(parent);
+                }
+            }
+        }
+        for(auto *handle : outputs)
+        {
+            node_report.transitions += handle->tensor().info()->total_size();
+        }
+
+        report.peak_live_transitions = std::max(report.peak_live_transitions, node_report.live_transitions);
+        report.nodes.push_back(std::move(node_report));
+    }
+
+    return report;
+}
+
+std::ostream &operator<<(std::ostream &os, const NodeMemoryReport &report)
+{
+    os << "Node " << report.id << " (" << report.name << ")"
+       << " : constants " << report.constants << " bytes"
+       << ", transitions " << report.transitions << " bytes"
+       << ", live transitions " << report.live_transitions << " bytes";
+    return os;
+}
+
+std::ostream &operator<<(std::ostream &os, const MemoryReport &report)
+{
+    os << "Constants : " << report.constants << " bytes" << std::endl;
+    os << "Transformed weights : " << report.transformed_weights << " bytes" << std::endl;
+    os << "Inputs and outputs : " << report.io << " bytes" << std::endl;
+    os << "Transitions : " << report.transitions << " bytes (peak alive " << report.peak_live_transitions << " bytes)" << std::endl;
+    os << "Function workspaces : " << report.workspaces << " bytes" << std::endl;
+    os << "Total : " << report.total() << " bytes" << std::endl;
+    return os;
+}
+} // namespace graph
+} // namespace arm_compute
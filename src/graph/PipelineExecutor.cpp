@@ -0,0 +1,713 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/PipelineExecutor.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "arm_compute/runtime/IScheduler.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/SingleThreadScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#if ARM_COMPUTE_CPP_SCHEDULER
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+
+#include "src/runtime/SchedulerScope.h"
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <set>
+
+#ifndef NO_MULTI_THREADING
+#include <thread>
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__)
+#include <sched.h>
+#endif /* !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) */
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Collects the tensors a node reads or writes, leaving out the constants
+ *
+ * @param[in] node Node to collect the tensors of
+ *
+ * @return The distinct tensors of the node
+ */
+std::vector<Tensor *> frame_tensors(INode &node)
+{
+    std::vector<Tensor *> tensors;
+    if(node.type() == NodeType::Const)
+    {
+        return tensors;
+    }
+    auto add = [&](Tensor * tensor)
+    {
+        if(tensor != nullptr && std::find(tensors.begin(), tensors.end(), tensor) == tensors.end())
+        {
+            tensors.push_back(tensor);
+        }
+    };
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if(edge != nullptr && edge->producer() != nullptr && edge->producer()->type() != NodeType::Const)
+        {
+            add(node.input(i));
+        }
+    }
+    for(size_t i = 0; i < node.num_outputs(); ++i)
+    {
+        add(node.output(i));
+    }
+    return tensors;
+}
+
+/** Estimates the cost of a node
+ *
+ * Nodes with weights are accounted for their multiply-accumulates and the other nodes for the number of elements they write.
+ *
+ * @param[in] node Node to estimate the cost of
+ *
+ * @return The estimated cost
+ */
+uint64_t estimate_cost(INode &node)
+{
+    if(node.type() == NodeType::Input || node.type() == NodeType::Output || node.type() == NodeType::Const || node.num_outputs() == 0 || node.output(0) == nullptr)
+    {
+        return 0;
+    }
+
+    const TensorDescriptor &output      = node.output(0)->desc();
+    const uint64_t          num_outputs = output.shape.total_size();
+    const Tensor           *weights     = (node.num_inputs() > 1) ? node.input(1) : nullptr;
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DeconvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayerWithPostOpsLayer:
+        case NodeType::FusedConvolutionWithPostOp:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        {
+            const uint64_t channels = get_dimension_size(output, DataLayoutDimension::CHANNEL);
+            if(weights != nullptr && channels != 0)
+            {
+                return num_outputs * (weights->desc().shape.total_size() / channels);
+            }
+            break;
+        }
+        case NodeType::FullyConnectedLayer:
+        {
+            const uint64_t channels = output.shape[0];
+            if(weights != nullptr && channels != 0)
+            {
+                return num_outputs * (weights->desc().shape.total_size() / channels);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+    return num_outputs;
+}
+
+/** Partitions the nodes of a graph into stages of similar estimated cost
+ *
+ * The stages are cut between consecutive nodes of the topological order. A cut is not allowed across tensors
+ * that are sub-tensors or parents of sub-tensors, as their memory can't be double-buffered on its own.
+ * Input nodes belong to the first stage and output nodes to the last one. With asynchronous accessors, they get
+ * a stage of their own on either side of the compute stages.
+ *
+ * @param[in]     g          Graph to partition
+ * @param[in]     node_order Topologically sorted nodes of the graph
+ * @param[in]     max_stages Maximum number of compute stages
+ * @param[in,out] async_io   Whether to give the input and output nodes their own stages. Reset if their tensors can't be double-buffered
+ * @param[out]    num_stages Number of stages
+ *
+ * @return The stage of each node
+ */
+std::map<NodeID, unsigned int> partition_stages(Graph &g, const std::vector<NodeID> &node_order, unsigned int max_stages, bool &async_io, unsigned int &num_stages)
+{
+    const int num_nodes = static_cast<int>(node_order.size());
+
+    // Handles backing sub-tensors
+    std::set<ITensorHandle *> parent_handles;
+    for(auto &tensor : g.tensors())
+    {
+        if(tensor != nullptr && tensor->handle() != nullptr && tensor->handle()->is_subtensor())
+        {
+            parent_handles.insert(tensor->handle()->parent_handle());
+        }
+    }
+
+    // Range of positions in the node order each tensor is used in
+    std::map<Tensor *, std::pair<int, int>> ranges;
+    std::vector<uint64_t>                   costs(num_nodes, 0);
+    uint64_t                                total_cost = 0;
+    for(int pos = 0; pos < num_nodes; ++pos)
+    {
+        INode *node = g.node(node_order[pos]);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        costs[pos] = estimate_cost(*node);
+        total_cost += costs[pos];
+
+        const int node_pos = (node->type() == NodeType::Input) ? -1 : ((node->type() == NodeType::Output) ? num_nodes : pos);
+        for(auto *tensor : frame_tensors(*node))
+        {
+            auto it = ranges.find(tensor);
+            if(it == ranges.end())
+            {
+                ranges.emplace(tensor, std::make_pair(node_pos, node_pos));
+            }
+            else
+            {
+                it->second.first  = std::min(it->second.first, node_pos);
+                it->second.second = std::max(it->second.second, node_pos);
+            }
+        }
+    }
+
+    // A cut after a position can't cross the tensors that can't be double-buffered
+    std::vector<bool> can_cut(num_nodes, true);
+    for(auto &range : ranges)
+    {
+        ITensorHandle *handle = range.first->handle();
+        if(handle == nullptr || handle->is_subtensor() || parent_handles.count(handle) != 0 || handle->target() != Target::NEON)
+        {
+            async_io = async_io && range.second.first >= 0 && range.second.second < num_nodes;
+            for(int pos = std::max(range.second.first, 0); pos < std::min(range.second.second, num_nodes); ++pos)
+            {
+                can_cut[pos] = false;
+            }
+        }
+    }
+
+    // Cut whenever the accumulated cost reaches the share of the next stage
+    std::vector<int> cuts;
+    uint64_t         cost = 0;
+    for(int pos = 0; pos + 1 < num_nodes && cuts.size() + 1 < max_stages; ++pos)
+    {
+        cost += costs[pos];
+        if(can_cut[pos] && cost * max_stages >= total_cost * (cuts.size() + 1))
+        {
+            cuts.push_back(pos);
+        }
+    }
+
+    const unsigned int io_stages = async_io ? 1 : 0;
+    num_stages                   = cuts.size() + 1 + 2 * io_stages;
+
+    std::map<NodeID, unsigned int> stages;
+    for(int pos = 0; pos < num_nodes; ++pos)
+    {
+        INode *node = g.node(node_order[pos]);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        unsigned int stage = io_stages + std::count_if(cuts.begin(), cuts.end(), [pos](int cut)
+        {
+            return cut < pos;
+        });
+        if(node->type() == NodeType::Input)
+        {
+            stage = 0;
+        }
+        else if(node->type() == NodeType::Output)
+        {
+            stage = num_stages - 1;
+        }
+        stages.emplace(node->id(), stage);
+    }
+    return stages;
+}
+
+/** Creates the scheduler of a stage
+ *
+ * @param[in] first_core  First core of the stage
+ * @param[in] num_threads Number of threads of the stage
+ * @param[in] num_cores   Number of cores of the system
+ *
+ * @return The scheduler of the stage
+ */
+std::unique_ptr<IScheduler> create_stage_scheduler(int first_core, unsigned int num_threads, unsigned int num_cores)
+{
+#if ARM_COMPUTE_CPP_SCHEDULER
+    // The thread of the stage takes part in the work and pins itself to the first core, the workers get the next ones
+    auto scheduler = std::make_unique<CPPScheduler>();
+    scheduler->set_num_threads_with_affinity(num_threads, [first_core, num_cores](int thread_index, int)
+    {
+        return thread_index == 0 ? -1 : static_cast<int>((first_core + thread_index) % num_cores);
+    });
+    return scheduler;
+#else  /* ARM_COMPUTE_CPP_SCHEDULER */
+    ARM_COMPUTE_UNUSED(first_core, num_threads, num_cores);
+    return std::make_unique<SingleThreadScheduler>();
+#endif /* ARM_COMPUTE_CPP_SCHEDULER */
+}
+
+/** Points a handle to a buffer
+ *
+ * @param[in] handle Handle of the Arm® Neon™ backend to update
+ * @param[in] buffer Buffer to import
+ */
+void import_buffer(ITensorHandle &handle, MemoryRegion &buffer)
+{
+    auto        *tensor = arm_compute::utils::cast::polymorphic_downcast<arm_compute::Tensor *>(&handle.tensor());
+    const Status status = tensor->allocator()->import_memory(buffer.buffer());
+    ARM_COMPUTE_ERROR_ON_MSG(!bool(status), status.error_description().c_str());
+    ARM_COMPUTE_UNUSED(status);
+}
+
+double elapsed_ms(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+} // namespace
+
+PipelineExecutor::PipelineExecutor(unsigned int num_stages, bool async_io)
+    : _max_stages(std::max(num_stages, 1u)), _async_io(async_io), _stages(), _shared(), _outputs(), _stats(), _frame_starts(), _total_latency_ms(0.0)
+{
+}
+
+PipelineExecutor::~PipelineExecutor() = default;
+
+ExecutionWorkload PipelineExecutor::configure(Graph &g, GraphContext &ctx, const std::vector<NodeID> &node_order)
+{
+    const bool                           requested_async_io = _async_io;
+    unsigned int                         num_stages         = 1;
+    const std::map<NodeID, unsigned int> node_stages        = partition_stages(g, node_order, _max_stages, _async_io, num_stages);
+    if(requested_async_io && !_async_io)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("The input and output tensors can't be double-buffered, calling their accessors synchronously" << std::endl);
+    }
+    _stages.clear();
+    _stages.resize(num_stages);
+    _shared.clear();
+    _outputs.clear();
+
+    // Find the stages using each tensor
+    std::map<Tensor *, std::set<unsigned int>> tensor_stages;
+    std::vector<std::vector<NodeID>>           stage_nodes(num_stages);
+    for(auto &node_id : node_order)
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        const unsigned int stage = node_stages.at(node_id);
+        stage_nodes[stage].push_back(node_id);
+        for(auto *tensor : frame_tensors(*node))
+        {
+            tensor_stages[tensor].insert(stage);
+        }
+    }
+
+    // Give the stages their own handles of the tensors they share, the first stage using a tensor keeps the handle of the graph tensor
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(Target::NEON);
+    std::map<Tensor *, int>   shared_ids;
+    for(auto &tensor_stage : tensor_stages)
+    {
+        if(tensor_stage.second.size() < 2)
+        {
+            continue;
+        }
+        SharedTensor shared;
+        shared.tensor     = tensor_stage.first;
+        shared.home_stage = *tensor_stage.second.begin();
+        for(auto stage : tensor_stage.second)
+        {
+            if(stage != shared.home_stage)
+            {
+                shared.handles.emplace(stage, backend.create_tensor(*shared.tensor));
+            }
+            _stages[shared.home_stage].wait_stage = std::max(_stages[shared.home_stage].wait_stage, stage);
+            _stages[stage].wait_stage             = std::max(_stages[stage].wait_stage, *tensor_stage.second.rbegin());
+        }
+        shared_ids.emplace(shared.tensor, static_cast<int>(_shared.size()));
+        _shared.emplace_back(std::move(shared));
+    }
+    for(unsigned int stage = 0; stage < num_stages; ++stage)
+    {
+        _stages[stage].wait_stage = std::max(_stages[stage].wait_stage, stage);
+    }
+
+    // Configure the nodes of each stage with the handles of the stage
+    ExecutionWorkload workload;
+    workload.graph = &g;
+    workload.ctx   = &ctx;
+    for(unsigned int stage = 0; stage < num_stages; ++stage)
+    {
+        auto swap_handles = [&]()
+        {
+            for(auto &shared : _shared)
+            {
+                auto it = shared.handles.find(stage);
+                if(it != shared.handles.end())
+                {
+                    std::unique_ptr<ITensorHandle> handle = shared.tensor->extract_handle();
+                    shared.tensor->set_handle(std::move(it->second));
+                    it->second = std::move(handle);
+                }
+            }
+        };
+
+        swap_handles();
+        ExecutionWorkload stage_workload = detail::configure_all_nodes(g, ctx, stage_nodes[stage]);
+        swap_handles();
+
+        for(auto &task : stage_workload.tasks)
+        {
+            _stages[stage].tasks.push_back(workload.tasks.size());
+            workload.tasks.emplace_back(std::move(task));
+        }
+        if(stage == 0)
+        {
+            workload.inputs  = stage_workload.inputs;
+            workload.outputs = stage_workload.outputs;
+        }
+    }
+
+    // Collect the handles each stage points to the buffers of its frames, and the handles the outputs are read from
+    for(size_t i = 0; i < _shared.size(); ++i)
+    {
+        SharedTensor &shared = _shared[i];
+        _stages[shared.home_stage].handles.emplace_back(shared.tensor->handle(), static_cast<int>(i));
+        for(auto &handle : shared.handles)
+        {
+            _stages[handle.first].handles.emplace_back(handle.second.get(), static_cast<int>(i));
+        }
+    }
+    for(auto *tensor : workload.outputs)
+    {
+        const auto     it     = shared_ids.find(tensor);
+        ITensorHandle *handle = tensor->handle();
+        if(it != shared_ids.end() && _shared[it->second].home_stage != num_stages - 1)
+        {
+            handle = _shared[it->second].handles.at(num_stages - 1).get();
+        }
+        _outputs.emplace_back(tensor, handle);
+    }
+
+    // All the handles of a shared tensor have to agree on the padding to share its buffers
+    for(auto &shared : _shared)
+    {
+        std::vector<ITensorHandle *> handles{ shared.tensor->handle() };
+        for(auto &handle : shared.handles)
+        {
+            handles.push_back(handle.second.get());
+        }
+        PaddingSize padding{};
+        for(auto *handle : handles)
+        {
+            const PaddingSize &handle_padding = handle->tensor().info()->padding();
+            padding.top                       = std::max(padding.top, handle_padding.top);
+            padding.right                     = std::max(padding.right, handle_padding.right);
+            padding.bottom                    = std::max(padding.bottom, handle_padding.bottom);
+            padding.left                      = std::max(padding.left, handle_padding.left);
+        }
+        for(auto *handle : handles)
+        {
+            if(handle->tensor().info()->is_resizable())
+            {
+                handle->tensor().info()->extend_padding(padding);
+            }
+        }
+    }
+
+    // Bind the compute stages to consecutive subsets of the cores, the accessor stages are single-threaded and not bound
+    const unsigned int io_stages       = _async_io ? 1 : 0;
+    const unsigned int compute_stages  = std::max(num_stages - 2 * io_stages, 1u);
+    const unsigned int num_cores       = std::max(Scheduler::get().cpu_info().get_cpu_num(), 1u);
+    const int          num_threads     = ctx.config().num_threads;
+    const unsigned int budget          = (num_threads > 0) ? std::min(static_cast<unsigned int>(num_threads), num_cores) : num_cores;
+    const unsigned int cores_per_stage = std::max(budget / compute_stages, 1u);
+    for(unsigned int stage = 0; stage < num_stages; ++stage)
+    {
+        if(stage < io_stages || stage + io_stages >= num_stages)
+        {
+            _stages[stage].scheduler = std::make_unique<SingleThreadScheduler>();
+            continue;
+        }
+        _stages[stage].first_core = static_cast<int>(((stage - io_stages) * cores_per_stage) % num_cores);
+        _stages[stage].scheduler  = create_stage_scheduler(_stages[stage].first_core, cores_per_stage, num_cores);
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Pipeline stage " << stage << " : " << _stages[stage].tasks.size() << " tasks on " << cores_per_stage
+                                      << " cores from core " << _stages[stage].first_core << std::endl);
+    }
+    if(num_stages > 1)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Partitioned graph into " << num_stages << " pipeline stages sharing " << _shared.size() << " double-buffered tensors" << std::endl);
+    }
+
+    return workload;
+}
+
+void PipelineExecutor::allocate()
+{
+    for(auto &shared : _shared)
+    {
+        ITensorHandle *handle = shared.tensor->handle();
+        const size_t   size   = handle->tensor().info()->total_size();
+        for(auto &buffer : shared.buffers)
+        {
+            buffer = std::make_unique<MemoryRegion>(size, 64);
+        }
+
+        // Importing the buffer of the first frame releases the memory the graph allocated for the tensor
+        import_buffer(*handle, *shared.buffers[0]);
+        for(auto &stage_handle : shared.handles)
+        {
+            ARM_COMPUTE_ERROR_ON(stage_handle.second->tensor().info()->total_size() != size);
+            import_buffer(*stage_handle.second, *shared.buffers[0]);
+        }
+    }
+}
+
+unsigned int PipelineExecutor::num_stages() const
+{
+    return _stages.size();
+}
+
+unsigned int PipelineExecutor::num_compute_stages() const
+{
+    return _async_io ? _stages.size() - 2 : _stages.size();
+}
+
+const PipelineStats &PipelineExecutor::stats() const
+{
+    return _stats;
+}
+
+bool PipelineExecutor::process(ExecutionWorkload &workload, unsigned int stage, unsigned int frame)
+{
+    Stage     &current = _stages[stage];
+    const auto start   = Clock::now();
+
+    // Point the handles of the stage to the buffers of the frame
+    for(auto &handle : current.handles)
+    {
+        import_buffer(*handle.first, *_shared[handle.second].buffers[frame % 2]);
+    }
+
+    bool is_valid = true;
+    if(stage == 0)
+    {
+        {
+#ifndef NO_MULTI_THREADING
+            std::lock_guard<std::mutex> lock(_mtx);
+#endif /* NO_MULTI_THREADING */
+            _frame_starts[frame] = start;
+        }
+        is_valid = detail::call_all_input_node_accessors(workload);
+    }
+
+    if(is_valid)
+    {
+        for(auto &task : current.tasks)
+        {
+            workload.tasks[task]();
+        }
+    }
+
+    if(is_valid && stage + 1 == _stages.size())
+    {
+        for(auto &output : _outputs)
+        {
+            is_valid = output.first->call_accessor(*output.second) && is_valid;
+        }
+
+#ifndef NO_MULTI_THREADING
+        std::lock_guard<std::mutex> lock(_mtx);
+#endif /* NO_MULTI_THREADING */
+        const double latency_ms = elapsed_ms(_frame_starts[frame], Clock::now());
+        _frame_starts.erase(frame);
+        _total_latency_ms += latency_ms;
+        _stats.max_latency_ms = std::max(_stats.max_latency_ms, latency_ms);
+        ++_stats.frames;
+    }
+
+    current.busy_ms += elapsed_ms(start, Clock::now());
+    return is_valid;
+}
+
+#ifndef NO_MULTI_THREADING
+void PipelineExecutor::stop_at(unsigned int frame)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        _stop_frame = std::min(_stop_frame, frame);
+    }
+    _frame_done.notify_all();
+}
+
+void PipelineExecutor::run_stage(ExecutionWorkload &workload, unsigned int stage)
+{
+    Stage &current = _stages[stage];
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__)
+    if(current.first_core >= 0)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(current.first_core, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+    }
+#endif /* !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) */
+
+    // Functions pick their scheduler through Scheduler::get(), point it to the scheduler of the stage
+    SchedulerScope scope(*current.scheduler);
+
+    for(unsigned int frame = 0;; ++frame)
+    {
+        {
+            // A frame can start once the previous stage is done with it and the later stages are done with the frame that used the same buffers
+            std::unique_lock<std::mutex> lock(_mtx);
+            _frame_done.wait(lock, [&]
+            {
+                return frame >= _stop_frame || ((stage == 0 || _done[stage - 1] > frame) && _done[current.wait_stage] + 1 >= frame);
+            });
+            if(frame >= _stop_frame)
+            {
+                return;
+            }
+        }
+
+        bool is_valid = false;
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        try
+        {
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+            is_valid = process(workload, stage, frame);
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+        }
+        catch(...)
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mtx);
+                if(_error == nullptr)
+                {
+                    _error = std::current_exception();
+                }
+            }
+            stop_at(0);
+            return;
+        }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+        if(!is_valid)
+        {
+            // Failing inputs end the stream before the frame, failing outputs after it
+            stop_at(stage == 0 ? frame : frame + 1);
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mtx);
+            _done[stage] = frame + 1;
+        }
+        _frame_done.notify_all();
+    }
+}
+#endif /* NO_MULTI_THREADING */
+
+void PipelineExecutor::execute(ExecutionWorkload &workload)
+{
+    _stats            = PipelineStats{};
+    _total_latency_ms = 0.0;
+    _frame_starts.clear();
+    for(auto &stage : _stages)
+    {
+        stage.busy_ms = 0.0;
+    }
+
+    const auto start = Clock::now();
+#ifndef NO_MULTI_THREADING
+    _done.assign(_stages.size(), 0);
+    _stop_frame = std::numeric_limits<unsigned int>::max();
+    _error      = nullptr;
+
+    std::vector<std::thread> threads;
+    for(unsigned int stage = 0; stage < _stages.size(); ++stage)
+    {
+        threads.emplace_back(&PipelineExecutor::run_stage, this, std::ref(workload), stage);
+    }
+    for(auto &thread : threads)
+    {
+        thread.join();
+    }
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    if(_error != nullptr)
+    {
+        std::rethrow_exception(_error);
+    }
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+#else  /* NO_MULTI_THREADING */
+    // Without threads the stages process the frames one after the other
+    bool is_valid = true;
+    for(unsigned int frame = 0; is_valid; ++frame)
+    {
+        for(unsigned int stage = 0; stage < _stages.size() && is_valid; ++stage)
+        {
+            is_valid = process(workload, stage, frame);
+        }
+    }
+#endif /* NO_MULTI_THREADING */
+
+    // Report the statistics
+    _stats.duration_ms = elapsed_ms(start, Clock::now());
+    if(_stats.duration_ms > 0.0)
+    {
+        _stats.throughput = _stats.frames * 1000.0 / _stats.duration_ms;
+        for(auto &stage : _stages)
+        {
+            _stats.stage_utilization.push_back(stage.busy_ms / _stats.duration_ms);
+        }
+    }
+    if(_stats.frames != 0)
+    {
+        _stats.avg_latency_ms = _total_latency_ms / _stats.frames;
+    }
+
+    ARM_COMPUTE_LOG_GRAPH_INFO("Pipelined " << _stats.frames << " frames in " << _stats.duration_ms << "ms: " << _stats.throughput << " frames/s, latency "
+                               << _stats.avg_latency_ms << "ms on average and " << _stats.max_latency_ms << "ms at most" << std::endl);
+    for(size_t stage = 0; stage < _stats.stage_utilization.size(); ++stage)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Pipeline stage " << stage << " utilization : " << _stats.stage_utilization[stage] * 100.0 << "%" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2019,2021 Arm Limited.
+ * Copyright (c) 2018-2019,2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,6 +67,11 @@ ITensorAccessor *Tensor::accessor()
     return _accessor.get();
 }
 
+std::unique_ptr<ITensorHandle> Tensor::extract_handle()
+{
+    return std::move(_handle);
+}
+
 std::unique_ptr<ITensorAccessor> Tensor::extract_accessor()
 {
     return std::move(_accessor);
@@ -80,27 +85,38 @@ bool Tensor::call_accessor()
         return false;
     }
 
+    return call_accessor(*_handle);
+}
+
+bool Tensor::call_accessor(ITensorHandle &handle)
+{
+    // Early exit guard
+    if(!_accessor)
+    {
+        return false;
+    }
+
     const bool access_data = _accessor->access_tensor_data();
 
     if(access_data)
     {
         // Map tensor
-        _handle->map(true);
+        handle.map(true);
 
         // Return in case of null backend buffer
-        if(_handle->tensor().buffer() == nullptr)
+        if(handle.tensor().buffer() == nullptr)
         {
             return false;
         }
     }
 
     // Call accessor
-    bool retval = _accessor->access_tensor(_handle->tensor());
+    bool retval = _accessor->access_tensor(handle.tensor());
 
     if(access_data)
     {
         // Unmap tensor
-        _handle->unmap();
+        handle.unmap();
     }
 
     return retval;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,10 +23,13 @@
  */
 #include "arm_compute/graph/Utils.h"
 
+#include "arm_compute/core/Helpers.h"
 #include "arm_compute/graph/GraphContext.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/mutators/GraphMutators.h"
 
+#include <cstring>
+
 namespace arm_compute
 {
 namespace graph
@@ -93,14 +96,28 @@ PassManager create_default_pass_manager(Target target, const GraphConfig &cfg)
             }
         }
     }
+    if(cfg.use_constant_folding)
+    {
+        pm.append(std::make_unique<ConstantFoldingMutator>());
+    }
     pm.append(std::make_unique<NodeFusionMutator>());
     pm.append(std::make_unique<GroupedConvolutionMutator>());
     pm.append(std::make_unique<InPlaceOperationMutator>());
 
     // Passes that mutate backend information
+    if(cfg.use_data_layout_selection)
+    {
+        pm.append(std::make_unique<DataLayoutSelectionMutator>());
+    }
     pm.append(std::make_unique<DepthConcatSubTensorMutator>());
     pm.append(std::make_unique<SplitLayerSubTensorMutator>());
+    pm.append(std::make_unique<ViewAliasingMutator>());
     pm.append(std::make_unique<NodeExecutionMethodMutator>());
+    if(cfg.use_conv_method_benchmark)
+    {
+        pm.append(std::make_unique<ConvolutionMethodSelectionMutator>(cfg.conv_method_file));
+    }
+    pm.append(std::make_unique<InPlaceOperationMutator>(true));
 
     return pm;
 }
@@ -214,6 +231,70 @@ std::vector<NodeIdxPair> get_driver_nodes(const INode &node)
     return driver_nodes;
 }
 
+bool is_only_consumer(const Graph &g, const Tensor &tensor, const INode &node)
+{
+    for(auto &eid : tensor.bound_edges())
+    {
+        const Edge *edge = g.edge(eid);
+        if(edge == nullptr || edge->consumer() == nullptr || (edge->consumer() != &node && edge->consumer()->output(0) != &tensor))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool has_in_place_writer(const Graph &g, const Tensor &tensor)
+{
+    for(auto &eid : tensor.bound_edges())
+    {
+        const Edge *edge = g.edge(eid);
+        if(edge != nullptr && edge->consumer() != nullptr && edge->consumer()->output(0) == &tensor)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace
+{
+template <typename F>
+void for_each_row(ITensor &tensor, F &&func)
+{
+    const size_t row_bytes = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+    Window window;
+    window.use_tensor_dimensions(tensor.info()->tensor_shape());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        func(it.ptr(), row_bytes);
+    },
+    it);
+}
+} // namespace
+
+void copy_tensor_to_buffer(ITensor &tensor, uint8_t *dst)
+{
+    for_each_row(tensor, [&](const uint8_t *row, size_t row_bytes)
+    {
+        std::memcpy(dst, row, row_bytes);
+        dst += row_bytes;
+    });
+}
+
+void copy_buffer_to_tensor(const uint8_t *src, ITensor &tensor)
+{
+    for_each_row(tensor, [&](uint8_t *row, size_t row_bytes)
+    {
+        std::memcpy(row, src, row_bytes);
+        src += row_bytes;
+    });
+}
+
 void configure_tensor(Tensor *tensor)
 {
     if(tensor != nullptr && tensor->handle() == nullptr)
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/WorkspaceLifetimeManager.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/IAllocator.h"
+#include "arm_compute/runtime/IMemory.h"
+#include "arm_compute/runtime/IMemoryGroup.h"
+#include "arm_compute/runtime/IMemoryPool.h"
+#include "arm_compute/runtime/MemoryRegion.h"
+
+#include <algorithm>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+size_t align_offset(size_t offset, size_t alignment)
+{
+    const size_t remainder = (alignment != 0U) ? offset % alignment : 0U;
+    return (remainder != 0U) ? offset + (alignment - remainder) : offset;
+}
+
+/** Memory pool giving the memory of the workspaces to the groups that have one */
+class WorkspaceMemoryPool final : public IMemoryPool
+{
+public:
+    /** Constructor
+     *
+     * @param[in] manager   Lifetime manager the groups are registered to
+     * @param[in] allocator Backend allocator
+     * @param[in] blob_info Blob of the groups without a workspace
+     */
+    WorkspaceMemoryPool(const WorkspaceLifetimeManager *manager, IAllocator *allocator, BlobInfo blob_info)
+        : _manager(manager), _allocator(allocator), _blob(), _blob_info(blob_info)
+    {
+        ARM_COMPUTE_ERROR_ON(manager == nullptr || allocator == nullptr);
+        if(blob_info.size != 0)
+        {
+            _blob = _allocator->make_region(blob_info.size, blob_info.alignment);
+        }
+    }
+    // Inherited methods overridden:
+    void acquire(MemoryMappings &handles) override
+    {
+        arm_compute::Tensor *workspace = _manager->workspace(handles);
+        const size_t         offset    = (workspace != nullptr) ? _manager->workspace_offset(handles) : 0U;
+        uint8_t             *base      = (workspace != nullptr) ? workspace->buffer() + offset : (_blob != nullptr ? static_cast<uint8_t *>(_blob->buffer()) : nullptr);
+        const size_t         size      = (workspace != nullptr) ? workspace->info()->total_size() - offset : _blob_info.size;
+        ARM_COMPUTE_ERROR_ON_MSG(base == nullptr, "No memory for the group!");
+
+        // Set memory to handlers
+        for(auto &handle : handles)
+        {
+            ARM_COMPUTE_ERROR_ON(handle.first == nullptr);
+            ARM_COMPUTE_ERROR_ON(handle.second > size);
+            handle.first->set_owned_region(std::make_unique<MemoryRegion>(base + handle.second, size - handle.second));
+        }
+    }
+    void release(MemoryMappings &handles) override
+    {
+        for(auto &handle : handles)
+        {
+            ARM_COMPUTE_ERROR_ON(handle.first == nullptr);
+            handle.first->set_region(nullptr);
+        }
+    }
+    MappingType mapping_type() const override
+    {
+        return MappingType::OFFSETS;
+    }
+    std::unique_ptr<IMemoryPool> duplicate() override
+    {
+        return std::make_unique<WorkspaceMemoryPool>(_manager, _allocator, _blob_info);
+    }
+
+private:
+    const WorkspaceLifetimeManager *_manager;
+    IAllocator                     *_allocator;
+    std::unique_ptr<IMemoryRegion>  _blob;
+    BlobInfo                        _blob_info;
+};
+} // namespace
+
+WorkspaceLifetimeManager::WorkspaceLifetimeManager()
+    : _active_node(EmptyNodeID), _groups(), _workspaces()
+{
+}
+
+void WorkspaceLifetimeManager::set_active_node(NodeID nid)
+{
+    _active_node = nid;
+}
+
+arm_compute::Tensor *WorkspaceLifetimeManager::create_workspace(NodeID nid)
+{
+    // A function can hold its group while the functions nested in it acquire theirs, so the groups of a node are laid out back to back
+    size_t size      = 0;
+    size_t alignment = 0;
+    for(auto &group : _groups)
+    {
+        if(group.second.node == nid)
+        {
+            group.second.offset = align_offset(size, group.second.alignment);
+            size                = group.second.offset + group.second.size;
+            alignment           = std::max(alignment, group.second.alignment);
+        }
+    }
+    if(nid == EmptyNodeID || size == 0)
+    {
+        return nullptr;
+    }
+
+    auto workspace = std::make_unique<arm_compute::Tensor>();
+    workspace->allocator()->init(TensorInfo(TensorShape(size), 1, DataType::U8), alignment);
+    arm_compute::Tensor *ptr = workspace.get();
+    _workspaces[nid]         = std::move(workspace);
+    return ptr;
+}
+
+arm_compute::Tensor *WorkspaceLifetimeManager::workspace(const MemoryMappings &mappings) const
+{
+    const auto group = _groups.find(&mappings);
+    if(group == std::end(_groups))
+    {
+        return nullptr;
+    }
+    const auto workspace = _workspaces.find(group->second.node);
+    return (workspace != std::end(_workspaces) && !workspace->second->info()->is_resizable()) ? workspace->second.get() : nullptr;
+}
+
+size_t WorkspaceLifetimeManager::workspace_offset(const MemoryMappings &mappings) const
+{
+    const auto group = _groups.find(&mappings);
+    return (group != std::end(_groups)) ? group->second.offset : 0U;
+}
+
+bool WorkspaceLifetimeManager::release_group(IMemoryGroup *group)
+{
+    if(group != nullptr)
+    {
+        _groups.erase(&group->mappings());
+    }
+    return ISimpleLifetimeManager::release_group(group);
+}
+
+std::unique_ptr<IMemoryPool> WorkspaceLifetimeManager::create_pool(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
+
+    // Size the blob for the largest group without a workspace
+    BlobInfo blob_info(0, 0);
+    for(const auto &group : _groups)
+    {
+        if(workspace(*group.first) == nullptr)
+        {
+            blob_info.size      = std::max(blob_info.size, group.second.size);
+            blob_info.alignment = std::max(blob_info.alignment, group.second.alignment);
+        }
+    }
+    return std::make_unique<WorkspaceMemoryPool>(this, allocator, blob_info);
+}
+
+MappingType WorkspaceLifetimeManager::mapping_type() const
+{
+    return MappingType::OFFSETS;
+}
+
+void WorkspaceLifetimeManager::update_blobs_and_mappings()
+{
+    ARM_COMPUTE_ERROR_ON(!are_all_finalized());
+    ARM_COMPUTE_ERROR_ON(_active_group == nullptr);
+
+    size_t alignment = 0;
+    for(const auto &free_blob : _free_blobs)
+    {
+        alignment = std::max(alignment, free_blob.max_alignment);
+    }
+
+    // Calculate group mappings
+    auto  &group_mappings = _active_group->mappings();
+    size_t offset         = 0;
+    for(auto &free_blob : _free_blobs)
+    {
+        for(auto &bound_element_id : free_blob.bound_elements)
+        {
+            ARM_COMPUTE_ERROR_ON(_active_elements.find(bound_element_id) == std::end(_active_elements));
+            Element &bound_element               = _active_elements[bound_element_id];
+            group_mappings[bound_element.handle] = offset;
+        }
+        offset = align_offset(offset + free_blob.max_size, alignment);
+    }
+
+    // Record the requirements of the group
+    GroupInfo &info = _groups[&group_mappings];
+    info.node       = _active_node;
+    info.size       = std::max(info.size, offset);
+    info.alignment  = std::max(info.alignment, alignment);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,11 +23,16 @@
  */
 #include "arm_compute/graph/algorithms/TopologicalSort.h"
 
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/graph/Graph.h"
 
 #include "support/Iterable.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <list>
+#include <map>
+#include <set>
 #include <stack>
 
 namespace arm_compute
@@ -67,6 +72,99 @@ inline bool all_inputs_are_visited(const INode *node, const std::vector<bool> &v
 
     return are_all_visited;
 }
+
+/** Memory object backing a tensor
+ *
+ * @param[in]  tensor Tensor to get the memory object of
+ * @param[out] sizes  Map to record the size in bytes of the memory object to
+ *
+ * @return The parent handle of the tensor if it has one else the tensor itself
+ */
+inline const void *memory_object(Tensor &tensor, std::map<const void *, size_t> &sizes)
+{
+    ITensorHandle *handle = tensor.handle();
+    if(handle != nullptr)
+    {
+        ITensorHandle *parent = handle->parent_handle();
+        sizes[parent]         = parent->tensor().info()->total_size();
+        return parent;
+    }
+    sizes[&tensor] = tensor.desc().shape.total_size() * element_size_from_data_type(tensor.desc().data_type);
+    return &tensor;
+}
+
+/** Lists the transition memory objects accessed by each node of a graph
+ *
+ * Memory objects accessed by input, output and const nodes are not transition objects.
+ *
+ * @param[in]  g     Graph to inspect
+ * @param[out] sizes Map to record the size in bytes of the memory objects to
+ *
+ * @return The distinct transition memory objects accessed by each node, indexed by node ID
+ */
+std::vector<std::vector<const void *>> transition_memory_objects(Graph &g, std::map<const void *, size_t> &sizes)
+{
+    const std::set<NodeType> const_node_types = { NodeType::Input, NodeType::Output, NodeType::Const };
+
+    std::vector<std::vector<const void *>> objects(g.nodes().size());
+    std::set<const void *>                 const_objects;
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr)
+        {
+            continue;
+        }
+        const bool is_const     = const_node_types.find(node->type()) != std::end(const_node_types);
+        auto      &node_objects = objects[node->id()];
+        auto       add_tensor   = [&](Tensor * tensor)
+        {
+            if(tensor == nullptr)
+            {
+                return;
+            }
+            const void *object = memory_object(*tensor, sizes);
+            if(is_const)
+            {
+                const_objects.insert(object);
+            }
+            if(std::find(node_objects.begin(), node_objects.end(), object) == node_objects.end())
+            {
+                node_objects.push_back(object);
+            }
+        };
+        for(unsigned int i = 0; i < node->num_inputs(); ++i)
+        {
+            add_tensor(node->input(i));
+        }
+        for(unsigned int i = 0; i < node->num_outputs(); ++i)
+        {
+            add_tensor(node->output(i));
+        }
+    }
+
+    for(auto &node_objects : objects)
+    {
+        node_objects.erase(std::remove_if(node_objects.begin(), node_objects.end(), [&](const void *object)
+        {
+            return const_objects.find(object) != std::end(const_objects);
+        }),
+        node_objects.end());
+    }
+    return objects;
+}
+
+/** Computes the peak of the transition memory alive for an execution order
+ *
+ * @param[in] g          Graph the nodes belong to
+ * @param[in] node_order Execution order of the nodes
+ *
+ * @return The peak in bytes
+ */
+inline size_t peak_transition_memory(Graph &g, const std::vector<NodeID> &node_order)
+{
+    const std::vector<size_t> live_memory = live_transition_memory(g, node_order);
+    return live_memory.empty() ? 0 : *std::max_element(live_memory.begin(), live_memory.end());
+}
 } // namespace detail
 
 std::vector<NodeID> bfs(Graph &g)
@@ -184,5 +282,139 @@ std::vector<NodeID> dfs(Graph &g)
 
     return dfs_order_vector;
 }
+
+std::vector<NodeID> memory_aware_sort(Graph &g)
+{
+    const std::vector<NodeID> dfs_order = dfs(g);
+
+    std::map<const void *, size_t> sizes;
+    const auto                     objects = detail::transition_memory_objects(g, sizes);
+
+    // Count the users of each memory object and the unscheduled producers of each node
+    std::map<const void *, unsigned int> num_users;
+    std::vector<size_t>                  dfs_position(g.nodes().size(), dfs_order.size());
+    std::vector<unsigned int>            num_pending(g.nodes().size(), 0);
+    std::vector<NodeID>                  ready;
+    for(size_t i = 0; i < dfs_order.size(); ++i)
+    {
+        const NodeID node_id  = dfs_order[i];
+        dfs_position[node_id] = i;
+        for(auto *object : objects[node_id])
+        {
+            ++num_users[object];
+        }
+        for(const auto &eid : g.node(node_id)->input_edges())
+        {
+            if(eid != EmptyEdgeID)
+            {
+                ++num_pending[node_id];
+            }
+        }
+        if(num_pending[node_id] == 0)
+        {
+            ready.push_back(node_id);
+        }
+    }
+
+    std::vector<NodeID>    order;
+    std::set<const void *> live;
+    order.reserve(dfs_order.size());
+    while(!ready.empty())
+    {
+        // Pick the node growing the live memory the least
+        auto    best       = ready.end();
+        int64_t best_delta = 0;
+        for(auto it = ready.begin(); it != ready.end(); ++it)
+        {
+            int64_t delta = 0;
+            for(auto *object : objects[*it])
+            {
+                if(live.find(object) == std::end(live))
+                {
+                    delta += static_cast<int64_t>(sizes[object]);
+                }
+                if(num_users[object] == 1)
+                {
+                    delta -= static_cast<int64_t>(sizes[object]);
+                }
+            }
+            if(best == ready.end() || delta < best_delta || (delta == best_delta && dfs_position[*it] < dfs_position[*best]))
+            {
+                best       = it;
+                best_delta = delta;
+            }
+        }
+
+        const NodeID node_id = *best;
+        ready.erase(best);
+        order.push_back(node_id);
+
+        for(auto *object : objects[node_id])
+        {
+            live.insert(object);
+            if(--num_users[object] == 0)
+            {
+                live.erase(object);
+            }
+        }
+        for(const auto &eid : g.node(node_id)->output_edges())
+        {
+            const Edge *e = g.edge(eid);
+            ARM_COMPUTE_ERROR_ON(e == nullptr);
+            const NodeID consumer_id = e->consumer_id();
+            if(dfs_position[consumer_id] < dfs_order.size() && --num_pending[consumer_id] == 0)
+            {
+                ready.push_back(consumer_id);
+            }
+        }
+    }
+
+    if(order.size() != dfs_order.size() || detail::peak_transition_memory(g, order) >= detail::peak_transition_memory(g, dfs_order))
+    {
+        return dfs_order;
+    }
+    return order;
+}
+
+std::vector<size_t> live_transition_memory(Graph &g, const std::vector<NodeID> &node_order)
+{
+    std::map<const void *, size_t> sizes;
+    const auto                     objects = detail::transition_memory_objects(g, sizes);
+
+    // Find the last node accessing each memory object
+    std::map<const void *, size_t> last_use;
+    for(size_t i = 0; i < node_order.size(); ++i)
+    {
+        for(auto *object : objects[node_order[i]])
+        {
+            last_use[object] = i;
+        }
+    }
+
+    std::vector<size_t>    live_memory(node_order.size(), 0);
+    std::set<const void *> live;
+    size_t                 live_bytes = 0;
+    for(size_t i = 0; i < node_order.size(); ++i)
+    {
+        const auto &node_objects = objects[node_order[i]];
+        for(auto *object : node_objects)
+        {
+            if(live.insert(object).second)
+            {
+                live_bytes += sizes[object];
+            }
+        }
+        live_memory[i] = live_bytes;
+        for(auto *object : node_objects)
+        {
+            if(last_use[object] == i)
+            {
+                live.erase(object);
+                live_bytes -= sizes[object];
+            }
+        }
+    }
+    return live_memory;
+}
 } // namespace graph
 } // namespace arm_compute
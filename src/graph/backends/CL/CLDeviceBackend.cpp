@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -184,6 +184,13 @@ std::unique_ptr<ITensorHandle> CLDeviceBackend::create_subtensor(ITensorHandle *
     return std::make_unique<CLSubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> CLDeviceBackend::create_alias(ITensorHandle *parent, const Tensor &tensor)
+{
+    ARM_COMPUTE_UNUSED(parent, tensor);
+    // OpenCL kernels may pad their tensors at configuration time, which would invalidate the alias
+    return nullptr;
+}
+
 std::unique_ptr<arm_compute::IFunction> CLDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CL node with ID : " << node.id() << std::endl);
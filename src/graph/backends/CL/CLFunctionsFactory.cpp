@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -249,7 +249,23 @@ std::unique_ptr<IFunction> CLFunctionFactory::create(INode *node, GraphContext &
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<CLChannelShuffleLayer, CLTargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
-            return detail::create_convolution_layer<CLConvolutionLayerFunctions, CLTargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            const bool is_default = conv_node->convolution_method() == ConvolutionMethod::Default;
+            auto       func       = detail::create_convolution_layer<CLConvolutionLayerFunctions, CLTargetInfo>(*conv_node, ctx);
+            if(is_default && conv_node->num_groups() == 1)
+            {
+                // Record the method picked by the heuristics so that graph plans reproduce it
+                const auto method = CLConvolutionLayer::get_convolution_method(detail::get_backing_tensor<CLTargetInfo>(conv_node->input(0))->info(),
+                                                                               detail::get_backing_tensor<CLTargetInfo>(conv_node->input(1))->info(),
+                                                                               detail::get_backing_tensor<CLTargetInfo>(conv_node->output(0))->info(),
+                                                                               conv_node->convolution_info(), WeightsInfo(), conv_node->fused_activation(),
+                                                                               CLScheduler::get().target(), Size2D(1U, 1U),
+                                                                               conv_node->fast_math_hint() == FastMathHint::Enabled);
+                detail::set_resolved_convolution_method(*conv_node, method);
+            }
+            return func;
+        }
         case NodeType::DeconvolutionLayer:
             return detail::create_deconvolution_layer<CLDeconvolutionLayer, CLTargetInfo>(*polymorphic_downcast<DeconvolutionLayerNode *>(node), ctx);
         case NodeType::ConcatenateLayer:
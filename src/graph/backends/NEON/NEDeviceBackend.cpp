@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,7 +28,9 @@
 #include "arm_compute/graph/INode.h"
 #include "arm_compute/graph/Logger.h"
 #include "arm_compute/graph/Tensor.h"
+#include "arm_compute/graph/WorkspaceLifetimeManager.h"
 #include "arm_compute/graph/backends/BackendRegistrar.h"
+#include "arm_compute/graph/backends/NEON/NEAliasTensorHandle.h"
 #include "arm_compute/graph/backends/NEON/NEFunctionFactory.h"
 #include "arm_compute/graph/backends/NEON/NENodeValidator.h"
 #include "arm_compute/graph/backends/NEON/NESubTensorHandle.h"
@@ -89,6 +91,13 @@ void NEDeviceBackend::setup_backend_context(GraphContext &ctx)
         mm_ctx.cross_group = std::make_shared<MemoryGroup>(mm_ctx.cross_mm);
         mm_ctx.allocator   = &_allocator;
 
+        // Place the auxiliary memory of the functions with the transition tensors
+        if(ctx.config().use_shared_workspace_memory)
+        {
+            mm_ctx.workspace_lm = std::make_shared<WorkspaceLifetimeManager>();
+            mm_ctx.intra_mm     = std::make_shared<MemoryManagerOnDemand>(mm_ctx.workspace_lm, std::make_shared<PoolManager>());
+        }
+
         ctx.insert_memory_management_ctx(std::move(mm_ctx));
     }
 
@@ -136,6 +145,26 @@ std::unique_ptr<ITensorHandle> NEDeviceBackend::create_subtensor(ITensorHandle *
     return std::make_unique<NESubTensorHandle>(parent, shape, coords, extend_parent);
 }
 
+std::unique_ptr<ITensorHandle> NEDeviceBackend::create_alias(ITensorHandle *parent, const Tensor &tensor)
+{
+    if(parent == nullptr)
+    {
+        return nullptr;
+    }
+
+    const TensorDescriptor &tensor_desc = tensor.desc();
+    ARM_COMPUTE_ERROR_ON(tensor_desc.target != Target::NEON);
+
+    TensorInfo info(tensor_desc.shape, 1, tensor_desc.data_type, tensor_desc.quant_info);
+    info.set_data_layout(tensor_desc.layout);
+    if(info.total_size() != parent->tensor().info()->total_size() || parent->tensor().info()->has_padding())
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<NEAliasTensorHandle>(parent, info);
+}
+
 std::unique_ptr<arm_compute::IFunction> NEDeviceBackend::configure_node(INode &node, GraphContext &ctx)
 {
     ARM_COMPUTE_LOG_GRAPH_VERBOSE("Configuring CPU node with ID : " << node.id() << std::endl);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -139,7 +139,22 @@ std::unique_ptr<IFunction> NEFunctionFactory::create(INode *node, GraphContext &
         case NodeType::ChannelShuffleLayer:
             return detail::create_channel_shuffle_layer<NEChannelShuffleLayer, NETargetInfo>(*polymorphic_downcast<ChannelShuffleLayerNode *>(node));
         case NodeType::ConvolutionLayer:
-            return detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*polymorphic_downcast<ConvolutionLayerNode *>(node), ctx);
+        {
+            auto *conv_node = polymorphic_downcast<ConvolutionLayerNode *>(node);
+            const bool is_default = conv_node->convolution_method() == ConvolutionMethod::Default;
+            auto       func       = detail::create_convolution_layer<NEConvolutionLayerFunctions, NETargetInfo>(*conv_node, ctx);
+            if(is_default && conv_node->num_groups() == 1)
+            {
+                // Record the method picked by the heuristics so that graph plans reproduce it
+                const auto method = NEConvolutionLayer::get_convolution_method(detail::get_backing_tensor<NETargetInfo>(conv_node->input(0))->info(),
+                                                                               detail::get_backing_tensor<NETargetInfo>(conv_node->input(1))->info(),
+                                                                               detail::get_backing_tensor<NETargetInfo>(conv_node->output(0))->info(),
+                                                                               conv_node->convolution_info(), WeightsInfo(), Size2D(1U, 1U),
+                                                                               conv_node->fused_activation(), conv_node->fast_math_hint() == FastMathHint::Enabled);
+                detail::set_resolved_convolution_method(*conv_node, method);
+            }
+            return func;
+        }
         case NodeType::DepthToSpaceLayer:
             return detail::create_depth_to_space_layer<NEDepthToSpaceLayer, NETargetInfo>(*polymorphic_downcast<DepthToSpaceLayerNode *>(node));
         case NodeType::DeconvolutionLayer:
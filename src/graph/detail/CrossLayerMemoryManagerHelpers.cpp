@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -30,6 +30,7 @@
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Types.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/WorkspaceLifetimeManager.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
 #include "arm_compute/core/ITensor.h"
@@ -55,6 +56,7 @@ struct TaskHandles
 {
     std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> input_handles  = {}; /**< Input handles to a task */
     std::vector<std::pair<ITensorHandle *, IMemoryGroup *>> output_handles = {}; /**< Output handles of a task */
+    std::pair<arm_compute::Tensor *, IMemoryGroup *>        workspace      = {}; /**< Workspace of the functions of a task */
 };
 
 /** Returns memory group depending on handle backend type
@@ -154,6 +156,13 @@ TaskHandles get_transition_handles(GraphContext                    &ctx,
         }
     }
 
+    // Add the workspace of the functions if they share the memory of the transition tensors
+    MemoryManagerContext *mm_ctx = ctx.memory_management_ctx(node.assigned_target());
+    if(mm_ctx != nullptr && mm_ctx->workspace_lm != nullptr && mm_ctx->cross_group != nullptr)
+    {
+        transition_handles.workspace = std::make_pair(mm_ctx->workspace_lm->create_workspace(node.id()), mm_ctx->cross_group.get());
+    }
+
     return transition_handles;
 }
 
@@ -214,6 +223,13 @@ void configure_handle_lifetime(std::vector<TaskHandles> &tasks_handles, const Ha
         acquire(task_handle.input_handles);
         acquire(task_handle.output_handles);
 
+        // The workspace is only alive while the task executes
+        if(task_handle.workspace.first != nullptr)
+        {
+            task_handle.workspace.second->manage(task_handle.workspace.first);
+            task_handle.workspace.first->allocator()->allocate();
+        }
+
         // Releasing the input tensors
         for(auto &input_handle : task_handle.input_handles)
         {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,7 @@
 #include "arm_compute/graph/GraphManager.h"
 #include "arm_compute/graph/Tensor.h"
 #include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/WorkspaceLifetimeManager.h"
 #include "arm_compute/graph/backends/BackendRegistry.h"
 
 namespace arm_compute
@@ -147,7 +148,12 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         {
             Target                     assigned_target = node->assigned_target();
             backends::IDeviceBackend &backend         = backends::BackendRegistry::get().get_backend(assigned_target);
-            std::unique_ptr<IFunction> func            = backend.configure_node(*node, ctx);
+            MemoryManagerContext      *mm_ctx          = ctx.memory_management_ctx(assigned_target);
+            if(mm_ctx != nullptr && mm_ctx->workspace_lm != nullptr)
+            {
+                mm_ctx->workspace_lm->set_active_node(node_id);
+            }
+            std::unique_ptr<IFunction> func = backend.configure_node(*node, ctx);
             if(func != nullptr || is_utility_node(node))
             {
                 workload.tasks.emplace_back(ExecutionTask(std::move(func), node));
@@ -155,6 +161,15 @@ ExecutionWorkload configure_all_nodes(Graph &g, GraphContext &ctx, const std::ve
         }
     }
 
+    // Auxiliary memory finalized from now on doesn't belong to a node
+    for(auto &mm_ctx : ctx.memory_managers())
+    {
+        if(mm_ctx.second.workspace_lm != nullptr)
+        {
+            mm_ctx.second.workspace_lm->set_active_node(EmptyNodeID);
+        }
+    }
+
     // Add inputs and outputs
     for(auto &node : g.nodes())
     {
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <set>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor filling a tensor with contents computed at finalize time
+ *
+ * The contents are released once they are loaded, as the tensor then holds them.
+ */
+class ConstantDataAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] data   Tensor elements stored contiguously
+     * @param[in] source Identifier of the data
+     */
+    ConstantDataAccessor(std::vector<uint8_t> data, std::string source)
+        : _data(std::move(data)), _source(std::move(source))
+    {
+    }
+    // Inherited methods overridden
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_data.empty())
+        {
+            return false;
+        }
+        copy_buffer_to_tensor(_data.data(), tensor);
+        std::vector<uint8_t>().swap(_data);
+        return true;
+    }
+    std::string source() const override
+    {
+        return _source;
+    }
+
+private:
+    std::vector<uint8_t> _data;
+    std::string          _source;
+};
+
+bool is_foldable(const INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::ActivationLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::EltwiseLayer:
+        case NodeType::FlattenLayer:
+        case NodeType::PermuteLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::ReshapeLayer:
+        case NodeType::UnaryEltwiseLayer:
+            break;
+        default:
+            return false;
+    }
+
+    // All the inputs must be constants that can be loaded and the output must not be accessed
+    if(node.num_outputs() != 1 || node.output(0) == nullptr || node.output(0)->accessor() != nullptr)
+    {
+        return false;
+    }
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        const Edge *edge = node.input_edge(i);
+        if(edge == nullptr || edge->producer() == nullptr || edge->producer()->type() != NodeType::Const || node.input(i)->accessor() == nullptr)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t tensor_bytes(const Tensor &tensor)
+{
+    return tensor.desc().shape.total_size() * element_size_from_data_type(tensor.desc().data_type);
+}
+
+/** Reads the contents of a tensor allocated on the Arm® Neon™ backend */
+std::vector<uint8_t> read_contents(Tensor &tensor)
+{
+    std::vector<uint8_t> data(tensor_bytes(tensor));
+    copy_tensor_to_buffer(tensor.handle()->tensor(), data.data());
+    return data;
+}
+
+/** Evaluates a node on the Arm® Neon™ backend
+ *
+ * Once the node is known to be supported, the accessors of the inputs are replaced by accessors holding the contents
+ * they loaded, so that the constants can still be used by other nodes. The accessors are left untouched otherwise.
+ *
+ * @param[in]  node   Node to evaluate
+ * @param[in]  ctx    Graph context to configure the function with
+ * @param[out] data   Contents of the output on success
+ * @param[out] source Identifier of the contents of the output on success, built from the ones of the inputs
+ *
+ * @return True if the node was evaluated else false
+ */
+bool evaluate_node(INode &node, GraphContext &ctx, std::vector<uint8_t> &data, std::string &source)
+{
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(Target::NEON);
+
+    std::vector<Tensor *> tensors;
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        if(std::find(tensors.begin(), tensors.end(), node.input(i)) == tensors.end())
+        {
+            tensors.push_back(node.input(i));
+        }
+    }
+    tensors.push_back(node.output(0));
+
+    // Temporarily place the node on the Arm® Neon™ backend
+    const Target        assigned_target = node.assigned_target();
+    std::vector<Target> tensor_targets;
+    node.set_assigned_target(Target::NEON);
+    for(auto *tensor : tensors)
+    {
+        tensor_targets.push_back(tensor->desc().target);
+        tensor->desc().target = Target::NEON;
+        tensor->set_handle(backend.create_tensor(*tensor));
+        tensor->handle()->allocate();
+    }
+
+    bool success = false;
+    if(bool(backend.validate_node(node)))
+    {
+        std::unique_ptr<IFunction> func = backend.configure_node(node, ctx);
+        if(func != nullptr)
+        {
+            // The result can only be identified if all the inputs can
+            bool is_source_known = true;
+            source               = "folded:" + std::to_string(static_cast<int>(node.type()));
+            for(size_t i = 0; i + 1 < tensors.size(); ++i)
+            {
+                const std::string input_source = tensors[i]->accessor()->source();
+                tensors[i]->call_accessor();
+                tensors[i]->set_accessor(std::make_unique<ConstantDataAccessor>(read_contents(*tensors[i]), input_source));
+                source += ":" + input_source;
+                is_source_known &= !input_source.empty();
+            }
+            if(!is_source_known)
+            {
+                source.clear();
+            }
+            func->run();
+            data    = read_contents(*node.output(0));
+            success = true;
+        }
+    }
+
+    // Restore the tensors
+    node.set_assigned_target(assigned_target);
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        tensors[i]->set_handle(nullptr);
+        tensors[i]->desc().target = tensor_targets[i];
+    }
+    return success;
+}
+} // namespace
+
+const char *ConstantFoldingMutator::name()
+{
+    return "ConstantFoldingMutator";
+}
+
+IGraphMutator::MutationType ConstantFoldingMutator::type() const
+{
+    return IGraphMutator::MutationType::IR;
+}
+
+void ConstantFoldingMutator::mutate(Graph &g)
+{
+    if(!is_target_supported(Target::NEON))
+    {
+        return;
+    }
+
+    // Functions get their own memory as no memory manager exists yet
+    GraphContext ctx;
+    GraphConfig  config;
+    config.use_function_memory_manager  = false;
+    config.use_function_weights_manager = false;
+    ctx.set_config(config);
+    setup_requested_backend_context(ctx, Target::NEON);
+
+    size_t           num_folded   = 0;
+    size_t           folded_bytes = 0;
+    std::set<NodeID> const_inputs;
+
+    // Nodes are visited in topological order so that chains of foldable nodes collapse
+    for(auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr || !is_foldable(*node))
+        {
+            continue;
+        }
+
+        std::vector<uint8_t> data;
+        std::string          source;
+        if(!evaluate_node(*node, ctx, data, source))
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding node with ID : " << node->id() << " and Name: " << node->name() << std::endl);
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const_inputs.insert(node->input_edge(i)->producer_id());
+        }
+
+        // Replace the node with a constant
+        const std::vector<NodeIdxPair> driving_nodes = get_driving_nodes(*node);
+        const TensorDescriptor         desc          = node->output(0)->desc();
+        NodeParams                     params        = node->common_node_params();
+        params.name += "_folded";
+
+        const NodeID const_id = g.add_node<ConstNode>(desc);
+        g.node(const_id)->set_common_node_parameters(params);
+        g.remove_node(node->id());
+        for(auto &driving_node : driving_nodes)
+        {
+            g.add_connection(const_id, 0, driving_node.node_id, driving_node.index);
+        }
+        g.node(const_id)->output(0)->set_accessor(std::make_unique<ConstantDataAccessor>(std::move(data), std::move(source)));
+
+        folded_bytes += tensor_bytes(*g.node(const_id)->output(0));
+        ++num_folded;
+    }
+
+    // Prune the constants that are not consumed anymore
+    size_t pruned_bytes = 0;
+    for(auto &node_id : const_inputs)
+    {
+        INode *node = g.node(node_id);
+        if(node != nullptr && node->output_edges().empty())
+        {
+            pruned_bytes += tensor_bytes(*node->output(0));
+            node->output(0)->extract_accessor();
+            g.remove_node(node_id);
+        }
+    }
+
+    if(num_folded != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Folded " << num_folded << " constant nodes: removed " << pruned_bytes << " bytes of constants and added " << folded_bytes << " bytes" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ConvolutionMethodSelectionMutator.h"
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/TypePrinter.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Builds the key identifying the configuration of a convolution node
+ *
+ * @param[in] node Convolution node
+ *
+ * @return The key of the configuration
+ */
+std::string convolution_key(const ConvolutionLayerNode &node)
+{
+    const Tensor             *input     = node.input(0);
+    const Tensor             *weights   = node.input(1);
+    const Tensor             *bias      = node.input(2);
+    const PadStrideInfo       conv_info = node.convolution_info();
+    const ActivationLayerInfo act       = node.fused_activation();
+
+    std::stringstream ss;
+    ss << node.assigned_target() << "," << input->desc().data_type << "," << input->desc().layout << ",";
+    for(size_t d = 0; d < input->desc().shape.num_dimensions(); ++d)
+    {
+        ss << input->desc().shape[d] << "x";
+    }
+    ss << ",";
+    for(size_t d = 0; d < weights->desc().shape.num_dimensions(); ++d)
+    {
+        ss << weights->desc().shape[d] << "x";
+    }
+    ss << "," << conv_info.stride().first << "," << conv_info.stride().second
+       << "," << conv_info.pad_left() << "," << conv_info.pad_right() << "," << conv_info.pad_top() << "," << conv_info.pad_bottom()
+       << "," << node.num_groups() << "," << (bias != nullptr) << "," << (act.enabled() ? static_cast<int>(act.activation()) : -1)
+       << "," << node.fast_math_hint() << "," << Scheduler::get().num_threads();
+    return ss.str();
+}
+
+/** Scratch allocation of the tensors of a node being measured */
+class ScratchTensors
+{
+public:
+    /** Allocates the tensors of a node that are not allocated yet
+     *
+     * @param[in] node Node to allocate the tensors of
+     *
+     * @return True if all the tensors could be allocated
+     */
+    bool allocate(INode &node)
+    {
+        std::vector<Tensor *> tensors;
+        for(size_t i = 0; i < node.num_inputs(); ++i)
+        {
+            tensors.push_back(node.input(i));
+        }
+        for(size_t i = 0; i < node.num_outputs(); ++i)
+        {
+            tensors.push_back(node.output(i));
+        }
+
+        for(auto *tensor : tensors)
+        {
+            if(tensor == nullptr)
+            {
+                continue;
+            }
+            ITensorHandle *handle = tensor->handle();
+            if(handle == nullptr || handle->is_subtensor())
+            {
+                return false;
+            }
+            if(handle->tensor().info()->is_resizable() && std::find(_handles.begin(), _handles.end(), handle) == _handles.end())
+            {
+                _handles.push_back(handle);
+            }
+        }
+
+        for(auto *handle : _handles)
+        {
+            handle->allocate();
+            handle->map(true);
+            std::memset(handle->tensor().buffer(), 0, handle->tensor().info()->total_size());
+            handle->unmap();
+        }
+        return true;
+    }
+    /** Releases the scratch memory and restores the state of the tensors */
+    ~ScratchTensors()
+    {
+        for(auto *handle : _handles)
+        {
+            handle->tensor().mark_as_used();
+            handle->free();
+        }
+    }
+
+private:
+    std::vector<ITensorHandle *> _handles{};
+};
+
+/** Measures the execution time of a convolution node with a given method
+ *
+ * @param[in] node       Convolution node to measure
+ * @param[in] method     Method to measure
+ * @param[in] iterations Number of timed runs
+ * @param[in] bench_ctx  Graph context to configure the function with
+ *
+ * @return The best time of the timed runs in microseconds, the maximum value if the method cannot be used
+ */
+double measure_method(ConvolutionLayerNode &node, ConvolutionMethod method, unsigned int iterations, GraphContext &bench_ctx)
+{
+    constexpr double invalid = std::numeric_limits<double>::max();
+
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node.assigned_target());
+    node.set_convolution_method(method);
+    if(!bool(backend.validate_node(node)))
+    {
+        return invalid;
+    }
+
+    ScratchTensors scratch;
+    if(!scratch.allocate(node))
+    {
+        return invalid;
+    }
+
+    std::unique_ptr<IFunction> func = backend.configure_node(node, bench_ctx);
+    if(func == nullptr)
+    {
+        return invalid;
+    }
+
+    // The first run includes the one-off preparation
+    func->run();
+    backend.sync();
+
+    double best = invalid;
+    for(unsigned int i = 0; i < iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        func->run();
+        backend.sync();
+        const auto end = std::chrono::steady_clock::now();
+        best           = std::min(best, std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    return best;
+}
+} // namespace
+
+ConvolutionMethodSelectionMutator::ConvolutionMethodSelectionMutator(std::string decisions_file, unsigned int iterations)
+    : _decisions_file(std::move(decisions_file)), _iterations(std::max(iterations, 1u)), _decisions()
+{
+}
+
+const char *ConvolutionMethodSelectionMutator::name()
+{
+    return "ConvolutionMethodSelectionMutator";
+}
+
+IGraphMutator::MutationType ConvolutionMethodSelectionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ConvolutionMethodSelectionMutator::mutate(Graph &g)
+{
+    // Load the decisions of previous runs
+    if(!_decisions_file.empty())
+    {
+        std::ifstream fs(_decisions_file);
+        std::string   line;
+        while(std::getline(fs, line))
+        {
+            const size_t pos = line.rfind(';');
+            int          method{ -1 };
+            if(pos != std::string::npos && (std::stringstream(line.substr(pos + 1)) >> method) && method >= 0 && method <= static_cast<int>(ConvolutionMethod::Winograd))
+            {
+                _decisions[line.substr(0, pos)] = static_cast<ConvolutionMethod>(method);
+            }
+        }
+    }
+
+    // Measured functions get their own memory so that they don't depend on the graph's memory managers
+    GraphContext bench_ctx;
+    GraphConfig  bench_config;
+    bench_config.use_function_memory_manager  = false;
+    bench_config.use_function_weights_manager = false;
+    bench_ctx.set_config(bench_config);
+    setup_requested_backend_context(bench_ctx, Target::NEON);
+
+    const std::vector<ConvolutionMethod> candidates{ ConvolutionMethod::Default, ConvolutionMethod::GEMM, ConvolutionMethod::Direct, ConvolutionMethod::Winograd };
+
+    bool new_decisions = false;
+    for(auto &node_id : g.nodes(NodeType::ConvolutionLayer))
+    {
+        auto *node = arm_compute::utils::cast::polymorphic_downcast<ConvolutionLayerNode *>(g.node(node_id));
+        if(node == nullptr || node->assigned_target() != Target::NEON)
+        {
+            continue;
+        }
+
+        const ConvolutionMethod requested = node->convolution_method();
+        const std::string       key       = convolution_key(*node);
+        const auto              it        = _decisions.find(key);
+        if(it != _decisions.end())
+        {
+            node->set_convolution_method(it->second);
+            backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(node->assigned_target());
+            if(!bool(backend.validate_node(*node)))
+            {
+                node->set_convolution_method(requested);
+            }
+            continue;
+        }
+
+        ConvolutionMethod best_method = requested;
+        double            best_time   = std::numeric_limits<double>::max();
+        for(const auto method : candidates)
+        {
+            const double time = measure_method(*node, method, _iterations, bench_ctx);
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Node " << node->name() << " with " << method << " convolution: " << time << "us" << std::endl);
+            if(time < best_time)
+            {
+                best_time   = time;
+                best_method = method;
+            }
+        }
+
+        node->set_convolution_method(best_method);
+        if(best_time != std::numeric_limits<double>::max())
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Selected " << best_method << " convolution for node with ID : " << node->id() << " and Name: " << node->name() << std::endl);
+            _decisions[key] = best_method;
+            new_decisions   = true;
+        }
+    }
+
+    // Store the decisions for later runs
+    if(new_decisions && !_decisions_file.empty())
+    {
+        std::ofstream fs(_decisions_file, std::ios::out | std::ios::trunc);
+        for(const auto &decision : _decisions)
+        {
+            fs << decision.first << ";" << static_cast<int>(decision.second) << std::endl;
+        }
+        if(!fs.good())
+        {
+            ARM_COMPUTE_LOG_GRAPH_WARNING("Could not store the convolution methods to " << _decisions_file << std::endl);
+        }
+    }
+}
+} // namespace graph
+} // namespace arm_compute
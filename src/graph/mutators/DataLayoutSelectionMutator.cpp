@@ -0,0 +1,617 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/DataLayoutSelectionMutator.h"
+
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include "support/Cast.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Accessor loading a constant in its original layout and permuting it into the tensor */
+class PermutingAccessor final : public ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] accessor Accessor loading the constant in its original layout
+     * @param[in] desc     Descriptor of the constant in its original layout
+     * @param[in] perm     Permutation from the original layout to the layout of the tensor
+     */
+    PermutingAccessor(std::unique_ptr<ITensorAccessor> accessor, TensorDescriptor desc, PermutationVector perm)
+        : _accessor(std::move(accessor)), _desc(std::move(desc)), _perm(perm)
+    {
+    }
+    // Inherited methods overridden
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(!_accessor->access_tensor_data())
+        {
+            return _accessor->access_tensor(tensor);
+        }
+
+        TensorInfo info(_desc.shape, 1, _desc.data_type, _desc.quant_info);
+        info.set_data_layout(_desc.layout);
+        arm_compute::Tensor src;
+        src.allocator()->init(info);
+        src.allocator()->allocate();
+        if(!_accessor->access_tensor(src))
+        {
+            return false;
+        }
+
+        const size_t element_size = info.element_size();
+        Window       win;
+        win.use_tensor_dimensions(info.tensor_shape());
+        execute_window_loop(win, [&](const Coordinates & id)
+        {
+            Coordinates dst_id = id;
+            for(unsigned int i = 0; i < _perm.num_dimensions(); ++i)
+            {
+                dst_id.set(i, id[_perm[i]]);
+            }
+            std::memcpy(tensor.ptr_to_element(dst_id), src.ptr_to_element(id), element_size);
+        });
+        return true;
+    }
+
+private:
+    std::unique_ptr<ITensorAccessor> _accessor;
+    TensorDescriptor                 _desc;
+    PermutationVector                _perm;
+};
+
+/** Nodes that can be executed in either data layout */
+enum class LayoutRole
+{
+    Fixed,    /**< The node has to keep its layout */
+    Agnostic, /**< The node performs the same in both layouts */
+    Sensitive /**< The node performs better in the preferred layout */
+};
+
+LayoutRole layout_role(const INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+        case NodeType::PoolingLayer:
+            return LayoutRole::Sensitive;
+        case NodeType::ActivationLayer:
+        case NodeType::BatchNormalizationLayer:
+        case NodeType::ConcatenateLayer:
+        case NodeType::DequantizationLayer:
+        case NodeType::NormalizationLayer:
+        case NodeType::QuantizationLayer:
+        case NodeType::ResizeLayer:
+        case NodeType::UnaryEltwiseLayer:
+            return LayoutRole::Agnostic;
+        case NodeType::EltwiseLayer:
+            // Broadcasting depends on the order of the dimensions
+            return (node.input(0) != nullptr && node.input(1) != nullptr && node.input(0)->desc().shape == node.input(1)->desc().shape) ? LayoutRole::Agnostic : LayoutRole::Fixed;
+        default:
+            return LayoutRole::Fixed;
+    }
+}
+
+/** Checks if an input of a node is a per-channel parameter, which has the same contents in both layouts */
+bool is_parameter_input(const INode &node, size_t idx)
+{
+    switch(node.type())
+    {
+        case NodeType::ConvolutionLayer:
+        case NodeType::DepthwiseConvolutionLayer:
+        case NodeType::FusedConvolutionBatchNormalizationLayer:
+        case NodeType::FusedDepthwiseConvolutionBatchNormalizationLayer:
+            return idx >= 2;
+        case NodeType::BatchNormalizationLayer:
+            return idx >= 1;
+        default:
+            return false;
+    }
+}
+
+bool is_candidate(const INode &node)
+{
+    if(layout_role(node) == LayoutRole::Fixed || node.num_outputs() != 1 || node.output(0) == nullptr)
+    {
+        return false;
+    }
+
+    const DataLayout layout = node.output(0)->desc().layout;
+    if(layout != DataLayout::NCHW && layout != DataLayout::NHWC)
+    {
+        return false;
+    }
+    for(size_t i = 0; i < node.num_inputs(); ++i)
+    {
+        if(is_parameter_input(node, i))
+        {
+            continue;
+        }
+        if(node.input(i) == nullptr || node.input(i)->desc().layout != layout)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t tensor_bytes(const Tensor &tensor)
+{
+    return tensor.desc().shape.total_size() * element_size_from_data_type(tensor.desc().data_type);
+}
+
+NodeID find_root(std::map<NodeID, NodeID> &parents, NodeID nid)
+{
+    while(parents[nid] != nid)
+    {
+        parents[nid] = parents[parents[nid]];
+        nid          = parents[nid];
+    }
+    return nid;
+}
+
+/** Set of connected nodes sharing a data layout */
+struct Region
+{
+    std::vector<NodeID> nodes{};   /**< Nodes of the region in topological order */
+    std::set<NodeID>    members{}; /**< Nodes of the region */
+    DataLayout          layout{};  /**< Current data layout of the region */
+};
+
+std::vector<Region> find_regions(Graph &g)
+{
+    std::map<NodeID, NodeID> parents;
+    const std::vector<NodeID> order = dfs(g);
+
+    // Checks if the node feeding an edge belongs to a region the consumer can be added to
+    const auto joins_producer = [&](const INode & node, const Edge * edge)
+    {
+        if(edge == nullptr || parents.count(edge->producer_id()) == 0)
+        {
+            return false;
+        }
+        const INode *producer = edge->producer();
+        return producer->assigned_target() == node.assigned_target() && producer->output(0)->desc().layout == node.output(0)->desc().layout;
+    };
+
+    for(auto &nid : order)
+    {
+        const INode *node = g.node(nid);
+        if(node == nullptr || !is_candidate(*node))
+        {
+            continue;
+        }
+
+        // In-place nodes write to the tensor of their first input: they can only change layout along with its producer
+        if(node->num_inputs() != 0 && node->input(0) == node->output(0) && !joins_producer(*node, node->input_edge(0)))
+        {
+            continue;
+        }
+
+        parents[nid] = nid;
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if(!is_parameter_input(*node, i) && joins_producer(*node, edge))
+            {
+                parents[find_root(parents, nid)] = find_root(parents, edge->producer_id());
+            }
+        }
+    }
+
+    std::map<NodeID, Region> regions;
+    for(auto &nid : order)
+    {
+        if(parents.count(nid) != 0)
+        {
+            Region &region = regions[find_root(parents, nid)];
+            region.nodes.push_back(nid);
+            region.members.insert(nid);
+            region.layout = g.node(nid)->output(0)->desc().layout;
+        }
+    }
+
+    std::vector<Region> result;
+    for(auto &region : regions)
+    {
+        result.push_back(std::move(region.second));
+    }
+    return result;
+}
+
+/** Checks if a constant is consumed by the nodes of a region only, in which case a permutation of it can be folded */
+bool is_region_constant(const INode &producer, const Region &region)
+{
+    if(producer.type() != NodeType::Const)
+    {
+        return false;
+    }
+    const Graph *g = producer.graph();
+    for(auto &eid : producer.output_edges())
+    {
+        if(region.members.count(g->edge(eid)->consumer_id()) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Estimates the cost in bytes moved of executing a region in a given layout
+ *
+ * A sensitive node executed in the layout it doesn't prefer is accounted as a permutation of its input and output,
+ * a permutation at the boundary of the region as reading and writing the boundary tensor.
+ */
+size_t estimate_cost(Graph &g, const Region &region, DataLayout layout, DataLayout preferred)
+{
+    size_t cost = 0;
+    for(auto &nid : region.nodes)
+    {
+        const INode *node = g.node(nid);
+        if(layout_role(*node) == LayoutRole::Sensitive && layout != preferred)
+        {
+            cost += 2 * (tensor_bytes(*node->input(0)) + tensor_bytes(*node->output(0)));
+        }
+    }
+    if(layout == region.layout)
+    {
+        return cost;
+    }
+
+    std::set<TensorID> boundary_inputs;
+    for(auto &nid : region.nodes)
+    {
+        const INode *node = g.node(nid);
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if(is_parameter_input(*node, i) || region.members.count(edge->producer_id()) != 0 || !boundary_inputs.insert(edge->tensor_id()).second)
+            {
+                continue;
+            }
+            if(!is_region_constant(*edge->producer(), region))
+            {
+                cost += 2 * tensor_bytes(*edge->tensor());
+            }
+        }
+
+        const std::vector<NodeIdxPair> consumers = get_driving_nodes(*node);
+        const bool                     external  = std::any_of(consumers.begin(), consumers.end(), [&](const NodeIdxPair & consumer)
+        {
+            return region.members.count(consumer.node_id) == 0;
+        });
+        if(external || node->output(0)->accessor() != nullptr)
+        {
+            cost += 2 * tensor_bytes(*node->output(0));
+        }
+    }
+    return cost;
+}
+
+PermutationVector permutation_to(DataLayout layout)
+{
+    return (layout == DataLayout::NHWC) ? PermutationVector(2U, 0U, 1U) : PermutationVector(1U, 2U, 0U);
+}
+
+NodeID add_permute_node(Graph &g, const INode &node, DataLayout layout, const std::string &suffix)
+{
+    const NodeID permute_id = g.add_node<PermuteLayerNode>(permutation_to(layout), layout);
+    INode       *permute    = g.node(permute_id);
+    permute->set_common_node_parameters(NodeParams{ node.name() + suffix, node.assigned_target() });
+    permute->set_assigned_target(node.assigned_target());
+    return permute_id;
+}
+
+/** Changes the layout of a region, permuting its inputs and outputs
+ *
+ * @param[in, out] g       Graph to update
+ * @param[in]      region  Region to change the layout of
+ * @param[in]      layout  New data layout of the region
+ * @param[out]     updated Tensors whose descriptor changed
+ *
+ * @return The number of permute nodes inserted
+ */
+size_t change_region_layout(Graph &g, const Region &region, DataLayout layout, std::vector<Tensor *> &updated)
+{
+    size_t                     num_permutes = 0;
+    std::map<TensorID, NodeID> permuted_inputs;
+
+    // Permute the inputs coming from outside of the region, the descriptors are forwarded in topological order
+    for(auto &nid : region.nodes)
+    {
+        INode *node = g.node(nid);
+
+        std::vector<std::pair<size_t, const Edge *>> boundary_edges;
+        for(size_t i = 0; i < node->num_inputs(); ++i)
+        {
+            const Edge *edge = node->input_edge(i);
+            if(!is_parameter_input(*node, i) && region.members.count(edge->producer_id()) == 0)
+            {
+                boundary_edges.emplace_back(i, edge);
+            }
+        }
+
+        // Disconnect all the boundary inputs first so that the node never sees inputs in different layouts
+        std::vector<std::pair<size_t, NodeIdxPair>> producers;
+        std::vector<TensorID>                       tensor_ids;
+        for(auto &boundary_edge : boundary_edges)
+        {
+            producers.emplace_back(boundary_edge.first, NodeIdxPair{ boundary_edge.second->producer_id(), boundary_edge.second->producer_idx() });
+            tensor_ids.push_back(boundary_edge.second->tensor_id());
+            g.remove_connection(boundary_edge.second->id());
+        }
+        for(size_t i = 0; i < producers.size(); ++i)
+        {
+            auto it = permuted_inputs.find(tensor_ids[i]);
+            if(it == permuted_inputs.end())
+            {
+                const NodeID permute_id = add_permute_node(g, *node, layout, "_input_permute");
+                g.add_connection(producers[i].second.node_id, producers[i].second.index, permute_id, 0);
+                updated.push_back(g.node(permute_id)->output(0));
+                it = permuted_inputs.emplace(tensor_ids[i], permute_id).first;
+                ++num_permutes;
+            }
+            g.add_connection(it->second, 0, nid, producers[i].first);
+        }
+
+        if(node->type() == NodeType::PoolingLayer)
+        {
+            arm_compute::utils::cast::polymorphic_downcast<PoolingLayerNode *>(node)->set_data_layout(layout);
+        }
+        node->forward_descriptors();
+        updated.push_back(node->output(0));
+    }
+
+    // Permute back the outputs consumed outside of the region
+    for(auto &nid : region.nodes)
+    {
+        INode                   *node = g.node(nid);
+        std::vector<NodeIdxPair> consumers;
+        std::vector<EdgeID>      edges;
+        for(auto &eid : node->output_edges())
+        {
+            const Edge *edge = g.edge(eid);
+            if(region.members.count(edge->consumer_id()) == 0)
+            {
+                consumers.push_back({ edge->consumer_id(), edge->consumer_idx() });
+                edges.push_back(eid);
+            }
+        }
+        Tensor *output = node->output(0);
+        if(consumers.empty() && output->accessor() == nullptr)
+        {
+            continue;
+        }
+
+        const NodeID permute_id = add_permute_node(g, *node, region.layout, "_output_permute");
+        g.add_connection(nid, 0, permute_id, 0);
+        for(size_t i = 0; i < consumers.size(); ++i)
+        {
+            g.remove_connection(edges[i]);
+            g.add_connection(permute_id, 0, consumers[i].node_id, consumers[i].index);
+        }
+        Tensor *permuted_output = g.node(permute_id)->output(0);
+        if(output->accessor() != nullptr)
+        {
+            permuted_output->set_accessor(output->extract_accessor());
+        }
+        updated.push_back(permuted_output);
+        ++num_permutes;
+    }
+    return num_permutes;
+}
+
+size_t permutation_at(const PermutationVector &perm, size_t idx)
+{
+    return (idx < perm.num_dimensions()) ? perm[idx] : idx;
+}
+
+/** Removes the pairs of adjacent permute nodes that cancel each other out
+ *
+ * @param[in, out] g Graph to update
+ *
+ * @return The number of pairs removed
+ */
+size_t remove_inverse_permutes(Graph &g)
+{
+    size_t                    num_removed = 0;
+    const std::vector<NodeID> permutes    = g.nodes(NodeType::PermuteLayer);
+    for(auto &nid : permutes)
+    {
+        auto *second = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(g.node(nid));
+        if(second == nullptr || second->input_edge(0) == nullptr || second->input_edge(0)->producer()->type() != NodeType::PermuteLayer)
+        {
+            continue;
+        }
+        auto       *first       = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(second->input_edge(0)->producer());
+        const Edge *source_edge = first->input_edge(0);
+        if(source_edge == nullptr || first->output_edges().size() != 1 || first->output(0)->accessor() != nullptr)
+        {
+            continue;
+        }
+
+        Tensor *source = first->input(0);
+        Tensor *result = second->output(0);
+        if(source->desc().layout != result->desc().layout || (source->accessor() != nullptr && result->accessor() != nullptr))
+        {
+            continue;
+        }
+        const PermutationVector &first_perm  = first->permutation_vector();
+        const PermutationVector &second_perm = second->permutation_vector();
+        bool                     identity    = true;
+        for(size_t i = 0; i < std::max(first_perm.num_dimensions(), second_perm.num_dimensions()); ++i)
+        {
+            identity = identity && (permutation_at(first_perm, permutation_at(second_perm, i)) == i);
+        }
+        if(!identity)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Removing inverse permute nodes with ID : " << first->id() << " and " << second->id() << std::endl);
+        const NodeIdxPair              producer  = { source_edge->producer_id(), source_edge->producer_idx() };
+        const std::vector<NodeIdxPair> consumers = get_driving_nodes(*second);
+        std::unique_ptr<ITensorAccessor> accessor = result->extract_accessor();
+        first->output(0)->set_handle(nullptr);
+        result->set_handle(nullptr);
+        g.remove_node(second->id());
+        g.remove_node(first->id());
+        for(auto &consumer : consumers)
+        {
+            g.add_connection(producer.node_id, producer.index, consumer.node_id, consumer.index);
+        }
+        if(accessor != nullptr)
+        {
+            source->set_accessor(std::move(accessor));
+        }
+        ++num_removed;
+    }
+    return num_removed;
+}
+
+/** Folds the permute nodes consuming a constant into the constant
+ *
+ * @param[in, out] g       Graph to update
+ * @param[out]     updated Tensors whose descriptor changed
+ *
+ * @return The number of permute nodes folded
+ */
+size_t fold_constant_permutes(Graph &g, std::vector<Tensor *> &updated)
+{
+    size_t                    num_folded = 0;
+    const std::vector<NodeID> permutes   = g.nodes(NodeType::PermuteLayer);
+    for(auto &nid : permutes)
+    {
+        auto *permute = arm_compute::utils::cast::polymorphic_downcast<PermuteLayerNode *>(g.node(nid));
+        if(permute == nullptr || permute->input_edge(0) == nullptr || permute->output(0)->accessor() != nullptr)
+        {
+            continue;
+        }
+        const INode *constant = permute->input_edge(0)->producer();
+        if(constant->type() != NodeType::Const || constant->output_edges().size() != 1)
+        {
+            continue;
+        }
+
+        ARM_COMPUTE_LOG_GRAPH_VERBOSE("Folding permute node with ID : " << nid << " into constant node with ID : " << constant->id() << std::endl);
+        const NodeID                     constant_id = constant->id();
+        const NodeParams                 params      = constant->common_node_params();
+        const Target                     target      = constant->assigned_target();
+        const TensorDescriptor           desc        = permute->output(0)->desc();
+        const std::vector<NodeIdxPair>   consumers   = get_driving_nodes(*permute);
+        std::unique_ptr<ITensorAccessor> accessor    = permute->input(0)->extract_accessor();
+        if(accessor != nullptr)
+        {
+            accessor = std::make_unique<PermutingAccessor>(std::move(accessor), permute->input(0)->desc(), permute->permutation_vector());
+        }
+        permute->input(0)->set_handle(nullptr);
+        permute->output(0)->set_handle(nullptr);
+        g.remove_node(nid);
+        g.remove_node(constant_id);
+
+        const NodeID const_id = g.add_node<ConstNode>(desc);
+        g.node(const_id)->set_common_node_parameters(params);
+        g.node(const_id)->set_assigned_target(target);
+        for(auto &consumer : consumers)
+        {
+            g.add_connection(const_id, 0, consumer.node_id, consumer.index);
+        }
+        g.node(const_id)->output(0)->set_accessor(std::move(accessor));
+        updated.push_back(g.node(const_id)->output(0));
+        ++num_folded;
+    }
+    return num_folded;
+}
+} // namespace
+
+const char *DataLayoutSelectionMutator::name()
+{
+    return "DataLayoutSelectionMutator";
+}
+
+IGraphMutator::MutationType DataLayoutSelectionMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void DataLayoutSelectionMutator::mutate(Graph &g)
+{
+    // The convolution and pooling kernels of both the Arm® Neon™ and OpenCL backends perform best in NHWC
+    const DataLayout preferred = DataLayout::NHWC;
+
+    std::vector<Tensor *> updated;
+    size_t                num_regions  = 0;
+    size_t                num_permutes = 0;
+    for(auto &region : find_regions(g))
+    {
+        const DataLayout other = (region.layout == DataLayout::NHWC) ? DataLayout::NCHW : DataLayout::NHWC;
+        if(estimate_cost(g, region, other, preferred) < estimate_cost(g, region, region.layout, preferred))
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Changing the layout of " << region.nodes.size() << " nodes starting at node with ID : " << region.nodes.front() << " to " << other << std::endl);
+            num_permutes += change_region_layout(g, region, other, updated);
+            ++num_regions;
+        }
+    }
+    if(num_regions == 0)
+    {
+        return;
+    }
+
+    const size_t num_removed = remove_inverse_permutes(g);
+    const size_t num_folded  = fold_constant_permutes(g, updated);
+
+    // Create the backend handles of the tensors whose descriptor changed
+    for(auto *tensor : updated)
+    {
+        tensor->set_handle(nullptr);
+        configure_tensor(tensor);
+    }
+
+    ARM_COMPUTE_UNUSED(num_removed, num_folded);
+    ARM_COMPUTE_LOG_GRAPH_INFO("Changed the data layout of " << num_regions << " regions: inserted " << num_permutes << " permute nodes, removed "
+                               << 2 * num_removed << " inverse permute nodes and folded " << num_folded << " into constants" << std::endl);
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -67,9 +67,17 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
             // Get output tensor
             auto output_tensor = node->output(0);
 
+            if(output_tensor == nullptr)
+            {
+                continue;
+            }
+
             // Check concatenation axis (Sub-tensor optimization is supported for concatenation axis >=2)
-            auto *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
-            if(output_tensor == nullptr || get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis()) < 2)
+            // Sub-tensors along a lower axis would have gaps between their rows, which the kernels that squash their
+            // execution window from their sources don't account for.
+            auto        *concat_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
+            const size_t axis        = get_dimension_idx(output_tensor->desc().layout, concat_node->concatenation_axis());
+            if(axis < 2)
             {
                 continue;
             }
@@ -88,17 +96,20 @@ void DepthConcatSubTensorMutator::mutate(Graph &g)
                 ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using sub-tensors for the node with ID : "
                                               << node->id() << " and name : " << node->name() << std::endl);
                 // Create sub-tensor handles
-                unsigned depth = 0;
+                unsigned offset = 0;
                 for(unsigned int i = 0; i < node->input_edges().size(); ++i)
                 {
                     auto       input_tensor = node->input(i);
                     const auto input_shape  = input_tensor->desc().shape;
 
+                    Coordinates coords;
+                    coords.set(axis, offset);
+
                     backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(input_tensor->desc().target);
-                    std::unique_ptr<ITensorHandle> handle  = backend.create_subtensor(output_tensor->handle(), input_shape, Coordinates(0, 0, depth), false);
+                    std::unique_ptr<ITensorHandle> handle  = backend.create_subtensor(output_tensor->handle(), input_shape, coords, false);
                     input_tensor->set_handle(std::move(handle));
 
-                    depth += input_shape.z();
+                    offset += input_shape[axis];
                 }
 
                 auto *dc_node = arm_compute::utils::cast::polymorphic_downcast<ConcatenateLayerNode *>(node);
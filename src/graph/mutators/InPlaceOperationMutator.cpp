@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,8 +27,11 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/graph/Graph.h"
 #include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
 #include "arm_compute/graph/nodes/DepthwiseConvolutionLayerNode.h"
 #include "arm_compute/graph/nodes/FusedDepthwiseConvolutionBatchNormalizationNode.h"
+#include "arm_compute/graph/nodes/PadLayerNode.h"
 #include "support/Cast.h"
 
 using namespace arm_compute::utils::cast;
@@ -199,11 +202,149 @@ void try_in_place_elementwise(std::unique_ptr<INode> &node)
         ARM_COMPUTE_LOG_GRAPH_VERBOSE("Prevented in-place operation as there is an accessor bound to the input tensor or the quantization info are different.\n");
     }
 }
+
+// Check if other backend handles are views of the memory of a handle
+bool is_aliased(Graph &g, ITensorHandle *handle)
+{
+    return std::any_of(g.tensors().begin(), g.tensors().end(), [&](const std::unique_ptr<Tensor> &tensor)
+    {
+        return (tensor != nullptr) && (tensor->handle() != nullptr) && (tensor->handle() != handle) && tensor->handle()->is_subtensor()
+               && (tensor->handle()->parent_handle() == handle);
+    });
+}
+
+// Check if the input and the output of a node can share their memory through their backend handles
+bool can_alias_handles(Graph &g, INode &node)
+{
+    Tensor *input  = node.input(0);
+    Tensor *output = node.output(0);
+    if(input == nullptr || output == nullptr || input->handle() == nullptr || output->handle() == nullptr)
+    {
+        return false;
+    }
+
+    // Only the Arm® Neon™ kernels are aliasing safe
+    if(node.assigned_target() != Target::NEON || input->desc().target != Target::NEON || output->desc().target != Target::NEON)
+    {
+        return false;
+    }
+
+    // The input must not be loaded by an accessor, read by other nodes or be a view of another tensor
+    return (input->accessor() == nullptr) && is_only_consumer(g, *input, node) && !input->handle()->is_subtensor() && !is_aliased(g, input->handle())
+           && !output->handle()->is_subtensor();
+}
+
+// Try to make the output of a quantization or dequantization node an alias of its input
+bool try_alias_quantization(Graph &g, INode &node)
+{
+    Tensor *input  = node.input(0);
+    Tensor *output = node.output(0);
+
+    // Elements have to be converted in place and views of the output would keep pointing to its current handle
+    if(element_size_from_data_type(input->desc().data_type) != element_size_from_data_type(output->desc().data_type) || is_aliased(g, output->handle()))
+    {
+        return false;
+    }
+
+    backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(Target::NEON);
+    std::unique_ptr<ITensorHandle> handle  = backend.create_alias(input->handle(), *output);
+    if(handle == nullptr)
+    {
+        return false;
+    }
+    output->set_handle(std::move(handle));
+    return true;
+}
+
+// Try to make the input of a pad node a sub-tensor of the interior of its output
+bool try_pad_into_border(INode &node)
+{
+    const PaddingList &padding = polymorphic_downcast<PadLayerNode *>(&node)->padding();
+    Tensor            *input   = node.input(0);
+    Tensor            *output  = node.output(0);
+
+    // Some padding has to be applied, and the input has to stay contiguous in the output, as the kernels squashing their
+    // execution window from their sources would otherwise write over the border. Only the outermost non-unit dimension
+    // of the input and the dimensions above it can therefore be padded.
+    const size_t outer_dim = input->desc().shape.num_dimensions() - 1;
+    bool         is_padded = false;
+    for(size_t d = 0; d < padding.size(); ++d)
+    {
+        const bool is_dim_padded = padding[d].first != 0 || padding[d].second != 0;
+        if(is_dim_padded && d < outer_dim)
+        {
+            return false;
+        }
+        is_padded |= is_dim_padded;
+    }
+    if(!is_padded || input->desc().data_type != output->desc().data_type || input->desc().quant_info != output->desc().quant_info
+       || input->desc().layout != output->desc().layout)
+    {
+        return false;
+    }
+
+    Coordinates coords;
+    for(size_t d = 0; d < padding.size(); ++d)
+    {
+        coords.set(d, padding[d].first);
+    }
+
+    backends::IDeviceBackend      &backend = backends::BackendRegistry::get().get_backend(Target::NEON);
+    std::unique_ptr<ITensorHandle> handle  = backend.create_subtensor(output->handle(), input->desc().shape, coords, false);
+    if(handle == nullptr)
+    {
+        return false;
+    }
+    input->set_handle(std::move(handle));
+    return true;
+}
+
+// Alias the backend handles of the nodes whose input and output have different descriptors
+void alias_handles(Graph &g)
+{
+    if(!is_target_supported(Target::NEON))
+    {
+        return;
+    }
+
+    for(auto &node : g.nodes())
+    {
+        if(node == nullptr || !can_alias_handles(g, *node))
+        {
+            continue;
+        }
+
+        bool aliased = false;
+        switch(node->type())
+        {
+            case NodeType::DequantizationLayer:
+            case NodeType::QuantizationLayer:
+                aliased = try_alias_quantization(g, *node);
+                break;
+            case NodeType::PadLayer:
+                aliased = try_pad_into_border(*node);
+                break;
+            default:
+                break;
+        }
+
+        if(aliased)
+        {
+            ARM_COMPUTE_LOG_GRAPH_INFO("Switching to in-place computation for the node with ID : "
+                                       << node->id() << " and name : " << node->name() << std::endl);
+        }
+    }
+}
 } // namespace
 
+InPlaceOperationMutator::InPlaceOperationMutator(bool alias_handles)
+    : _alias_handles(alias_handles)
+{
+}
+
 const char *InPlaceOperationMutator::name()
 {
-    return "InPlaceOperationMutator";
+    return _alias_handles ? "InPlaceOperationMutator (handle aliasing)" : "InPlaceOperationMutator";
 }
 
 IGraphMutator::MutationType InPlaceOperationMutator::type() const
@@ -213,6 +354,12 @@ IGraphMutator::MutationType InPlaceOperationMutator::type() const
 
 void InPlaceOperationMutator::mutate(Graph &g)
 {
+    if(_alias_handles)
+    {
+        alias_handles(g);
+        return;
+    }
+
     std::set<NodeType> in_place_nodes =
     {
         NodeType::ActivationLayer,
@@ -224,10 +371,20 @@ void InPlaceOperationMutator::mutate(Graph &g)
         NodeType::PrintLayer
     };
 
+    // Nodes that are only computed in-place on the Arm® Neon™ backend
+    std::set<NodeType> neon_in_place_nodes =
+    {
+        NodeType::L2NormalizeLayer,
+        NodeType::NormalizationLayer,
+        NodeType::PReluLayer,
+        NodeType::SoftmaxLayer
+    };
+
     // Not interested in the order of nodes
     for(auto &node : g.nodes())
     {
-        if(node && in_place_nodes.find(node->type()) != std::end(in_place_nodes))
+        if(node && (in_place_nodes.find(node->type()) != std::end(in_place_nodes)
+                    || (node->assigned_target() == Target::NEON && neon_in_place_nodes.find(node->type()) != std::end(neon_in_place_nodes))))
         {
             // Get input edge
             Edge *input_edge = node->input_edge(0);
@@ -235,7 +392,7 @@ void InPlaceOperationMutator::mutate(Graph &g)
             // Check if parent has a single output if yes then force in place calculation else not
             if((input_edge != nullptr) && output_edges_are_separate_tensors(g, input_edge))
             {
-                if(node->type() == NodeType::EltwiseLayer)
+                if(node->type() == NodeType::EltwiseLayer || node->type() == NodeType::PReluLayer)
                 {
                     try_in_place_elementwise(node);
                 }
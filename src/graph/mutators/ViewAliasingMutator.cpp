@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/mutators/ViewAliasingMutator.h"
+
+#include "arm_compute/core/utils/helpers/tensor_transform.h"
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/Logger.h"
+#include "arm_compute/graph/Utils.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/backends/BackendRegistry.h"
+#include "arm_compute/graph/nodes/Nodes.h"
+
+#include "support/Cast.h"
+
+#include <tuple>
+
+namespace arm_compute
+{
+namespace graph
+{
+namespace
+{
+/** Checks if a box of a tensor is stored contiguously
+ *
+ * All the dimensions of the box below its outermost one must span the whole tensor,
+ * so that the view can be used by kernels that don't account for the strides.
+ */
+bool is_contiguous_view(const TensorShape &parent_shape, const Coordinates &coords, const TensorShape &shape)
+{
+    for(size_t d = 0; d + 1 < shape.num_dimensions(); ++d)
+    {
+        if(coords[d] != 0 || shape[d] != parent_shape[d])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Computes the coordinates of a slice in its input
+ *
+ * @param[in]  input_shape Shape of the input
+ * @param[in]  output      Output of the slice
+ * @param[in]  starts      Starts of the slice
+ * @param[in]  ends        Ends of the slice
+ * @param[in]  strides     Strides of the slice
+ * @param[in]  info        Masks of the slice
+ * @param[out] coords      Coordinates of the first element of the slice in the input
+ *
+ * @return True if the slice is a contiguous box of its input else false
+ */
+bool compute_view_coords(const TensorShape &input_shape, const Tensor &output, const Coordinates &starts, const Coordinates &ends, const BiStrides &strides,
+                         const StridedSliceLayerInfo &info, Coordinates &coords)
+{
+    using namespace arm_compute::helpers::tensor_transform;
+
+    Coordinates final_strides;
+    std::tie(coords, std::ignore, final_strides) = calculate_strided_slice_coords(input_shape, starts, ends, strides, info.begin_mask(), info.end_mask(), info.shrink_axis_mask());
+    for(size_t d = 0; d < input_shape.num_dimensions(); ++d)
+    {
+        if(final_strides[d] != 1)
+        {
+            return false;
+        }
+    }
+
+    // Shrunk dimensions would make the shape of the output differ from the shape of the box
+    const TensorShape box_shape = compute_strided_slice_output_shape(input_shape, starts, ends, strides, info.begin_mask(), info.end_mask(), info.shrink_axis_mask(), true);
+    return box_shape == output.desc().shape && is_contiguous_view(input_shape, coords, box_shape);
+}
+
+/** Creates the view of the output of a node on its input
+ *
+ * @param[in] node Reshape, flatten, slice or strided slice node
+ *
+ * @return The handle of the view, nullptr if the output cannot be a view of the input
+ */
+std::unique_ptr<ITensorHandle> create_view(INode &node)
+{
+    Tensor *input  = node.input(0);
+    Tensor *output = node.output(0);
+    if(input == nullptr || output == nullptr || input->handle() == nullptr || output->handle() == nullptr || output->handle()->is_subtensor())
+    {
+        return nullptr;
+    }
+
+    const Target target = output->desc().target;
+    if(input->desc().target != target || !is_target_supported(target))
+    {
+        return nullptr;
+    }
+
+    // Writes through the view would land in the input, which must neither be read by other nodes nor be written in-place
+    const Graph *g = node.graph();
+    if(!is_only_consumer(*g, *input, node) || has_in_place_writer(*g, *output))
+    {
+        return nullptr;
+    }
+
+    // Split nodes may have already created sub-tensors of the output
+    for(auto &eid : node.output_edges())
+    {
+        if(g->edge(eid)->consumer()->type() == NodeType::SplitLayer)
+        {
+            return nullptr;
+        }
+    }
+
+    backends::IDeviceBackend &backend = backends::BackendRegistry::get().get_backend(target);
+    switch(node.type())
+    {
+        case NodeType::FlattenLayer:
+        case NodeType::ReshapeLayer:
+        {
+            if(input->handle()->is_subtensor())
+            {
+                return nullptr;
+            }
+            return backend.create_alias(input->handle(), *output);
+        }
+        case NodeType::SliceLayer:
+        {
+            auto       *slice_node = arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(&node);
+            Coordinates coords;
+            if(!compute_view_coords(input->desc().shape, *output, slice_node->starts(), slice_node->ends(), BiStrides(),
+                                    StridedSliceLayerInfo(0, helpers::tensor_transform::construct_slice_end_mask(slice_node->ends())), coords))
+            {
+                return nullptr;
+            }
+            return backend.create_subtensor(input->handle(), output->desc().shape, coords, false);
+        }
+        case NodeType::StridedSliceLayer:
+        {
+            auto       *slice_node = arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(&node);
+            Coordinates coords;
+            if(!compute_view_coords(input->desc().shape, *output, slice_node->starts(), slice_node->ends(), slice_node->strides(), slice_node->strided_slice_info(), coords))
+            {
+                return nullptr;
+            }
+            return backend.create_subtensor(input->handle(), output->desc().shape, coords, false);
+        }
+        default:
+            return nullptr;
+    }
+}
+
+void disable_node(INode &node)
+{
+    switch(node.type())
+    {
+        case NodeType::FlattenLayer:
+            arm_compute::utils::cast::polymorphic_downcast<FlattenLayerNode *>(&node)->set_enabled(false);
+            break;
+        case NodeType::ReshapeLayer:
+            arm_compute::utils::cast::polymorphic_downcast<ReshapeLayerNode *>(&node)->set_enabled(false);
+            break;
+        case NodeType::SliceLayer:
+            arm_compute::utils::cast::polymorphic_downcast<SliceLayerNode *>(&node)->set_enabled(false);
+            break;
+        case NodeType::StridedSliceLayer:
+            arm_compute::utils::cast::polymorphic_downcast<StridedSliceLayerNode *>(&node)->set_enabled(false);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported node type");
+    }
+}
+} // namespace
+
+const char *ViewAliasingMutator::name()
+{
+    return "ViewAliasingMutator";
+}
+
+IGraphMutator::MutationType ViewAliasingMutator::type() const
+{
+    return IGraphMutator::MutationType::Backend;
+}
+
+void ViewAliasingMutator::mutate(Graph &g)
+{
+    // Early exit if no view candidates exist in graph
+    if(g.nodes(NodeType::FlattenLayer).empty() && g.nodes(NodeType::ReshapeLayer).empty() && g.nodes(NodeType::SliceLayer).empty()
+       && g.nodes(NodeType::StridedSliceLayer).empty())
+    {
+        return;
+    }
+
+    // Views are created in order of execution so that their parents are final
+    size_t num_views = 0;
+    for(auto &node_id : dfs(g))
+    {
+        INode *node = g.node(node_id);
+        if(node == nullptr)
+        {
+            continue;
+        }
+        switch(node->type())
+        {
+            case NodeType::FlattenLayer:
+            case NodeType::ReshapeLayer:
+            case NodeType::SliceLayer:
+            case NodeType::StridedSliceLayer:
+                break;
+            default:
+                continue;
+        }
+
+        std::unique_ptr<ITensorHandle> handle = create_view(*node);
+        if(handle != nullptr)
+        {
+            ARM_COMPUTE_LOG_GRAPH_VERBOSE("Using a view of the input for the node with ID : " << node->id() << " and name : " << node->name() << std::endl);
+            node->output(0)->set_handle(std::move(handle));
+            disable_node(*node);
+            ++num_views;
+        }
+    }
+
+    if(num_views != 0)
+    {
+        ARM_COMPUTE_LOG_GRAPH_INFO("Replaced " << num_views << " copies by views of their inputs" << std::endl);
+    }
+}
+} // namespace graph
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -44,6 +44,14 @@ PoolingLayerInfo PoolingLayerNode::pooling_info() const
     return _info;
 }
 
+void PoolingLayerNode::set_data_layout(DataLayout layout)
+{
+    if(_info.data_layout != DataLayout::UNKNOWN)
+    {
+        _info.data_layout = layout;
+    }
+}
+
 TensorDescriptor PoolingLayerNode::compute_output_descriptor(const TensorDescriptor &input_descriptor,
                                                              PoolingLayerInfo        info)
 {
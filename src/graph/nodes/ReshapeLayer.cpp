@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018 Arm Limited.
+ * Copyright (c) 2018, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -37,6 +37,16 @@ ReshapeLayerNode::ReshapeLayerNode(TensorShape shape)
     _outputs.resize(1, NullTensorID);
 }
 
+void ReshapeLayerNode::set_enabled(bool is_enabled)
+{
+    _is_enabled = is_enabled;
+}
+
+bool ReshapeLayerNode::is_enabled() const
+{
+    return _is_enabled;
+}
+
 bool ReshapeLayerNode::forward_descriptors()
 {
     if((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020 Arm Limited.
+ * Copyright (c) 2018-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -60,6 +60,16 @@ TensorDescriptor SliceLayerNode::compute_output_descriptor(const TensorDescripto
     return output_desc;
 }
 
+void SliceLayerNode::set_enabled(bool is_enabled)
+{
+    _is_enabled = is_enabled;
+}
+
+bool SliceLayerNode::is_enabled() const
+{
+    return _is_enabled;
+}
+
 bool SliceLayerNode::forward_descriptors()
 {
     if((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -77,6 +77,16 @@ TensorDescriptor StridedSliceLayerNode::compute_output_descriptor(const TensorDe
     return output_desc;
 }
 
+void StridedSliceLayerNode::set_enabled(bool is_enabled)
+{
+    _is_enabled = is_enabled;
+}
+
+bool StridedSliceLayerNode::is_enabled() const
+{
+    return _is_enabled;
+}
+
 bool StridedSliceLayerNode::forward_descriptors()
 {
     if((input_id(0) != NullTensorID) && (output_id(0) != NullTensorID))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022 Arm Limited.
+ * Copyright (c) 2016-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,12 +31,14 @@
 #include "arm_compute/core/utils/misc/Utility.h"
 #include "support/Mutex.h"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <iostream>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <system_error>
 #include <thread>
 #include <vector>
@@ -112,6 +114,54 @@ void set_thread_affinity(int core_id)
 #endif /* !defined(__APPLE__) && !defined(__OpenBSD__) */
 }
 
+/** Allow the current thread to run on any core
+ *
+ * @param[in] num_cores Number of cores of the system
+ */
+void reset_thread_affinity(unsigned int num_cores)
+{
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for(unsigned int core = 0; core < num_cores && core < CPU_SETSIZE; ++core)
+    {
+        CPU_SET(core, &set);
+    }
+    ARM_COMPUTE_EXIT_ON_MSG(sched_setaffinity(0, sizeof(set), &set), "Error setting thread affinity");
+#else  /* !defined(__APPLE__) && !defined(__OpenBSD__) */
+    ARM_COMPUTE_UNUSED(num_cores);
+#endif /* !defined(__APPLE__) && !defined(__OpenBSD__) */
+}
+
+/** Order the cores of the system for a given core policy
+ *
+ * @param[in] policy   Core policy
+ * @param[in] cpu_info CPU information
+ *
+ * @return The cores to use by decreasing capacity, only the big ones for @ref IScheduler::CorePolicy::BIG_CORES_ONLY
+ */
+std::vector<int> cores_for_policy(IScheduler::CorePolicy policy, const CPUInfo &cpu_info)
+{
+    std::vector<int> cores(std::max(cpu_info.get_cpu_num(), 1U));
+    std::iota(cores.begin(), cores.end(), 0);
+    std::stable_sort(cores.begin(), cores.end(), [&cpu_info](int lhs, int rhs)
+    {
+        return cpu_info.get_cpu_capacity(lhs) > cpu_info.get_cpu_capacity(rhs);
+    });
+
+    if(policy == IScheduler::CorePolicy::BIG_CORES_ONLY)
+    {
+        // Cores with less than half the capacity of the biggest one are little cores
+        const unsigned int max_capacity = cpu_info.get_cpu_capacity(cores.front());
+        cores.erase(std::find_if(cores.begin(), cores.end(), [&](int core)
+        {
+            return 2 * cpu_info.get_cpu_capacity(core) <= max_capacity;
+        }),
+        cores.end());
+    }
+    return cores;
+}
+
 /** There are currently 2 scheduling modes supported by CPPScheduler
  *
  * Linear:
@@ -323,7 +373,7 @@ struct CPPScheduler::Impl final
         Fanout
     };
     explicit Impl(unsigned int thread_hint)
-        : _num_threads(thread_hint), _threads(_num_threads - 1), _mode(Mode::Linear), _wake_fanout(0U)
+        : _num_threads(thread_hint), _requested_num_threads(thread_hint), _threads(_num_threads - 1), _mode(Mode::Linear), _wake_fanout(0U)
     {
         const auto mode_env_v = utility::tolower(utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_MODE"));
         if(mode_env_v == "linear")
@@ -339,27 +389,95 @@ struct CPPScheduler::Impl final
             _forced_mode = ModeToggle::None;
         }
     }
-    void set_num_threads(unsigned int num_threads, unsigned int thread_hint)
+    void set_num_threads(unsigned int num_threads, unsigned int thread_hint, const CPUInfo &cpu_info)
     {
-        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _requested_num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _num_threads           = _requested_num_threads;
+        if(_core_policy != CorePolicy::UNIFORM)
+        {
+            // Re-pin the new set of threads
+            set_core_policy(_core_policy, cpu_info);
+            return;
+        }
         _threads.resize(_num_threads - 1);
         auto_switch_mode(_num_threads);
     }
     void set_num_threads_with_affinity(unsigned int num_threads, unsigned int thread_hint, BindFunc func)
     {
-        _num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _requested_num_threads = num_threads == 0 ? thread_hint : num_threads;
+        _num_threads           = _requested_num_threads;
+        _thread_cores.resize(_num_threads);
 
         // Set affinity on main thread
-        set_thread_affinity(func(0, thread_hint));
+        _thread_cores[0] = func(0, thread_hint);
+        set_thread_affinity(_thread_cores[0]);
 
         // Set affinity on worked threads
         _threads.clear();
         for(auto i = 1U; i < _num_threads; ++i)
         {
-            _threads.emplace_back(func(i, thread_hint));
+            _thread_cores[i] = func(i, thread_hint);
+            _threads.emplace_back(_thread_cores[i]);
         }
         auto_switch_mode(_num_threads);
     }
+    void set_core_policy(CorePolicy policy, const CPUInfo &cpu_info)
+    {
+        _core_policy = policy;
+        _num_threads = _requested_num_threads;
+        _threads.clear();
+        if(policy == CorePolicy::UNIFORM)
+        {
+            if(!_thread_cores.empty())
+            {
+                reset_thread_affinity(cpu_info.get_cpu_num());
+            }
+            _thread_cores.clear();
+            _threads.resize(_num_threads - 1);
+            auto_switch_mode(_num_threads);
+            return;
+        }
+
+        // The main thread and the first workers get the biggest cores
+        const std::vector<int> cores = cores_for_policy(policy, cpu_info);
+        if(policy == CorePolicy::BIG_CORES_ONLY)
+        {
+            // Never more threads than requested, nor than there are big cores
+            _num_threads = std::min(_requested_num_threads, static_cast<unsigned int>(cores.size()));
+        }
+        _thread_cores.resize(_num_threads);
+        for(unsigned int i = 0; i < _num_threads; ++i)
+        {
+            _thread_cores[i] = cores[i % cores.size()];
+        }
+
+        set_thread_affinity(_thread_cores[0]);
+        for(auto i = 1U; i < _num_threads; ++i)
+        {
+            _threads.emplace_back(_thread_cores[i]);
+        }
+        auto_switch_mode(_num_threads);
+    }
+    std::vector<unsigned int> thread_capacities(unsigned int num_threads_to_use, const CPUInfo &cpu_info) const
+    {
+        if(_core_policy == CorePolicy::UNIFORM || num_threads_to_use > _thread_cores.size())
+        {
+            return {};
+        }
+
+        // The worker threads have ids [0, num_threads_to_use - 1) and the main thread has the last id
+        std::vector<unsigned int> capacities(num_threads_to_use);
+        for(unsigned int t = 0; t < num_threads_to_use; ++t)
+        {
+            const int core = (t + 1 == num_threads_to_use) ? _thread_cores[0] : _thread_cores[t + 1];
+            if(core < 0)
+            {
+                return {};
+            }
+            capacities[t] = cpu_info.get_cpu_capacity(core);
+        }
+        return capacities;
+    }
     void auto_switch_mode(unsigned int num_threads_to_use)
     {
         // If the environment variable is set to any of the modes, it overwrites the mode selected over num_threads_to_use
@@ -419,7 +537,10 @@ struct CPPScheduler::Impl final
     void run_workloads(std::vector<IScheduler::Workload> &workloads);
 
     unsigned int       _num_threads;
+    unsigned int       _requested_num_threads;
     std::list<Thread>  _threads;
+    std::vector<int>   _thread_cores{};
+    CorePolicy         _core_policy{ CorePolicy::UNIFORM };
     arm_compute::Mutex _run_workloads_mutex{};
     Mode               _mode{ Mode::Linear };
     ModeToggle         _forced_mode{ ModeToggle::None };
@@ -438,6 +559,15 @@ CPPScheduler &CPPScheduler::get()
 CPPScheduler::CPPScheduler()
     : _impl(std::make_unique<Impl>(num_threads_hint()))
 {
+    const auto policy_env_v = utility::tolower(utility::getenv("ARM_COMPUTE_CPP_SCHEDULER_CORE_POLICY"));
+    if(policy_env_v == "capacity")
+    {
+        _impl->set_core_policy(CorePolicy::CAPACITY_WEIGHTED, cpu_info());
+    }
+    else if(policy_env_v == "big")
+    {
+        _impl->set_core_policy(CorePolicy::BIG_CORES_ONLY, cpu_info());
+    }
 }
 
 CPPScheduler::~CPPScheduler() = default;
@@ -446,7 +576,7 @@ void CPPScheduler::set_num_threads(unsigned int num_threads)
 {
     // No changes in the number of threads while current workloads are running
     arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
-    _impl->set_num_threads(num_threads, num_threads_hint());
+    _impl->set_num_threads(num_threads, num_threads_hint(), cpu_info());
 }
 
 void CPPScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFunc func)
@@ -456,6 +586,23 @@ void CPPScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindF
     _impl->set_num_threads_with_affinity(num_threads, num_threads_hint(), func);
 }
 
+void CPPScheduler::set_core_policy(CorePolicy policy)
+{
+    // No changes in the thread mapping while current workloads are running
+    arm_compute::lock_guard<std::mutex> lock(_impl->_run_workloads_mutex);
+    _impl->set_core_policy(policy, cpu_info());
+}
+
+IScheduler::CorePolicy CPPScheduler::core_policy() const
+{
+    return _impl->_core_policy;
+}
+
+std::vector<unsigned int> CPPScheduler::thread_capacities(unsigned int num_threads) const
+{
+    return _impl->thread_capacities(num_threads, CPUInfo::get());
+}
+
 unsigned int CPPScheduler::num_threads() const
 {
     return _impl->num_threads();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2021 Arm Limited.
+ * Copyright (c) 2019-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,7 +26,9 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/Scheduler.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/NMSHelpers.h"
 
 #include "src/common/utils/Log.h"
 
@@ -327,28 +329,63 @@ void CPPDetectionPostProcessLayer::run()
         std::vector<float>        result_scores_after_nms;
         std::vector<unsigned int> sorted_indices;
 
-        for(unsigned int c = 0; c < num_classes; ++c)
+        // Run Non-maxima Suppression for each class in parallel
+        std::vector<std::vector<int>>   selected_per_class(num_classes);
+        std::vector<std::vector<float>> scores_per_class(num_classes);
+
+        nms_helpers::OverlapInfo overlap_info;
+        overlap_info.iou_threshold = _info.iou_threshold();
+
+        auto run_class_nms = [&](unsigned int c)
         {
             // For each boxes get scores of the boxes for the class c
+            std::vector<int>   candidates;
+            std::vector<float> candidate_scores;
             for(unsigned int i = 0; i < _num_boxes; ++i)
             {
-                *(reinterpret_cast<float *>(_class_scores.ptr_to_element(Coordinates(i)))) =
-                    *(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(Coordinates(c + 1, i)))); // i * _num_classes_with_background + c + 1
+                const float score = *(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(Coordinates(c + 1, i)))); // i * _num_classes_with_background + c + 1
+                if(score >= _info.nms_score_threshold())
+                {
+                    candidates.emplace_back(i);
+                    candidate_scores.emplace_back(score);
+                }
             }
 
-            // Run Non-maxima Suppression
-            _nms.run();
+            selected_per_class[c] = nms_helpers::greedy_nms(candidates, candidate_scores, _info.detection_per_class(), overlap_info,
+                                                            [this](int idx, float & xmin, float & ymin, float & xmax, float & ymax)
+            {
+                xmin = *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(0, idx))));
+                ymin = *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(1, idx))));
+                xmax = *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(2, idx))));
+                ymax = *(reinterpret_cast<float *>(_decoded_boxes.ptr_to_element(Coordinates(3, idx))));
+            });
+
+            for(const auto selected_index : selected_per_class[c])
+            {
+                scores_per_class[c].emplace_back(*(reinterpret_cast<float *>(_input_scores_to_use->ptr_to_element(Coordinates(c + 1, selected_index)))));
+            }
+        };
 
-            for(unsigned int i = 0; i < _info.detection_per_class(); ++i)
+        const unsigned int                num_threads = std::max(1U, std::min(Scheduler::get().num_threads(), num_classes));
+        std::vector<IScheduler::Workload> workloads(num_threads);
+        for(unsigned int t = 0; t < num_threads; ++t)
+        {
+            workloads[t] = [t, num_threads, num_classes, &run_class_nms](const ThreadInfo &)
             {
-                const auto selected_index = *(reinterpret_cast<int *>(_selected_indices.ptr_to_element(Coordinates(i))));
-                if(selected_index == -1)
+                for(unsigned int c = t; c < num_classes; c += num_threads)
                 {
-                    // Nms will return -1 for all the last M-elements not valid
-                    break;
+                    run_class_nms(c);
                 }
-                result_idx_boxes_after_nms.emplace_back(selected_index);
-                result_scores_after_nms.emplace_back((reinterpret_cast<float *>(_class_scores.buffer()))[selected_index]);
+            };
+        }
+        Scheduler::get().run_tagged_workloads(workloads, "CPPDetectionPostProcessLayer");
+
+        for(unsigned int c = 0; c < num_classes; ++c)
+        {
+            for(unsigned int i = 0; i < selected_per_class[c].size(); ++i)
+            {
+                result_idx_boxes_after_nms.emplace_back(selected_per_class[c][i]);
+                result_scores_after_nms.emplace_back(scores_per_class[c][i]);
                 result_classes_after_nms.emplace_back(c);
             }
         }
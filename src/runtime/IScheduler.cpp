@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2023 Arm Limited.
+ * Copyright (c) 2016-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -29,15 +29,56 @@
 #include "arm_compute/core/Window.h"
 #include "src/common/cpuinfo/CpuInfo.h"
 #include "src/runtime/SchedulerUtils.h"
+#include "support/Mutex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 
 namespace arm_compute
 {
+namespace
+{
+#ifndef BARE_METAL
+/** Restrict a window to a range of iterations along one dimension
+ *
+ * @param[in] window    Window to restrict
+ * @param[in] dimension Dimension to restrict
+ * @param[in] it_start  First iteration to keep
+ * @param[in] it_end    One past the last iteration to keep
+ *
+ * @return The restricted window
+ */
+Window restrict_window(const Window &window, std::size_t dimension, std::size_t it_start, std::size_t it_end)
+{
+    const Window::Dimension &dim   = window[dimension];
+    const int                step  = dim.step();
+    const int                start = dim.start() + static_cast<int>(it_start) * step;
+    const int                end   = std::min(dim.end(), dim.start() + static_cast<int>(it_end) * step);
+
+    Window out(window);
+    out.set(dimension, Window::Dimension(start, end, step));
+    return out;
+}
+#endif /* !BARE_METAL */
+} // namespace
+
+struct IScheduler::ImbalanceRecorder
+{
+    std::atomic<bool>                     enabled{ false };
+    mutable arm_compute::Mutex            mutex{};
+    std::map<std::string, ImbalanceStats> stats{};
+};
+
 IScheduler::IScheduler()
+    : _imbalance(std::make_unique<ImbalanceRecorder>())
 {
     // Work out the best possible number of execution threads
     _num_threads_hint = cpuinfo::num_threads_hint();
 }
 
+IScheduler::~IScheduler() = default;
+
 CPUInfo &IScheduler::cpu_info()
 {
     return CPUInfo::get();
@@ -49,11 +90,95 @@ void IScheduler::set_num_threads_with_affinity(unsigned int num_threads, BindFun
     ARM_COMPUTE_ERROR("Feature for affinity setting is not implemented");
 }
 
+void IScheduler::set_core_policy(CorePolicy policy)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(policy != CorePolicy::UNIFORM, "Core policies are not implemented by this scheduler");
+    ARM_COMPUTE_UNUSED(policy);
+}
+
+IScheduler::CorePolicy IScheduler::core_policy() const
+{
+    return CorePolicy::UNIFORM;
+}
+
+void IScheduler::set_imbalance_stats_enabled(bool enable)
+{
+    _imbalance->enabled = enable;
+}
+
+std::map<std::string, IScheduler::ImbalanceStats> IScheduler::imbalance_stats() const
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_imbalance->mutex);
+    return _imbalance->stats;
+}
+
+void IScheduler::reset_imbalance_stats()
+{
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_imbalance->mutex);
+    _imbalance->stats.clear();
+}
+
+std::vector<unsigned int> IScheduler::thread_capacities(unsigned int num_threads) const
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+    return {};
+}
+
 unsigned int IScheduler::num_threads_hint() const
 {
     return _num_threads_hint;
 }
 
+void IScheduler::run_kernel_workloads(const ICPPKernel &kernel, std::vector<Workload> &workloads)
+{
+    if(!_imbalance->enabled)
+    {
+        run_workloads(workloads);
+        return;
+    }
+
+    // Each thread only updates its own entry, so no synchronisation is needed
+    std::vector<double>   busy_time(num_threads(), 0.);
+    std::vector<Workload> timed_workloads(workloads.size());
+    for(std::size_t i = 0; i < workloads.size(); ++i)
+    {
+        timed_workloads[i] = [i, &workloads, &busy_time](const ThreadInfo & info)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            workloads[i](info);
+            if(static_cast<std::size_t>(info.thread_id) < busy_time.size())
+            {
+                busy_time[info.thread_id] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            }
+        };
+    }
+    run_workloads(timed_workloads);
+
+    double       max_time    = 0.;
+    double       total_time  = 0.;
+    unsigned int num_workers = 0;
+    for(const auto t : busy_time)
+    {
+        if(t > 0.)
+        {
+            max_time = std::max(max_time, t);
+            total_time += t;
+            ++num_workers;
+        }
+    }
+    if(num_workers == 0)
+    {
+        return;
+    }
+
+    const double                                imbalance = max_time * num_workers / total_time;
+    arm_compute::lock_guard<arm_compute::Mutex> lock(_imbalance->mutex);
+    ImbalanceStats                             &stats = _imbalance->stats[kernel.name()];
+    ++stats.num_runs;
+    stats.sum_imbalance += imbalance;
+    stats.max_imbalance = std::max(stats.max_imbalance, imbalance);
+}
+
 void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const Window &window, ITensorPack &tensors)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
@@ -96,7 +221,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
                 });
             }
         }
-        run_workloads(workloads);
+        run_kernel_workloads(*kernel, workloads);
     }
     else
     {
@@ -142,13 +267,34 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
             // Make sure the smallest window is larger than minimum workload size
             num_windows = adjust_num_of_windows(max_window, hints.split_dimension(), num_windows, *kernel, cpu_info());
 
+            // Static windows are run by the thread with the same id: give each of them a share proportional to the capacity of its core
+            std::vector<std::size_t> offsets;
+            if(hints.strategy() == StrategyHint::STATIC && num_windows > 1)
+            {
+                const std::vector<unsigned int> capacities = thread_capacities(num_windows);
+                if(!capacities.empty())
+                {
+                    offsets = scheduler_utils::split_by_weights(num_iterations, capacities);
+                    for(unsigned int t = 0; t < num_windows; ++t)
+                    {
+                        if(offsets[t] == offsets[t + 1])
+                        {
+                            // Keep every thread busy rather than creating empty windows
+                            offsets.clear();
+                            break;
+                        }
+                    }
+                }
+            }
+
             std::vector<IScheduler::Workload> workloads(num_windows);
             for(unsigned int t = 0; t < num_windows; ++t)
             {
                 //Capture 't' by copy, all the other variables by reference:
-                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors](const ThreadInfo & info)
+                workloads[t] = [t, &hints, &max_window, &num_windows, &kernel, &tensors, &offsets](const ThreadInfo & info)
                 {
-                    Window win = max_window.split_window(hints.split_dimension(), t, num_windows);
+                    Window win = offsets.empty() ? max_window.split_window(hints.split_dimension(), t, num_windows) :
+                                 restrict_window(max_window, hints.split_dimension(), offsets[t], offsets[t + 1]);
                     win.validate();
 
                     if(tensors.empty())
@@ -161,7 +307,7 @@ void IScheduler::schedule_common(ICPPKernel *kernel, const Hints &hints, const W
                     }
                 };
             }
-            run_workloads(workloads);
+            run_kernel_workloads(*kernel, workloads);
         }
     }
 #else  /* !BARE_METAL */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021 Arm Limited.
+ * Copyright (c) 2019, 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -175,4 +175,21 @@ void IWeightsManager::pre_mark_as_unused(const ITensor *weights)
 
     _managed_counter[weights].is_unused = true;
 }
+
+size_t IWeightsManager::transformed_weights_size() const
+{
+    size_t size = 0;
+    for(const auto &managed : _managed_weights)
+    {
+        for(auto *transform : managed.second)
+        {
+            const ITensor *weights = transform->is_reshape_run() ? transform->get_weights() : nullptr;
+            if(weights != nullptr && !weights->info()->is_resizable())
+            {
+                size += weights->info()->total_size();
+            }
+        }
+    }
+    return size;
+}
 } // namespace arm_compute
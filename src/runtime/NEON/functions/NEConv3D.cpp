@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,6 +27,7 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "src/common/utils/Log.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv3d.h"
 
 namespace arm_compute
@@ -35,8 +36,13 @@ using namespace arm_compute::experimental;
 
 struct NEConv3D::Impl
 {
+    MemoryGroup                        memory_group{};
     std::unique_ptr<cpu::ICpuOperator> op{ nullptr };
     ITensorPack                        run_pack{};
+    ITensorPack                        prep_pack{};
+    WorkspaceData<Tensor>              workspace{};
+    experimental::MemoryRequirements   aux_mem_req{};
+    bool                               is_prepared{ false };
 };
 
 NEConv3D::NEConv3D()
@@ -59,7 +65,11 @@ void NEConv3D::configure(ITensor *input, const ITensor *weights, const ITensor *
 
     if(_impl->op != nullptr)
     {
-        _impl->run_pack = { { ACL_SRC_0, input }, { ACL_SRC_1, weights }, { ACL_SRC_2, biases }, { ACL_DST, output } };
+        _impl->aux_mem_req = _impl->op->workspace();
+        _impl->run_pack    = { { ACL_SRC_0, input }, { ACL_SRC_1, weights }, { ACL_SRC_2, biases }, { ACL_DST, output } };
+        _impl->prep_pack   = { { ACL_SRC_1, weights }, { ACL_SRC_2, biases } };
+        _impl->workspace   = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->prep_pack);
+        _impl->is_prepared = false;
     }
 }
 
@@ -74,7 +84,23 @@ void NEConv3D::run()
 {
     if(_impl->op != nullptr)
     {
+        prepare();
+
+        MemoryGroupResourceScope scope_mg(_impl->memory_group);
         _impl->op->run(_impl->run_pack);
     }
 }
+
+void NEConv3D::prepare()
+{
+    if(!_impl->is_prepared && _impl->op != nullptr)
+    {
+        _impl->op->prepare(_impl->prep_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+        _impl->is_prepared = true;
+    }
+}
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,16 +27,135 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/core/utils/quantization/AsymmHelpers.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEPermute.h"
+#include "arm_compute/runtime/NEON/functions/NEReshapeLayer.h"
 #include "src/common/utils/Log.h"
 #include "src/core/helpers/AutoConfiguration.h"
+#include "src/core/helpers/MemoryHelpers.h"
+#include "src/cpu/kernels/CpuDeconvCol2ImKernel.h"
+#include "src/cpu/operators/CpuGemm.h"
+#include "src/cpu/operators/CpuGemmLowpMatrixMultiplyCore.h"
 
 using namespace arm_compute::misc::shape_calculator;
+using namespace arm_compute::experimental;
 
 namespace arm_compute
 {
+struct NEDeconvolutionLayer::Impl
+{
+    bool                                                 is_native{ false };
+    std::unique_ptr<cpu::ICpuOperator>                   gemm{ nullptr };
+    std::unique_ptr<cpu::kernels::CpuDeconvCol2ImKernel> col2im{ nullptr };
+    NEPermute                                            permute_weights{};
+    NEReshapeLayer                                       reshape_weights{};
+    Tensor                                               weights_permuted{};
+    Tensor                                               weights_gemm{};
+    Tensor                                               gemm_output{};
+    ITensorPack                                          gemm_run_pack{};
+    ITensorPack                                          gemm_prep_pack{};
+    ITensorPack                                          col2im_pack{};
+    WorkspaceData<Tensor>                                workspace{};
+    MemoryRequirements                                   aux_mem_req{};
+};
+
 namespace
 {
+/** Infos of the tensors used by the native transposed convolution
+ *
+ * The input is multiplied by the weights reshaped to [kernel_w * kernel_h * OFM, IFM] and every input pixel produces the contributions of all the kernel taps,
+ * which are then accumulated into the output by @ref cpu::kernels::CpuDeconvCol2ImKernel. Compared to the upsampling path, this skips the multiplications
+ * by the inserted zeros and never allocates the upsampled input.
+ */
+struct NativeDeconvInfo
+{
+    TensorInfo              weights_permuted{};
+    TensorInfo              weights_gemm{};
+    TensorInfo              gemm_output{};
+    GEMMInfo                gemm_info{};
+    GEMMLowpOutputStageInfo output_stage{};
+};
+
+const PermutationVector native_weights_perm(3U, 1U, 2U, 0U);
+
+Status compute_native_info(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *output, bool enable_fast_math, NativeDeconvInfo &native_info)
+{
+    const DataType   data_type    = input->data_type();
+    const bool       is_quantized = is_data_type_quantized_asymmetric(data_type);
+    const TensorInfo weights_permuted(weights->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_permutation_output_shape(*weights, native_weights_perm)));
+    const size_t     num_taps = weights->dimension(1) * weights->dimension(2);
+    const size_t     ofm      = weights->dimension(3);
+
+    native_info.weights_permuted = weights_permuted;
+    native_info.weights_gemm     = TensorInfo(weights_permuted.clone()->set_tensor_shape(TensorShape(num_taps * ofm, weights->dimension(0))));
+
+    TensorShape gemm_output_shape(input->tensor_shape());
+    gemm_output_shape.set(0, num_taps * ofm);
+    native_info.gemm_output = TensorInfo(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(gemm_output_shape).set_data_type(is_quantized ? DataType::S32 : data_type));
+
+    // The input is read in place as a 3D tensor and every row of the output is the set of columns of one input pixel
+    native_info.gemm_info = GEMMInfo(false, false, true, input->dimension(2), true, false, GEMMLowpOutputStageInfo(), false, enable_fast_math);
+
+    if(is_quantized)
+    {
+        const QuantizationInfo oqinfo = (output->total_size() == 0) ? input->quantization_info() : output->quantization_info();
+
+        native_info.output_stage.type                     = GEMMLowpOutputStageType::QUANTIZE_DOWN_FIXEDPOINT;
+        native_info.output_stage.gemmlowp_offset          = oqinfo.uniform().offset;
+        native_info.output_stage.is_quantized_per_channel = is_data_type_quantized_per_channel(weights->data_type());
+        ARM_COMPUTE_RETURN_ON_ERROR(quantization::calculate_quantized_multipliers(input->quantization_info(), weights->quantization_info(), oqinfo, native_info.output_stage));
+    }
+    return Status{};
+}
+
+/** Infos to configure the quantized matrix multiplication with, as it expects the offsets to be negated */
+std::pair<TensorInfo, TensorInfo> gemmlowp_infos(const ITensorInfo &input, const ITensorInfo &weights_gemm)
+{
+    TensorInfo a_info(input);
+    TensorInfo b_info(weights_gemm);
+    a_info.set_quantization_info(QuantizationInfo(input.quantization_info().uniform().scale, -input.quantization_info().uniform().offset));
+    if(!is_data_type_quantized_per_channel(weights_gemm.data_type()))
+    {
+        b_info.set_quantization_info(QuantizationInfo(weights_gemm.quantization_info().uniform().scale, -weights_gemm.quantization_info().uniform().offset));
+    }
+    return std::make_pair(a_info, b_info);
+}
+
+Status validate_native(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info,
+                       bool enable_fast_math, const WeightsInfo &weights_info)
+{
+    ARM_COMPUTE_RETURN_ERROR_ON(input->data_layout() != DataLayout::NHWC);
+    ARM_COMPUTE_RETURN_ERROR_ON(info.stride().first == 1 && info.stride().second == 1);
+    ARM_COMPUTE_RETURN_ERROR_ON(weights_info.weight_format() != arm_compute::WeightFormat::UNSPECIFIED);
+
+    NativeDeconvInfo native_info;
+    ARM_COMPUTE_RETURN_ON_ERROR(compute_native_info(input, weights, output, enable_fast_math, native_info));
+
+    ARM_COMPUTE_RETURN_ON_ERROR(NEPermute::validate(weights, &native_info.weights_permuted, native_weights_perm));
+    ARM_COMPUTE_RETURN_ON_ERROR(NEReshapeLayer::validate(&native_info.weights_permuted, &native_info.weights_gemm));
+    if(is_data_type_quantized_asymmetric(input->data_type()))
+    {
+        const auto infos = gemmlowp_infos(*input, native_info.weights_gemm);
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemmLowpMatrixMultiplyCore::validate(&infos.first, &infos.second, nullptr, &native_info.gemm_output, native_info.gemm_info));
+    }
+    else
+    {
+        ARM_COMPUTE_RETURN_ON_ERROR(cpu::CpuGemm::validate(input, &native_info.weights_gemm, nullptr, &native_info.gemm_output, 1.f, 0.f, native_info.gemm_info));
+    }
+
+    const unsigned int width_idx  = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::HEIGHT);
+    const Size2D       kernel_dims(weights->dimension(width_idx), weights->dimension(height_idx));
+    if(output->total_size() == 0)
+    {
+        const auto       out_dims = deconvolution_output_dimensions(input->dimension(width_idx), input->dimension(height_idx), kernel_dims.width, kernel_dims.height, info);
+        const TensorInfo output_info(input->clone()->set_is_resizable(true).reset_padding().set_tensor_shape(compute_deconvolution_output_shape(out_dims, *input, *weights)));
+        return cpu::kernels::CpuDeconvCol2ImKernel::validate(&native_info.gemm_output, bias, &output_info, kernel_dims, info, native_info.output_stage);
+    }
+    return cpu::kernels::CpuDeconvCol2ImKernel::validate(&native_info.gemm_output, bias, output, kernel_dims, info, native_info.output_stage);
+}
+
 PadStrideInfo compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_pad_x, uint32_t deconv_pad_y)
 {
     const unsigned int pad_left   = info.pad_left();
@@ -67,7 +186,8 @@ PadStrideInfo compute_upsample_info(const PadStrideInfo &info, uint32_t deconv_p
 } // namespace
 
 NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager) // NOLINT
-    : _memory_group(std::move(memory_manager)),
+    : _impl(std::make_unique<Impl>()),
+      _memory_group(std::move(memory_manager)),
       _conv_f(),
       _upsample_f(),
       _flip_weights(),
@@ -82,6 +202,8 @@ NEDeconvolutionLayer::NEDeconvolutionLayer(std::shared_ptr<IMemoryManager> memor
 {
 }
 
+NEDeconvolutionLayer::~NEDeconvolutionLayer() = default;
+
 Status NEDeconvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &info,
                                       bool enable_fast_math, const WeightsInfo &weights_info)
 {
@@ -153,6 +275,11 @@ Status NEDeconvolutionLayer::validate(const ITensorInfo *input, const ITensorInf
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(batches_idx) != scale_out_info.dimension(batches_idx));
     ARM_COMPUTE_RETURN_ERROR_ON(input->dimension(channel_idx) != scale_out_info.dimension(channel_idx));
 
+    if(bool(validate_native(input, weights, bias, output, info, enable_fast_math, weights_info)))
+    {
+        return Status{};
+    }
+
     if(do_upsampling)
     {
         const PadStrideInfo conv_info(1, 1, 0, 0, 0, 0, DimensionRoundingType::CEIL);
@@ -193,6 +320,13 @@ void NEDeconvolutionLayer::configure(ITensor *input, const ITensor *weights, con
     // Output auto initialization if not yet initialized
     auto_init_if_empty(*output->info(), output_shape, 1, input->info()->data_type(), input->info()->quantization_info());
 
+    _impl->is_native = bool(validate_native(input->info(), weights->info(), (bias == nullptr) ? nullptr : bias->info(), output->info(), info, enable_fast_math, weights_info));
+    if(_impl->is_native)
+    {
+        configure_native(input, weights, bias, output, enable_fast_math);
+        return;
+    }
+
     _flip_axis.allocator()->init(TensorInfo(TensorShape(2U), 1, DataType::U32));
 
     _weights_flipped.allocator()->init(weights->info()->clone()->set_data_layout(data_layout));
@@ -240,12 +374,59 @@ void NEDeconvolutionLayer::configure(ITensor *input, const ITensor *weights, con
     }
 }
 
+void NEDeconvolutionLayer::configure_native(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, bool enable_fast_math)
+{
+    NativeDeconvInfo native_info;
+    ARM_COMPUTE_ERROR_THROW_ON(compute_native_info(input->info(), weights->info(), output->info(), enable_fast_math, native_info));
+
+    _impl->weights_permuted.allocator()->init(native_info.weights_permuted);
+    _impl->weights_gemm.allocator()->init(native_info.weights_gemm);
+    _impl->gemm_output.allocator()->init(native_info.gemm_output);
+    _impl->permute_weights.configure(weights, &_impl->weights_permuted, native_weights_perm);
+    _impl->reshape_weights.configure(&_impl->weights_permuted, &_impl->weights_gemm);
+
+    if(is_data_type_quantized_asymmetric(input->info()->data_type()))
+    {
+        const auto infos = gemmlowp_infos(*input->info(), native_info.weights_gemm);
+        auto       gemm  = std::make_unique<cpu::CpuGemmLowpMatrixMultiplyCore>();
+        gemm->configure(&infos.first, &infos.second, nullptr, _impl->gemm_output.info(), native_info.gemm_info);
+        _impl->gemm = std::move(gemm);
+    }
+    else
+    {
+        auto gemm = std::make_unique<cpu::CpuGemm>();
+        gemm->configure(input->info(), _impl->weights_gemm.info(), nullptr, _impl->gemm_output.info(), 1.f, 0.f, native_info.gemm_info);
+        _impl->gemm = std::move(gemm);
+    }
+
+    const unsigned int width_idx  = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::WIDTH);
+    const unsigned int height_idx = get_data_layout_dimension_index(DataLayout::NHWC, DataLayoutDimension::HEIGHT);
+    _impl->col2im                 = std::make_unique<cpu::kernels::CpuDeconvCol2ImKernel>();
+    _impl->col2im->configure(_impl->gemm_output.info(), (bias == nullptr) ? nullptr : bias->info(), output->info(),
+                             Size2D(weights->info()->dimension(width_idx), weights->info()->dimension(height_idx)), _info, native_info.output_stage);
+
+    _memory_group.manage(&_impl->gemm_output);
+    _impl->aux_mem_req    = _impl->gemm->workspace();
+    _impl->gemm_run_pack  = { { ACL_SRC_0, input }, { ACL_SRC_1, &_impl->weights_gemm }, { ACL_DST, &_impl->gemm_output } };
+    _impl->gemm_prep_pack = { { ACL_SRC_1, &_impl->weights_gemm } };
+    _impl->workspace      = manage_workspace<Tensor>(_impl->aux_mem_req, _memory_group, _impl->gemm_run_pack, _impl->gemm_prep_pack);
+    _impl->col2im_pack    = { { ACL_SRC_0, &_impl->gemm_output }, { ACL_SRC_1, bias }, { ACL_DST, output } };
+    _impl->gemm_output.allocator()->allocate();
+}
+
 void NEDeconvolutionLayer::run()
 {
     prepare();
 
     MemoryGroupResourceScope scope_mg(_memory_group);
 
+    if(_impl->is_native)
+    {
+        _impl->gemm->run(_impl->gemm_run_pack);
+        NEScheduler::get().schedule_op(_impl->col2im.get(), Window::DimZ, _impl->col2im->window(), _impl->col2im_pack);
+        return;
+    }
+
     if(_do_upsampling)
     {
         _upsample_f.run();
@@ -259,6 +440,27 @@ void NEDeconvolutionLayer::prepare()
     {
         ARM_COMPUTE_ERROR_ON(!_original_weights->is_used());
 
+        if(_impl->is_native)
+        {
+            // Reshape the weights to [kernel_w * kernel_h * OFM, IFM] and let the matrix multiplication pretranspose them
+            _impl->weights_permuted.allocator()->allocate();
+            _impl->weights_gemm.allocator()->allocate();
+            _impl->permute_weights.run();
+            _original_weights->mark_as_unused();
+            _impl->reshape_weights.run();
+            _impl->weights_permuted.allocator()->free();
+
+            _impl->gemm->prepare(_impl->gemm_prep_pack);
+            if(!_impl->weights_gemm.is_used())
+            {
+                _impl->weights_gemm.allocator()->free();
+            }
+            release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+            _is_prepared = true;
+            return;
+        }
+
         // Run weights flipping and mark original weights tensor as unused
         _weights_flipped.allocator()->allocate();
         _flip_weights.run();
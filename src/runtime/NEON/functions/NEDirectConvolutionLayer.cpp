@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -27,17 +27,22 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "src/core/helpers/MemoryHelpers.h"
 #include "src/cpu/operators/CpuDirectConv2d.h"
 
 namespace arm_compute
 {
+using namespace arm_compute::experimental;
+
 struct NEDirectConvolutionLayer::Impl
 {
-    ITensor                              *src{ nullptr };
-    const ITensor                        *weights{ nullptr };
-    const ITensor                        *bias{ nullptr };
-    ITensor                              *dst{ nullptr };
+    MemoryGroup                           memory_group{};
     std::unique_ptr<cpu::CpuDirectConv2d> op{ nullptr };
+    ITensorPack                           run_pack{};
+    ITensorPack                           prep_pack{};
+    WorkspaceData<Tensor>                 workspace{};
+    experimental::MemoryRequirements      aux_mem_req{};
+    bool                                  is_prepared{ false };
 };
 
 NEDirectConvolutionLayer::NEDirectConvolutionLayer(std::shared_ptr<IMemoryManager> memory_manager)
@@ -48,12 +53,15 @@ NEDirectConvolutionLayer::~NEDirectConvolutionLayer() = default;
 
 void NEDirectConvolutionLayer::configure(ITensor *input, const ITensor *weights, const ITensor *bias, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info)
 {
-    _impl->src     = input;
-    _impl->weights = weights;
-    _impl->bias    = bias;
-    _impl->dst     = output;
-    _impl->op      = std::make_unique<cpu::CpuDirectConv2d>(_memory_manager);
+    _impl->op = std::make_unique<cpu::CpuDirectConv2d>(_memory_manager);
     _impl->op->configure(input->info(), weights->info(), (bias != nullptr ? bias->info() : nullptr), output->info(), conv_info, act_info);
+
+    _impl->memory_group = MemoryGroup(_memory_manager);
+    _impl->aux_mem_req  = _impl->op->workspace();
+    _impl->run_pack     = { { ACL_SRC_0, input }, { ACL_SRC_1, weights }, { ACL_SRC_2, bias }, { ACL_DST, output } };
+    _impl->prep_pack    = { { ACL_SRC_1, weights }, { ACL_SRC_2, bias } };
+    _impl->workspace    = manage_workspace<Tensor>(_impl->aux_mem_req, _impl->memory_group, _impl->run_pack, _impl->prep_pack);
+    _impl->is_prepared  = false;
 }
 
 Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITensorInfo *weights, const ITensorInfo *bias, const ITensorInfo *output, const PadStrideInfo &conv_info,
@@ -64,11 +72,22 @@ Status NEDirectConvolutionLayer::validate(const ITensorInfo *input, const ITenso
 
 void NEDirectConvolutionLayer::run()
 {
-    ITensorPack pack;
-    pack.add_tensor(TensorType::ACL_SRC_0, _impl->src);
-    pack.add_tensor(TensorType::ACL_SRC_1, _impl->weights);
-    pack.add_tensor(TensorType::ACL_SRC_2, _impl->bias);
-    pack.add_tensor(TensorType::ACL_DST, _impl->dst);
-    _impl->op->run(pack);
+    prepare();
+
+    MemoryGroupResourceScope scope_mg(_impl->memory_group);
+    _impl->op->run(_impl->run_pack);
+}
+
+void NEDirectConvolutionLayer::prepare()
+{
+    if(!_impl->is_prepared)
+    {
+        _impl->op->prepare(_impl->prep_pack);
+
+        // Release temporary tensors that are only used in prepare stage
+        release_temporaries<Tensor>(_impl->aux_mem_req, _impl->workspace);
+
+        _impl->is_prepared = true;
+    }
 }
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2022 Arm Limited.
+ * Copyright (c) 2018-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,8 +25,10 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/utils/misc/ShapeCalculator.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "src/common/utils/Log.h"
 #include "src/core/CPP/Validate.h"
+#include "src/core/NEON/kernels/NEReductionMultiAxisKernel.h"
 #include "src/core/NEON/kernels/NEReductionOperationKernel.h"
 #include "src/core/helpers/AutoConfiguration.h"
 
@@ -86,12 +88,49 @@ Status validate_config(const ITensorInfo *input, const Coordinates &reduction_ax
     }
     return Status{};
 }
+
+/** Number of chunks in which the reduced dimensions should be split so that all the threads get some work
+ *
+ * @param[in] input          Source tensor info
+ * @param[in] reduction_axis Reduction axis vector, already wrapped around
+ *
+ * @return the number of chunks, 1 if the output rows alone are enough to keep the threads busy
+ */
+unsigned int compute_num_chunks(const ITensorInfo *input, const Coordinates &reduction_axis)
+{
+    size_t num_out_rows = 1;
+    size_t split_size   = 1;
+    for(size_t d = 1; d < 4; ++d)
+    {
+        bool reduced = false;
+        for(unsigned int i = 0; i < reduction_axis.num_dimensions(); ++i)
+        {
+            reduced |= (static_cast<size_t>(reduction_axis[i]) == d);
+        }
+        if(reduced)
+        {
+            split_size = input->dimension(d);
+        }
+        else
+        {
+            num_out_rows *= input->dimension(d);
+        }
+    }
+
+    const size_t num_threads = NEScheduler::get().num_threads();
+    if(num_out_rows >= num_threads)
+    {
+        return 1;
+    }
+    return static_cast<unsigned int>(std::min(num_threads, split_size));
+}
 } // namespace
 
 NEReduceMean::~NEReduceMean() = default;
 
 NEReduceMean::NEReduceMean(std::shared_ptr<IMemoryManager> memory_manager)
-    : _memory_group(std::move(memory_manager)), _reduction_kernels(), _reduced_outs(), _reshape(), _reduction_ops(), _keep_dims()
+    : _memory_group(std::move(memory_manager)), _reduction_kernels(), _reduced_outs(), _reshape(), _reduction_ops(), _keep_dims(), _multi_axis_kernel(), _partials(),
+      _split_reduction(false)
 {
 }
 
@@ -110,10 +149,34 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
     const TensorShape output_shape = arm_compute::misc::shape_calculator::calculate_reduce_mean_shape(input->info(), reduction_axis, keep_dims);
     auto_init_if_empty(*output->info(), input->info()->clone()->set_tensor_shape(output_shape));
 
-    _reduction_ops = reduction_axis.num_dimensions();
+    _reduction_ops   = reduction_axis.num_dimensions();
+    _keep_dims       = keep_dims;
+    _split_reduction = false;
+
+    // Floating point inputs are reduced over all the axes at once, reading the input a single time
+    if(NEReductionMultiAxisKernel::validate(input->info(), output->info(), reduction_axis, keep_dims))
+    {
+        Coordinates axis_local = reduction_axis;
+        convert_negative_axis(axis_local, input->info()->num_dimensions());
+        const unsigned int num_chunks = compute_num_chunks(input->info(), axis_local);
+
+        _multi_axis_kernel = std::make_unique<NEReductionMultiAxisKernel>();
+        if(num_chunks > 1)
+        {
+            _split_reduction = true;
+            _memory_group.manage(&_partials);
+            _multi_axis_kernel->configure(input, output, reduction_axis, keep_dims, num_chunks, &_partials);
+            _partials.allocator()->allocate();
+        }
+        else
+        {
+            _multi_axis_kernel->configure(input, output, reduction_axis, keep_dims);
+        }
+        return;
+    }
+
     _reduction_kernels.resize(_reduction_ops);
     _reduced_outs.resize(_reduction_ops - (keep_dims ? 1 : 0));
-    _keep_dims = keep_dims;
 
     ITensor *tmp_input  = input;
     ITensor *tmp_output = output;
@@ -166,6 +229,15 @@ void NEReduceMean::configure(ITensor *input, const Coordinates &reduction_axis,
 void NEReduceMean::run()
 {
     MemoryGroupResourceScope scope_mg(_memory_group);
+    if(_multi_axis_kernel != nullptr)
+    {
+        NEScheduler::get().schedule(_multi_axis_kernel.get(), _multi_axis_kernel->split_dimension());
+        if(_split_reduction)
+        {
+            _multi_axis_kernel->combine_partials();
+        }
+        return;
+    }
     for(auto &kernel : _reduction_kernels)
     {
         kernel.run();
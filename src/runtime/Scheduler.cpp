@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020 Arm Limited.
+ * Copyright (c) 2017-2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/Scheduler.h"
 
 #include "arm_compute/core/Error.h"
+#include "src/runtime/SchedulerScope.h"
 
 #if ARM_COMPUTE_CPP_SCHEDULER
 #include "arm_compute/runtime/CPP/CPPScheduler.h"
@@ -93,6 +94,13 @@ Scheduler::Type Scheduler::get_type()
 
 IScheduler &Scheduler::get()
 {
+    // A queue with its own thread pool takes precedence on the threads running its work
+    IScheduler *scoped = SchedulerScope::current();
+    if(scoped != nullptr)
+    {
+        return *scoped;
+    }
+
     if(_scheduler_type == Type::CUSTOM)
     {
         if(_custom_scheduler == nullptr)
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/runtime/SchedulerScope.h"
+
+namespace arm_compute
+{
+namespace
+{
+#ifndef NO_MULTI_THREADING
+thread_local IScheduler *scoped_scheduler = nullptr;
+#else  /* NO_MULTI_THREADING */
+IScheduler *scoped_scheduler = nullptr;
+#endif /* NO_MULTI_THREADING */
+} // namespace
+
+SchedulerScope::SchedulerScope(IScheduler &scheduler)
+    : _previous(scoped_scheduler)
+{
+    scoped_scheduler = &scheduler;
+}
+
+SchedulerScope::~SchedulerScope()
+{
+    scoped_scheduler = _previous;
+}
+
+IScheduler *SchedulerScope::current()
+{
+    return scoped_scheduler;
+}
+} // namespace arm_compute
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef SRC_RUNTIME_SCHEDULERSCOPE_H
+#define SRC_RUNTIME_SCHEDULERSCOPE_H
+
+#include "arm_compute/runtime/IScheduler.h"
+
+namespace arm_compute
+{
+/** RAII object making a scheduler the one returned by @ref Scheduler::get() on the calling thread for its lifetime
+ *
+ * Used to run the functions and operators of a queue on the thread pool of that queue.
+ * Scopes can be nested, the previous scheduler is restored on destruction.
+ */
+class SchedulerScope
+{
+public:
+    /** Constructor
+     *
+     * @param[in] scheduler Scheduler to use on the calling thread. Must outlive the scope.
+     */
+    explicit SchedulerScope(IScheduler &scheduler);
+    /** Prevent instances of this class from being copied */
+    SchedulerScope(const SchedulerScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    SchedulerScope &operator=(const SchedulerScope &) = delete;
+    /** Restore the previous scheduler of the calling thread */
+    ~SchedulerScope();
+
+    /** Scheduler set by the innermost scope of the calling thread
+     *
+     * @return The scoped scheduler, nullptr if the calling thread is not within a scope
+     */
+    static IScheduler *current();
+
+private:
+    IScheduler *_previous;
+};
+} // namespace arm_compute
+#endif /* SRC_RUNTIME_SCHEDULERSCOPE_H */
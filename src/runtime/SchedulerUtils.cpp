@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,7 +25,10 @@
 
 #include "arm_compute/core/Error.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <numeric>
 
 namespace arm_compute
 {
@@ -78,6 +81,40 @@ std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std:
         return { 1, std::min<unsigned>(n, max_threads) };
     }
 }
+
+std::vector<std::size_t> split_by_weights(std::size_t num_iterations, const std::vector<unsigned int> &weights)
+{
+    const uint64_t total_weight = std::accumulate(weights.begin(), weights.end(), uint64_t(0));
+    ARM_COMPUTE_ERROR_ON(total_weight == 0);
+
+    // Floor of each ideal share, then give one more iteration to the largest remainders
+    const std::size_t        num_chunks = weights.size();
+    std::vector<std::size_t> sizes(num_chunks);
+    std::vector<uint64_t>    remainders(num_chunks);
+    std::size_t              assigned = 0;
+    for(std::size_t i = 0; i < num_chunks; ++i)
+    {
+        const uint64_t share = static_cast<uint64_t>(num_iterations) * weights[i];
+        sizes[i]             = static_cast<std::size_t>(share / total_weight);
+        remainders[i]        = share % total_weight;
+        assigned += sizes[i];
+    }
+
+    std::vector<std::size_t> order(num_chunks);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&remainders](std::size_t lhs, std::size_t rhs)
+    {
+        return remainders[lhs] > remainders[rhs];
+    });
+    for(std::size_t i = 0; assigned < num_iterations; ++i, ++assigned)
+    {
+        ++sizes[order[i % num_chunks]];
+    }
+
+    std::vector<std::size_t> offsets(num_chunks + 1, 0);
+    std::partial_sum(sizes.begin(), sizes.end(), offsets.begin() + 1);
+    return offsets;
+}
 #endif /* #ifndef BARE_METAL */
 } // namespace scheduler_utils
 } // namespace arm_compute
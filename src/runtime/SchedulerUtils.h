@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020 Arm Limited.
+ * Copyright (c) 2020, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@
 
 #include <cstddef>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -40,6 +41,18 @@ namespace scheduler_utils
  * @returns [m_nthreads, n_nthreads] A pair of the threads that should be used in each dimension
  */
 std::pair<unsigned, unsigned> split_2d(unsigned max_threads, std::size_t m, std::size_t n);
+
+/** Split a range of iterations in contiguous chunks whose sizes are proportional to the given weights
+ *
+ * The remainder of the integer division is handed out to the chunks with the largest fractional parts,
+ * so that the sizes of the chunks add up to @p num_iterations.
+ *
+ * @param[in] num_iterations Number of iterations to split
+ * @param[in] weights        Weight of each chunk. Must not be empty nor contain only zeros.
+ *
+ * @returns The first iteration of each chunk followed by @p num_iterations, i.e. weights.size() + 1 values
+ */
+std::vector<std::size_t> split_by_weights(std::size_t num_iterations, const std::vector<unsigned int> &weights);
 } // namespace scheduler_utils
 } // namespace arm_compute
 #endif /* SRC_COMPUTE_SCHEDULER_UTILS_H */
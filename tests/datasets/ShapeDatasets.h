@@ -1188,7 +1188,8 @@ public:
     Large2DNonMaxSuppressionShapes()
         : ShapeDataset("Shape",
     {
-        TensorShape{ 4U, 113U }
+        TensorShape{ 4U, 113U },
+        TensorShape{ 4U, 1000U }
     })
     {
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -51,6 +51,18 @@ public:
     }
 };
 
+class SmallGEMVDataset final : public GEMMDataset
+{
+public:
+    SmallGEMVDataset()
+    {
+        add_config(TensorShape(1021U, 1U), TensorShape(17U, 1021U), TensorShape(17U, 1U), TensorShape(17U, 1U), 1.0f, 0.0f);
+        add_config(TensorShape(512U, 1U), TensorShape(5U, 512U), TensorShape(5U, 1U), TensorShape(5U, 1U), 1.0f, 1.0f);
+        add_config(TensorShape(768U, 1U), TensorShape(23U, 768U), TensorShape(23U, 1U), TensorShape(23U, 1U), 0.4f, 0.7f);
+        add_config(TensorShape(2048U, 1U), TensorShape(40U, 2048U), TensorShape(40U, 1U), TensorShape(40U, 1U), 1.0f, 0.0f);
+    }
+};
+
 class SmallGEMMOutput3DDataset final : public GEMMDataset
 {
 public:
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,31 @@ public:
         _real_scheduler.set_num_threads_with_affinity(num_threads, func);
     }
 
+    void set_core_policy(CorePolicy policy) override
+    {
+        _real_scheduler.set_core_policy(policy);
+    }
+
+    CorePolicy core_policy() const override
+    {
+        return _real_scheduler.core_policy();
+    }
+
+    void set_imbalance_stats_enabled(bool enable) override
+    {
+        _real_scheduler.set_imbalance_stats_enabled(enable);
+    }
+
+    std::map<std::string, ImbalanceStats> imbalance_stats() const override
+    {
+        return _real_scheduler.imbalance_stats();
+    }
+
+    void reset_imbalance_stats() override
+    {
+        _real_scheduler.reset_imbalance_stats();
+    }
+
     unsigned int num_threads() const override
     {
         return _real_scheduler.num_threads();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -166,6 +166,12 @@ AbsoluteTolerance<uint8_t> tolerance_qasymm8(ActivationLayerInfo::ActivationFunc
 
 constexpr AbsoluteTolerance<int16_t> tolerance_qsymm16(1);
 
+/** Tolerances of the fast approximations of the transcendental functions */
+constexpr AbsoluteTolerance<float> tolerance_fast_math_f32(0.001f);
+#ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
+constexpr AbsoluteTolerance<float> tolerance_fast_math_f16(0.01f);
+#endif /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
+
 /** CNN data types */
 const auto CNNDataTypes = framework::dataset::make("DataType",
 {
@@ -181,6 +187,15 @@ const auto NeonActivationFunctionsDataset = concat(datasets::ActivationFunctions
 /** Input data sets. */
 const auto ActivationDataset = combine(combine(framework::dataset::make("InPlace", { false, true }), NeonActivationFunctionsDataset), framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
 
+/** Activation functions with a fast approximation */
+const auto FastMathActivationDataset = combine(combine(framework::dataset::make("InPlace", { false }),
+                                                       framework::dataset::make("ActivationFunction", { ActivationLayerInfo::ActivationFunction::LOGISTIC,
+                                                                                                        ActivationLayerInfo::ActivationFunction::TANH,
+                                                                                                        ActivationLayerInfo::ActivationFunction::SWISH,
+                                                                                                        ActivationLayerInfo::ActivationFunction::GELU
+                                                                                                      })),
+                                               framework::dataset::make("AlphaBeta", { 0.5f, 1.f }));
+
 template <typename T, ARM_COMPUTE_REQUIRES_TA(arm_compute::utils::traits::is_floating_point<T>::value)>
 void test_float_sqrt_boundary_value()
 {
@@ -262,6 +277,10 @@ TEST_CASE(ActivationAPI, framework::DatasetMode::ALL)
     // Execute operator
     err = act.run(queue, pack);
     ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    // Wait for the operator to complete before the tensors get destroyed
+    err = queue.finish();
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
 }
 
 // *INDENT-OFF*
@@ -313,7 +332,7 @@ DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL, concat(concat(
     cpu_isa.sve2 = (cpu_ext == "SVE2");
     cpu_isa.fp16 = (data_type == DataType::F16);
 
-    const auto *selected_impl = CpuActivationKernel::get_implementation(ActivationDataTypeISASelectorData{data_type, CPUModel::GENERIC, cpu_isa,ActivationLayerInfo::ActivationFunction::BOUNDED_RELU}, cpu::KernelSelectionType::Preferred);
+    const auto *selected_impl = CpuActivationKernel::get_implementation(ActivationDataTypeISASelectorData{data_type, CPUModel::GENERIC, cpu_isa,ActivationLayerInfo::ActivationFunction::BOUNDED_RELU, false}, cpu::KernelSelectionType::Preferred);
 
     ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
 
@@ -322,11 +341,37 @@ DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL, concat(concat(
 
     ARM_COMPUTE_EXPECT_EQUAL(expected, actual, framework::LogLevel::ERRORS);
 }
+
+DATA_TEST_CASE(KernelSelectionLut16, framework::DatasetMode::ALL, combine(
+               framework::dataset::make("DataType", { DataType::F16, DataType::QSYMM16 }),
+               framework::dataset::make("ActivationFunction", { ActivationLayerInfo::ActivationFunction::LOGISTIC,
+                                                                ActivationLayerInfo::ActivationFunction::TANH })),
+               data_type, function)
+{
+    using namespace cpu::kernels;
+
+    cpuinfo::CpuIsaInfo cpu_isa{};
+    cpu_isa.neon = true;
+    cpu_isa.sve  = true;
+    cpu_isa.sve2 = true;
+    cpu_isa.fp16 = (data_type == DataType::F16);
+
+    const auto *selected_impl = CpuActivationKernel::get_implementation(ActivationDataTypeISASelectorData{data_type, CPUModel::GENERIC, cpu_isa, function, false}, cpu::KernelSelectionType::Preferred);
+
+    ARM_COMPUTE_ERROR_ON_NULLPTR(selected_impl);
+
+    std::string expected = "neon_" + cpu_impl_dt(data_type) + "_activation_lut";
+    std::string actual   = selected_impl->name;
+
+    ARM_COMPUTE_EXPECT_EQUAL(expected, actual, framework::LogLevel::ERRORS);
+}
 // clang-format on
 // *INDENT-ON*
 
 template <typename T>
 using NEActivationLayerFixture = ActivationValidationFixture<Tensor, Accessor, NEActivationLayer, T>;
+template <typename T>
+using NEActivationLayerFastMathFixture = ActivationValidationFastMathFixture<Tensor, Accessor, NEActivationLayer, T>;
 
 TEST_SUITE(Float)
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -342,6 +387,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerFixture<half>, framework::Data
     // Validate output
     validate(Accessor(_target), _reference, relative_tolerance(_data_type, _function), 0.f, absolute_tolerance(_data_type, _function));
 }
+FIXTURE_DATA_TEST_CASE(RunFastMath, NEActivationLayerFastMathFixture<half>, framework::DatasetMode::ALL, combine(combine(datasets::SmallShapes(), FastMathActivationDataset),
+                                                                                                                 framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, relative_tolerance(_data_type, _function), 0.f, tolerance_fast_math_f16);
+}
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
@@ -357,6 +408,12 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEActivationLayerFixture<float>, framework::Dat
     // Validate output
     validate(Accessor(_target), _reference, relative_tolerance(_data_type, _function), 0.f, absolute_tolerance(_data_type, _function));
 }
+FIXTURE_DATA_TEST_CASE(RunFastMath, NEActivationLayerFastMathFixture<float>, framework::DatasetMode::ALL, combine(combine(datasets::SmallShapes(), FastMathActivationDataset),
+                                                                                                                  framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, relative_tolerance(_data_type, _function), 0.f, tolerance_fast_math_f32);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/ArithmeticOperationsFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -70,6 +71,50 @@ const auto OutOfPlaceDataSet = framework::dataset::make("InPlace", { false });
 TEST_SUITE(NEON)
 TEST_SUITE(ArithmeticSubtraction)
 
+/** Test case for the elementwise operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created for a subtraction that broadcasts the second input
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the difference of the inputs
+ */
+TEST_CASE(ElementwiseAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorDescriptor src0_info({ 4, 2 }, acl::DataType::Float32);
+    acl::TensorDescriptor src1_info({ 4, 1 }, acl::DataType::Float32);
+    acl::TensorDescriptor dst_info({ 4, 2 }, acl::DataType::Float32);
+    acl::ElementwiseDesc  desc{ AclElementwiseSub };
+
+    acl::Elementwise sub(ctx, src0_info, src1_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src0 = create_acl_tensor(ctx, src0_info);
+    acl::Tensor src1 = create_acl_tensor(ctx, src1_info);
+    acl::Tensor dst  = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src0, std::vector<float> { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f });
+    fill_acl_tensor(src1, std::vector<float> { 1.f, 2.f, 3.f, 4.f });
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src0, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(src1, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, sub, pack);
+
+    const std::vector<float> expected{ -1.f, -1.f, -1.f, -1.f, 3.f, 3.f, 3.f, 3.f };
+    const std::vector<float> out = read_acl_tensor<float>(dst, expected.size());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(out[i] == expected[i], framework::LogLevel::ERRORS);
+    }
+}
+
 template <typename T>
 using NEArithmeticSubtractionFixture = ArithmeticSubtractionValidationFixture<Tensor, Accessor, NEArithmeticSubtraction, T>;
 
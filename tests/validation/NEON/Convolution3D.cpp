@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -72,6 +72,22 @@ const auto data_precommit = combine(combine(zip(zip(zip(zip(zip(zip(zip(zip(zip(
                                                 framework::dataset::make("NumKernels", { 2, 3, 8 })),
                                             framework::dataset::make("HasBias", { true, false })),
                                     ActivationFunctionsDataset);
+
+const auto data_dilated = zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(zip(
+                                                                            datasets::SmallDirectConv3DShapes(),
+                                                                            framework::dataset::make("StrideX", { 1, 2, 1 })),
+                                                                        framework::dataset::make("StrideY", { 1, 1, 2 })),
+                                                                    framework::dataset::make("StrideZ", { 1, 1, 1 })),
+                                                                framework::dataset::make("PadX", { 1, 0, 2 })),
+                                                            framework::dataset::make("PadY", { 1, 1, 0 })),
+                                                        framework::dataset::make("PadZ", { 1, 2, 0 })),
+                                                    framework::dataset::make("KernelWidth", { 3, 3, 5 })),
+                                                framework::dataset::make("KernelHeight", { 2, 3, 3 })),
+                                            framework::dataset::make("KernelDepth", { 2, 2, 1 })),
+                                        framework::dataset::make("NumKernels", { 2, 3, 8 })),
+                                    framework::dataset::make("HasBias", { true, false, true })),
+                                framework::dataset::make("ActivationInfo", { ActivationLayerInfo(), ActivationLayerInfo(), ActivationLayerInfo() })),
+                            framework::dataset::make("Dilation", { Size3D(2U, 2U, 2U), Size3D(3U, 1U, 2U), Size3D(2U, 3U, 1U) }));
 } // namespace
 
 TEST_SUITE(NEON)
@@ -128,6 +144,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
 
 template <typename T>
 using NEDirectConvolution3DFixture = DirectConvolution3DValidationFixture<Tensor, Accessor, NEConv3D, T>;
+template <typename T>
+using NEDirectConvolution3DDilatedFixture = DirectConvolution3DValidationDilatedFixture<Tensor, Accessor, NEConv3D, T>;
 
 TEST_SUITE(Float)
 TEST_SUITE(FP32)
@@ -138,6 +156,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<float>, framework:
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDirectConvolution3DDilatedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(data_dilated,
+                                                                                                                        framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                        framework::dataset::make("DataLayout", { DataLayout::NDHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 TEST_SUITE_END() // FP32
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -149,6 +174,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DFixture<half>, framework::
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDirectConvolution3DDilatedFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(data_dilated,
+                                                                                                                       framework::dataset::make("DataType", DataType::F16)),
+                                                                                                                       framework::dataset::make("DataLayout", { DataLayout::NDHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
+}
 TEST_SUITE_END() // FP16
 #endif           /* __ARM_FEATURE_FP16_VECTOR_ARITHMETIC */
 
@@ -156,6 +188,8 @@ TEST_SUITE_END() // Float
 
 template <typename T>
 using NEDirectConvolution3DQuantizedFixture = DirectConvolution3DValidationQuantizedFixture<Tensor, Accessor, NEConv3D, T>;
+template <typename T>
+using NEDirectConvolution3DQuantizedDilatedFixture = DirectConvolution3DValidationQuantizedDilatedFixture<Tensor, Accessor, NEConv3D, T>;
 
 TEST_SUITE(Quantized)
 TEST_SUITE(QASYMM8)
@@ -186,6 +220,16 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolution3DQuantizedFixture<uint8_t>,
 {
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDirectConvolution3DQuantizedDilatedFixture<uint8_t>, framework::DatasetMode::PRECOMMIT,
+                       combine(combine(combine(combine(combine(data_dilated,
+                                                               framework::dataset::make("DataType", DataType::QASYMM8)),
+                                                       framework::dataset::make("DataLayout", DataLayout::NDHWC)),
+                                               framework::dataset::make("SrcQuantizationInfo", QuantizationInfo(0.1f, 10))),
+                                       framework::dataset::make("WeightsQuantizationInfo", QuantizationInfo(0.3f, 20))),
+                               framework::dataset::make("DstQuantizationInfo", QuantizationInfo(0.2f, 5))))
+{
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 
 TEST_SUITE_END() // QASYMM8
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "src/cpu/operators/CpuWinogradConv2d.h"
 #include "tests/NEON/Accessor.h"
 #include "tests/PaddingCalculator.h"
+#include "tests/datasets/DilatedConvolutionLayerDataset.h"
 #include "tests/datasets/LargeConvolutionLayerDataset.h"
 #include "tests/datasets/SmallConvolutionLayerDataset.h"
 #include "tests/datasets/TinyConvolutionLayerDataset.h"
@@ -42,6 +43,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/ConvolutionLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 #include "tests/validation/fixtures/WinogradConvolutionLayerFixture.h"
 
 namespace arm_compute
@@ -124,29 +126,45 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
                                           framework::dataset::make("InputInfo", { TensorInfo(TensorShape(18U, 18U, 32U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(23U, 27U, 32U, 4U), 1, DataType::F32),
                                                                                   TensorInfo(TensorShape(3U, 3U, 2U, 1U), 1, DataType::F32),
-                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32)
+                                                                                  TensorInfo(TensorShape(33U, 27U, 7U, 4U), 1, DataType::F32),
+                                                                                  TensorInfo(TensorShape(3U, 224U, 224U), 1, DataType::F32, DataLayout::NHWC),
+                                                                                  TensorInfo(TensorShape(16U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC),
+                                                                                  TensorInfo(TensorShape(16U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC)
                                           }),
                                           framework::dataset::make("WeightsInfo", { TensorInfo(TensorShape(3U, 3U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(5U, 5U, 32U, 21U), 1, DataType::F32),
                                                                                     TensorInfo(TensorShape(3U, 3U, 5U, 21U), 1, DataType::F32),
-                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16)
+                                                                                    TensorInfo(TensorShape(5U, 5U, 7U, 16U), 1, DataType::F16),
+                                                                                    TensorInfo(TensorShape(3U, 7U, 7U, 64U), 1, DataType::F32, DataLayout::NHWC),
+                                                                                    TensorInfo(TensorShape(16U, 1U, 1U, 32U), 1, DataType::F32, DataLayout::NHWC),
+                                                                                    TensorInfo(TensorShape(16U, 1U, 1U, 32U), 1, DataType::F32, DataLayout::NHWC)
                                           })),
                                           framework::dataset::make("OutputInfo", { TensorInfo(TensorShape(16U, 16U, 21U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(19U, 23U, 21U, 4U), 1, DataType::F32),
                                                                                    TensorInfo(TensorShape(11U, 25U, 21U), 1, DataType::F32),
-                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32)
+                                                                                   TensorInfo(TensorShape(11U, 12U, 16U, 4U), 1, DataType::F32),
+                                                                                   TensorInfo(TensorShape(64U, 112U, 112U), 1, DataType::F32, DataLayout::NHWC),
+                                                                                   TensorInfo(TensorShape(32U, 4U, 4U), 1, DataType::F32, DataLayout::NHWC),   // Strided 1x1 needs im2col: implicit GEMM
+                                                                                   TensorInfo(TensorShape(32U, 8U, 8U), 1, DataType::F32, DataLayout::NHWC)    // Unit stride 1x1 skips im2col: GEMM
                                           })),
                                           framework::dataset::make("ConvInfo", { PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(1, 1, 0, 0),
                                                                                  PadStrideInfo(2, 1, 0, 0),
-                                                                                 PadStrideInfo(3, 2, 1, 0)
+                                                                                 PadStrideInfo(3, 2, 1, 0),
+                                                                                 PadStrideInfo(2, 2, 3, 3),
+                                                                                 PadStrideInfo(2, 2, 0, 0),
+                                                                                 PadStrideInfo(1, 1, 0, 0)
                                           })),
                                           framework::dataset::make("FastMath", { true,
                                                                                  true,
                                                                                  false,
+                                                                                 false,
+                                                                                 false,
+                                                                                 false,
                                                                                  false
                                           })),
-                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM })),
+                                                                           framework::dataset::make("Expected", { ConvolutionMethod::WINOGRAD, ConvolutionMethod::WINOGRAD, ConvolutionMethod::GEMM, ConvolutionMethod::GEMM, ConvolutionMethod::DIRECT,
+                                                                                                                  ConvolutionMethod::GEMM_CONV2D, ConvolutionMethod::GEMM })),
                input_info, weights_info, output_info, conv_info, fast_math, expected)
 {
     ConvolutionMethod is_valid = NEConvolutionLayer::get_convolution_method(&input_info.clone()->set_is_resizable(true),
@@ -156,6 +174,56 @@ DATA_TEST_CASE(ValidateConvolutionMethod, framework::DatasetMode::ALL, zip(zip(z
 }
 // clang-format on
 // *INDENT-ON*
+
+/** Test case for the convolution operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created for a NHWC convolution
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the sum over the receptive field plus the bias
+ */
+TEST_CASE(ConvolutionAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    // 3x3 convolution of a 5x5x4 input producing 2 channels
+    acl::TensorDescriptor src_info({ 4, 5, 5, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor weights_info({ 4, 3, 3, 2 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor bias_info({ 2 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor dst_info({ 2, 3, 3, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::Conv2dDesc       desc{};
+    desc.pad_stride.stride_x = 1;
+    desc.pad_stride.stride_y = 1;
+
+    acl::Conv2d conv(ctx, src_info, weights_info, &bias_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src     = create_acl_tensor(ctx, src_info);
+    acl::Tensor weights = create_acl_tensor(ctx, weights_info);
+    acl::Tensor bias    = create_acl_tensor(ctx, bias_info);
+    acl::Tensor dst     = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<float>(4 * 5 * 5, 1.f));
+    fill_acl_tensor(weights, std::vector<float>(4 * 3 * 3 * 2, 1.f));
+    fill_acl_tensor(bias, std::vector<float>(2, 0.5f));
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(weights, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(bias, ACL_SRC_2) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, conv, pack);
+
+    for(float out : read_acl_tensor<float>(dst, 2 * 3 * 3))
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out - 36.5f) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
 TEST_SUITE_END() // ConvolutionLayer
 
 TEST_SUITE(WinogradLayer)
@@ -1219,6 +1287,18 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectGEMMConv2dLayerFixture<float>, framewor
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
 }
+FIXTURE_DATA_TEST_CASE(RunSmallDilated, NEDirectGEMMConv2dLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallDilatedConvolutionLayerDataset(),
+                                                                                                                            framework::dataset::make("ReshapeWeights", { true })), framework::dataset::make("DataType", DataType::F32)), framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })), ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
+FIXTURE_DATA_TEST_CASE(RunSmallGrouped, NEDirectGEMMConv2dLayerFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                                                                                                                            framework::dataset::make("ReshapeWeights", { true })), framework::dataset::make("DataType", DataType::F32)), framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })), ActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, rel_tolerance_f32, 0.f, float(abs_tolerance_f32));
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -1244,6 +1324,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectGEMMConv2dLayerQuantizedFixture<uint8_t
     // Validate output
     validate(Accessor(_target), _reference, tolerance_qasymm8);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGrouped, NEDirectGEMMConv2dLayerQuantizedFixture<uint8_t>, framework::DatasetMode::ALL, combine(combine(combine(combine(combine(datasets::SmallGroupedConvolutionLayerDataset(),
+                                                                                                                               framework::dataset::make("ReshapeWeights", { true })), framework::dataset::make("DataType", DataType::QASYMM8)), framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
+                                                                                                                               framework::dataset::make("QuantizationInfo", { QuantizationInfo(2.f / 255.f, 10) })), QuantizedActivationFunctionsDataset))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_qasymm8);
+}
 TEST_SUITE_END() // QASYMM8
 
 TEST_SUITE(QASYMM8_SIGNED)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022 Arm Limited.
+ * Copyright (c) 2017-2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/DepthwiseConvolutionLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -73,6 +74,64 @@ const auto input_qinfo_dataset = framework::dataset::make("InputQInfo",
 TEST_SUITE(NEON)
 TEST_SUITE(DepthwiseConvolutionLayer)
 
+/** Test case for the depthwise convolution operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created for a NHWC depthwise convolution
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the sum over the receptive field of its channel, scaled by the weights of the channel, plus the bias
+ */
+TEST_CASE(DepthwiseConvolutionAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    // 3x3 depthwise convolution of a 4x4x2 input
+    acl::TensorDescriptor   src_info({ 2, 4, 4, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor   weights_info({ 2, 3, 3 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor   bias_info({ 2 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor   dst_info({ 2, 2, 2, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::DepthwiseConv2dDesc desc{};
+    desc.pad_stride.stride_x = 1;
+    desc.pad_stride.stride_y = 1;
+    desc.depth_multiplier    = 1;
+
+    acl::DepthwiseConv2d dwc(ctx, src_info, weights_info, &bias_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src     = create_acl_tensor(ctx, src_info);
+    acl::Tensor weights = create_acl_tensor(ctx, weights_info);
+    acl::Tensor bias    = create_acl_tensor(ctx, bias_info);
+    acl::Tensor dst     = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<float>(2 * 4 * 4, 1.f));
+    // The weights of the first channel are 1, the ones of the second channel 2
+    std::vector<float> weights_values(2 * 3 * 3);
+    for(size_t i = 0; i < weights_values.size(); ++i)
+    {
+        weights_values[i] = (i % 2 == 0) ? 1.f : 2.f;
+    }
+    fill_acl_tensor(weights, weights_values);
+    fill_acl_tensor(bias, std::vector<float>(2, 0.5f));
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(weights, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(bias, ACL_SRC_2) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, dwc, pack);
+
+    const std::vector<float> out = read_acl_tensor<float>(dst, 2 * 2 * 2);
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        const float expected = (i % 2 == 0) ? 9.5f : 18.5f;
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - expected) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate3x3, framework::DatasetMode::ALL, zip(zip(zip(zip(zip(zip(zip(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/DequantizationLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -92,6 +93,45 @@ const auto dataset_nightly_f32   = concat(dataset_quant_f32, dataset_quant_per_c
 TEST_SUITE(NEON)
 TEST_SUITE(DequantizationLayer)
 
+/** Test case for the dequantization operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created with the quantization parameters of the source descriptor
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is dequantized with the scale and (negative) offset of the descriptor
+ */
+TEST_CASE(DequantizationAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorDescriptor src_info({ 4 }, acl::DataType::QAsymmInt8, acl::DataLayout::Nchw, 0.25f, -3);
+    acl::TensorDescriptor dst_info({ 4 }, acl::DataType::Float32);
+
+    acl::Dequantize dequantize(ctx, src_info, dst_info, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src = create_acl_tensor(ctx, src_info);
+    acl::Tensor dst = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<int8_t> { -3, 1, -7, 5 });
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, dequantize, pack);
+
+    const std::vector<float> expected{ 0.f, 1.f, -1.f, 2.f };
+    const std::vector<float> out = read_acl_tensor<float>(dst, expected.size());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - expected[i]) < 1e-6f, framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
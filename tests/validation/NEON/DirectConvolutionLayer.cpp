@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -102,6 +102,15 @@ const auto data8x8 = combine(datasets::SmallDirectConvolutionShapes(),
                                                      combine(framework::dataset::make("PadY", { 0 }),
                                                              framework::dataset::make("KernelSize", 8))))));
 
+/** Direct convolution data set with few input channels, as in the first layer of a network */
+const auto data_small_channels = combine(framework::dataset::make("InputShape", { TensorShape(27U, 23U, 3U), TensorShape(19U, 21U, 4U, 2U) }),
+                                         combine(framework::dataset::make("StrideX", { 1, 2 }),
+                                                 combine(framework::dataset::make("StrideY", { 1, 2 }),
+                                                         combine(framework::dataset::make("PadX", { 1 }),
+                                                                 combine(framework::dataset::make("PadY", { 3 }),
+                                                                         combine(framework::dataset::make("KernelSize", { 3, 5, 7 }),
+                                                                                 framework::dataset::make("NumKernels", { 7, 16 })))))));
+
 const auto data_f32_nightly = combine(data_f32, framework::dataset::make("NumKernels", { 1, 4, 5 }));
 const auto data_f16_nightly = combine(data_f16, framework::dataset::make("NumKernels", { 1, 4, 5 }));
 
@@ -188,7 +197,7 @@ DATA_TEST_CASE(KernelSelection, framework::DatasetMode::ALL,
                               framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })),
                       combine(combine(framework::dataset::make("CpuExt", std::string("NEON")),
                                       framework::dataset::make("DataType", { DataType::F16 })),
-                              framework::dataset::make("DataLayout", { DataLayout::NCHW }))),
+                              framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC }))),
                cpu_ext, data_type, data_layout)
 {
     using namespace cpu::kernels;
@@ -339,7 +348,7 @@ TEST_SUITE(FP16)
 FIXTURE_DATA_TEST_CASE(RunSmall, NEDirectConvolutionLayerFixture<half>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_precommit, framework::dataset::make("DataType",
                                                                                                                    DataType::F16)),
                                                                                                                    ActivationFunctionsDataset),
-                                                                                                                   framework::dataset::make("DataLayout", DataLayout::NCHW)))
+                                                                                                                   framework::dataset::make("DataLayout", { DataLayout::NCHW, DataLayout::NHWC })))
 {
     // Validate output
     validate(Accessor(_target), _reference, rel_tolerance_f16, tolerance_num, abs_tolerance_f16);
@@ -389,6 +398,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall9x9, NEDirectConvolutionLayerFixture<float>, fram
     // Validate output
     validate(Accessor(_target), _reference, tolerance_fp32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallChannels, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(combine(data_small_channels, framework::dataset::make("DataType",
+                                                                                                                           DataType::F32)),
+                                                                                                                           ActivationFunctionsDataset),
+                                                                                                                           framework::dataset::make("DataLayout", { DataLayout::NHWC })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_fp32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NEDirectConvolutionLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(data_f32_nightly, framework::dataset::make("DataType",
                                                                                                                   DataType::F32)),
                                                                                                                   ActivationFunctionsDataset),
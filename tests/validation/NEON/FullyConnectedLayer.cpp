@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/FullyConnectedLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -96,6 +97,56 @@ const auto ActivationFunctionsQuantizedDataset = framework::dataset::make("Activ
 TEST_SUITE(NEON)
 TEST_SUITE(FullyConnectedLayer)
 
+/** Test case for the fully connected operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created with weights stored as [num_inputs, num_outputs]
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the sum of the inputs plus the bias of its output
+ */
+TEST_CASE(FullyConnectedAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    // 4 inputs, 3 outputs and a batch of 2
+    acl::TensorDescriptor  src_info({ 4, 2 }, acl::DataType::Float32);
+    acl::TensorDescriptor  weights_info({ 4, 3 }, acl::DataType::Float32);
+    acl::TensorDescriptor  bias_info({ 3 }, acl::DataType::Float32);
+    acl::TensorDescriptor  dst_info({ 3, 2 }, acl::DataType::Float32);
+    acl::FullyConnectedDesc desc{};
+    desc.transpose_weights = true;
+    desc.constant_weights  = true;
+
+    acl::FullyConnected fc(ctx, src_info, weights_info, &bias_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src     = create_acl_tensor(ctx, src_info);
+    acl::Tensor weights = create_acl_tensor(ctx, weights_info);
+    acl::Tensor bias    = create_acl_tensor(ctx, bias_info);
+    acl::Tensor dst     = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<float>(4 * 2, 1.f));
+    fill_acl_tensor(weights, std::vector<float>(4 * 3, 1.f));
+    fill_acl_tensor(bias, std::vector<float> { 0.f, 1.f, 2.f });
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(weights, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(bias, ACL_SRC_2) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, fc, pack);
+
+    const std::vector<float> out = read_acl_tensor<float>(dst, 3 * 2);
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - (4.f + i % 3)) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 /** Test case for memory injection in @ref cpu::CpuFullyConnected.
  *
  * Configure the operator once and inject memory at run-time in multiple executions.
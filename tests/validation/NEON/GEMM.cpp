@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGEMM.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -43,6 +44,7 @@
 #include "tests/validation/fixtures/GEMMFixture.h"
 #include "tests/validation/fixtures/GEMMInterleave4x4Fixture.h"
 #include "tests/validation/fixtures/GEMMTranspose1xWFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -107,6 +109,59 @@ bool validate_gemm_zero_padding(const TensorShape shape0, const TensorShape shap
 TEST_SUITE(NEON)
 TEST_SUITE(GEMM)
 
+/** Test case for the GEMM operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created with constant weights and a scaling factor
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the scaled dot product of a row of a and a column of b
+ */
+TEST_CASE(GEMMAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    // d = 2 * a * b with a of 2 rows and 4 columns, b of 4 rows and 3 columns
+    acl::TensorDescriptor a_info({ 4, 2 }, acl::DataType::Float32);
+    acl::TensorDescriptor b_info({ 3, 4 }, acl::DataType::Float32);
+    acl::TensorDescriptor d_info({ 3, 2 }, acl::DataType::Float32);
+    acl::GemmDesc         desc{};
+    desc.alpha      = 2.f;
+    desc.beta       = 0.f;
+    desc.constant_b = true;
+
+    acl::Gemm gemm(ctx, a_info, b_info, nullptr, d_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor a = create_acl_tensor(ctx, a_info);
+    acl::Tensor b = create_acl_tensor(ctx, b_info);
+    acl::Tensor d = create_acl_tensor(ctx, d_info);
+    fill_acl_tensor(a, std::vector<float>(4 * 2, 1.f));
+    // Every element of the n-th column of b is n
+    std::vector<float> b_values(3 * 4);
+    for(size_t i = 0; i < b_values.size(); ++i)
+    {
+        b_values[i] = static_cast<float>(i % 3);
+    }
+    fill_acl_tensor(b, b_values);
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(a, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(b, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(d, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, gemm, pack);
+
+    const std::vector<float> out = read_acl_tensor<float>(d, 3 * 2);
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - 8.f * (i % 3)) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 /** Test case for memory injection in @ref cpu::CpuGemm.
  *
  * Configure the operator once and inject memory at run-time in multiple executions.
@@ -344,6 +399,24 @@ using NEGEMMFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T>;
 template <typename T>
 using NEBatchedMatMulFixture = GEMMValidationFixture<Tensor, Accessor, NEGEMM, T, true, false, false, false, false, true>;
 
+/** GEMM fixture configuring and running the function on several threads
+ *
+ * The pretransposed GEMV only splits K between the threads when there are fewer output blocks than threads.
+ */
+template <typename T>
+class NEGEMMMultiThreadedFixture : public NEGEMMFixture<T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape_a, TensorShape shape_b, TensorShape shape_c, TensorShape output_shape, float alpha, float beta, bool pretranspose, DataType data_type)
+    {
+        const unsigned int num_threads = NEScheduler::get().num_threads();
+        NEScheduler::get().set_num_threads(4);
+        NEGEMMFixture<T>::setup(shape_a, shape_b, shape_c, output_shape, alpha, beta, pretranspose, data_type);
+        NEScheduler::get().set_num_threads(num_threads);
+    }
+};
+
 TEST_SUITE(Float)
 DATA_TEST_CASE(ValidateZeroPadding, framework::DatasetMode::ALL, zip(framework::dataset::make("In0", { TensorShape(21U, 13U),
                                                                                                        TensorShape(31U, 1U),
@@ -414,6 +487,13 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMFixture<float>, framework::DatasetMode::N
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallGEMVSplitK, NEGEMMMultiThreadedFixture<float>, framework::DatasetMode::PRECOMMIT, combine(combine(datasets::SmallGEMVDataset(),
+                                                                                                                     framework::dataset::make("ReshapeWeights", { true })),
+                                                                                                             framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f);
+}
 
 TEST_SUITE(BATCHED_MATMUL)
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023 Arm Limited.
+ * Copyright (c) 2017-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -237,6 +237,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputFi
 {
     validate(Accessor(_target), _reference, tolerance_batched);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallQuantizeDown, NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputFixtureBatchedUnsigned, framework::DatasetMode::ALL,
+                       combine(combine(datasets::SmallGEMMLowpFusedOffsetOutputBatchedDataset(),
+                                       framework::dataset::make("DataType", { DataType::QASYMM8 })),
+                               framework::dataset::make("bool", { false })))
+{
+    validate(Accessor(_target), _reference, tolerance_batched);
+}
 TEST_SUITE_END() // QASYMM8
 
 using NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputFixtureBatchedSigned =
@@ -269,6 +276,20 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputFi
     // Validate output
     validate(Accessor(_target), _reference, tolerance_quant);
 }
+
+/** Unsigned Matrix A with a signed per-channel Matrix B, with and without converting Matrix A to signed before the multiplication */
+using NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputPerChannelFixture =
+    GEMMLowpMatrixMultiplyCoreFusedOffsetOutputGenericValidationFixture<Tensor, Accessor, NEGEMMLowpMatrixMultiplyCore, false, false, uint8_t, int8_t>;
+TEST_SUITE(PerChannel)
+FIXTURE_DATA_TEST_CASE(RunSmall, NEGEMMLowpMatrixMultiplyCoreFusedOffsetOutputPerChannelFixture, framework::DatasetMode::ALL,
+                       combine(combine(datasets::SmallGEMMLowpFusedOffsetOutputPerChannelDataset(),
+                                       framework::dataset::make("DataType", { DataType::QSYMM8_PER_CHANNEL })),
+                               framework::dataset::make("reshape_b_only_on_first_run", { true, false })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_quant);
+}
+TEST_SUITE_END() // PerChannel
 TEST_SUITE_END() // FusedOffsetOutput
 TEST_SUITE_END() // MatrixMultiplyCore
 TEST_SUITE_END() // GEMMLowp
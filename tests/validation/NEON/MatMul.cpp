@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Arm Limited.
+ * Copyright (c) 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "tests/datasets/LargeMatMulDataset.h"
 #include "tests/datasets/SmallMatMulDataset.h"
 #include "tests/validation/fixtures/MatMulFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -50,6 +51,51 @@ constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8(0);
 constexpr AbsoluteTolerance<uint8_t> tolerance_qasymm8_signed(0);
 #endif // __aarch64__
 
+/** Test case for the MatMul operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created for operands that are both provided at run time
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the sum of a row of the left-hand side
+ */
+TEST_CASE(MatMulAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    // lhs of 2 rows and 3 columns, rhs of 3 rows and 2 columns
+    acl::TensorDescriptor lhs_info({ 3, 2 }, acl::DataType::Float32);
+    acl::TensorDescriptor rhs_info({ 2, 3 }, acl::DataType::Float32);
+    acl::TensorDescriptor dst_info({ 2, 2 }, acl::DataType::Float32);
+    acl::MatMulDesc       desc{};
+
+    acl::MatMul matmul(ctx, lhs_info, rhs_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor lhs = create_acl_tensor(ctx, lhs_info);
+    acl::Tensor rhs = create_acl_tensor(ctx, rhs_info);
+    acl::Tensor dst = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(lhs, std::vector<float> { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f });
+    fill_acl_tensor(rhs, std::vector<float>(2 * 3, 1.f));
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(lhs, ACL_SRC_0) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(rhs, ACL_SRC_1) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, matmul, pack);
+
+    const std::vector<float> expected{ 3.f, 3.f, 12.f, 12.f };
+    const std::vector<float> out = read_acl_tensor<float>(dst, expected.size());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - expected[i]) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 // clang-format off
 // *INDENT-OFF*
 // Validation Tests
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/functions/NEPadLayer.h"
+#include "arm_compute/runtime/SubTensor.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 #include "tests/NEON/Accessor.h"
@@ -184,6 +185,31 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPaddingFixture<uint8_t>, framework::DatasetMo
     // Validate output
     validate(Accessor(_target), _reference);
 }
+TEST_CASE(SubTensorInput, framework::DatasetMode::ALL)
+{
+    // The input is a sub-tensor of the interior of the output, as when padding into the border in graphs
+    const TensorShape input_shape(7U, 5U, 3U);
+    const PaddingList padding{ { 0, 0 }, { 0, 0 }, { 2, 1 } };
+    const uint8_t     const_value = 17;
+
+    Tensor    dst = create_tensor<Tensor>(TensorShape(7U, 5U, 6U), DataType::QASYMM8);
+    SubTensor src(&dst, input_shape, Coordinates(0, 0, 2));
+
+    NEPadLayer pad;
+    pad.configure(&src, &dst, padding, PixelValue(const_value));
+
+    dst.allocator()->allocate();
+    ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+    library->fill_tensor_uniform(Accessor(src), 0);
+    pad.run();
+
+    SimpleTensor<uint8_t> ref_src{ input_shape, DataType::QASYMM8 };
+    library->fill_tensor_uniform(ref_src, 0);
+
+    // Validate output
+    validate(Accessor(dst), reference::pad_layer(ref_src, padding, PixelValue(const_value), PaddingMode::CONSTANT));
+}
 TEST_SUITE_END() // QASYMM8
 TEST_SUITE_END() // Quantized
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Arm Limited.
+ * Copyright (c) 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,21 @@ const auto Pooling3dLayerDatasetFPSmall = combine(combine(combine(combine(datase
                                                           framework::dataset::make("Padding", { Padding3D(0, 0, 0), Padding3D(1, 1, 1), Padding3D(1, 0, 0) })),
                                                   framework::dataset::make("ExcludePadding", { true, false }));
 
+/** Input data set for the channel blocking and the window split of the floating-point kernels
+ *
+ * The channels don't fit in one block and end with a tail shorter than a vector. The batch, depth and height
+ * dimensions are collapsed in turn so that the window is split along each of them.
+ */
+const auto Pooling3dLayerDatasetFPChannelBlocks = combine(combine(combine(combine(combine(framework::dataset::make("InputShape", { TensorShape(131U, 13U, 7U, 5U, 1U),
+                                                                                                                              TensorShape(101U, 19U, 3U, 2U, 4U),
+                                                                                                                              TensorShape(67U, 9U, 1U, 1U, 1U)
+                                                                                                                            }),
+                                                                                          datasets::PoolingTypes()),
+                                                                                  framework::dataset::make("PoolingSize", { Size3D(3, 3, 3), Size3D(2, 2, 2) })),
+                                                                          framework::dataset::make("Stride", { Size3D(1, 1, 1), Size3D(2, 1, 1) })),
+                                                                  framework::dataset::make("Padding", { Padding3D(1, 1, 1) })),
+                                                          framework::dataset::make("ExcludePadding", { true, false }));
+
 const auto Pooling3dLayerDatasetQASYMM8Small = combine(combine(combine(combine(framework::dataset::make("PoolingType", { PoolingType::MAX, PoolingType::AVG }),
                                                                                framework::dataset::make("PoolingSize", { Size3D(3, 3, 3) })),
                                                                        framework::dataset::make("Stride", { Size3D(1, 1, 1), Size3D(2, 1, 1), Size3D(1, 2, 1), Size3D(2, 2, 1) })),
@@ -189,6 +204,13 @@ FIXTURE_DATA_TEST_CASE(RunLarge, NEPoolingLayer3dFixture<float>, framework::Data
     validate(Accessor(_target), _reference, tolerance_f32);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallChannelBlocks, NEPoolingLayer3dFixture<float>, framework::DatasetMode::PRECOMMIT,
+                       combine(Pooling3dLayerDatasetFPChannelBlocks, framework::dataset::make("DataType", DataType::F32)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
+
 TEST_SUITE(GlobalPooling)
 // *INDENT-OFF*
 // clang-format off
@@ -249,6 +271,13 @@ FIXTURE_DATA_TEST_CASE(RunSmall, NEPoolingLayer3dFixture<half>, framework::Datas
     validate(Accessor(_target), _reference, tolerance_f16);
 }
 
+FIXTURE_DATA_TEST_CASE(RunSmallChannelBlocks, NEPoolingLayer3dFixture<half>, framework::DatasetMode::PRECOMMIT,
+                       combine(Pooling3dLayerDatasetFPChannelBlocks, framework::dataset::make("DataType", DataType::F16)))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f16);
+}
+
 
 FIXTURE_DATA_TEST_CASE(RunLarge, NEPoolingLayer3dFixture<half>, framework::DatasetMode::NIGHTLY, combine(datasets::Large5dShapes(), combine(Pooling3dLayerDatasetFP,
                                                                                                            framework::dataset::make("DataType",
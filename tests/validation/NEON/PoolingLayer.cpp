@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, 2023 Arm Limited.
+ * Copyright (c) 2017-2021, 2023-2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/PoolingLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 namespace arm_compute
 {
 namespace test
@@ -93,6 +94,70 @@ const auto pool_outside_input_dataset = zip(zip(zip(zip(
 TEST_SUITE(NEON)
 TEST_SUITE(PoolingLayer)
 
+/** Test case for the pooling operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can't be created for an unknown pooling type
+ * - It can be created for a NHWC max pooling
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is the maximum of its window
+ */
+TEST_CASE(PoolingAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    // 2x2 max pooling with stride 2 of a 4x4x2 input
+    acl::TensorDescriptor src_info({ 2, 4, 4, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::TensorDescriptor dst_info({ 2, 2, 2, 1 }, acl::DataType::Float32, acl::DataLayout::Nhwc);
+    acl::Pool2dDesc       desc{};
+    desc.pool_width          = 2;
+    desc.pool_height         = 2;
+    desc.pad_stride.stride_x = 2;
+    desc.pad_stride.stride_y = 2;
+
+    desc.type             = static_cast<AclPoolingType>(-1);
+    AclOperator invalid_op = nullptr;
+    ARM_COMPUTE_EXPECT(AclPool2d(&invalid_op, ctx.get(), src_info.get(), dst_info.get(), desc) == AclStatus::AclInvalidArgument, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(invalid_op == nullptr, framework::LogLevel::ERRORS);
+
+    desc.type = AclMaxPooling;
+    acl::Pool2d pool(ctx, src_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor        src = create_acl_tensor(ctx, src_info);
+    acl::Tensor        dst = create_acl_tensor(ctx, dst_info);
+    std::vector<float> src_values(2 * 4 * 4);
+    for(size_t i = 0; i < src_values.size(); ++i)
+    {
+        src_values[i] = static_cast<float>(i);
+    }
+    fill_acl_tensor(src, src_values);
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, pool, pack);
+
+    // The values increase along the width and height, so the maximum is the bottom-right element of the window
+    const std::vector<float> out = read_acl_tensor<float>(dst, 2 * 2 * 2);
+    for(int oy = 0; oy < 2; ++oy)
+    {
+        for(int ox = 0; ox < 2; ++ox)
+        {
+            for(int c = 0; c < 2; ++c)
+            {
+                const float expected = static_cast<float>(c + 2 * ((2 * ox + 1) + 4 * (2 * oy + 1)));
+                ARM_COMPUTE_EXPECT(out[c + 2 * (ox + 2 * oy)] == expected, framework::LogLevel::ERRORS);
+            }
+        }
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,6 +33,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/QuantizationLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 
 namespace arm_compute
 {
@@ -53,6 +54,45 @@ const auto                            QuantizationLargeShapes = concat(datasets:
 TEST_SUITE(NEON)
 TEST_SUITE(QuantizationLayer)
 
+/** Test case for the quantization operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created with the quantization parameters of the destination descriptor
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each output value is quantized with the scale and offset of the descriptor
+ */
+TEST_CASE(QuantizationAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorDescriptor src_info({ 4 }, acl::DataType::Float32);
+    acl::TensorDescriptor dst_info({ 4 }, acl::DataType::QAsymmUInt8, acl::DataLayout::Nchw, 0.5f, 10);
+
+    acl::Quantize quantize(ctx, src_info, dst_info, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src = create_acl_tensor(ctx, src_info);
+    acl::Tensor dst = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<float> { 1.f, -1.f, 2.5f, 0.f });
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, quantize, pack);
+
+    const std::vector<uint8_t> expected{ 12, 8, 15, 10 };
+    const std::vector<uint8_t> out = read_acl_tensor<uint8_t>(dst, expected.size());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(out[i] == expected[i], framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEReduceMean.h"
 #include "arm_compute/runtime/Tensor.h"
 #include "arm_compute/runtime/TensorAllocator.h"
@@ -51,7 +52,11 @@ constexpr AbsoluteTolerance<int8_t>  tolerance_s8(2);    /**< Tolerance value fo
 
 const auto axis_keep = combine(framework::dataset::make("Axis", { Coordinates(0), Coordinates(1, 0), Coordinates(1, 2), Coordinates(0, 2), Coordinates(1, 3), Coordinates(0, 1, 2, 3) }),
                                framework::dataset::make("KeepDims", { true }));
-const auto axis_drop = combine(framework::dataset::make("Axis", { Coordinates(0), Coordinates(1), Coordinates(3) }), framework::dataset::make("KeepDims", { false }));
+const auto axis_drop = combine(framework::dataset::make("Axis", { Coordinates(0), Coordinates(1), Coordinates(3), Coordinates(1, 2) }), framework::dataset::make("KeepDims", { false }));
+
+/** Shapes and axes leaving fewer output rows than threads, so that the reduced dimensions are split between the threads */
+const auto split_shapes = framework::dataset::make("Shape", { TensorShape(16U, 8U, 32U, 1U), TensorShape(7U, 5U, 9U, 2U) });
+const auto split_axis   = combine(framework::dataset::make("Axis", { Coordinates(1, 2), Coordinates(0, 1, 2) }), framework::dataset::make("KeepDims", { true, false }));
 } // namespace
 TEST_SUITE(NEON)
 TEST_SUITE(ReduceMean)
@@ -86,6 +91,24 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
 template <typename T>
 using NEReduceMeanFixture = ReduceMeanFixture<Tensor, Accessor, NEReduceMean, T>;
 
+/** Fixture running the function with four threads
+ *
+ * The multi-axis reduction only splits the reduced dimensions when there are fewer output rows than threads.
+ */
+template <typename T>
+class NEReduceMeanMultiThreadedFixture : public NEReduceMeanFixture<T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type, Coordinates axis, bool keep_dims)
+    {
+        const unsigned int num_threads = NEScheduler::get().num_threads();
+        NEScheduler::get().set_num_threads(4);
+        NEReduceMeanFixture<T>::setup(shape, data_type, axis, keep_dims);
+        NEScheduler::get().set_num_threads(num_threads);
+    }
+};
+
 TEST_SUITE(Float)
 
 #ifdef __ARM_FEATURE_FP16_VECTOR_ARITHMETIC
@@ -127,6 +150,15 @@ FIXTURE_DATA_TEST_CASE(RunLarge,
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+
+FIXTURE_DATA_TEST_CASE(RunSmallSplit,
+                       NEReduceMeanMultiThreadedFixture<float>,
+                       framework::DatasetMode::PRECOMMIT,
+                       combine(combine(split_shapes, framework::dataset::make("DataType", DataType::F32)), split_axis))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 TEST_SUITE_END() // FP32
 TEST_SUITE_END() // Float
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, 2022 Arm Limited.
+ * Copyright (c) 2017-2020, 2022, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -35,6 +35,7 @@
 #include "tests/framework/datasets/Datasets.h"
 #include "tests/validation/Validation.h"
 #include "tests/validation/fixtures/SoftmaxLayerFixture.h"
+#include "tests/validation/fixtures/UNIT/OperatorHelpers.h"
 namespace arm_compute
 {
 namespace test
@@ -63,6 +64,50 @@ const auto CNNDataTypes = framework::dataset::make("DataType",
 
 TEST_SUITE(NEON)
 TEST_SUITE(SoftmaxLayer)
+
+/** Test case for the softmax operator of the C API
+ *
+ * Checks performed in order:
+ * - The operator can be created for a reduction along the first axis
+ * - It runs once the workspace it reports has been added to the tensor pack
+ * - Each row of the output holds the normalized exponentials of the row of the input
+ */
+TEST_CASE(SoftmaxAPI, framework::DatasetMode::ALL)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    acl::Context ctx(acl::Target::Cpu, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::Queue queue(ctx, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    acl::TensorDescriptor src_info({ 4, 2 }, acl::DataType::Float32);
+    acl::TensorDescriptor dst_info({ 4, 2 }, acl::DataType::Float32);
+    acl::SoftmaxDesc      desc{};
+    desc.beta   = 1.f;
+    desc.axis   = 0;
+    desc.is_log = false;
+
+    acl::Softmax softmax(ctx, src_info, dst_info, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+    acl::Tensor src = create_acl_tensor(ctx, src_info);
+    acl::Tensor dst = create_acl_tensor(ctx, dst_info);
+    fill_acl_tensor(src, std::vector<float> { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, std::log(5.f) });
+
+    acl::TensorPack pack(ctx);
+    ARM_COMPUTE_ASSERT(pack.add(src, ACL_SRC) == acl::StatusCode::Success);
+    ARM_COMPUTE_ASSERT(pack.add(dst, ACL_DST) == acl::StatusCode::Success);
+
+    const auto workspace = run_acl_operator(ctx, queue, softmax, pack);
+
+    const std::vector<float> expected{ 0.25f, 0.25f, 0.25f, 0.25f, 0.125f, 0.125f, 0.125f, 0.625f };
+    const std::vector<float> out = read_acl_tensor<float>(dst, expected.size());
+    for(size_t i = 0; i < out.size(); ++i)
+    {
+        ARM_COMPUTE_EXPECT(std::abs(out[i] - expected[i]) < 1e-4f, framework::LogLevel::ERRORS);
+    }
+}
+
 // *INDENT-OFF*
 // clang-format off
 DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
@@ -120,6 +165,8 @@ DATA_TEST_CASE(Validate, framework::DatasetMode::ALL, zip(zip(zip(zip(
 
 template <typename T>
 using NESoftmaxLayerFixture = SoftmaxValidationFixture<Tensor, Accessor, NESoftmaxLayer, T>;
+template <typename T>
+using NESoftmaxLayerInPlaceFixture = SoftmaxValidationInPlaceFixture<Tensor, Accessor, NESoftmaxLayer, T>;
 
 DATA_TEST_CASE(KernelSelection_max_logits, framework::DatasetMode::ALL, concat(
                    combine(framework::dataset::make("CpuExt", std::string("NEON")),
@@ -235,6 +282,14 @@ FIXTURE_DATA_TEST_CASE(RunSmall4D, NESoftmaxLayerFixture<float>, framework::Data
     // Validate output
     validate(Accessor(_target), _reference, tolerance_f32);
 }
+FIXTURE_DATA_TEST_CASE(RunSmallInPlace, NESoftmaxLayerInPlaceFixture<float>, framework::DatasetMode::ALL, combine(combine(combine(datasets::Small4DShapes(),
+                                                                                                                 framework::dataset::make("DataType", DataType::F32)),
+                                                                                                                 framework::dataset::make("Beta", { 1.0f, 2.0f })),
+                                                                                                         framework::dataset::make("Axis", { 0, 1 })))
+{
+    // Validate output
+    validate(Accessor(_target), _reference, tolerance_f32);
+}
 FIXTURE_DATA_TEST_CASE(RunLarge, NESoftmaxLayerFixture<float>, framework::DatasetMode::NIGHTLY, combine(combine(combine(datasets::SoftmaxLayerLargeShapes(),
                                                                                                                         framework::dataset::make("DataType", DataType::F32)),
                                                                                                                 framework::dataset::make("Beta", { 1.0f, 2.0f })),
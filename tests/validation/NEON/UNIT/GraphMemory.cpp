@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/MemoryReport.h"
+#include "arm_compute/graph/algorithms/TopologicalSort.h"
+#include "arm_compute/graph/detail/ExecutionHelpers.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/UNIT/GraphUtils.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::test::validation::graph_utils;
+
+namespace
+{
+/** Adds a 1x1 convolution to @p depth channels whose weights aren't filled */
+graph::NodeID add_conv(graph::Graph &g, graph::NodeIdxPair input, unsigned int depth)
+{
+    return graph::GraphBuilder::add_convolution_node(g, neon_params, input, Size2D(1U, 1U), depth, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled, nullptr);
+}
+
+/** Builds the sum of a 1x1 convolution of a 8x8x8 NCHW input with a chain of three 1x1 convolutions of the same input
+ *
+ * The chain goes through 2, 5 and 4 channels while the single convolution outputs 4 channels, so the output of the
+ * single convolution is best computed after the chain.
+ *
+ * @param[out] g                Graph to build
+ * @param[in]  single_conv_last True to add the single convolution after the chain, which puts it first in the depth first order
+ */
+void build_branches(graph::Graph &g, bool single_conv_last)
+{
+    const auto in = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U, 8U, 8U), DataType::F32));
+
+    graph::NodeID single = single_conv_last ? graph::EmptyNodeID : add_conv(g, { in, 0 }, 4);
+    graph::NodeID chain  = in;
+    for(unsigned int depth : { 2U, 5U, 4U })
+    {
+        chain = add_conv(g, { chain, 0 }, depth);
+    }
+    if(single_conv_last)
+    {
+        single = add_conv(g, { in, 0 }, 4);
+    }
+
+    const auto add = graph::GraphBuilder::add_elementwise_node(g, neon_params, { single, 0 }, { chain, 0 }, graph::EltwiseOperation::Add);
+    graph::GraphBuilder::add_output_node(g, neon_params, { add, 0 });
+
+    // The memory of the transitions is read from their handles
+    graph::force_target_to_graph(g, graph::Target::NEON);
+    graph::detail::configure_all_tensors(g);
+}
+
+size_t peak_live_memory(graph::Graph &g, const std::vector<graph::NodeID> &node_order)
+{
+    const std::vector<size_t> live_memory = graph::live_transition_memory(g, node_order);
+    return live_memory.empty() ? 0 : *std::max_element(live_memory.begin(), live_memory.end());
+}
+
+size_t tensor_size(graph::Tensor *tensor)
+{
+    return tensor->handle()->tensor().info()->total_size();
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphMemory)
+TEST_SUITE(MemoryAwareSort)
+
+/** Test case for a graph whose depth first order keeps a tensor alive along a branch
+ *
+ * Checks performed in order:
+ * - The depth first order computes the single convolution first and peaks at 3328 bytes in the chain
+ * - The memory aware order is a reordering of the same nodes that peaks at 2304 bytes
+ */
+TEST_CASE(LowerPeak, framework::DatasetMode::ALL)
+{
+    graph::Graph g(0, "LowerPeak");
+    build_branches(g, true);
+
+    const std::vector<graph::NodeID> dfs_order   = graph::dfs(g);
+    const std::vector<graph::NodeID> aware_order = graph::memory_aware_sort(g);
+
+    ARM_COMPUTE_EXPECT(aware_order.size() == dfs_order.size(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(std::is_permutation(aware_order.begin(), aware_order.end(), dfs_order.begin()), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(peak_live_memory(g, dfs_order) == 3328, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(peak_live_memory(g, aware_order) == 2304, framework::LogLevel::ERRORS);
+}
+
+/** Test case for a graph whose depth first order already minimizes the peak
+ *
+ * Checks performed in order:
+ * - The depth first order computes the chain first
+ * - The memory aware order doesn't lower the peak, so it is the depth first order
+ */
+TEST_CASE(FallbackToDfs, framework::DatasetMode::ALL)
+{
+    graph::Graph g(0, "FallbackToDfs");
+    build_branches(g, false);
+
+    const std::vector<graph::NodeID> dfs_order = graph::dfs(g);
+
+    ARM_COMPUTE_EXPECT(peak_live_memory(g, dfs_order) == 2304, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(graph::memory_aware_sort(g) == dfs_order, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // MemoryAwareSort
+
+TEST_SUITE(MemoryReport)
+
+/** Test case for the memory report of a chain of two 1x1 convolutions without memory managers
+ *
+ * Checks performed in order:
+ * - The input and output tensors are accounted for as inputs and outputs
+ * - The output of the first convolution is the only transition and the peak of the live transitions
+ * - No memory is reported for the workspaces and the transformed weights
+ * - Each convolution reports its weights as constants and the transition it writes
+ */
+TEST_CASE(ConvChain, framework::DatasetMode::ALL)
+{
+    graph::GraphConfig config;
+    config.use_transition_memory_manager = false;
+    config.use_function_memory_manager   = false;
+    config.use_function_weights_manager  = false;
+
+    graph::GraphContext ctx;
+    graph::GraphManager gm;
+    graph::Graph        g(0, "ConvChain");
+    const auto          in    = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U, 8U, 4U), DataType::F32));
+    const auto          conv0 = add_conv(g, { in, 0 }, 8);
+    const auto          conv1 = add_conv(g, { conv0, 0 }, 4);
+    const auto          out   = graph::GraphBuilder::add_output_node(g, neon_params, { conv1, 0 });
+    finalize_graph(gm, ctx, g, config);
+
+    const graph::MemoryReport report = gm.memory_report(g);
+
+    // 8x8x4 input and output, 8x8x8 transition, 1x1x4x8 and 1x1x8x4 weights of 4 bytes elements
+    ARM_COMPUTE_EXPECT(report.io == tensor_size(g.node(in)->output(0)) + tensor_size(g.node(out)->input(0)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.io >= 2 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.transitions == tensor_size(g.node(conv0)->output(0)), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.transitions >= 2048, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.peak_live_transitions == report.transitions, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.constants <= 2 * 128, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.workspaces == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.transformed_weights == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(report.total() == report.constants + report.io + report.transitions, framework::LogLevel::ERRORS);
+
+    // Const nodes aren't reported
+    ARM_COMPUTE_EXPECT(report.nodes.size() == 4, framework::LogLevel::ERRORS);
+    for(const auto &node_report : report.nodes)
+    {
+        const bool   is_conv     = node_report.id == conv0 || node_report.id == conv1;
+        const size_t transitions = (node_report.id == conv0) ? report.transitions : 0;
+        ARM_COMPUTE_EXPECT(node_report.constants == (is_conv ? 128 : 0), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(node_report.transitions == transitions, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(node_report.live_transitions == (is_conv ? report.transitions : 0), framework::LogLevel::ERRORS);
+    }
+}
+
+TEST_SUITE_END() // MemoryReport
+TEST_SUITE_END() // GraphMemory
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
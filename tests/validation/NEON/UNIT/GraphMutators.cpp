@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/mutators/ConstantFoldingMutator.h"
+#include "arm_compute/graph/nodes/ConvolutionLayerNode.h"
+#include "support/Cast.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/UNIT/GraphUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::test::validation::graph_utils;
+
+namespace
+{
+/** Concatenates two 3D buffers along their second dimension */
+std::vector<float> concat_dim1(const std::vector<float> &a, const std::vector<float> &b, size_t dim0, size_t dim1_a, size_t dim1_b, size_t dim2)
+{
+    std::vector<float> dst;
+    for(size_t z = 0; z < dim2; ++z)
+    {
+        dst.insert(dst.end(), a.begin() + z * dim0 * dim1_a, a.begin() + (z + 1) * dim0 * dim1_a);
+        dst.insert(dst.end(), b.begin() + z * dim0 * dim1_b, b.begin() + (z + 1) * dim0 * dim1_b);
+    }
+    return dst;
+}
+
+/** Rectifies two 3D tensors and concatenates them along their second dimension */
+std::vector<float> run_concat_dim1(const std::vector<float> &a, const std::vector<float> &b, size_t dim0, size_t dim1_a, size_t dim1_b, size_t dim2,
+                                   DataLayout layout, graph::DataLayoutDimension axis)
+{
+    std::vector<float> src_a = a;
+    std::vector<float> src_b = b;
+    std::vector<float> dst;
+
+    graph::Graph g(0, "ConcatDim1");
+    const auto   in_a   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(dim0, dim1_a, dim2), DataType::F32, QuantizationInfo(), layout),
+                                                              input_accessor(src_a));
+    const auto   in_b   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(dim0, dim1_b, dim2), DataType::F32, QuantizationInfo(), layout),
+                                                              input_accessor(src_b));
+    const auto   act_a  = graph::GraphBuilder::add_activation_node(g, neon_params, { in_a, 0 }, relu_info);
+    const auto   act_b  = graph::GraphBuilder::add_activation_node(g, neon_params, { in_b, 0 }, relu_info);
+    const auto   concat = graph::GraphBuilder::add_concatenate_node(g, neon_params, { { act_a, 0 }, { act_b, 0 } }, graph::descriptors::ConcatLayerDescriptor(axis));
+    graph::GraphBuilder::add_output_node(g, neon_params, { concat, 0 }, output_accessor(dst));
+
+    run_graph(g);
+
+    return dst;
+}
+
+/** Buffers of the graphs computing a chain of two 1x1 convolutions */
+struct ConvChainBuffers
+{
+    std::vector<float> src{ make_data(4 * 8 * 8) };
+    std::vector<float> weights0{ make_data(4 * 8) };
+    std::vector<float> weights1{ make_data(8 * 4) };
+    std::vector<float> dst{};
+    unsigned int       weights_calls{ 0 };
+};
+
+/** Adds a rectified 1x1 convolution to 8 channels followed by a 1x1 convolution to 4 channels */
+graph::NodeID add_conv_chain(graph::Graph &g, graph::NodeIdxPair input, ConvChainBuffers &buffers)
+{
+    const auto conv0 = graph::GraphBuilder::add_convolution_node(g, neon_params, input, Size2D(1U, 1U), 8, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                 const_accessor(buffers.weights0, "weights0", buffers.weights_calls));
+    const auto act   = graph::GraphBuilder::add_activation_node(g, neon_params, { conv0, 0 }, relu_info);
+    return graph::GraphBuilder::add_convolution_node(g, neon_params, { act, 0 }, Size2D(1U, 1U), 4, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                     const_accessor(buffers.weights1, "weights1", buffers.weights_calls));
+}
+
+/** Runs the convolution chain on a 8x8x4 NCHW input */
+void run_nchw_conv_chain(graph::Graph &g, ConvChainBuffers &buffers, const graph::GraphConfig &config)
+{
+    const auto in   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U, 8U, 4U), DataType::F32), input_accessor(buffers.src));
+    const auto last = add_conv_chain(g, { in, 0 }, buffers);
+    graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, output_accessor(buffers.dst));
+
+    run_graph(g, config);
+}
+
+graph::GraphConfig layout_selection_config()
+{
+    graph::GraphConfig config;
+    config.use_data_layout_selection = true;
+    return config;
+}
+
+/** Checks that two buffers match up to the rounding differences of the kernels of each data layout */
+bool is_close(const std::vector<float> &target, const std::vector<float> &reference)
+{
+    if(target.size() != reference.size())
+    {
+        return false;
+    }
+    for(size_t i = 0; i < target.size(); ++i)
+    {
+        if(std::abs(target[i] - reference[i]) > 1e-4f * std::max(1.f, std::abs(reference[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Runs a 1x1 convolution to 8 channels of a 8x8x4 NCHW input
+ *
+ * @return The ID of the convolution node
+ */
+graph::NodeID run_conv(graph::Graph &g, ConvChainBuffers &buffers, const graph::GraphConfig &config)
+{
+    const auto in   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U, 8U, 4U), DataType::F32), input_accessor(buffers.src));
+    const auto conv = graph::GraphBuilder::add_convolution_node(g, neon_params, { in, 0 }, Size2D(1U, 1U), 8, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                const_accessor(buffers.weights0, "weights0", buffers.weights_calls));
+    graph::GraphBuilder::add_output_node(g, neon_params, { conv, 0 }, output_accessor(buffers.dst));
+
+    run_graph(g, config);
+    return conv;
+}
+
+graph::GraphConfig conv_method_benchmark_config(const std::string &conv_method_file)
+{
+    graph::GraphConfig config;
+    config.use_conv_method_benchmark = true;
+    config.conv_method_file          = conv_method_file;
+    return config;
+}
+
+graph::ConvolutionMethod convolution_method(graph::Graph &g, graph::NodeID nid)
+{
+    return arm_compute::utils::cast::polymorphic_downcast<graph::ConvolutionLayerNode *>(g.node(nid))->convolution_method();
+}
+
+std::vector<std::string> read_lines(const std::string &filename)
+{
+    std::ifstream            fs(filename);
+    std::vector<std::string> lines;
+    std::string              line;
+    while(std::getline(fs, line))
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+void write_lines(const std::string &filename, const std::vector<std::string> &lines)
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::trunc);
+    for(const auto &line : lines)
+    {
+        fs << line << std::endl;
+    }
+}
+
+/** Measures the convolution of @ref run_conv and returns the key of its configuration in the decisions file */
+std::string measure_conv_key(const std::string &conv_method_file)
+{
+    ConvChainBuffers buffers;
+    graph::Graph     g(0, "MeasureConvKey");
+    run_conv(g, buffers, conv_method_benchmark_config(conv_method_file));
+
+    const std::vector<std::string> lines = read_lines(conv_method_file);
+    return lines.empty() ? std::string() : lines[0].substr(0, lines[0].rfind(';'));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphMutators)
+TEST_SUITE(ViewAliasing)
+
+TEST_CASE(BranchedReshape, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = make_data(8);
+    std::vector<float> dst_relu;
+    std::vector<float> dst_input;
+
+    // The reshaped tensor is rectified in-place while the tensor it reshapes is also an output
+    graph::Graph g(0, "BranchedReshape");
+    const auto   in      = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(4U, 2U), DataType::F32), input_accessor(src));
+    const auto   x       = graph::GraphBuilder::add_activation_node(g, neon_params, { in, 0 }, identity_info);
+    const auto   reshape = graph::GraphBuilder::add_reshape_node(g, neon_params, { x, 0 }, TensorShape(8U));
+    const auto   act     = graph::GraphBuilder::add_activation_node(g, neon_params, { reshape, 0 }, relu_info);
+    graph::GraphBuilder::add_output_node(g, neon_params, { act, 0 }, output_accessor(dst_relu));
+    graph::GraphBuilder::add_output_node(g, neon_params, { x, 0 }, output_accessor(dst_input));
+
+    run_graph(g);
+
+    ARM_COMPUTE_EXPECT(dst_relu == relu(src), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst_input == src, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(SoleConsumerReshape, framework::DatasetMode::ALL)
+{
+    std::vector<float> src = make_data(8);
+    std::vector<float> dst;
+
+    graph::Graph g(0, "SoleConsumerReshape");
+    const auto   in      = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(4U, 2U), DataType::F32), input_accessor(src));
+    const auto   x       = graph::GraphBuilder::add_activation_node(g, neon_params, { in, 0 }, identity_info);
+    const auto   reshape = graph::GraphBuilder::add_reshape_node(g, neon_params, { x, 0 }, TensorShape(8U));
+    const auto   act     = graph::GraphBuilder::add_activation_node(g, neon_params, { reshape, 0 }, relu_info);
+    graph::GraphBuilder::add_output_node(g, neon_params, { act, 0 }, output_accessor(dst));
+
+    run_graph(g);
+
+    ARM_COMPUTE_EXPECT(dst == relu(src), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ViewAliasing
+
+TEST_SUITE(DepthConcatSubTensor)
+
+TEST_CASE(WidthNHWC, framework::DatasetMode::ALL)
+{
+    const std::vector<float> a = make_data(3 * 2 * 4);
+    const std::vector<float> b = make_data(3 * 5 * 4);
+
+    const std::vector<float> dst = run_concat_dim1(a, b, 3, 2, 5, 4, DataLayout::NHWC, graph::DataLayoutDimension::WIDTH);
+
+    ARM_COMPUTE_EXPECT(dst == concat_dim1(relu(a), relu(b), 3, 2, 5, 4), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(HeightNCHW, framework::DatasetMode::ALL)
+{
+    const std::vector<float> a = make_data(5 * 2 * 3);
+    const std::vector<float> b = make_data(5 * 3 * 3);
+
+    const std::vector<float> dst = run_concat_dim1(a, b, 5, 2, 3, 3, DataLayout::NCHW, graph::DataLayoutDimension::HEIGHT);
+
+    ARM_COMPUTE_EXPECT(dst == concat_dim1(relu(a), relu(b), 5, 2, 3, 3), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DepthConcatSubTensor
+
+TEST_SUITE(DataLayoutSelection)
+
+/** Test case for an NCHW chain of convolutions
+ *
+ * Checks performed in order:
+ * - The convolutions are executed in NHWC
+ * - A single permute node is inserted at the input and at the output of the chain
+ * - The output matches the one computed in NCHW
+ */
+TEST_CASE(NCHWConvChain, framework::DatasetMode::ALL)
+{
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "NCHWConvChain");
+    run_nchw_conv_chain(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers selected;
+    graph::Graph     g(0, "NCHWConvChain");
+    run_nchw_conv_chain(g, selected, layout_selection_config());
+
+    for(auto &nid : g.nodes(graph::NodeType::ConvolutionLayer))
+    {
+        ARM_COMPUTE_EXPECT(g.node(nid)->output(0)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::PermuteLayer).size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(selected.dst, reference.dst), framework::LogLevel::ERRORS);
+}
+
+/** Test case for the weights of convolutions changing layout
+ *
+ * Checks performed in order:
+ * - The weights are stored in NHWC and no permute node reads a constant
+ * - Each weights accessor is called once
+ */
+TEST_CASE(FoldedWeights, framework::DatasetMode::ALL)
+{
+    ConvChainBuffers selected;
+    graph::Graph     g(0, "FoldedWeights");
+    run_nchw_conv_chain(g, selected, layout_selection_config());
+
+    for(auto &nid : g.nodes(graph::NodeType::ConvolutionLayer))
+    {
+        ARM_COMPUTE_EXPECT(g.node(nid)->input(1)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+    }
+    for(auto &nid : g.nodes(graph::NodeType::PermuteLayer))
+    {
+        ARM_COMPUTE_EXPECT(g.node(nid)->input_edge(0)->producer()->type() != graph::NodeType::Const, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(selected.weights_calls == 2, framework::LogLevel::ERRORS);
+}
+
+/** Test case for a chain of convolutions fed by a permutation from NHWC
+ *
+ * Checks performed in order:
+ * - The permutation of the input cancels out with the one inserted by the pass: only the output permute node is left
+ * - The output matches the one computed in NCHW
+ */
+TEST_CASE(InversePermutes, framework::DatasetMode::ALL)
+{
+    const auto run = [](graph::Graph & g, ConvChainBuffers & buffers, const graph::GraphConfig & config)
+    {
+        const auto in      = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(4U, 8U, 8U), DataType::F32, QuantizationInfo(), DataLayout::NHWC),
+                                                                 input_accessor(buffers.src));
+        const auto permute = graph::GraphBuilder::add_permute_node(g, neon_params, { in, 0 }, PermutationVector(1U, 2U, 0U), DataLayout::NCHW);
+        const auto last    = add_conv_chain(g, { permute, 0 }, buffers);
+        graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, output_accessor(buffers.dst));
+        run_graph(g, config);
+    };
+
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "InversePermutes");
+    run(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers selected;
+    graph::Graph     g(0, "InversePermutes");
+    run(g, selected, layout_selection_config());
+
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::PermuteLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(selected.dst, reference.dst), framework::LogLevel::ERRORS);
+}
+
+/** Test case for an in-place node at the boundary of a region
+ *
+ * The activation is computed in-place on the output of the reshape, which can't change layout.
+ *
+ * Checks performed in order:
+ * - The reshape and the activation keep the NCHW layout while the convolutions are executed in NHWC
+ * - The output matches the one computed in NCHW
+ */
+TEST_CASE(InPlaceBoundary, framework::DatasetMode::ALL)
+{
+    graph::NodeID reshape = graph::EmptyNodeID;
+    graph::NodeID act     = graph::EmptyNodeID;
+
+    const auto run = [&](graph::Graph & g, ConvChainBuffers & buffers, const graph::GraphConfig & config)
+    {
+        const auto in   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(16U, 4U, 4U), DataType::F32), input_accessor(buffers.src));
+        reshape         = graph::GraphBuilder::add_reshape_node(g, neon_params, { in, 0 }, TensorShape(8U, 8U, 4U));
+        act             = graph::GraphBuilder::add_activation_node(g, neon_params, { reshape, 0 }, relu_info);
+        const auto last = add_conv_chain(g, { act, 0 }, buffers);
+        graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, output_accessor(buffers.dst));
+        run_graph(g, config);
+    };
+
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "InPlaceBoundary");
+    run(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers selected;
+    graph::Graph     g(0, "InPlaceBoundary");
+    run(g, selected, layout_selection_config());
+
+    ARM_COMPUTE_EXPECT(g.node(reshape)->output(0)->desc().layout == DataLayout::NCHW, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(act)->output(0)->desc().layout == DataLayout::NCHW, framework::LogLevel::ERRORS);
+    for(auto &nid : g.nodes(graph::NodeType::ConvolutionLayer))
+    {
+        ARM_COMPUTE_EXPECT(g.node(nid)->output(0)->desc().layout == DataLayout::NHWC, framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(is_close(selected.dst, reference.dst), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // DataLayoutSelection
+
+TEST_SUITE(ConvolutionMethodSelection)
+
+/** Test case for the convolution methods stored by a previous finalization
+ *
+ * Checks performed in order:
+ * - The measured method of the convolution is stored in the decisions file
+ * - A method written to the file is pinned on the node by the next finalization, which doesn't store the decisions again
+ * - The output matches the one of the default method
+ */
+TEST_CASE(StoredDecisions, framework::DatasetMode::ALL)
+{
+    const std::string conv_method_file = "conv_methods_stored_decisions.csv";
+    std::remove(conv_method_file.c_str());
+
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "StoredDecisions");
+    run_conv(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers measured;
+    graph::Graph     g_measured(0, "StoredDecisions");
+    const auto       measured_conv   = run_conv(g_measured, measured, conv_method_benchmark_config(conv_method_file));
+    const auto       measured_method = convolution_method(g_measured, measured_conv);
+
+    const std::vector<std::string> lines = read_lines(conv_method_file);
+    ARM_COMPUTE_ASSERT(lines.size() == 1);
+    const size_t separator = lines[0].rfind(';');
+    ARM_COMPUTE_ASSERT(separator != std::string::npos);
+    ARM_COMPUTE_EXPECT(lines[0].substr(separator + 1) == std::to_string(static_cast<int>(measured_method)), framework::LogLevel::ERRORS);
+
+    // Pin a method that is valid for the convolution and differs from the measured one
+    const graph::ConvolutionMethod pinned_method = (measured_method == graph::ConvolutionMethod::GEMM) ? graph::ConvolutionMethod::Default : graph::ConvolutionMethod::GEMM;
+    const std::string              pinned_line   = lines[0].substr(0, separator + 1) + std::to_string(static_cast<int>(pinned_method));
+    write_lines(conv_method_file, { pinned_line });
+
+    ConvChainBuffers pinned;
+    graph::Graph     g_pinned(0, "StoredDecisions");
+    const auto       pinned_conv = run_conv(g_pinned, pinned, conv_method_benchmark_config(conv_method_file));
+
+    ARM_COMPUTE_EXPECT(convolution_method(g_pinned, pinned_conv) == pinned_method, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(read_lines(conv_method_file) == std::vector<std::string> { pinned_line }, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(pinned.dst, reference.dst), framework::LogLevel::ERRORS);
+
+    std::remove(conv_method_file.c_str());
+}
+
+/** Test case for a decisions file with malformed lines
+ *
+ * Checks performed in order:
+ * - Lines without a method, or with a method out of range or not numeric are ignored and the convolution is measured again
+ * - The file is rewritten with the measured decision only
+ * - The output matches the one of the default method
+ */
+TEST_CASE(MalformedDecisions, framework::DatasetMode::ALL)
+{
+    const std::string conv_method_file = "conv_methods_malformed_decisions.csv";
+    std::remove(conv_method_file.c_str());
+
+    const std::string key = measure_conv_key(conv_method_file);
+    ARM_COMPUTE_ASSERT(!key.empty());
+    write_lines(conv_method_file, { "not a decision", key, key + ";", key + ";42", key + ";-1", key + ";GEMM" });
+
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "MalformedDecisions");
+    run_conv(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers measured;
+    graph::Graph     g_measured(0, "MalformedDecisions");
+    const auto       measured_conv = run_conv(g_measured, measured, conv_method_benchmark_config(conv_method_file));
+
+    const std::string measured_line = key + ";" + std::to_string(static_cast<int>(convolution_method(g_measured, measured_conv)));
+    ARM_COMPUTE_EXPECT(read_lines(conv_method_file) == std::vector<std::string> { measured_line }, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(measured.dst, reference.dst), framework::LogLevel::ERRORS);
+
+    std::remove(conv_method_file.c_str());
+}
+
+/** Test case for a decisions file recording a method the convolution doesn't support anymore
+ *
+ * Checks performed in order:
+ * - The convolution keeps the method it requested
+ * - The output matches the one of the default method
+ */
+TEST_CASE(StaleDecision, framework::DatasetMode::ALL)
+{
+    const std::string conv_method_file = "conv_methods_stale_decision.csv";
+    std::remove(conv_method_file.c_str());
+
+    // Winograd doesn't support 1x1 convolutions
+    const std::string key = measure_conv_key(conv_method_file);
+    ARM_COMPUTE_ASSERT(!key.empty());
+    write_lines(conv_method_file, { key + ";" + std::to_string(static_cast<int>(graph::ConvolutionMethod::Winograd)) });
+
+    ConvChainBuffers reference;
+    graph::Graph     g_reference(0, "StaleDecision");
+    run_conv(g_reference, reference, graph::GraphConfig());
+
+    ConvChainBuffers stale;
+    graph::Graph     g_stale(0, "StaleDecision");
+    const auto       stale_conv = run_conv(g_stale, stale, conv_method_benchmark_config(conv_method_file));
+
+    ARM_COMPUTE_EXPECT(convolution_method(g_stale, stale_conv) == graph::ConvolutionMethod::Default, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(stale.dst, reference.dst), framework::LogLevel::ERRORS);
+
+    std::remove(conv_method_file.c_str());
+}
+
+TEST_SUITE_END() // ConvolutionMethodSelection
+
+TEST_SUITE(ConstantFolding)
+
+TEST_CASE(FoldedActivation, framework::DatasetMode::ALL)
+{
+    std::vector<float> weights = make_data(8);
+    std::vector<float> src     = make_data(8);
+    std::vector<float> dst;
+
+    std::vector<float> expected = relu(weights);
+    std::transform(expected.begin(), expected.end(), src.begin(), expected.begin(), std::plus<float>());
+
+    graph::Graph g(0, "FoldedActivation");
+    const auto   in  = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U), DataType::F32), input_accessor(src));
+    const auto   c   = graph::GraphBuilder::add_const_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U), DataType::F32), input_accessor(weights));
+    const auto   act = graph::GraphBuilder::add_activation_node(g, neon_params, { c, 0 }, relu_info);
+    const auto   add = graph::GraphBuilder::add_elementwise_node(g, neon_params, { in, 0 }, { act, 0 }, graph::EltwiseOperation::Add);
+    graph::GraphBuilder::add_output_node(g, neon_params, { add, 0 }, output_accessor(dst));
+
+    graph::GraphConfig config;
+    config.use_constant_folding = true;
+    run_graph(g, config);
+
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::ActivationLayer).empty(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == expected, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(DisabledByDefault, framework::DatasetMode::ALL)
+{
+    std::vector<float> weights = make_data(8);
+    std::vector<float> dst;
+
+    graph::Graph g(0, "DisabledByDefault");
+    const auto   c   = graph::GraphBuilder::add_const_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U), DataType::F32), input_accessor(weights));
+    const auto   act = graph::GraphBuilder::add_activation_node(g, neon_params, { c, 0 }, relu_info);
+    graph::GraphBuilder::add_output_node(g, neon_params, { act, 0 }, output_accessor(dst));
+
+    run_graph(g);
+
+    ARM_COMPUTE_EXPECT(g.nodes(graph::NodeType::ActivationLayer).size() == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(dst == relu(weights), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(UnsupportedNodeKeepsAccessors, framework::DatasetMode::ALL)
+{
+    std::vector<float> a = make_data(8);
+    std::vector<float> b = make_data(8);
+
+    // Adding tensors of different data types fails validation
+    graph::Graph g(0, "UnsupportedNodeKeepsAccessors");
+    const auto   c0  = graph::GraphBuilder::add_const_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U), DataType::F32), input_accessor(a));
+    const auto   c1  = graph::GraphBuilder::add_const_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U), DataType::S32), input_accessor(b));
+    const auto   add = graph::GraphBuilder::add_elementwise_node(g, neon_params, { c0, 0 }, { c1, 0 }, graph::EltwiseOperation::Add);
+
+    const graph::ITensorAccessor *accessor0 = g.node(c0)->output(0)->accessor();
+    const graph::ITensorAccessor *accessor1 = g.node(c1)->output(0)->accessor();
+
+    graph::ConstantFoldingMutator().mutate(g);
+
+    ARM_COMPUTE_EXPECT(g.node(add) != nullptr, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(c0)->output(0)->accessor() == accessor0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(g.node(c1)->output(0)->accessor() == accessor1, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // ConstantFolding
+TEST_SUITE_END() // GraphMutators
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
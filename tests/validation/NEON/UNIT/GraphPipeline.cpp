@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphBuilder.h"
+#include "arm_compute/graph/PipelineExecutor.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/framework/datasets/Datasets.h"
+#include "tests/validation/NEON/UNIT/GraphUtils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::test::validation::graph_utils;
+
+namespace
+{
+using Frames = std::vector<std::vector<float>>;
+
+/** Accessor loading a sequence of frames into an input tensor, failing once the frames are exhausted */
+class FrameSource final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in]  frames    Frames to load, one after the other
+     * @param[out] num_calls Counter incremented every time the tensor is accessed
+     */
+    FrameSource(const Frames &frames, unsigned int &num_calls)
+        : _frames(frames), _num_calls(num_calls)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        const unsigned int frame = _num_calls++;
+        if(frame >= _frames.size())
+        {
+            return false;
+        }
+        graph::copy_buffer_to_tensor(reinterpret_cast<const uint8_t *>(_frames[frame].data()), tensor);
+        return true;
+    }
+
+private:
+    const Frames &_frames;
+    unsigned int &_num_calls;
+};
+
+/** Accessor appending the frames read from an output tensor */
+class FrameSink final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[out] frames Frames read, in the order they are consumed
+     */
+    explicit FrameSink(Frames &frames)
+        : _frames(frames)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        _frames.emplace_back(tensor.info()->tensor_shape().total_size());
+        graph::copy_tensor_to_buffer(tensor, reinterpret_cast<uint8_t *>(_frames.back().data()));
+        return true;
+    }
+
+private:
+    Frames &_frames;
+};
+
+/** Buffers of a graph streaming frames */
+struct StreamBuffers
+{
+    std::vector<Frames>       inputs{};      /**< Frames of each input */
+    std::vector<unsigned int> input_calls{}; /**< Number of calls of the accessor of each input */
+    Frames                    outputs{};     /**< Frames read from the output */
+    std::vector<float>        weights{};     /**< Weights shared by the convolutions */
+    unsigned int              weights_calls{ 0 };
+};
+
+/** Result of streaming frames through a graph */
+struct StreamResult
+{
+    Frames                    outputs{};            /**< Frames read from the output */
+    std::vector<unsigned int> input_calls{};        /**< Number of calls of the accessor of each input */
+    int                       pipeline_stages{ 0 }; /**< Number of compute stages the graph has been executed with */
+    graph::PipelineStats      stats{};              /**< Statistics of the pipelined execution, empty if the graph isn't pipelined */
+};
+
+using StreamGraphBuilder = std::function<void(graph::Graph &, StreamBuffers &)>;
+
+/** Creates @p num_frames frames of @p size elements that differ from one frame to the next */
+Frames make_frames(unsigned int num_frames, size_t size)
+{
+    Frames frames(num_frames, make_data(size));
+    for(unsigned int frame = 0; frame < num_frames; ++frame)
+    {
+        for(auto &v : frames[frame])
+        {
+            v += static_cast<float>(frame);
+        }
+    }
+    return frames;
+}
+
+graph::NodeID add_stream_input(graph::Graph &g, StreamBuffers &buffers, unsigned int input, unsigned int channels)
+{
+    return graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(8U, 8U, channels), DataType::F32),
+                                               std::make_unique<FrameSource>(buffers.inputs[input], buffers.input_calls[input]));
+}
+
+/** Adds a rectified 1x1 convolution to @p depth channels, the weights are the first elements of the weights buffer */
+graph::NodeID add_conv(graph::Graph &g, StreamBuffers &buffers, graph::NodeIdxPair input, unsigned int depth, bool has_relu = true)
+{
+    const auto conv = graph::GraphBuilder::add_convolution_node(g, neon_params, input, Size2D(1U, 1U), depth, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                const_accessor(buffers.weights, "weights", buffers.weights_calls));
+    return has_relu ? graph::GraphBuilder::add_activation_node(g, neon_params, { conv, 0 }, relu_info) : conv;
+}
+
+/** Builds a chain of three rectified 1x1 convolutions of similar cost on a 8x8x8 NCHW input */
+void build_conv_chain(graph::Graph &g, StreamBuffers &buffers)
+{
+    auto last = add_stream_input(g, buffers, 0, 8);
+    for(int i = 0; i < 3; ++i)
+    {
+        last = add_conv(g, buffers, { last, 0 }, 8);
+    }
+    graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, std::make_unique<FrameSink>(buffers.outputs));
+}
+
+/** Builds the sum of two 8x8x8 NCHW inputs followed by the chain of @ref build_conv_chain */
+void build_sum_conv_chain(graph::Graph &g, StreamBuffers &buffers)
+{
+    const auto in0  = add_stream_input(g, buffers, 0, 8);
+    const auto in1  = add_stream_input(g, buffers, 1, 8);
+    auto       last = graph::GraphBuilder::add_elementwise_node(g, neon_params, { in0, 0 }, { in1, 0 }, graph::EltwiseOperation::Add);
+    for(int i = 0; i < 3; ++i)
+    {
+        last = add_conv(g, buffers, { last, 0 }, 8);
+    }
+    graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, std::make_unique<FrameSink>(buffers.outputs));
+}
+
+/** Builds two 1x1 convolutions of a 8x8x8 NCHW input whose outputs are concatenated along the channels into the graph output
+ *
+ * The outputs of the convolutions are sub-tensors of the output of the concatenation.
+ */
+void build_concat(graph::Graph &g, StreamBuffers &buffers)
+{
+    const auto in     = add_stream_input(g, buffers, 0, 8);
+    const auto conv0  = add_conv(g, buffers, { in, 0 }, 4, false);
+    const auto conv1  = add_conv(g, buffers, { in, 0 }, 4, false);
+    const auto concat = graph::GraphBuilder::add_concatenate_node(g, neon_params, { { conv0, 0 }, { conv1, 0 } },
+                                                                  graph::descriptors::ConcatLayerDescriptor(graph::DataLayoutDimension::CHANNEL));
+    graph::GraphBuilder::add_output_node(g, neon_params, { concat, 0 }, std::make_unique<FrameSink>(buffers.outputs));
+}
+
+/** Builds two rectified 1x1 convolutions of the halves of a 8x8x8 NCHW input split along the channels, whose sum goes through two
+ *  rectified 1x1 convolutions
+ *
+ * The halves of the input are sub-tensors of the input.
+ */
+void build_split(graph::Graph &g, StreamBuffers &buffers)
+{
+    const auto in    = add_stream_input(g, buffers, 0, 8);
+    const auto split = graph::GraphBuilder::add_split_node(g, neon_params, { in, 0 }, 2, 2);
+    const auto conv0 = add_conv(g, buffers, { split, 0 }, 8);
+    const auto conv1 = add_conv(g, buffers, { split, 1 }, 8);
+    auto       last  = graph::GraphBuilder::add_elementwise_node(g, neon_params, { conv0, 0 }, { conv1, 0 }, graph::EltwiseOperation::Add);
+    for(int i = 0; i < 2; ++i)
+    {
+        last = add_conv(g, buffers, { last, 0 }, 8);
+    }
+    graph::GraphBuilder::add_output_node(g, neon_params, { last, 0 }, std::make_unique<FrameSink>(buffers.outputs));
+}
+
+/** Streams frames through a graph until an input runs out of frames
+ *
+ * @param[in] build  Function building the graph
+ * @param[in] inputs Frames of each input of the graph
+ * @param[in] config Configuration to finalize the graph with
+ *
+ * @return The frames read from the output and the execution details
+ */
+StreamResult run_stream(const StreamGraphBuilder &build, const std::vector<Frames> &inputs, const graph::GraphConfig &config)
+{
+    StreamBuffers buffers;
+    buffers.inputs      = inputs;
+    buffers.input_calls = std::vector<unsigned int>(inputs.size(), 0);
+    buffers.weights     = make_data(8 * 8);
+
+    StreamResult result;
+    {
+        graph::GraphContext ctx;
+        graph::GraphManager gm;
+        graph::Graph        g(0, "Stream");
+        build(g, buffers);
+        finalize_graph(gm, ctx, g, config);
+        gm.execute_graph(g);
+
+        result.pipeline_stages = ctx.config().pipeline_stages;
+        result.stats           = gm.pipeline_stats(g);
+    }
+    result.outputs     = buffers.outputs;
+    result.input_calls = buffers.input_calls;
+    return result;
+}
+
+graph::GraphConfig pipeline_config(int pipeline_stages)
+{
+    graph::GraphConfig config;
+    config.pipeline_stages = pipeline_stages;
+    return config;
+}
+
+graph::GraphConfig async_config(int pipeline_stages)
+{
+    graph::GraphConfig config  = pipeline_config(pipeline_stages);
+    config.use_async_accessors = true;
+    return config;
+}
+
+/** Checks that two sequences of frames match up to the rounding differences of the kernels run with different numbers of threads */
+bool is_close(const Frames &target, const Frames &reference)
+{
+    if(target.size() != reference.size())
+    {
+        return false;
+    }
+    for(size_t frame = 0; frame < target.size(); ++frame)
+    {
+        if(target[frame].size() != reference[frame].size())
+        {
+            return false;
+        }
+        for(size_t i = 0; i < target[frame].size(); ++i)
+        {
+            if(std::abs(target[frame][i] - reference[frame][i]) > 1e-4f * std::max(1.f, std::abs(reference[frame][i])))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphPipeline)
+
+/** Test case for a chain of convolutions pipelined on two stages
+ *
+ * Checks performed in order:
+ * - The graph is partitioned into two stages
+ * - Every frame goes through the pipeline
+ * - The output frames match the ones of the execution without pipeline, in the same order
+ */
+TEST_CASE(TwoStages, framework::DatasetMode::ALL)
+{
+    const std::vector<Frames> inputs{ make_frames(5, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_conv_chain, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_conv_chain, inputs, pipeline_config(2));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+/** Test case for a chain of convolutions pipelined on three stages
+ *
+ * Checks performed in order:
+ * - The graph is partitioned into three stages
+ * - Every frame goes through the pipeline
+ * - The output frames match the ones of the execution without pipeline, in the same order
+ */
+TEST_CASE(ThreeStages, framework::DatasetMode::ALL)
+{
+    const std::vector<Frames> inputs{ make_frames(7, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_conv_chain, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_conv_chain, inputs, pipeline_config(3));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 7, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.stage_utilization.size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 7, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+/** Test case for a graph whose only cuts would cross sub-tensors
+ *
+ * Checks performed in order:
+ * - No cut is made across the concatenation, so the graph isn't pipelined
+ * - The output frames match the ones of the execution without pipeline
+ */
+TEST_CASE(SubTensorsBlockCuts, framework::DatasetMode::ALL)
+{
+    const std::vector<Frames> inputs{ make_frames(3, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_concat, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_concat, inputs, pipeline_config(2));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+/** Test case for an input running out of frames before the other one
+ *
+ * Checks performed in order:
+ * - The pipeline stops at the first frame an input can't load
+ * - Both inputs are accessed as often as without pipeline
+ * - The output frames match the ones of the execution without pipeline
+ */
+TEST_CASE(InputStopsMidStream, framework::DatasetMode::ALL)
+{
+    const std::vector<Frames> inputs{ make_frames(6, 8 * 8 * 8), make_frames(3, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_sum_conv_chain, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_sum_conv_chain, inputs, pipeline_config(2));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.input_calls == reference.input_calls, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 3, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE(AsyncAccessors)
+
+/** Test case for the accessors called on stages of their own
+ *
+ * Checks performed in order:
+ * - The input and output accessors get a stage on either side of the compute stages
+ * - Every frame is loaded once and the input accessor is called once more to end the stream
+ * - Every frame is consumed once, and the output frames match the ones of the synchronous execution in the same order
+ */
+DATA_TEST_CASE(CountingAccessors, framework::DatasetMode::ALL, framework::dataset::make("PipelineStages", { 1, 2 }), pipeline_stages)
+{
+    const std::vector<Frames> inputs{ make_frames(5, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_conv_chain, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_conv_chain, inputs, async_config(pipeline_stages));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == pipeline_stages, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.stage_utilization.size() == static_cast<size_t>(pipeline_stages) + 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.input_calls == std::vector<unsigned int> { 6 }, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+/** Test case for an input tensor that is the parent of sub-tensors
+ *
+ * Checks performed in order:
+ * - The input can't be double-buffered, so the accessors are called synchronously on the compute stages
+ * - The graph is still pipelined on the requested compute stages
+ * - The output frames match the ones of the synchronous execution
+ */
+TEST_CASE(SubTensorParentInput, framework::DatasetMode::ALL)
+{
+    const std::vector<Frames> inputs{ make_frames(4, 8 * 8 * 8) };
+    const StreamResult        reference = run_stream(build_split, inputs, graph::GraphConfig());
+    const StreamResult        target    = run_stream(build_split, inputs, async_config(2));
+
+    ARM_COMPUTE_EXPECT(target.pipeline_stages == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.stage_utilization.size() == 2, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.stats.frames == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(target.input_calls == reference.input_calls, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(reference.outputs.size() == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(is_close(target.outputs, reference.outputs), framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // AsyncAccessors
+TEST_SUITE_END() // GraphPipeline
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/graph/GraphPlan.h"
+#include "arm_compute/graph/GraphBuilder.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+#include "tests/validation/NEON/UNIT/GraphUtils.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+using namespace arm_compute::test::validation::graph_utils;
+
+namespace
+{
+/** Offsets of the fields of the plan file patched by the tests */
+constexpr size_t plan_num_nodes_offset   = 12;
+constexpr size_t plan_data_offset_offset = 32;
+constexpr size_t plan_data_size_offset   = 40;
+constexpr size_t plan_header_size        = 48;
+constexpr size_t plan_node_record_size   = 16;
+
+/** Buffers of a graph computing a rectified 1x1 convolution */
+struct ConvGraphData
+{
+    std::vector<float> src{ make_data(4 * 4 * 2) };
+    std::vector<float> weights{};
+    std::vector<float> dst{};
+    unsigned int       weights_calls{ 0 };
+};
+
+/** Builds a graph computing a rectified 1x1 convolution with @p depth output channels of a 4x4x2 input */
+void build_conv_graph(graph::Graph &g, ConvGraphData &data, unsigned int depth)
+{
+    data.weights = make_data(2 * depth);
+
+    const auto in   = graph::GraphBuilder::add_input_node(g, neon_params, graph::TensorDescriptor(TensorShape(4U, 4U, 2U), DataType::F32), input_accessor(data.src));
+    const auto conv = graph::GraphBuilder::add_convolution_node(g, neon_params, { in, 0 }, Size2D(1U, 1U), depth, PadStrideInfo(), 1, graph::ConvolutionMethod::Default, graph::FastMathHint::Disabled,
+                                                                const_accessor(data.weights, "weights", data.weights_calls));
+    const auto act  = graph::GraphBuilder::add_activation_node(g, neon_params, { conv, 0 }, relu_info);
+    graph::GraphBuilder::add_output_node(g, neon_params, { act, 0 }, output_accessor(data.dst));
+}
+
+graph::GraphConfig plan_config(const std::string &plan_file)
+{
+    graph::GraphConfig config;
+    config.plan_file = plan_file;
+    return config;
+}
+
+std::vector<char> read_file(const std::string &filename)
+{
+    std::ifstream fs(filename, std::ios::in | std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(fs), std::istreambuf_iterator<char>());
+}
+
+void write_file(const std::string &filename, const std::vector<char> &contents)
+{
+    std::ofstream fs(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    fs.write(contents.data(), contents.size());
+}
+
+template <typename T>
+T read_field(const std::vector<char> &contents, size_t offset)
+{
+    T value{};
+    std::memcpy(&value, contents.data() + offset, sizeof(T));
+    return value;
+}
+
+template <typename T>
+void write_field(std::vector<char> &contents, size_t offset, T value)
+{
+    std::memcpy(contents.data() + offset, &value, sizeof(T));
+}
+} // namespace
+
+TEST_SUITE(NEON)
+TEST_SUITE(UNIT)
+TEST_SUITE(GraphPlan)
+
+/** Test case for storing and reusing a graph plan
+ *
+ * Checks performed in order:
+ * - The first finalization calls the weights accessor and stores a plan that can be loaded
+ * - The second finalization of the same graph fills the weights from the plan without calling their accessor
+ * - Both graphs compute the same output
+ */
+TEST_CASE(RoundTrip, framework::DatasetMode::ALL)
+{
+    const std::string plan_file = "graph_plan_round_trip.bin";
+    std::remove(plan_file.c_str());
+
+    ConvGraphData first;
+    graph::Graph  g_first(0, "RoundTrip");
+    build_conv_graph(g_first, first, 3);
+    run_graph(g_first, plan_config(plan_file));
+
+    ARM_COMPUTE_EXPECT(first.weights_calls == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(graph::GraphPlan().load(plan_file), framework::LogLevel::ERRORS);
+
+    ConvGraphData second;
+    graph::Graph  g_second(0, "RoundTrip");
+    build_conv_graph(g_second, second, 3);
+    run_graph(g_second, plan_config(plan_file));
+
+    ARM_COMPUTE_EXPECT(second.weights_calls == 0, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(second.dst == first.dst, framework::LogLevel::ERRORS);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Test case for a plan stored from a different graph
+ *
+ * Checks performed in order:
+ * - The plan of a graph isn't compatible with a graph with more output channels
+ * - Finalizing that graph with the plan calls the weights accessor and computes the same output as without the plan
+ */
+TEST_CASE(DifferentGraph, framework::DatasetMode::ALL)
+{
+    const std::string plan_file = "graph_plan_different_graph.bin";
+    std::remove(plan_file.c_str());
+
+    ConvGraphData planned;
+    graph::Graph  g_planned(0, "DifferentGraph");
+    build_conv_graph(g_planned, planned, 3);
+    run_graph(g_planned, plan_config(plan_file));
+
+    graph::GraphContext ctx;
+    graph::GraphManager gm;
+    ConvGraphData       reference;
+    graph::Graph        g_reference(0, "DifferentGraph");
+    build_conv_graph(g_reference, reference, 4);
+    finalize_graph(gm, ctx, g_reference, graph::GraphConfig());
+    gm.execute_graph(g_reference);
+    {
+        graph::GraphPlan plan;
+        ARM_COMPUTE_EXPECT(plan.load(plan_file), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(plan.is_compatible(g_planned), framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(!plan.is_compatible(g_reference), framework::LogLevel::ERRORS);
+    }
+
+    ConvGraphData different;
+    graph::Graph  g_different(0, "DifferentGraph");
+    build_conv_graph(g_different, different, 4);
+    run_graph(g_different, plan_config(plan_file));
+
+    ARM_COMPUTE_EXPECT(different.weights_calls == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(different.dst == reference.dst, framework::LogLevel::ERRORS);
+
+    std::remove(plan_file.c_str());
+}
+
+/** Test case for damaged plan files
+ *
+ * Checks performed in order:
+ * - A truncated plan isn't loaded and a graph finalized with it calls the weights accessor and computes the right output
+ * - A plan whose data section wraps around the address space isn't loaded
+ * - A plan whose tensor record wraps around the data section isn't loaded
+ */
+TEST_CASE(DamagedFile, framework::DatasetMode::ALL)
+{
+    const std::string plan_file = "graph_plan_damaged_file.bin";
+    std::remove(plan_file.c_str());
+
+    ConvGraphData planned;
+    graph::Graph  g_planned(0, "DamagedFile");
+    build_conv_graph(g_planned, planned, 3);
+    run_graph(g_planned, plan_config(plan_file));
+
+    const std::vector<char> contents = read_file(plan_file);
+    ARM_COMPUTE_ASSERT(contents.size() > plan_header_size);
+
+    // Truncated file
+    write_file(plan_file, std::vector<char>(contents.begin(), contents.begin() + contents.size() / 2));
+    ARM_COMPUTE_EXPECT(!graph::GraphPlan().load(plan_file), framework::LogLevel::ERRORS);
+
+    ConvGraphData truncated;
+    graph::Graph  g_truncated(0, "DamagedFile");
+    build_conv_graph(g_truncated, truncated, 3);
+    run_graph(g_truncated, plan_config(plan_file));
+
+    ARM_COMPUTE_EXPECT(truncated.weights_calls == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(truncated.dst == planned.dst, framework::LogLevel::ERRORS);
+
+    // Data section whose end overflows
+    std::vector<char> wrapped_data = contents;
+    const auto        data_offset  = read_field<uint64_t>(contents, plan_data_offset_offset);
+    write_field<uint64_t>(wrapped_data, plan_data_size_offset, std::numeric_limits<uint64_t>::max() - data_offset + 1);
+    write_file(plan_file, wrapped_data);
+    ARM_COMPUTE_EXPECT(!graph::GraphPlan().load(plan_file), framework::LogLevel::ERRORS);
+
+    // Tensor record whose end overflows: the tensor records follow the node records
+    std::vector<char> wrapped_record = contents;
+    const size_t      record_offset  = plan_header_size + read_field<uint32_t>(contents, plan_num_nodes_offset) * plan_node_record_size + 8;
+    write_field<uint64_t>(wrapped_record, record_offset, std::numeric_limits<uint64_t>::max() - 7);
+    write_file(plan_file, wrapped_record);
+    ARM_COMPUTE_EXPECT(!graph::GraphPlan().load(plan_file), framework::LogLevel::ERRORS);
+
+    std::remove(plan_file.c_str());
+}
+
+TEST_SUITE_END() // GraphPlan
+TEST_SUITE_END() // UNIT
+TEST_SUITE_END() // NEON
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
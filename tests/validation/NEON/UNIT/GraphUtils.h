@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef TESTS_VALIDATION_NEON_UNIT_GRAPHUTILS
+#define TESTS_VALIDATION_NEON_UNIT_GRAPHUTILS
+
+#include "arm_compute/graph/Graph.h"
+#include "arm_compute/graph/GraphContext.h"
+#include "arm_compute/graph/GraphManager.h"
+#include "arm_compute/graph/ITensorAccessor.h"
+#include "arm_compute/graph/Utils.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace graph_utils
+{
+/** Accessor filling a graph tensor from a buffer, or reading a graph tensor into a buffer
+ *
+ * Inputs are filled on every call while outputs are only read once, so that a graph runs a single frame.
+ */
+class BufferAccessor final : public graph::ITensorAccessor
+{
+public:
+    /** Constructor
+     *
+     * @param[in]  buffer    Buffer holding the elements of the tensor contiguously
+     * @param[in]  is_input  True to fill the tensor from @p buffer, false to read the tensor into @p buffer
+     * @param[in]  source    (Optional) Identifier of the contents of @p buffer. Empty if they can't be identified
+     * @param[out] num_calls (Optional) Counter incremented every time the tensor is accessed
+     */
+    BufferAccessor(std::vector<float> &buffer, bool is_input, std::string source = std::string(), unsigned int *num_calls = nullptr)
+        : _buffer(buffer), _is_input(is_input), _source(std::move(source)), _num_calls(num_calls)
+    {
+    }
+    bool access_tensor(ITensor &tensor) override
+    {
+        if(_num_calls != nullptr)
+        {
+            ++(*_num_calls);
+        }
+        if(_is_input)
+        {
+            graph::copy_buffer_to_tensor(reinterpret_cast<const uint8_t *>(_buffer.data()), tensor);
+        }
+        else
+        {
+            _buffer.resize(tensor.info()->tensor_shape().total_size());
+            graph::copy_tensor_to_buffer(tensor, reinterpret_cast<uint8_t *>(_buffer.data()));
+        }
+        return _is_input;
+    }
+    std::string source() const override
+    {
+        return _source;
+    }
+
+private:
+    std::vector<float> &_buffer;
+    bool                _is_input;
+    std::string         _source;
+    unsigned int       *_num_calls;
+};
+
+inline std::unique_ptr<graph::ITensorAccessor> input_accessor(std::vector<float> &buffer)
+{
+    return std::make_unique<BufferAccessor>(buffer, true);
+}
+
+inline std::unique_ptr<graph::ITensorAccessor> output_accessor(std::vector<float> &buffer)
+{
+    return std::make_unique<BufferAccessor>(buffer, false);
+}
+
+/** Accessor of a constant tensor whose contents are identified by @p source, counting its calls in @p num_calls */
+inline std::unique_ptr<graph::ITensorAccessor> const_accessor(std::vector<float> &buffer, const std::string &source, unsigned int &num_calls)
+{
+    return std::make_unique<BufferAccessor>(buffer, true, source, &num_calls);
+}
+
+/** Finalizes a graph on the Arm® Neon™ backend with the default passes */
+inline void finalize_graph(graph::GraphManager &gm, graph::GraphContext &ctx, graph::Graph &g, const graph::GraphConfig &config)
+{
+    ctx.set_config(config);
+    graph::PassManager pm = graph::create_default_pass_manager(graph::Target::NEON, config);
+    gm.finalize_graph(g, ctx, pm, graph::Target::NEON);
+}
+
+/** Finalizes a graph on the Arm® Neon™ backend with the default passes and executes it */
+inline void run_graph(graph::Graph &g, const graph::GraphConfig &config = graph::GraphConfig())
+{
+    graph::GraphContext ctx;
+    graph::GraphManager gm;
+    finalize_graph(gm, ctx, g, config);
+    gm.execute_graph(g);
+}
+
+/** Creates a buffer of @p size elements alternating negative and positive values */
+inline std::vector<float> make_data(size_t size)
+{
+    std::vector<float> data(size);
+    for(size_t i = 0; i < size; ++i)
+    {
+        data[i] = static_cast<float>(i % 2 == 0 ? -static_cast<int>(i) : static_cast<int>(i));
+    }
+    return data;
+}
+
+inline std::vector<float> relu(std::vector<float> data)
+{
+    std::transform(data.begin(), data.end(), data.begin(), [](float v)
+    {
+        return std::max(v, 0.f);
+    });
+    return data;
+}
+
+const graph::NodeParams   neon_params{ "", graph::Target::NEON };
+const ActivationLayerInfo identity_info(ActivationLayerInfo::ActivationFunction::IDENTITY);
+const ActivationLayerInfo relu_info(ActivationLayerInfo::ActivationFunction::RELU);
+} // namespace graph_utils
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* TESTS_VALIDATION_NEON_UNIT_GRAPHUTILS */
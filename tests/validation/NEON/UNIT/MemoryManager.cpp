@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "arm_compute/graph/WorkspaceLifetimeManager.h"
 #include "arm_compute/runtime/Allocator.h"
 #include "arm_compute/runtime/BlobLifetimeManager.h"
 #include "arm_compute/runtime/MemoryGroup.h"
@@ -89,6 +90,56 @@ TEST_CASE(BlobMemoryManagerSimpleWithinFunctionLevel, framework::DatasetMode::AL
     ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
 }
 
+TEST_CASE(WorkspaceMemoryManagerNestedGroups, framework::DatasetMode::ALL)
+{
+    Allocator allocator{};
+    auto      lifetime_mgr = std::make_shared<graph::WorkspaceLifetimeManager>();
+    auto      pool_mgr     = std::make_shared<PoolManager>();
+    auto      mm           = std::make_shared<MemoryManagerOnDemand>(lifetime_mgr, pool_mgr);
+
+    // Groups of the same node, as created by a function and a function nested in it
+    MemoryGroup outer_group(mm);
+    MemoryGroup inner_group(mm);
+    Tensor      outer = create_tensor<Tensor>(TensorShape(64U), DataType::F32, 1);
+    Tensor      inner = create_tensor<Tensor>(TensorShape(32U), DataType::F32, 1);
+
+    lifetime_mgr->set_active_node(0);
+    outer_group.manage(&outer);
+    outer.allocator()->allocate();
+    inner_group.manage(&inner);
+    inner.allocator()->allocate();
+    lifetime_mgr->set_active_node(graph::EmptyNodeID);
+
+    // Allocate the workspace of the node
+    arm_compute::Tensor *workspace = lifetime_mgr->create_workspace(0);
+    ARM_COMPUTE_ASSERT(workspace != nullptr);
+    workspace->allocator()->allocate();
+
+    mm->populate(allocator, 2 /* num_pools */);
+    ARM_COMPUTE_EXPECT(mm->lifetime_manager()->are_all_finalized(), framework::LogLevel::ERRORS);
+
+    // The outer function holds its group while the nested one acquires its own
+    outer_group.acquire();
+    inner_group.acquire();
+
+    const uint8_t *workspace_begin = workspace->buffer();
+    const uint8_t *workspace_end   = workspace_begin + workspace->info()->total_size();
+    const uint8_t *outer_begin     = outer.buffer();
+    const uint8_t *outer_end       = outer_begin + outer.info()->total_size();
+    const uint8_t *inner_begin     = inner.buffer();
+    const uint8_t *inner_end       = inner_begin + inner.info()->total_size();
+    ARM_COMPUTE_EXPECT(outer_begin >= workspace_begin && outer_end <= workspace_end, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(inner_begin >= workspace_begin && inner_end <= workspace_end, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(outer_end <= inner_begin || inner_end <= outer_begin, framework::LogLevel::ERRORS);
+
+    inner_group.release();
+    outer_group.release();
+
+    // Clear manager
+    mm->clear();
+    ARM_COMPUTE_EXPECT(mm->pool_manager()->num_pools() == 0, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END()
 TEST_SUITE_END()
 TEST_SUITE_END()
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "src/common/cpuinfo/CpuCacheInfo.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+TEST_SUITE(UNIT)
+TEST_SUITE(CpuCacheInfo)
+
+TEST_CASE(ParseCacheSize, framework::DatasetMode::ALL)
+{
+    uint32_t size = 0;
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("64K", size) && size == 64 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("1M", size) && size == 1024 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::parse_cache_size("32768", size) && size == 32768, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!cpuinfo::parse_cache_size("", size), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(!cpuinfo::parse_cache_size("K", size), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(CountCpusInList, framework::DatasetMode::ALL)
+{
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpus_in_list("0") == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpus_in_list("0-3") == 4, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpus_in_list("0-3,8") == 5, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpuinfo::count_cpus_in_list("4-7,0-1") == 6, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(OverrideCacheInfo, framework::DatasetMode::ALL)
+{
+    cpuinfo::CpuCacheInfo info{};
+    info.l1d.size = 32 * 1024;
+    info.l2.size  = 256 * 1024;
+
+    cpuinfo::override_cpu_cache_info(info, "L2=1M,L3=8M");
+    ARM_COMPUTE_EXPECT(info.l1d.size == 32 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.l2.size == 1024 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.l3.size == 8 * 1024 * 1024, framework::LogLevel::ERRORS);
+
+    // Malformed entries are ignored
+    cpuinfo::override_cpu_cache_info(info, "L1=,L4=1M,L2");
+    ARM_COMPUTE_EXPECT(info.l1d.size == 32 * 1024, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(info.l2.size == 1024 * 1024, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // CpuCacheInfo
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/CPP/CPPScheduler.h"
+#include "src/runtime/SchedulerUtils.h"
+#include "tests/framework/Asserts.h"
+#include "tests/framework/Macros.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+namespace
+{
+/** Kernel counting the iterations it is run on */
+class CountingKernel final : public ICPPKernel
+{
+public:
+    explicit CountingKernel(int num_iterations)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, num_iterations));
+        ICPPKernel::configure(win);
+    }
+    const char *name() const override
+    {
+        return "CountingKernel";
+    }
+    void run(const Window &window, const ThreadInfo &info) override
+    {
+        ARM_COMPUTE_UNUSED(info);
+        count += window.num_iterations(Window::DimX);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+
+    std::atomic<int> count{ 0 };
+};
+} // namespace
+
+TEST_SUITE(UNIT)
+TEST_SUITE(Scheduler)
+
+TEST_CASE(SplitByWeights, framework::DatasetMode::ALL)
+{
+    // Big cores get proportionally more iterations, the remainder goes to the largest fractional parts
+    const std::vector<std::size_t> offsets = scheduler_utils::split_by_weights(10, { 1024, 1024, 410, 410 });
+    ARM_COMPUTE_EXPECT(offsets == std::vector<std::size_t>({ 0, 4, 8, 9, 10 }), framework::LogLevel::ERRORS);
+
+    // Equal weights behave like an even split
+    const std::vector<std::size_t> even = scheduler_utils::split_by_weights(9, { 1, 1, 1 });
+    ARM_COMPUTE_EXPECT(even == std::vector<std::size_t>({ 0, 3, 6, 9 }), framework::LogLevel::ERRORS);
+
+    // All the iterations are always assigned
+    const std::vector<std::size_t> uneven = scheduler_utils::split_by_weights(7, { 3, 5, 11 });
+    ARM_COMPUTE_EXPECT(uneven.front() == 0 && uneven.back() == 7, framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(ImbalanceStats, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    scheduler.set_num_threads(2);
+    scheduler.set_imbalance_stats_enabled(true);
+
+    CountingKernel kernel(64);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    ARM_COMPUTE_EXPECT(kernel.count == 64, framework::LogLevel::ERRORS);
+
+    const auto stats = scheduler.imbalance_stats();
+    const auto it    = stats.find("CountingKernel");
+    ARM_COMPUTE_ASSERT(it != stats.end());
+    ARM_COMPUTE_EXPECT(it->second.num_runs == 1, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(it->second.mean_imbalance() >= 1., framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(it->second.max_imbalance <= 2., framework::LogLevel::ERRORS);
+
+    // Statistics are only collected when enabled
+    scheduler.reset_imbalance_stats();
+    scheduler.set_imbalance_stats_enabled(false);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    ARM_COMPUTE_EXPECT(scheduler.imbalance_stats().empty(), framework::LogLevel::ERRORS);
+}
+
+TEST_CASE(BigCoresOnlyWithNumThreads, framework::DatasetMode::ALL)
+{
+    CPPScheduler scheduler;
+    CountingKernel kernel(64);
+
+    // The big cores policy never uses more threads than requested
+    scheduler.set_num_threads(1);
+    scheduler.set_core_policy(IScheduler::CorePolicy::BIG_CORES_ONLY);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 1, framework::LogLevel::ERRORS);
+
+    // Nor more threads than there are big cores, which is at least one
+    scheduler.set_num_threads(2);
+    ARM_COMPUTE_EXPECT(scheduler.core_policy() == IScheduler::CorePolicy::BIG_CORES_ONLY, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() >= 1 && scheduler.num_threads() <= 2, framework::LogLevel::ERRORS);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    ARM_COMPUTE_EXPECT(kernel.count == 64, framework::LogLevel::ERRORS);
+
+    // The requested number of threads is restored without the policy
+    scheduler.set_core_policy(IScheduler::CorePolicy::UNIFORM);
+    ARM_COMPUTE_EXPECT(scheduler.num_threads() == 2, framework::LogLevel::ERRORS);
+    scheduler.schedule(&kernel, IScheduler::Hints(Window::DimX));
+    ARM_COMPUTE_EXPECT(kernel.count == 128, framework::LogLevel::ERRORS);
+}
+
+TEST_SUITE_END() // Scheduler
+TEST_SUITE_END() // UNIT
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,16 @@
  */
 #include "tests/validation/fixtures/UNIT/QueueFixture.h"
 
+#include "arm_compute/runtime/Scheduler.h"
 #include "src/cpu/CpuQueue.h"
 
+#include <algorithm>
+#include <vector>
+
+#if !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__)
+#include <sched.h>
+#endif /* !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) */
+
 namespace arm_compute
 {
 namespace test
@@ -40,6 +48,170 @@ EMPTY_BODY_FIXTURE_TEST_CASE(CreateQueuerWithInvalidOptions, CreateQueuerWithInv
 EMPTY_BODY_FIXTURE_TEST_CASE(DestroyInvalidQueue, DestroyInvalidQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 EMPTY_BODY_FIXTURE_TEST_CASE(SimpleQueue, SimpleQueueFixture<acl::Target::Cpu>, framework::DatasetMode::ALL)
 
+/** Test case for a queue with its own thread pool
+ *
+ * Test Steps:
+ *  - Create a queue without compute units and confirm it uses the process-wide scheduler
+ *  - Create a queue with 2 compute units and confirm it owns a pool of at most 2 threads
+ *  - Confirm that the work executed on the queue sees the pool of the queue through Scheduler::get()
+ */
+TEST_CASE(DedicatedThreadPool, framework::DatasetMode::ALL)
+{
+    acl::Context ctx(acl::Target::Cpu);
+
+    AclQueue        shared_queue = nullptr;
+    AclQueueOptions shared_opts{ AclTuningModeNone, 0, 0 };
+    ARM_COMPUTE_ASSERT(AclCreateQueue(&shared_queue, ctx.get(), &shared_opts) == AclStatus::AclSuccess);
+    ARM_COMPUTE_EXPECT(&static_cast<cpu::CpuQueue *>(shared_queue)->scheduler() == &Scheduler::get(), framework::LogLevel::ERRORS);
+
+    AclQueue        own_queue = nullptr;
+    AclQueueOptions own_opts{ AclTuningModeNone, 2, 0 };
+    ARM_COMPUTE_ASSERT(AclCreateQueue(&own_queue, ctx.get(), &own_opts) == AclStatus::AclSuccess);
+    auto *cpu_queue = static_cast<cpu::CpuQueue *>(own_queue);
+    ARM_COMPUTE_EXPECT(&cpu_queue->scheduler() != &Scheduler::get(), framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(cpu_queue->scheduler().num_threads() <= 2, framework::LogLevel::ERRORS);
+
+    IScheduler *scheduler_in_queue = nullptr;
+    cpu_queue->execute([&scheduler_in_queue]()
+    {
+        scheduler_in_queue = &Scheduler::get();
+    });
+    ARM_COMPUTE_EXPECT(AclQueueFinish(own_queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(scheduler_in_queue == &cpu_queue->scheduler(), framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(AclDestroyQueue(own_queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(AclDestroyQueue(shared_queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+}
+
+#if ARM_COMPUTE_CPP_SCHEDULER && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(NO_MULTI_THREADING)
+namespace
+{
+/** Return the core the calling thread is pinned to, -1 if it can run on more than one core */
+int pinned_core()
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) != 0 || CPU_COUNT(&set) != 1)
+    {
+        return -1;
+    }
+    for(int core = 0; core < CPU_SETSIZE; ++core)
+    {
+        if(CPU_ISSET(core, &set))
+        {
+            return core;
+        }
+    }
+    return -1;
+}
+} // namespace
+
+/** Test case for a queue pinned to a core mask
+ *
+ * Test Steps:
+ *  - Create a queue with a mask of (up to) two of the cores the process can run on
+ *  - Confirm that the thread of the queue is pinned to the first core of the mask
+ *  - Confirm that each thread of the pool of the queue is pinned to its own core of the mask
+ */
+TEST_CASE(CoreMask, framework::DatasetMode::ALL)
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    ARM_COMPUTE_ASSERT(sched_getaffinity(0, sizeof(allowed), &allowed) == 0);
+    std::vector<int> cores;
+    for(int core = 0; core < 64 && cores.size() < 2; ++core)
+    {
+        if(CPU_ISSET(core, &allowed))
+        {
+            cores.push_back(core);
+        }
+    }
+    ARM_COMPUTE_ASSERT(!cores.empty());
+
+    uint64_t core_mask = 0;
+    for(auto core : cores)
+    {
+        core_mask |= uint64_t(1) << core;
+    }
+
+    acl::Context    ctx(acl::Target::Cpu);
+    AclQueue        queue = nullptr;
+    AclQueueOptions opts{ AclTuningModeNone, 0, core_mask };
+    ARM_COMPUTE_ASSERT(AclCreateQueue(&queue, ctx.get(), &opts) == AclStatus::AclSuccess);
+    auto *cpu_queue = static_cast<cpu::CpuQueue *>(queue);
+
+    const unsigned int num_threads = cpu_queue->scheduler().num_threads();
+    ARM_COMPUTE_ASSERT(num_threads >= 1 && num_threads <= cores.size());
+
+    int              queue_core = -1;
+    std::vector<int> thread_cores(num_threads, -1);
+    cpu_queue->execute([&]()
+    {
+        queue_core = pinned_core();
+
+        std::vector<IScheduler::Workload> workloads(num_threads, [&thread_cores](const ThreadInfo & info)
+        {
+            thread_cores[info.thread_id] = pinned_core();
+        });
+        Scheduler::get().run_tagged_workloads(workloads, "CoreMask");
+    });
+    ARM_COMPUTE_EXPECT(AclQueueFinish(queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+
+    ARM_COMPUTE_EXPECT(queue_core == cores[0], framework::LogLevel::ERRORS);
+    std::sort(thread_cores.begin(), thread_cores.end());
+    for(unsigned int i = 0; i < num_threads; ++i)
+    {
+        ARM_COMPUTE_EXPECT(thread_cores[i] == cores[i], framework::LogLevel::ERRORS);
+    }
+
+    ARM_COMPUTE_EXPECT(AclDestroyQueue(queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+}
+#endif /* ARM_COMPUTE_CPP_SCHEDULER && !defined(_WIN64) && !defined(__APPLE__) && !defined(__OpenBSD__) && !defined(NO_MULTI_THREADING) */
+
+/** Test case for the asynchronous execution of a queue
+ *
+ * Test Steps:
+ *  - Submit several pieces of work to a queue
+ *  - Call AclQueueFinish and confirm that all the work has been executed in submission order
+ *  - Submit work that fails and confirm that the failure is reported by AclQueueFinish only once
+ */
+TEST_CASE(InOrderExecution, framework::DatasetMode::ALL)
+{
+    acl::Context ctx(acl::Target::Cpu);
+
+    AclQueue queue = nullptr;
+    ARM_COMPUTE_ASSERT(AclCreateQueue(&queue, ctx.get(), nullptr) == AclStatus::AclSuccess);
+    auto *cpu_queue = static_cast<cpu::CpuQueue *>(queue);
+
+    constexpr int    num_work = 16;
+    std::vector<int> executed;
+    for(int i = 0; i < num_work; ++i)
+    {
+        ARM_COMPUTE_EXPECT(cpu_queue->execute([&executed, i]()
+        {
+            executed.push_back(i);
+        }) == StatusCode::Success,
+        framework::LogLevel::ERRORS);
+    }
+    ARM_COMPUTE_EXPECT(AclQueueFinish(queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_ASSERT(executed.size() == static_cast<size_t>(num_work));
+    for(int i = 0; i < num_work; ++i)
+    {
+        ARM_COMPUTE_EXPECT(executed[i] == i, framework::LogLevel::ERRORS);
+    }
+
+#ifndef ARM_COMPUTE_EXCEPTIONS_DISABLED
+    cpu_queue->execute([]()
+    {
+        ARM_COMPUTE_ERROR("Failing work");
+    });
+    ARM_COMPUTE_EXPECT(AclQueueFinish(queue) == AclStatus::AclRuntimeError, framework::LogLevel::ERRORS);
+    ARM_COMPUTE_EXPECT(AclQueueFinish(queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+#endif /* ARM_COMPUTE_EXCEPTIONS_DISABLED */
+
+    ARM_COMPUTE_EXPECT(AclDestroyQueue(queue) == AclStatus::AclSuccess, framework::LogLevel::ERRORS);
+}
+
 TEST_SUITE_END() // Queue
 TEST_SUITE_END() // UNIT
 TEST_SUITE_END() // CPU
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,13 +45,13 @@ namespace
 constexpr int max_input_tensor_dim = 3;
 } // namespace
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
-class L2NormalizeLayerValidationFixture : public framework::Fixture
+class L2NormalizeLayerValidationGenericFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon)
+    void setup(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon, bool in_place)
     {
-        _target    = compute_target(shape, data_type, data_layout, axis, epsilon);
+        _target    = compute_target(shape, data_type, data_layout, axis, epsilon, in_place);
         _reference = compute_reference(shape, data_type, data_layout, axis, epsilon);
     }
 
@@ -66,7 +66,7 @@ protected:
         library->fill(tensor, distribution, 0);
     }
 
-    TensorType compute_target(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon)
+    TensorType compute_target(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon, bool in_place)
     {
         if(data_layout == DataLayout::NHWC)
         {
@@ -77,19 +77,24 @@ protected:
         TensorType src = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
         TensorType dst = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
 
+        TensorType *dst_ptr = in_place ? &src : &dst;
+
         // Create and configure function
         FunctionType l2_norm_func;
-        l2_norm_func.configure(&src, &dst, axis, epsilon);
+        l2_norm_func.configure(&src, dst_ptr, axis, epsilon);
 
         ARM_COMPUTE_ASSERT(src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
 
         // Allocate tensors
         src.allocator()->allocate();
-        dst.allocator()->allocate();
-
         ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
-        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        if(!in_place)
+        {
+            dst.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        }
 
         // Fill tensors
         fill(AccessorType(src));
@@ -97,6 +102,10 @@ protected:
         // Compute function
         l2_norm_func.run();
 
+        if(in_place)
+        {
+            return src;
+        }
         return dst;
     }
 
@@ -132,6 +141,28 @@ protected:
     TensorType      _target{};
     SimpleTensor<T> _reference{};
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class L2NormalizeLayerValidationFixture : public L2NormalizeLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon)
+    {
+        L2NormalizeLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, data_type, data_layout, axis, epsilon, false);
+    }
+};
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class L2NormalizeLayerValidationInPlaceFixture : public L2NormalizeLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type, DataLayout data_layout, int axis, float epsilon)
+    {
+        L2NormalizeLayerValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, data_type, data_layout, axis, epsilon, true);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,11 +47,11 @@ class NormalizationValidationGenericFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(TensorShape shape, NormType norm_type, int norm_size, float beta, bool is_scaled, DataType data_type, DataLayout data_layout)
+    void setup(TensorShape shape, NormType norm_type, int norm_size, float beta, bool is_scaled, DataType data_type, DataLayout data_layout, bool in_place = false)
     {
         NormalizationLayerInfo info(norm_type, norm_size, 5, beta, 1.f, is_scaled);
 
-        _target    = compute_target(shape, info, data_type, data_layout);
+        _target    = compute_target(shape, info, data_type, data_layout, in_place);
         _reference = compute_reference(shape, info, data_type);
     }
 
@@ -66,7 +66,7 @@ protected:
         library->fill(tensor, distribution, 0);
     }
 
-    TensorType compute_target(TensorShape shape, NormalizationLayerInfo info, DataType data_type, DataLayout data_layout)
+    TensorType compute_target(TensorShape shape, NormalizationLayerInfo info, DataType data_type, DataLayout data_layout, bool in_place)
     {
         if(data_layout == DataLayout::NHWC)
         {
@@ -77,19 +77,24 @@ protected:
         TensorType src = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
         TensorType dst = create_tensor<TensorType>(shape, data_type, 1, QuantizationInfo(), data_layout);
 
+        TensorType *dst_ptr = in_place ? &src : &dst;
+
         // Create and configure function
         FunctionType norm_layer;
-        norm_layer.configure(&src, &dst, info);
+        norm_layer.configure(&src, dst_ptr, info);
 
         ARM_COMPUTE_ASSERT(src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
 
         // Allocate tensors
         src.allocator()->allocate();
-        dst.allocator()->allocate();
-
         ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
-        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        if(!in_place)
+        {
+            dst.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        }
 
         // Fill tensors
         fill(AccessorType(src));
@@ -97,6 +102,10 @@ protected:
         // Compute function
         norm_layer.run();
 
+        if(in_place)
+        {
+            return src;
+        }
         return dst;
     }
 
@@ -125,6 +134,17 @@ public:
         NormalizationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, norm_type, norm_size, beta, is_scaled, data_type, data_layout);
     }
 };
+
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T>
+class NormalizationValidationInPlaceFixture : public NormalizationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, NormType norm_type, int norm_size, float beta, bool is_scaled, DataType data_type, DataLayout data_layout)
+    {
+        NormalizationValidationGenericFixture<TensorType, AccessorType, FunctionType, T>::setup(shape, norm_type, norm_size, beta, is_scaled, data_type, data_layout, true);
+    }
+};
 } // namespace validation
 } // namespace test
 } // namespace arm_compute
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -47,12 +47,12 @@ class SoftmaxValidationGenericFixture : public framework::Fixture
 {
 public:
     template <typename...>
-    void setup(TensorShape shape, DataType data_type, QuantizationInfo quantization_info, float beta, size_t axis)
+    void setup(TensorShape shape, DataType data_type, QuantizationInfo quantization_info, float beta, size_t axis, bool in_place = false)
     {
         _quantization_info = quantization_info;
 
         _reference = compute_reference(shape, data_type, quantization_info, beta, axis);
-        _target    = compute_target(shape, data_type, quantization_info, beta, axis);
+        _target    = compute_target(shape, data_type, quantization_info, beta, axis, in_place);
     }
 
 protected:
@@ -81,25 +81,30 @@ protected:
     }
 
     TensorType compute_target(const TensorShape &shape, DataType data_type,
-                              QuantizationInfo quantization_info, float beta, int32_t axis)
+                              QuantizationInfo quantization_info, float beta, int32_t axis, bool in_place)
     {
         // Create tensors
         TensorType src = create_tensor<TensorType>(shape, data_type, 1, quantization_info);
         TensorType dst = create_tensor<TensorType>(shape, data_type, 1, get_softmax_output_quantization_info(data_type, IS_LOG));
 
+        TensorType *dst_ptr = in_place ? &src : &dst;
+
         // Create and configure function
         FunctionType smx_layer;
-        smx_layer.configure(&src, &dst, beta, axis);
+        smx_layer.configure(&src, dst_ptr, beta, axis);
 
         ARM_COMPUTE_ASSERT(src.info()->is_resizable());
         ARM_COMPUTE_ASSERT(dst.info()->is_resizable());
 
         // Allocate tensors
         src.allocator()->allocate();
-        dst.allocator()->allocate();
-
         ARM_COMPUTE_ASSERT(!src.info()->is_resizable());
-        ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+
+        if(!in_place)
+        {
+            dst.allocator()->allocate();
+            ARM_COMPUTE_ASSERT(!dst.info()->is_resizable());
+        }
 
         // Fill tensors
         fill(AccessorType(src));
@@ -107,6 +112,10 @@ protected:
         // Compute function
         smx_layer.run();
 
+        if(in_place)
+        {
+            return src;
+        }
         return dst;
     }
 
@@ -142,6 +151,22 @@ public:
     }
 };
 
+template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool IS_LOG = false>
+class SoftmaxValidationInPlaceFixture : public SoftmaxValidationGenericFixture<TensorType, AccessorType, FunctionType, T, IS_LOG>
+{
+public:
+    template <typename...>
+    void setup(TensorShape shape, DataType data_type, float beta, size_t axis)
+    {
+        SoftmaxValidationGenericFixture<TensorType, AccessorType, FunctionType, T, IS_LOG>::setup(shape,
+                                                                                                  data_type,
+                                                                                                  QuantizationInfo(),
+                                                                                                  beta,
+                                                                                                  axis,
+                                                                                                  true);
+    }
+};
+
 template <typename TensorType, typename AccessorType, typename FunctionType, typename T, bool IS_LOG = false>
 class SoftmaxValidationQuantizedFixture : public SoftmaxValidationGenericFixture<TensorType, AccessorType, FunctionType, T, IS_LOG>
 {
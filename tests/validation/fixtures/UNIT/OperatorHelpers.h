@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Arm Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_TEST_UNIT_OPERATOR_HELPERS
+#define ARM_COMPUTE_TEST_UNIT_OPERATOR_HELPERS
+
+#include "arm_compute/Acl.hpp"
+#include "tests/framework/Asserts.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+namespace test
+{
+namespace validation
+{
+/** Create a tensor through the C++ interface of the C API
+ *
+ * @param[in] ctx  Context to create the tensor on
+ * @param[in] desc Descriptor of the tensor
+ *
+ * @return The allocated tensor
+ */
+inline acl::Tensor create_acl_tensor(acl::Context &ctx, const acl::TensorDescriptor &desc)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+    acl::Tensor     tensor(ctx, desc, &err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    return tensor;
+}
+
+/** Write values to the start of a tensor created through the C API
+ *
+ * @param[in, out] tensor Tensor to fill
+ * @param[in]      values Values to write
+ */
+template <typename T>
+void fill_acl_tensor(acl::Tensor &tensor, const std::vector<T> &values)
+{
+    void *ptr = tensor.map();
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    std::copy(values.begin(), values.end(), static_cast<T *>(ptr));
+    ARM_COMPUTE_ASSERT(tensor.unmap(ptr) == acl::StatusCode::Success);
+}
+
+/** Read values from the start of a tensor created through the C API
+ *
+ * @param[in] tensor       Tensor to read
+ * @param[in] num_elements Number of values to read
+ *
+ * @return The values read
+ */
+template <typename T>
+std::vector<T> read_acl_tensor(acl::Tensor &tensor, size_t num_elements)
+{
+    void *ptr = tensor.map();
+    ARM_COMPUTE_ASSERT(ptr != nullptr);
+    const T       *data = static_cast<const T *>(ptr);
+    std::vector<T> values(data, data + num_elements);
+    ARM_COMPUTE_ASSERT(tensor.unmap(ptr) == acl::StatusCode::Success);
+    return values;
+}
+
+/** Run an operator of the C API and wait for it to complete
+ *
+ * Operators do not allocate their workspace, the tensors they report through @ref acl::Operator::memory_requirements
+ * are allocated and added to the pack before running.
+ *
+ * @param[in]      ctx   Context of the operator
+ * @param[in]      queue Queue to run the operator on
+ * @param[in]      op    Operator to run
+ * @param[in, out] pack  Tensors of the operator, excluding the workspace
+ *
+ * @return The workspace tensors, which are referenced by @p pack
+ */
+inline std::vector<std::unique_ptr<acl::Tensor>> run_acl_operator(acl::Context &ctx, acl::Queue &queue, acl::Operator &op, acl::TensorPack &pack)
+{
+    acl::StatusCode err = acl::StatusCode::Success;
+
+    std::vector<std::unique_ptr<acl::Tensor>> workspace;
+    const auto                                reqs = op.memory_requirements(&err);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    for(const auto &req : reqs)
+    {
+        acl::TensorDescriptor ws_info({ static_cast<int32_t>(req.size) }, acl::DataType::UInt8);
+        workspace.emplace_back(std::make_unique<acl::Tensor>(create_acl_tensor(ctx, ws_info)));
+        err = pack.add(*workspace.back(), req.slot);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    }
+
+    err = op.run(queue, pack);
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    err = queue.finish();
+    ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+    return workspace;
+}
+} // namespace validation
+} // namespace test
+} // namespace arm_compute
+#endif /* ARM_COMPUTE_TEST_UNIT_OPERATOR_HELPERS */
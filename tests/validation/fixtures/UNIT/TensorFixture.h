@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Arm Limited.
+ * Copyright (c) 2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -397,6 +397,49 @@ public:
     };
 };
 
+/** Test case for the layout and quantization fields of a tensor descriptor
+ *
+ * Test Steps:
+ *  - Create quantized tensors with a layout, a scale and an offset
+ *  - Confirm that the descriptor returned by AclGetTensorDescriptor holds the same layout, scale and offset
+ *  - Create a float tensor with a scale and an offset and confirm that they are dropped
+ */
+template <acl::Target Target>
+class QuantizedDescriptorConversionFixture : public framework::Fixture
+{
+public:
+    void setup()
+    {
+        acl::StatusCode err = acl::StatusCode::Success;
+        acl::Context    ctx(Target, &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+
+        acl::Tensor qasymm8(ctx, acl::TensorDescriptor({ 4, 2, 2 }, acl::DataType::QAsymmUInt8, acl::DataLayout::Nhwc, 0.25f, 7), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        AclTensorDescriptor desc{};
+        ARM_COMPUTE_ASSERT(AclGetTensorDescriptor(qasymm8.get(), &desc) == AclStatus::AclSuccess);
+        ARM_COMPUTE_EXPECT(desc.data_type == AclDataType::AclQAsymmUInt8, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.layout == AclDataLayout::AclNhwc, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.quant_scale == 0.25f, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.quant_offset == 7, framework::LogLevel::ERRORS);
+
+        acl::Tensor qasymm8_signed(ctx, acl::TensorDescriptor({ 4, 2 }, acl::DataType::QAsymmInt8, acl::DataLayout::Nchw, 0.5f, -12), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        ARM_COMPUTE_ASSERT(AclGetTensorDescriptor(qasymm8_signed.get(), &desc) == AclStatus::AclSuccess);
+        ARM_COMPUTE_EXPECT(desc.data_type == AclDataType::AclQAsymmInt8, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.layout == AclDataLayout::AclNchw, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.quant_scale == 0.5f, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.quant_offset == -12, framework::LogLevel::ERRORS);
+
+        // Quantization parameters are only used by quantized data types
+        acl::Tensor fp32(ctx, acl::TensorDescriptor({ 4, 2 }, acl::DataType::Float32, acl::DataLayout::Nhwc, 0.5f, 3), &err);
+        ARM_COMPUTE_ASSERT(err == acl::StatusCode::Success);
+        ARM_COMPUTE_ASSERT(AclGetTensorDescriptor(fp32.get(), &desc) == AclStatus::AclSuccess);
+        ARM_COMPUTE_EXPECT(desc.layout == AclDataLayout::AclNhwc, framework::LogLevel::ERRORS);
+        ARM_COMPUTE_EXPECT(desc.quant_offset == 0, framework::LogLevel::ERRORS);
+    };
+};
+
 template <acl::Target Target>
 class InvalidDescriptorConversionFixture : public framework::Fixture
 {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -88,6 +88,14 @@ namespace utils
     os << "Tuner mode : " << common_params.tuner_mode << std::endl;
     os << "Tuner file : " << common_params.tuner_file << std::endl;
     os << "MLGO file : " << common_params.mlgo_file << std::endl;
+    os << "Plan file : " << common_params.plan_file << std::endl;
+    os << "Convolution benchmark enabled? : " << (common_params.conv_benchmark ? true_str : false_str) << std::endl;
+    os << "Convolution method file : " << common_params.conv_method_file << std::endl;
+    os << "Data layout selection enabled? : " << (common_params.layout_selection ? true_str : false_str) << std::endl;
+    os << "Pipeline stages : " << common_params.pipeline_stages << std::endl;
+    os << "Asynchronous accessors enabled? : " << (common_params.async_accessors ? true_str : false_str) << std::endl;
+    os << "Minimum memory order enabled? : " << (common_params.min_memory_order ? true_str : false_str) << std::endl;
+    os << "Shared workspaces enabled? : " << (common_params.share_workspaces ? true_str : false_str) << std::endl;
     os << "Fast math enabled? : " << (common_params.fast_math_hint == FastMathHint::Enabled ? true_str : false_str) << std::endl;
     if(!common_params.data_path.empty())
     {
@@ -132,7 +140,15 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
       validation_path(parser.add_option<SimpleOption<std::string>>("validation-path")),
       validation_range(parser.add_option<SimpleOption<std::string>>("validation-range")),
       tuner_file(parser.add_option<SimpleOption<std::string>>("tuner-file")),
-      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file"))
+      mlgo_file(parser.add_option<SimpleOption<std::string>>("mlgo-file")),
+      plan_file(parser.add_option<SimpleOption<std::string>>("plan-file")),
+      conv_benchmark(parser.add_option<ToggleOption>("conv-benchmark")),
+      conv_method_file(parser.add_option<SimpleOption<std::string>>("conv-method-file", "acl_conv_methods.csv")),
+      layout_selection(parser.add_option<ToggleOption>("layout-selection")),
+      pipeline_stages(parser.add_option<SimpleOption<int>>("pipeline-stages", 1)),
+      async_accessors(parser.add_option<ToggleOption>("async-accessors")),
+      min_memory_order(parser.add_option<ToggleOption>("min-memory-order")),
+      share_workspaces(parser.add_option<ToggleOption>("share-workspaces"))
 {
     std::set<arm_compute::graph::Target> supported_targets
     {
@@ -189,6 +205,14 @@ CommonGraphOptions::CommonGraphOptions(CommandLineParser &parser)
     validation_range->set_help("Range of the images to validate for (Format : start,end)");
     tuner_file->set_help("File to load/save CLTuner values");
     mlgo_file->set_help("File to load MLGO heuristics");
+    plan_file->set_help("File to load/save the finalized graph plan");
+    conv_benchmark->set_help("Select the convolution methods by measuring them on the device");
+    conv_method_file->set_help("File to load/save the measured convolution methods");
+    layout_selection->set_help("Select the data layout of the nodes to minimise the permutations");
+    pipeline_stages->set_help("Number of pipeline stages executing consecutive frames concurrently on Neon");
+    async_accessors->set_help("Load the inputs and consume the outputs on their own threads while the frames execute on Neon");
+    min_memory_order->set_help("Execute the nodes in the order minimizing the peak memory of the intermediate tensors");
+    share_workspaces->set_help("Place the auxiliary memory of the functions with the intermediate tensors on Neon");
 }
 
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
@@ -219,8 +243,36 @@ CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options)
     common_params.validation_range_end   = validation_range.second;
     common_params.tuner_file             = options.tuner_file->value();
     common_params.mlgo_file              = options.mlgo_file->value();
+    common_params.plan_file              = options.plan_file->value();
+    common_params.conv_benchmark         = options.conv_benchmark->is_set() ? options.conv_benchmark->value() : false;
+    common_params.conv_method_file       = options.conv_method_file->value();
+    common_params.layout_selection       = options.layout_selection->is_set() ? options.layout_selection->value() : false;
+    common_params.pipeline_stages        = options.pipeline_stages->value();
+    common_params.async_accessors        = options.async_accessors->is_set() ? options.async_accessors->value() : false;
+    common_params.min_memory_order       = options.min_memory_order->is_set() ? options.min_memory_order->value() : false;
+    common_params.share_workspaces       = options.share_workspaces->is_set() ? options.share_workspaces->value() : false;
 
     return common_params;
 }
+
+arm_compute::graph::GraphConfig create_graph_config(const CommonGraphParams &common_params)
+{
+    arm_compute::graph::GraphConfig config;
+    config.num_threads                 = common_params.threads;
+    config.use_tuner                   = common_params.enable_tuner;
+    config.tuner_mode                  = common_params.tuner_mode;
+    config.tuner_file                  = common_params.tuner_file;
+    config.mlgo_file                   = common_params.mlgo_file;
+    config.plan_file                   = common_params.plan_file;
+    config.use_conv_method_benchmark   = common_params.conv_benchmark;
+    config.conv_method_file            = common_params.conv_method_file;
+    config.use_data_layout_selection   = common_params.layout_selection;
+    config.pipeline_stages             = common_params.pipeline_stages;
+    config.use_async_accessors         = common_params.async_accessors;
+    config.use_memory_aware_order      = common_params.min_memory_order;
+    config.use_shared_workspace_memory = common_params.share_workspaces;
+
+    return config;
+}
 } // namespace utils
 } // namespace arm_compute
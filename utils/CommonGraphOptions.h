@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2021 Arm Limited.
+ * Copyright (c) 2018-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -109,6 +109,14 @@ struct CommonGraphParams
     std::string                      validation_path{};
     std::string                      tuner_file{};
     std::string                      mlgo_file{};
+    std::string                      plan_file{};
+    bool                             conv_benchmark{ false };
+    std::string                      conv_method_file{};
+    bool                             layout_selection{ false };
+    int                              pipeline_stages{ 1 };
+    bool                             async_accessors{ false };
+    bool                             min_memory_order{ false };
+    bool                             share_workspaces{ false };
     unsigned int                     validation_range_start{ 0 };
     unsigned int                     validation_range_end{ std::numeric_limits<unsigned int>::max() };
 };
@@ -168,6 +176,14 @@ public:
     SimpleOption<std::string>              *validation_range; /**< Validation range */
     SimpleOption<std::string>              *tuner_file;       /**< File to load/store the tuner's values from */
     SimpleOption<std::string>              *mlgo_file;        /**< File to load the MLGO heuristics from */
+    SimpleOption<std::string>              *plan_file;        /**< File to load/store the finalized graph plan from */
+    ToggleOption                           *conv_benchmark;   /**< Select the convolution methods by measuring them */
+    SimpleOption<std::string>              *conv_method_file; /**< File to load/store the measured convolution methods from */
+    ToggleOption                           *layout_selection; /**< Select the data layout of the nodes */
+    SimpleOption<int>                      *pipeline_stages;  /**< Number of pipeline stages to execute the frames with */
+    ToggleOption                           *async_accessors;  /**< Call the input and output accessors asynchronously */
+    ToggleOption                           *min_memory_order; /**< Execute the nodes in the order minimizing the peak memory */
+    ToggleOption                           *share_workspaces; /**< Place the function workspaces with the intermediate tensors */
 };
 
 /** Consumes the common graph options and creates a structure containing any information
@@ -177,6 +193,14 @@ public:
  * @return Structure containing the common graph parameters
  */
 CommonGraphParams consume_common_graph_parameters(CommonGraphOptions &options);
+
+/** Creates the graph configuration selected by the common graph parameters
+ *
+ * @param[in] common_params Common graph parameters
+ *
+ * @return The graph configuration to finalize the graph with
+ */
+arm_compute::graph::GraphConfig create_graph_config(const CommonGraphParams &common_params);
 } // namespace utils
 } // namespace arm_compute
 #endif /* ARM_COMPUTE_EXAMPLES_UTILS_COMMON_GRAPH_OPTIONS */
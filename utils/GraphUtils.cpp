@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -167,6 +167,11 @@ bool DummyAccessor::access_tensor_data()
     return false;
 }
 
+std::string DummyAccessor::source() const
+{
+    return "dummy";
+}
+
 bool DummyAccessor::access_tensor(ITensor &tensor)
 {
     ARM_COMPUTE_UNUSED(tensor);
@@ -695,6 +700,11 @@ void RandomAccessor::fill(ITensor &tensor, D &&distribution)
     }
 }
 
+std::string RandomAccessor::source() const
+{
+    return "random:" + std::to_string(_lower.get<uint64_t>()) + ":" + std::to_string(_upper.get<uint64_t>()) + ":" + std::to_string(_seed);
+}
+
 bool RandomAccessor::access_tensor(ITensor &tensor)
 {
     switch(tensor.info()->data_type())
@@ -777,6 +787,11 @@ NumPyBinLoader::NumPyBinLoader(std::string filename, DataLayout file_layout)
 {
 }
 
+std::string NumPyBinLoader::source() const
+{
+    return _filename;
+}
+
 bool NumPyBinLoader::access_tensor(ITensor &tensor)
 {
     if(!_already_loaded)
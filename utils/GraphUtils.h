@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021 Arm Limited.
+ * Copyright (c) 2017-2021, 2024 Arm Limited.
  *
  * SPDX-License-Identifier: MIT
  *
@@ -137,6 +137,7 @@ public:
     // Inherited methods overriden:
     bool access_tensor_data() override;
     bool access_tensor(ITensor &tensor) override;
+    std::string source() const override;
 
 private:
     unsigned int _iterator;
@@ -419,6 +420,7 @@ public:
 
     // Inherited methods overriden:
     bool access_tensor(ITensor &tensor) override;
+    std::string source() const override;
 
 private:
     template <typename T, typename D>
@@ -443,6 +445,7 @@ public:
 
     // Inherited methods overriden:
     bool access_tensor(ITensor &tensor) override;
+    std::string source() const override;
 
 private:
     bool              _already_loaded;